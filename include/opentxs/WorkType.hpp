@@ -72,6 +72,7 @@ enum class WorkType : std::underlying_type_t<WorkType> {
     OTXResponse = 4097,
     OTXPush = 4098,
     OTXLegacyXML = 4099,
+    OTXLegacyBinary = 4100,
     PeerRequest = 5120,
     PeerReply = 5121,
 };  // IWYU pragma: export
@@ -273,6 +274,9 @@ enum class WorkType : std::underlying_type_t<WorkType> {
  *          2: corresponding height as blockchain::block::Height
  *          3: corresponding block hash as blockchain::block::Hash (encoded as
  *             byte sequence)
+ *          4: block cache hits as std::size_t
+ *          5: block cache misses as std::size_t
+ *          6: block cache evictions as std::size_t
  *
  *   OTXConnectionStatus: reports state changes to notary connections
  *       * Additional frames:
@@ -327,6 +331,16 @@ enum class WorkType : std::underlying_type_t<WorkType> {
  *          2: send success value as std::byte. 0x00 indicates an error
  *          3: [optional] error string
  *
+ *   OTXLegacyXML: legacy notary request and reply messages
+ *       * Additional frames:
+ *          1: signed message (encoded as armored ascii)
+ *          2: [optional, replies only] OTXLegacyBinary as WorkType if the
+ *             notary accepts OTXLegacyBinary requests
+ *
+ *   OTXLegacyBinary: legacy notary request and reply messages without armor
+ *       * Additional frames:
+ *          1: signed message (encoded as ascii)
+ *
  *   PeerRequest: OTX structured peer request message
  *       * Additional frames:
  *          1: request id as identifier::Generic (encoded as protobuf)
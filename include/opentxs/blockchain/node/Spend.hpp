@@ -45,6 +45,7 @@ namespace opentxs::blockchain::node
 class OPENTXS_EXPORT Spend
 {
 public:
+    auto CoinSelection() const noexcept -> node::CoinSelection;
     auto Funding() const noexcept -> node::Funding;
     auto ID() const noexcept -> const identifier::Generic&;
     OPENTXS_NO_EXPORT auto Internal() const noexcept -> const internal::Spend&;
@@ -69,6 +70,8 @@ public:
     [[nodiscard]] auto SendToPaymentCode(
         const PaymentCode& recipient,
         const Amount& amount) noexcept -> bool;
+    [[nodiscard]] auto SetCoinSelection(node::CoinSelection value) noexcept
+        -> bool;
     [[nodiscard]] auto SetMemo(std::string_view) noexcept -> bool;
     [[nodiscard]] auto SetSpendUnconfirmedChange(bool value) noexcept -> bool;
     [[nodiscard]] auto SetSpendUnconfirmedIncoming(bool value) noexcept -> bool;
@@ -30,6 +30,9 @@ class OPENTXS_EXPORT Stats
 public:
     class Imp;
 
+    auto BlockCacheEvictions(Type chain) const noexcept -> std::size_t;
+    auto BlockCacheHits(Type chain) const noexcept -> std::size_t;
+    auto BlockCacheMisses(Type chain) const noexcept -> std::size_t;
     auto BlockHeaderTip(Type chain) const noexcept -> block::Position;
     auto BlockTip(Type chain) const noexcept -> block::Position;
     auto CfilterTip(Type chain) const noexcept -> block::Position;
@@ -46,10 +46,11 @@ class Output;
 
 namespace opentxs::blockchain::node
 {
-enum class Funding : std::uint32_t;     // IWYU pragma: export
-enum class SendResult : std::uint32_t;  // IWYU pragma: export
-enum class TxoState : std::uint16_t;    // IWYU pragma: export
-enum class TxoTag : std::uint16_t;      // IWYU pragma: export
+enum class CoinSelection : std::uint8_t;  // IWYU pragma: export
+enum class Funding : std::uint32_t;      // IWYU pragma: export
+enum class SendResult : std::uint32_t;   // IWYU pragma: export
+enum class TxoState : std::uint16_t;     // IWYU pragma: export
+enum class TxoTag : std::uint16_t;       // IWYU pragma: export
 
 using BlockResult = std::shared_future<block::Block>;
 using BlockResults = Vector<BlockResult>;
@@ -57,6 +58,7 @@ using SendOutcome = std::pair<SendResult, block::TransactionHash>;
 using PendingOutgoing = std::future<SendOutcome>;
 using UTXO = std::pair<block::Outpoint, protocol::bitcoin::base::block::Output>;
 
+OPENTXS_EXPORT auto print(CoinSelection) noexcept -> std::string_view;
 OPENTXS_EXPORT auto print(Funding) noexcept -> std::string_view;
 OPENTXS_EXPORT auto print(SendResult) noexcept -> std::string_view;
 OPENTXS_EXPORT auto print(TxoState) noexcept -> std::string_view;
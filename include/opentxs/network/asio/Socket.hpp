@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <optional>
 
 #include "opentxs/Export.hpp"
 #include "opentxs/Types.hpp"
@@ -31,6 +32,14 @@ class OPENTXS_EXPORT Socket
 public:
     class Imp;
 
+    /// Returns the size of the message body described by a message header,
+    /// or nothing if the header is not valid or the size exceeds what the
+    /// protocol permits
+    using BodySize =
+        std::function<std::optional<std::size_t>(ReadView header)>;
+    /// Returns true if a message body matches the checksum in its header
+    using VerifyBody = std::function<bool(ReadView header, ReadView body)>;
+
     auto Close() noexcept -> void;
     /**  Open an connection to a remote peer asynchronously
      *
@@ -74,6 +83,36 @@ public:
         const zeromq::Envelope& notify,
         const OTZMQWorkType type,
         const std::size_t bytes) noexcept -> bool;
+    /**  Receive one or more framed messages from a remote peer asynchronously
+     *
+     *   Incoming bytes are read in large blocks into a buffer owned by the
+     *   socket and split into messages in place. Every complete message in
+     *   the buffer is delivered as a header frame followed by a body frame,
+     *   and all of them are returned together in a single message of the
+     *   caller-specified type. Errors are reported the same way as Receive().
+     *
+     *   A header which bodySize rejects or a body which verifyBody rejects
+     *   is reported as an AsioDisconnect and no further data is read.
+     *
+     *   @param notify      the connection id which will be notified of the
+     *                      resolution of the receive attempt
+     *   @param type        the message type to be used for returning the
+     *                      received messages
+     *   @param headerBytes the fixed size of a message header
+     *   @param bodySize    returns the body size encoded in a header. This
+     *                      function is called from an asio thread.
+     *   @param verifyBody  checks a complete message before it is delivered.
+     *                      This function is called from an asio thread.
+     *
+     *   \returns false if the asio context is shutting down or if the notify
+     *            parameter is empty
+     */
+    auto ReceiveMessages(
+        const zeromq::Envelope& notify,
+        const OTZMQWorkType type,
+        const std::size_t headerBytes,
+        const BodySize& bodySize,
+        const VerifyBody& verifyBody) noexcept -> bool;
     /**  Asynchronously deliver bytes to a remote peer
      *
      *   @param notify the connection id which will be notified of the
@@ -87,6 +87,7 @@
 #include "opentxs/blockchain/crypto/Types.hpp"            // IWYU pragma: export
 #include "opentxs/blockchain/crypto/Wallet.hpp"           // IWYU pragma: export
 #include "opentxs/blockchain/node/BlockOracle.hpp"        // IWYU pragma: export
+#include "opentxs/blockchain/node/CoinSelection.hpp"      // IWYU pragma: export
 #include "opentxs/blockchain/node/FilterOracle.hpp"       // IWYU pragma: export
 #include "opentxs/blockchain/node/Funding.hpp"            // IWYU pragma: export
 #include "opentxs/blockchain/node/HeaderOracle.hpp"       // IWYU pragma: export
@@ -34,6 +34,7 @@ class OPENTXS_EXPORT Options final
 public:
     auto BlockchainBindIpv4() const noexcept -> const Set<CString>&;
     auto BlockchainBindIpv6() const noexcept -> const Set<CString>&;
+    auto BlockchainBlockCacheBytes() const noexcept -> std::size_t;
     auto BlockchainProfile() const noexcept -> opentxs::BlockchainProfile;
     auto BlockchainWalletEnabled() const noexcept -> bool;
     auto DebugAllocations() const noexcept -> bool;
@@ -87,6 +88,7 @@ public:
         std::string_view value) noexcept -> Options&;
     OPENTXS_NO_EXPORT auto Internal() noexcept -> internal::Options&;
     auto ParseCommandLine(int argc, char** argv) noexcept -> Options&;
+    auto SetBlockchainBlockCacheBytes(std::size_t bytes) noexcept -> Options&;
     auto SetBlockchainProfile(opentxs::BlockchainProfile value) noexcept
         -> Options&;
     auto SetBlockchainSyncEnabled(bool enabled) noexcept -> Options&;
@@ -27,6 +27,14 @@ class Driver
 {
 public:
     virtual auto Description() const noexcept -> std::string_view = 0;
+    /// Returns true if the object is known to be present in the bucket
+    ///
+    /// Drivers which do not override this report every object as missing, so
+    /// garbage collection copies it again rather than skipping it.
+    virtual auto Exists(const Hash&, Bucket) const noexcept -> bool
+    {
+        return false;
+    }
     virtual auto Load(
         const Log& logger,
         const Hash& key,
@@ -194,6 +194,24 @@ auto Asio::Receive(
     }
 }
 
+auto Asio::ReceiveMessages(
+    const opentxs::network::zeromq::Envelope& id,
+    const OTZMQWorkType type,
+    const std::size_t headerBytes,
+    const Socket::BodySize& bodySize,
+    const Socket::VerifyBody& verifyBody,
+    SocketImp socket) const noexcept -> bool
+{
+    if (auto p = weak_.lock(); p) {
+
+        return p->ReceiveMessages(
+            p, id, type, headerBytes, bodySize, verifyBody, socket);
+    } else {
+
+        return {};
+    }
+}
+
 auto Asio::Shutdown() noexcept -> void
 {
     acceptors_.Stop();
@@ -22,6 +22,7 @@
 #include <optional>
 #include <span>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -37,6 +38,7 @@
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/network/zeromq/socket/Factory.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/Thread.hpp"
 #include "internal/util/Timer.hpp"
 #include "network/asio/Endpoint.hpp"
@@ -111,6 +113,75 @@ auto Shared::Connect(
     }
 }
 
+auto Shared::deliver_messages(
+    opentxs::network::asio::Socket::Imp& socket,
+    const opentxs::network::zeromq::Envelope& id,
+    const OTZMQWorkType type,
+    const std::size_t headerBytes,
+    const internal::Asio::Socket::BodySize& bodySize,
+    const internal::Asio::Socket::VerifyBody& verifyBody,
+    std::size_t& missing) const noexcept -> bool
+{
+    auto work = opentxs::network::zeromq::tagged_reply_to_message(
+        opentxs::network::zeromq::Envelope{id}, type, true);
+    auto count = 0_uz;
+
+    try {
+        auto handle = socket.reader_.lock();
+        auto& reader = *handle;
+        auto data = reader.Data();
+        auto consumed = 0_uz;
+
+        while (headerBytes <= data.size()) {
+            const auto header = data.substr(0_uz, headerBytes);
+            const auto body = std::invoke(bodySize, header);
+
+            if (false == body.has_value()) {
+                throw std::runtime_error{"invalid message header"};
+            }
+
+            const auto total = headerBytes + *body;
+
+            if (data.size() < total) {
+                missing = total - data.size();
+
+                break;
+            }
+
+            const auto payload = data.substr(headerBytes, *body);
+
+            if (false == std::invoke(verifyBody, header, payload)) {
+                throw std::runtime_error{"invalid message checksum"};
+            }
+
+            // NOTE messages are framed in place and copied only once, into
+            // the outgoing zeromq frames
+            work.AddFrame(header.data(), header.size());
+            work.AddFrame(payload.data(), payload.size());
+            data.remove_prefix(total);
+            consumed += total;
+            ++count;
+        }
+
+        if (0_uz == count) { return false; }
+
+        reader.Consume(consumed);
+    } catch (const std::exception& e) {
+        // NOTE the connection is abandoned so nothing already framed from
+        // this read is delivered and no further read is scheduled
+        const auto address = socket.endpoint_.str();
+        LogError()()(address)(": ")(e.what()).Flush();
+        process_receive_error(
+            e.what(), address, opentxs::network::zeromq::Envelope{id});
+
+        return true;
+    }
+
+    data_.lock()->to_actor_.SendDeferred(std::move(work));
+
+    return true;
+}
+
 auto Shared::FetchJson(
     std::shared_ptr<const Shared> me,
     const ReadView host,
@@ -288,24 +359,44 @@ auto Shared::process_receive(
 {
     assert_false(nullptr == socket);
 
-    data_.lock()->to_actor_.SendDeferred([&]() {
-        auto work = opentxs::network::zeromq::tagged_reply_to_message(
-            std::move(connection),
-            (e ? value(WorkType::AsioDisconnect) : type),
-            true);
-
-        if (e) {
-            work.AddFrame(address.data(), address.size());
-            work.AddFrame(e.message());
-        } else {
+    if (e) {
+        process_receive_error(e, address, std::move(connection));
+    } else {
+        data_.lock()->to_actor_.SendDeferred([&]() {
+            auto work = opentxs::network::zeromq::tagged_reply_to_message(
+                std::move(connection), type, true);
             work.AddFrame(data.data(), data.size());
-        }
 
-        assert_true(1 < work.Payload().size());
+            assert_true(1 < work.Payload().size());
+
+            return work;
+        }());
+    }
+
+    socket->buffer_.lock()->Finish(index);
+}
+
+auto Shared::process_receive_error(
+    const boost::system::error_code& e,
+    ReadView address,
+    opentxs::network::zeromq::Envelope&& connection) const noexcept -> void
+{
+    process_receive_error(e.message(), address, std::move(connection));
+}
+
+auto Shared::process_receive_error(
+    ReadView error,
+    ReadView address,
+    opentxs::network::zeromq::Envelope&& connection) const noexcept -> void
+{
+    data_.lock()->to_actor_.SendDeferred([&]() {
+        auto work = opentxs::network::zeromq::tagged_reply_to_message(
+            std::move(connection), value(WorkType::AsioDisconnect), true);
+        work.AddFrame(address.data(), address.size());
+        work.AddFrame(error.data(), error.size());
 
         return work;
     }());
-    socket->buffer_.lock()->Finish(index);
 }
 
 auto Shared::process_resolve(
@@ -429,6 +520,98 @@ auto Shared::Receive(
     }
 }
 
+auto Shared::ReceiveMessages(
+    std::shared_ptr<const Shared> me,
+    const opentxs::network::zeromq::Envelope& id,
+    const OTZMQWorkType type,
+    const std::size_t headerBytes,
+    const internal::Asio::Socket::BodySize& bodySize,
+    const internal::Asio::Socket::VerifyBody& verifyBody,
+    internal::Asio::SocketImp socket) noexcept -> bool
+{
+    try {
+        if (false == me.operator bool()) {
+            throw std::runtime_error{"invalid self"};
+        }
+
+        if (false == socket.operator bool()) {
+            throw std::runtime_error{"invalid socket"};
+        }
+
+        if (false == id.IsValid()) { throw std::runtime_error{"invalid id"}; }
+
+        if (nullptr == bodySize) {
+            throw std::runtime_error{"invalid body size function"};
+        }
+
+        if (nullptr == verifyBody) {
+            throw std::runtime_error{"invalid body verification function"};
+        }
+
+        if (false == me->running_) {
+            throw std::runtime_error{"shutting down"};
+        }
+
+        read_messages(me, socket, id, type, headerBytes, bodySize, verifyBody);
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto Shared::read_messages(
+    std::shared_ptr<const Shared> me,
+    internal::Asio::SocketImp socket,
+    const opentxs::network::zeromq::Envelope& id,
+    const OTZMQWorkType type,
+    const std::size_t headerBytes,
+    internal::Asio::Socket::BodySize bodySize,
+    internal::Asio::Socket::VerifyBody verifyBody) noexcept -> void
+{
+    assert_false(nullptr == me);
+    assert_false(nullptr == socket);
+
+    auto missing = 0_uz;
+
+    // NOTE a previous read may have buffered more than one message
+    if (me->deliver_messages(
+            *socket, id, type, headerBytes, bodySize, verifyBody, missing)) {
+
+        return;
+    }
+
+    const auto buffer =
+        socket->reader_.lock()->Prepare(std::max(missing, read_bytes_));
+    socket->socket_.async_read_some(
+        buffer,
+        [me,
+         socket,
+         id,
+         type,
+         headerBytes,
+         bodySize{std::move(bodySize)},
+         verifyBody{std::move(verifyBody)}](const auto& e, auto size) mutable {
+            if (e) {
+                const auto address = socket->endpoint_.str();
+                me->process_receive_error(
+                    e, address, opentxs::network::zeromq::Envelope{id});
+            } else {
+                socket->reader_.lock()->Commit(size);
+                read_messages(
+                    me,
+                    socket,
+                    id,
+                    type,
+                    headerBytes,
+                    std::move(bodySize),
+                    std::move(verifyBody));
+            }
+        });
+}
+
 auto Shared::Resolve(
     std::shared_ptr<const Shared> me,
     const opentxs::network::zeromq::Envelope& id,
@@ -90,6 +90,14 @@ public:
         const OTZMQWorkType type,
         const std::size_t bytes,
         internal::Asio::SocketImp socket) noexcept -> bool;
+    static auto ReceiveMessages(
+        std::shared_ptr<const Shared> me,
+        const opentxs::network::zeromq::Envelope& id,
+        const OTZMQWorkType type,
+        const std::size_t headerBytes,
+        const internal::Asio::Socket::BodySize& bodySize,
+        const internal::Asio::Socket::VerifyBody& verifyBody,
+        internal::Asio::SocketImp socket) noexcept -> bool;
     static auto Resolve(
         std::shared_ptr<const Shared> me,
         const opentxs::network::zeromq::Envelope& id,
@@ -134,6 +142,17 @@ private:
         const IPversion protocol_{};
     };
 
+    // NOTE minimum size of each read performed by ReceiveMessages()
+    static constexpr auto read_bytes_ = std::size_t{64u * 1024u};
+
+    static auto read_messages(
+        std::shared_ptr<const Shared> me,
+        internal::Asio::SocketImp socket,
+        const opentxs::network::zeromq::Envelope& id,
+        const OTZMQWorkType type,
+        const std::size_t headerBytes,
+        internal::Asio::Socket::BodySize bodySize,
+        internal::Asio::Socket::VerifyBody verifyBody) noexcept -> void;
     static auto retrieve_json_http(
         std::shared_ptr<const Shared> me,
         opentxs::network::asio::TLS tls,
@@ -154,6 +173,14 @@ private:
         -> void;
     static auto sites() -> const Vector<Site>&;
 
+    auto deliver_messages(
+        opentxs::network::asio::Socket::Imp& socket,
+        const opentxs::network::zeromq::Envelope& id,
+        const OTZMQWorkType type,
+        const std::size_t headerBytes,
+        const internal::Asio::Socket::BodySize& bodySize,
+        const internal::Asio::Socket::VerifyBody& verifyBody,
+        std::size_t& missing) const noexcept -> bool;
     auto post(const Data& data, internal::Asio::Callback cb) const noexcept
         -> bool;
     auto process_address_query(
@@ -178,6 +205,14 @@ private:
         OTZMQWorkType type,
         std::size_t index,
         ReadView data) const noexcept -> void;
+    auto process_receive_error(
+        const boost::system::error_code& e,
+        ReadView address,
+        opentxs::network::zeromq::Envelope&& connection) const noexcept -> void;
+    auto process_receive_error(
+        ReadView error,
+        ReadView address,
+        opentxs::network::zeromq::Envelope&& connection) const noexcept -> void;
     auto process_resolve(
         const std::shared_ptr<Resolver>& resolver,
         const boost::system::error_code& e,
@@ -176,6 +176,7 @@ auto BlockchainImp::Init(
     base_config_.set_value([&] {
         auto output = Config{};
         output.profile_ = options.BlockchainProfile();
+        output.block_cache_bytes_ = options.BlockchainBlockCacheBytes();
 
         switch (output.profile_) {
             case BlockchainProfile::mobile:
@@ -422,10 +422,11 @@ auto Storage::DeletePaymentWorkflow(
         .Delete(workflowID);
 }
 
-auto Storage::DoGC(const opentxs::storage::tree::GCParams& params) noexcept
-    -> bool
+auto Storage::DoGC(
+    opentxs::storage::tree::GCParams& params,
+    std::size_t limit) noexcept -> bool
 {
-    return plugin_.DoGC(params);
+    return plugin_.DoGC(params, limit);
 }
 
 auto Storage::FinishGC(bool success) noexcept -> void
@@ -433,6 +434,8 @@ auto Storage::FinishGC(bool success) noexcept -> void
     mutable_Root().get().FinishGC(success);
 }
 
+auto Storage::Flush() const noexcept -> bool { return plugin_.Flush(); }
+
 auto Storage::GCStatus() const noexcept -> opentxs::storage::tree::GCParams
 {
     return Root().GCStatus();
@@ -1701,6 +1704,11 @@ auto Storage::SetPeerRequestTime(
     }
 }
 
+auto Storage::SetPendingCallback(SimpleCallback cb) noexcept -> void
+{
+    plugin_.SetPendingCallback(std::move(cb));
+}
+
 auto Storage::SetReadState(
     const identifier::Nym& nymId,
     const identifier::Generic& threadId,
@@ -2356,6 +2364,12 @@ auto Storage::UnreadCount(
     return threads.Thread(threadId).UnreadCount();
 }
 
+auto Storage::UpdateGC(
+    const opentxs::storage::tree::GCParams& progress) noexcept -> bool
+{
+    return mutable_Root().get().UpdateGC(progress);
+}
+
 auto Storage::Upgrade() noexcept -> void { mutable_Root().get().Upgrade(); }
 
 auto Storage::verify_write_lock(const Lock& lock) const noexcept -> bool
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <memory>
@@ -520,12 +521,18 @@ public:
         const identifier::Generic& threadId) const noexcept
         -> std::size_t final;
 
-    auto DoGC(const opentxs::storage::tree::GCParams& params) noexcept -> bool;
+    auto DoGC(
+        opentxs::storage::tree::GCParams& params,
+        std::size_t limit) noexcept -> bool;
     auto FinishGC(bool success) noexcept -> void;
+    auto Flush() const noexcept -> bool;
+    auto SetPendingCallback(SimpleCallback cb) noexcept -> void;
     auto Start(std::shared_ptr<const api::internal::Session> api) noexcept
         -> void final;
     auto StartGC() const noexcept
         -> std::optional<opentxs::storage::tree::GCParams>;
+    auto UpdateGC(const opentxs::storage::tree::GCParams& progress) noexcept
+        -> bool;
     auto Upgrade() noexcept -> void final;
 
     Storage(
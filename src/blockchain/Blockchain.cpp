@@ -55,15 +55,19 @@ auto GetDefinition(blockchain::Type in) noexcept -> const display::Definition&
 
 namespace opentxs::blockchain::internal
 {
-BitReader::BitReader(const Vector<std::byte>& data)
-    : raw_data_(data)
-    , data_(reinterpret_cast<const std::uint8_t*>(raw_data_.data()))
-    , len_(raw_data_.size())
+BitReader::BitReader(const ReadView data)
+    : data_(reinterpret_cast<const std::uint8_t*>(data.data()))
+    , len_(data.size())
     , accum_(0)
     , n_(0_uz)
 {
 }
 
+BitReader::BitReader(const Vector<std::byte>& data)
+    : BitReader(reader(data))
+{
+}
+
 auto BitReader::eof() -> bool { return (len_ == 0_uz && n_ == 0_uz); }
 
 auto BitReader::read(std::size_t nbits) -> std::uint64_t
@@ -80,7 +84,7 @@ auto BitReader::read(std::size_t nbits) -> std::uint64_t
 
         // n_ starts out as zero. Therefore this if() will resolve to true.
         // This is because accum_ contains no data, since all the input data
-        // is in the ByteArray member raw_data_.
+        // is still behind data_.
         if (!n_) {
             // Let's say the raw data contains 500 bytes. so len_ is 500,
             // and definitely larger than 4 bytes.
@@ -108,7 +112,7 @@ auto BitReader::read(std::size_t nbits) -> std::uint64_t
                 // the data pointer.
                 accum_ = *data_++;
                 // We read one byte, so decrement len_ which is the number
-                // of bytes needing to be read from raw_data_.
+                // of bytes needing to be read from data_.
                 --len_;
                 // n_ records that we now have 8 more bits of data in
                 // accum_.
@@ -63,4 +63,10 @@ auto GCS(
 {
     return {};
 }
+
+auto GCSView(const api::Session&, const ReadView, alloc::Default) noexcept
+    -> blockchain::cfilter::GCS
+{
+    return {};
+}
 }  // namespace opentxs::factory
@@ -225,4 +225,33 @@ auto GCS(
         return pmr::default_construct<BlankType>(alloc);
     }
 }
+
+auto GCSView(
+    const api::Session& api,
+    const ReadView flat,
+    alloc::Default alloc) noexcept -> blockchain::cfilter::GCS
+{
+    using ReturnType = blockchain::cfilter::implementation::GCS;
+    using BlankType = blockchain::cfilter::GCSPrivate;
+
+    try {
+        if (false == gcs::IsFlat(flat)) {
+            throw std::runtime_error{"not a flat cfilter record"};
+        }
+
+        const auto& header =
+            *reinterpret_cast<const gcs::FlatHeader*>(flat.data());
+
+        if (gcs::FlatHeader::current_format_ != header.format_) {
+            throw std::runtime_error{"unsupported flat cfilter format"};
+        }
+
+        return pmr::construct<ReturnType>(
+            alloc, api, header, flat.substr(sizeof(gcs::FlatHeader)));
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return pmr::default_construct<BlankType>(alloc);
+    }
+}
 }  // namespace opentxs::factory
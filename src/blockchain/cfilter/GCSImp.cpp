@@ -5,7 +5,6 @@
 
 #include "blockchain/cfilter/GCSImp.hpp"  // IWYU pragma: associated
 
-#include <boost/multiprecision/cpp_int.hpp>
 #include <opentxs/protobuf/GCS.pb.h>
 #include <algorithm>
 #include <cstddef>
@@ -14,25 +13,26 @@
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string_view>
 #include <utility>
 
+#include "blockchain/cfilter/GolombReader.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/cfilter/GCS.hpp"
 #include "internal/util/Bytes.hpp"
 #include "internal/util/P0330.hpp"
 #include "opentxs/api/Session.hpp"
-#include "opentxs/api/crypto/Hash.hpp"
-#include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/blockchain/cfilter/FilterType.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/cfilter/Hash.hpp"
 #include "opentxs/blockchain/cfilter/Header.hpp"
 #include "opentxs/blockchain/cfilter/Types.hpp"
 #include "opentxs/core/ByteArray.hpp"
 #include "opentxs/core/Data.hpp"
-#include "opentxs/crypto/HashType.hpp"  // IWYU pragma: keep
 #include "opentxs/crypto/Types.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/protobuf/Types.internal.hpp"
@@ -45,6 +45,14 @@
 #include "opentxs/util/Writer.hpp"
 #include "util/Container.hpp"
 
+#if !defined(__SIZEOF_INT128__)
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#else
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+#endif
+
 namespace opentxs
 {
 constexpr auto bitmask(const std::uint64_t n) -> std::uint64_t
@@ -60,21 +68,8 @@ constexpr auto range(std::uint32_t N, std::uint32_t M) noexcept -> gcs::Range
 
 namespace opentxs::gcs
 {
-using BitReader = blockchain::internal::BitReader;
 using BitWriter = blockchain::internal::BitWriter;
 
-static auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(
-    false) -> Delta
-{
-    auto quotient = Delta{0};
-
-    while (1 == stream.read(1)) { quotient++; }
-
-    auto remainder = stream.read(P);
-
-    return Delta{(quotient << P) + remainder};
-}
-
 static auto golomb_encode(
     const std::uint8_t P,
     const Delta value,
@@ -97,16 +92,25 @@ auto GolombDecode(
     const std::uint8_t P,
     const Vector<std::byte>& encoded,
     alloc::Default alloc) noexcept(false) -> Elements
+{
+    return GolombDecode(N, P, reader(encoded), alloc);
+}
+
+auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    alloc::Default alloc) noexcept(false) -> Elements
 {
     auto output = Elements{alloc};
-    auto stream = BitReader{encoded};
+    output.reserve(N);
+    output.clear();
+    auto stream = GolombReader{P, encoded};
     auto last = Element{0};
 
     for (auto i = 0_uz; i < N; ++i) {
-        auto delta = golomb_decode(P, stream);
-        auto value = last + delta;
-        output.emplace_back(value);
-        last = value;
+        last += stream.Next();
+        output.emplace_back(last);
     }
 
     return output;
@@ -146,45 +150,62 @@ auto HashToRange(
 
 auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element
 {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128 = unsigned __int128;
+
+    return static_cast<Element>((uint128{hash} * uint128{range}) >> 64u);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return ::__umulh(hash, range);
+#else
     namespace mp = boost::multiprecision;
 
     return ((mp::uint128_t{hash} * mp::uint128_t{range}) >> 64u)
         .convert_to<Element>();
+#endif
+}
+
+auto HashToRange(
+    const Range range,
+    std::span<const Hash> hashes,
+    std::span<Element> out) noexcept(false) -> void
+{
+    assert_true(hashes.size() == out.size());
+
+    std::ranges::transform(hashes, out.begin(), [range](const auto hash) {
+        return HashToRange(range, hash);
+    });
 }
 
 auto HashedSetConstruct(
-    const api::Session& api,
+    const api::Session&,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
     const blockchain::cfilter::Targets& items,
     alloc::Default alloc) noexcept(false) -> Elements
 {
-    auto output = Elements{alloc};
-    std::ranges::transform(
-        items, std::back_inserter(output), [&](const auto& item) {
-            return HashToRange(api, key, range(N, M), item);
-        });
+    auto output = Elements(items.size(), alloc);
+    Siphash(key, items, output);
+    HashToRange(range(N, M), output, output);
     std::ranges::sort(output);
 
     return output;
 }
 
+auto IsFlat(const ReadView serialized) noexcept -> bool
+{
+    return (sizeof(FlatHeader) <= serialized.size()) &&
+           (FlatHeader::marker_ ==
+            static_cast<std::uint8_t>(serialized.front()));
+}
+
 auto Siphash(
-    const api::Session& api,
+    const api::Session&,
     const ReadView key,
     const ReadView item) noexcept(false) -> Hash
 {
-    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
-
     auto output = Hash{};
-    auto writer = preallocated(sizeof(output), &output);
-
-    if (false ==
-        api.Crypto().Hash().HMAC(
-            crypto::HashType::SipHash24, key, item, std::move(writer))) {
-        throw std::runtime_error("siphash failed");
-    }
+    Siphash(key, {std::addressof(item), 1_uz}, {std::addressof(output), 1_uz});
 
     return output;
 }
@@ -210,6 +231,7 @@ GCS::GCS(
     , count_(count)
     , key_()
     , compressed_(std::move(compressed), alloc)
+    , encoded_(reader(compressed_))
     , elements_(std::move(elements))
 {
     static_assert(16u == sizeof(key_));
@@ -287,6 +309,24 @@ GCS::GCS(
 {
 }
 
+GCS::GCS(
+    const api::Session& api,
+    const gcs::FlatHeader& header,
+    const ReadView encoded,
+    allocator_type alloc) noexcept(false)
+    : GCSPrivate(alloc)
+    , version_(header.version_.value())
+    , api_(api)
+    , bits_(header.bits_)
+    , false_positive_rate_(header.fp_rate_.value())
+    , count_(header.count_.value())
+    , key_(header.key_)
+    , compressed_(alloc)
+    , encoded_(encoded)
+    , elements_(std::nullopt)
+{
+}
+
 GCS::GCS(const GCS& rhs, allocator_type alloc) noexcept
     : GCS(
           rhs.version_,
@@ -303,7 +343,12 @@ GCS::GCS(const GCS& rhs, allocator_type alloc) noexcept
                   return std::nullopt;
               }
           }(),
-          Vector<std::byte>{rhs.compressed_, alloc},
+          [&] {
+              auto out = Vector<std::byte>{alloc};
+              copy(rhs.encoded_, writer(out));
+
+              return out;
+          }(),
           reader(rhs.key_),
           alloc)
 {
@@ -311,18 +356,7 @@ GCS::GCS(const GCS& rhs, allocator_type alloc) noexcept
 
 auto GCS::Compressed(Writer&& out) const noexcept -> bool
 {
-    return copy(reader(compressed_), std::move(out));
-}
-
-auto GCS::decompress() const noexcept -> const gcs::Elements&
-{
-    if (false == elements_.has_value()) {
-        auto& set = elements_;
-        set = gcs::GolombDecode(count_, bits_, compressed_, alloc_);
-        std::ranges::sort(set.value());
-    }
-
-    return elements_.value();
+    return copy(encoded_, std::move(out));
 }
 
 auto GCS::Encode(Writer&& cb) const noexcept -> bool
@@ -331,13 +365,13 @@ auto GCS::Encode(Writer&& cb) const noexcept -> bool
     const auto bytes = CompactSize{count_}.Encode();
     const auto max = std::numeric_limits<std::size_t>::max() - bytes.size();
 
-    if (max < compressed_.size()) {
+    if (max < encoded_.size()) {
         LogError()()("filter is too large to encode").Flush();
 
         return false;
     }
 
-    const auto target = bytes.size() + compressed_.size();
+    const auto target = bytes.size() + encoded_.size();
     auto out = cb.Reserve(target);
 
     if (false == out.IsValid(target)) {
@@ -350,9 +384,9 @@ auto GCS::Encode(Writer&& cb) const noexcept -> bool
     std::memcpy(i, bytes.data(), bytes.size());
     std::advance(i, bytes.size());
 
-    if (0_uz < compressed_.size()) {
-        std::memcpy(i, compressed_.data(), compressed_.size());
-        std::advance(i, compressed_.size());
+    if (0_uz < encoded_.size()) {
+        std::memcpy(i, encoded_.data(), encoded_.size());
+        std::advance(i, encoded_.size());
     }
 
     return true;
@@ -383,13 +417,8 @@ auto GCS::hashed_set_construct(
 auto GCS::hashed_set_construct(const gcs::Hashes& targets, allocator_type alloc)
     const noexcept -> gcs::Elements
 {
-    auto out = gcs::Elements{alloc};
-    out.reserve(targets.size());
-    const auto range = Range();
-    std::ranges::transform(
-        targets, std::back_inserter(out), [&](const auto& hash) {
-            return gcs::HashToRange(range, hash);
-        });
+    auto out = gcs::Elements(targets.size(), alloc);
+    gcs::HashToRange(Range(), targets, out);
 
     return out;
 }
@@ -401,11 +430,6 @@ auto GCS::hashed_set_construct(const Targets& elements, allocator_type alloc)
         api_, reader(key_), count_, false_positive_rate_, elements, alloc);
 }
 
-auto GCS::hash_to_range(const ReadView in) const noexcept -> gcs::Range
-{
-    return gcs::HashToRange(api_, reader(key_), Range(), in);
-}
-
 auto GCS::Header(const cfilter::Header& previous) const noexcept
     -> cfilter::Header
 {
@@ -416,6 +440,53 @@ auto GCS::Header(const cfilter::Header& previous) const noexcept
         api_, reader(preimage), previous.Bytes());
 }
 
+auto GCS::intersect(
+    const gcs::Elements& targets,
+    const std::size_t limit,
+    allocator_type alloc) const noexcept -> gcs::Elements
+{
+    auto output = gcs::Elements{alloc};
+    output.clear();
+
+    if (targets.empty() || (0_uz == limit)) { return output; }
+
+    if (elements_.has_value()) {
+        std::ranges::set_intersection(
+            targets, elements_.value(), std::back_inserter(output));
+
+        if (output.size() > limit) { output.resize(limit); }
+
+        return output;
+    }
+
+    // NOTE decode the filter one element at a time and merge it against the
+    // targets so the full set is never materialized and decoding stops as
+    // soon as the largest target has been passed
+    auto stream = gcs::GolombReader{bits_, encoded_};
+    auto value = gcs::Element{0};
+    auto target = targets.cbegin();
+    const auto end = targets.cend();
+
+    for (auto i = 0_uz; i < count_; ++i) {
+        value += stream.Next();
+
+        while (*target < value) {
+            if (++target == end) { return output; }
+        }
+
+        if (*target == value) {
+            output.emplace_back(value);
+
+            if ((output.size() == limit) || (++target == end)) {
+
+                return output;
+            }
+        }
+    }
+
+    return output;
+}
+
 auto GCS::Match(
     const Targets& targets,
     allocator_type alloc,
@@ -428,21 +499,18 @@ auto GCS::Match(
     auto hashed = gcs::Elements{monotonic};
     hashed.reserve(targets.size());
     hashed.clear();
-    auto matches = gcs::Elements{monotonic};
-    matches.reserve(reserveMatches);
-    matches.clear();
     auto map = Map{monotonic};
+    hashed.resize(targets.size());
+    gcs::Siphash(reader(key_), targets, hashed);
+    gcs::HashToRange(Range(), hashed, hashed);
 
-    for (auto i = targets.cbegin(); i != targets.cend(); ++i) {
-        const auto& hash = hashed.emplace_back(hash_to_range(*i));
-        map[hash].emplace_back(i);
+    for (auto i = 0_uz; i < targets.size(); ++i) {
+        map[hashed[i]].emplace_back(std::next(targets.cbegin(), i));
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::ranges::set_intersection(hashed, set, std::back_inserter(matches));
 
-    for (const auto& match : matches) {
+    for (const auto& match : intersect(hashed, hashed.size(), monotonic)) {
         auto& values = map.at(match);
         std::ranges::copy(values, std::back_inserter(output));
     }
@@ -460,22 +528,17 @@ auto GCS::Match(const gcs::Hashes& prehashed, alloc::Default monotonic)
     auto hashed = gcs::Elements{monotonic};
     hashed.reserve(prehashed.size());
     hashed.clear();
-    auto matches = gcs::Elements{monotonic};
-    matches.reserve(reserveMatches);
-    matches.clear();
     auto map = Map{monotonic};
-    const auto range = Range();
+    hashed.resize(prehashed.size());
+    gcs::HashToRange(Range(), prehashed, hashed);
 
-    for (auto i = prehashed.cbegin(); i != prehashed.cend(); ++i) {
-        const auto& hash = hashed.emplace_back(gcs::HashToRange(range, *i));
-        map[hash].emplace_back(i);
+    for (auto i = 0_uz; i < prehashed.size(); ++i) {
+        map[hashed[i]].emplace_back(std::next(prehashed.cbegin(), i));
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::ranges::set_intersection(hashed, set, std::back_inserter(matches));
 
-    for (const auto& match : matches) {
+    for (const auto& match : intersect(hashed, hashed.size(), monotonic)) {
         auto& values = map.at(match);
         std::ranges::copy(values, std::back_inserter(output));
     }
@@ -495,8 +558,7 @@ auto GCS::Serialize(protobuf::GCS& output) const noexcept -> bool
     output.set_fprate(false_positive_rate_);
     output.set_key(reinterpret_cast<const char*>(key_.data()), key_.size());
     output.set_count(count_);
-    output.set_filter(
-        reinterpret_cast<const char*>(compressed_.data()), compressed_.size());
+    output.set_filter(encoded_.data(), encoded_.size());
 
     return true;
 }
@@ -510,6 +572,41 @@ auto GCS::Serialize(Writer&& out) const noexcept -> bool
     return protobuf::write(proto, std::move(out));
 }
 
+auto GCS::SerializeFlat(Writer&& out) const noexcept -> bool
+{
+    const auto target = SerializedFlatSize();
+    auto buf = out.Reserve(target);
+
+    if (false == buf.IsValid(target)) {
+        LogError()()("failed to allocate space for output").Flush();
+
+        return false;
+    }
+
+    auto* i = buf.as<std::byte>();
+    auto* header = new (i) gcs::FlatHeader{};
+    header->marker_byte_ = gcs::FlatHeader::marker_;
+    header->format_ = gcs::FlatHeader::current_format_;
+    header->bits_ = bits_;
+    header->reserved_ = 0;
+    header->version_ = version_;
+    header->fp_rate_ = false_positive_rate_;
+    header->count_ = count_;
+    header->key_ = key_;
+    std::advance(i, sizeof(gcs::FlatHeader));
+
+    if (0_uz < encoded_.size()) {
+        std::memcpy(i, encoded_.data(), encoded_.size());
+    }
+
+    return true;
+}
+
+auto GCS::SerializedFlatSize() const noexcept -> std::size_t
+{
+    return sizeof(gcs::FlatHeader) + encoded_.size();
+}
+
 auto GCS::Test(const Data& target, allocator_type monotonic) const noexcept
     -> bool
 {
@@ -526,23 +623,8 @@ auto GCS::Test(const ReadView target, allocator_type monotonic) const noexcept
 
         return out;
     }();
-    const auto set = hashed_set_construct(input, monotonic);
-
-    assert_true(1 == set.size());
-
-    const auto& hash = set.front();
-
-    for (const auto& element : decompress()) {
-        if (element == hash) {
-
-            return true;
-        } else if (element > hash) {
-
-            return false;
-        }
-    }
 
-    return false;
+    return test(hashed_set_construct(input, monotonic), monotonic);
 }
 
 auto GCS::Test(const Vector<ByteArray>& targets, allocator_type monotonic)
@@ -563,16 +645,12 @@ auto GCS::Test(const gcs::Hashes& targets, alloc::Default monotonic)
     return test(hashed_set_construct(targets, monotonic), monotonic);
 }
 
-auto GCS::test(const gcs::Elements& targets, allocator_type monotonic)
+auto GCS::test(gcs::Elements&& targets, allocator_type monotonic)
     const noexcept -> bool
 {
-    const auto& set = decompress();
-    auto matches = Vector<gcs::Element>{monotonic};
-    matches.reserve(std::min(targets.size(), set.size()));
-    matches.clear();
-    std::ranges::set_intersection(targets, set, std::back_inserter(matches));
+    dedup(targets);
 
-    return false == matches.empty();
+    return false == intersect(targets, 1_uz, monotonic).empty();
 }
 
 auto GCS::transform(const Vector<ByteArray>& in, allocator_type alloc) noexcept
@@ -62,12 +62,11 @@ public:
     auto Match(const gcs::Hashes& prehashed, alloc::Default monotonic)
         const noexcept -> PrehashedMatches final;
     auto Range() const noexcept -> gcs::Range final;
-    auto size() const noexcept -> std::size_t final
-    {
-        return compressed_.size();
-    }
+    auto size() const noexcept -> std::size_t final { return encoded_.size(); }
     auto Serialize(protobuf::GCS& out) const noexcept -> bool final;
     auto Serialize(Writer&& out) const noexcept -> bool final;
+    auto SerializeFlat(Writer&& out) const noexcept -> bool final;
+    auto SerializedFlatSize() const noexcept -> std::size_t final;
     auto Test(const Data& target, allocator_type monotonic) const noexcept
         -> bool final;
     auto Test(const ReadView target, allocator_type monotonic) const noexcept
@@ -99,6 +98,14 @@ public:
         gcs::Elements&& hashed,
         Vector<std::byte>&& compressed,
         allocator_type alloc) noexcept(false);
+    /// Wrap a filter stored in the flat layout without copying it
+    ///
+    /// The encoded bytes must remain valid for the lifetime of this object.
+    /// Copies always own their encoded bytes.
+    GCS(const api::Session& api,
+        const gcs::FlatHeader& header,
+        const ReadView encoded,
+        allocator_type alloc) noexcept(false);
     GCS(const GCS& rhs, allocator_type alloc = {}) noexcept;
     GCS() = delete;
     GCS(GCS&&) = delete;
@@ -117,6 +124,7 @@ private:
     const std::uint32_t count_;
     const Key key_;
     const Vector<std::byte> compressed_;
+    const ReadView encoded_;
     mutable std::optional<gcs::Elements> elements_;
 
     static auto transform(
@@ -126,7 +134,6 @@ private:
         const Vector<Space>& in,
         allocator_type alloc) noexcept -> Targets;
 
-    auto decompress() const noexcept -> const gcs::Elements&;
     auto hashed_set_construct(
         const Vector<ByteArray>& elements,
         allocator_type alloc) const noexcept -> gcs::Elements;
@@ -137,9 +144,14 @@ private:
         const noexcept -> gcs::Elements;
     auto hashed_set_construct(const Targets& elements, allocator_type alloc)
         const noexcept -> gcs::Elements;
-    auto test(const gcs::Elements& targetHashes, allocator_type monotonic)
+    /// Return the elements of a sorted, deduplicated target set which are
+    /// present in the filter, stopping after limit matches have been found
+    auto intersect(
+        const gcs::Elements& targets,
+        const std::size_t limit,
+        allocator_type alloc) const noexcept -> gcs::Elements;
+    auto test(gcs::Elements&& targetHashes, allocator_type monotonic)
         const noexcept -> bool;
-    auto hash_to_range(const ReadView in) const noexcept -> gcs::Range;
 
     GCS(const api::Session& api,
         const std::uint8_t bits,
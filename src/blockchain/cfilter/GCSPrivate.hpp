@@ -78,6 +78,11 @@ public:
         return {};
     }
     virtual auto Serialize(Writer&&) const noexcept -> bool { return {}; }
+    auto SerializeFlat(Writer&&) const noexcept -> bool override { return {}; }
+    auto SerializedFlatSize() const noexcept -> std::size_t override
+    {
+        return {};
+    }
     virtual auto size() const noexcept -> std::size_t { return {}; }
     virtual auto Test(const Data&, allocator_type) const noexcept -> bool
     {
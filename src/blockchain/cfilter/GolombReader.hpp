@@ -0,0 +1,122 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "internal/blockchain/cfilter/GCS.hpp"
+#include "opentxs/Types.hpp"
+
+namespace opentxs::gcs
+{
+/// Word-at-a-time Golomb-Rice decoder
+///
+/// Produces the same values as decoding through BitReader one bit at a time,
+/// including treating bits past the end of the input as zero. Buffered bits
+/// are kept left-aligned in a 64 bit word so the unary quotient can be
+/// measured with a single count-leading-ones instruction.
+class GolombReader
+{
+public:
+    auto Next() noexcept -> Delta
+    {
+        auto quotient = Delta{0};
+
+        while (true) {
+            if (0u == available_) {
+                refill();
+
+                // NOTE missing bits read as zero which terminates the quotient
+                if (0u == available_) { break; }
+            }
+
+            const auto ones = static_cast<unsigned>(std::countl_one(buffer_));
+
+            if (ones < available_) {
+                quotient += ones;
+                consume(ones + 1u);
+
+                break;
+            } else {
+                quotient += available_;
+                consume(available_);
+            }
+        }
+
+        if (0u == P_) { return quotient; }
+
+        if (available_ < P_) { refill(); }
+
+        const auto remainder = buffer_ >> (word_bits_ - P_);
+        consume(P_);
+
+        return (quotient << P_) + remainder;
+    }
+
+    GolombReader(const std::uint8_t P, const ReadView data) noexcept
+        : P_(std::min<unsigned>(P, word_bits_ - 8u))
+        , next_(reinterpret_cast<const std::uint8_t*>(data.data()))
+        , end_(next_ + data.size())
+        , buffer_(0)
+        , available_(0u)
+    {
+    }
+    GolombReader() = delete;
+    GolombReader(const GolombReader&) = delete;
+    GolombReader(GolombReader&&) = delete;
+    auto operator=(const GolombReader&) -> GolombReader& = delete;
+    auto operator=(GolombReader&&) -> GolombReader& = delete;
+
+    ~GolombReader() = default;
+
+private:
+    static constexpr auto word_bits_ =
+        unsigned{std::numeric_limits<std::uint64_t>::digits};
+
+    const unsigned P_;
+    const std::uint8_t* next_;
+    const std::uint8_t* const end_;
+    std::uint64_t buffer_;
+    unsigned available_;
+
+    auto consume(const unsigned bits) noexcept -> void
+    {
+        const auto n = std::min(bits, available_);
+        buffer_ = (n < word_bits_) ? (buffer_ << n) : std::uint64_t{0};
+        available_ -= n;
+    }
+    auto refill() noexcept -> void
+    {
+        const auto bytes = (word_bits_ - available_) / 8u;
+
+        if (0u == bytes) { return; }
+
+        if (static_cast<std::size_t>(end_ - next_) >= sizeof(std::uint64_t)) {
+            auto word = std::uint64_t{};
+            std::memcpy(&word, next_, sizeof(word));
+            word = boost::endian::big_to_native(word);
+            // only keep whole bytes so bits below available_ stay zero
+            word &= std::numeric_limits<std::uint64_t>::max()
+                    << (word_bits_ - (bytes * 8u));
+            buffer_ |= word >> available_;
+            next_ += bytes;
+            available_ += bytes * 8u;
+        } else {
+            while ((available_ <= (word_bits_ - 8u)) && (next_ != end_)) {
+                buffer_ |= std::uint64_t{*next_++}
+                           << (word_bits_ - 8u - available_);
+                available_ += 8u;
+            }
+        }
+    }
+};
+}  // namespace opentxs::gcs
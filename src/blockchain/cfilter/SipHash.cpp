@@ -0,0 +1,182 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "blockchain/cfilter/SipHash.hpp"  // IWYU pragma: associated
+#include "internal/blockchain/cfilter/GCS.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+#include "internal/util/P0330.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::gcs::siphash
+{
+static auto load(const char* in) noexcept -> std::uint64_t
+{
+    auto out = std::uint64_t{};
+    std::memcpy(&out, in, sizeof(out));
+
+    return boost::endian::little_to_native(out);
+}
+
+#ifndef _WIN32
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wattributes"
+#define OT_SIPHASH_WRAPPING                                                    \
+    __attribute__((no_sanitize("unsigned-integer-overflow")))
+#else
+#define OT_SIPHASH_WRAPPING
+#endif
+struct State {
+    std::uint64_t v0_;
+    std::uint64_t v1_;
+    std::uint64_t v2_;
+    std::uint64_t v3_;
+
+    OT_SIPHASH_WRAPPING auto compress(const std::uint64_t m) noexcept -> void
+    {
+        v3_ ^= m;
+        round();
+        round();
+        v0_ ^= m;
+    }
+    OT_SIPHASH_WRAPPING auto finalize() noexcept -> std::uint64_t
+    {
+        v2_ ^= 0xffu;
+        round();
+        round();
+        round();
+        round();
+
+        return v0_ ^ v1_ ^ v2_ ^ v3_;
+    }
+    OT_SIPHASH_WRAPPING auto round() noexcept -> void
+    {
+        v0_ += v1_;
+        v1_ = std::rotl(v1_, 13);
+        v1_ ^= v0_;
+        v0_ = std::rotl(v0_, 32);
+        v2_ += v3_;
+        v3_ = std::rotl(v3_, 16);
+        v3_ ^= v2_;
+        v0_ += v3_;
+        v3_ = std::rotl(v3_, 21);
+        v3_ ^= v0_;
+        v2_ += v1_;
+        v1_ = std::rotl(v1_, 17);
+        v1_ ^= v2_;
+        v2_ = std::rotl(v2_, 32);
+    }
+
+    State(const std::uint64_t k0, const std::uint64_t k1) noexcept
+        : v0_(k0 ^ 0x736f6d6570736575ULL)
+        , v1_(k1 ^ 0x646f72616e646f6dULL)
+        , v2_(k0 ^ 0x6c7967656e657261ULL)
+        , v3_(k1 ^ 0x7465646279746573ULL)
+    {
+    }
+};
+#undef OT_SIPHASH_WRAPPING
+#ifndef _WIN32
+#pragma GCC diagnostic pop
+#endif
+
+auto scalar(
+    const std::uint64_t k0,
+    const std::uint64_t k1,
+    const char* data,
+    const std::size_t size) noexcept -> std::uint64_t
+{
+    auto state = State{k0, k1};
+    const auto blocks = size / 8_uz;
+    const auto* i = data;
+
+    for (auto n = 0_uz; n < blocks; ++n, i += 8_uz) {
+        state.compress(load(i));
+    }
+
+    auto last = std::uint64_t{size & 0xffu} << 56u;
+
+    for (auto n = 0_uz, tail = size % 8_uz; n < tail; ++n) {
+        last |= std::uint64_t{static_cast<std::uint8_t>(i[n])} << (8_uz * n);
+    }
+
+    state.compress(last);
+
+    return state.finalize();
+}
+}  // namespace opentxs::gcs::siphash
+
+namespace opentxs::gcs
+{
+auto Siphash(
+    const ReadView key,
+    std::span<const ReadView> items,
+    std::span<Hash> out) noexcept(false) -> void
+{
+    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
+
+    const auto count = items.size();
+
+    if (out.size() != count) {
+        throw std::runtime_error("output size does not match input");
+    }
+
+    using namespace siphash;
+    const auto k0 = load(key.data());
+    const auto k1 = load(std::next(key.data(), 8));
+    static const auto simd = avx2_available();
+
+    if ((false == simd) || (count < lanes_)) {
+        for (auto n = 0_uz; n < count; ++n) {
+            const auto& item = items[n];
+            out[n] = scalar(k0, k1, item.data(), item.size());
+        }
+
+        return;
+    }
+
+    // NOTE the vector kernel requires every lane to have the same length so
+    // visit the items in order of increasing length
+    auto order = Vector<std::size_t>(count);
+    std::iota(order.begin(), order.end(), 0_uz);
+    std::ranges::stable_sort(order, [&](const auto lhs, const auto rhs) {
+        return items[lhs].size() < items[rhs].size();
+    });
+    auto n = 0_uz;
+
+    while (n < count) {
+        const auto size = items[order[n]].size();
+        auto end = n;
+
+        while ((end < count) && (items[order[end]].size() == size)) { ++end; }
+
+        for (; (n + lanes_) <= end; n += lanes_) {
+            auto data = Messages{};
+            auto hashes = Lanes{};
+
+            for (auto l = 0_uz; l < lanes_; ++l) {
+                data[l] = items[order[n + l]].data();
+            }
+
+            avx2(k0, k1, data, size, hashes);
+
+            for (auto l = 0_uz; l < lanes_; ++l) {
+                out[order[n + l]] = hashes[l];
+            }
+        }
+
+        for (; n < end; ++n) {
+            const auto& item = items[order[n]];
+            out[order[n]] = scalar(k0, k1, item.data(), item.size());
+        }
+    }
+}
+}  // namespace opentxs::gcs
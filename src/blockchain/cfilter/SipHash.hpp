@@ -0,0 +1,36 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace opentxs::gcs::siphash
+{
+inline constexpr auto lanes_ = std::size_t{4};
+
+using Lanes = std::array<std::uint64_t, lanes_>;
+using Messages = std::array<const char*, lanes_>;
+
+/// Returns true if the cpu supports the vectorized kernel
+auto avx2_available() noexcept -> bool;
+/// Compute SipHash-2-4 for four messages of identical length in parallel
+///
+/// Must only be called if avx2_available() returns true.
+auto avx2(
+    const std::uint64_t k0,
+    const std::uint64_t k1,
+    const Messages& data,
+    const std::size_t size,
+    Lanes& out) noexcept -> void;
+/// Compute SipHash-2-4 for a single message
+auto scalar(
+    const std::uint64_t k0,
+    const std::uint64_t k1,
+    const char* data,
+    const std::size_t size) noexcept -> std::uint64_t;
+}  // namespace opentxs::gcs::siphash
@@ -0,0 +1,137 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "blockchain/cfilter/SipHash.hpp"  // IWYU pragma: associated
+
+#include <immintrin.h>
+#include <cstring>
+
+// NOTE this file is compiled without -mavx2 so that no vector instructions
+// leak into inline functions shared with other translation units. Only the
+// functions marked with OT_AVX2 are allowed to use them, and they are only
+// reached after avx2_available() has returned true.
+#define OT_AVX2 __attribute__((target("avx2")))
+
+namespace opentxs::gcs::siphash
+{
+OT_AVX2 static inline auto rotl(const __m256i x, const int b) noexcept
+    -> __m256i
+{
+    return _mm256_or_si256(
+        _mm256_slli_epi64(x, b), _mm256_srli_epi64(x, 64 - b));
+}
+
+OT_AVX2 static inline auto rotl32(const __m256i x) noexcept -> __m256i
+{
+    return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+OT_AVX2 static inline auto round(
+    __m256i& v0,
+    __m256i& v1,
+    __m256i& v2,
+    __m256i& v3) noexcept -> void
+{
+    v0 = _mm256_add_epi64(v0, v1);
+    v1 = rotl(v1, 13);
+    v1 = _mm256_xor_si256(v1, v0);
+    v0 = rotl32(v0);
+    v2 = _mm256_add_epi64(v2, v3);
+    v3 = rotl(v3, 16);
+    v3 = _mm256_xor_si256(v3, v2);
+    v0 = _mm256_add_epi64(v0, v3);
+    v3 = rotl(v3, 21);
+    v3 = _mm256_xor_si256(v3, v0);
+    v2 = _mm256_add_epi64(v2, v1);
+    v1 = rotl(v1, 17);
+    v1 = _mm256_xor_si256(v1, v2);
+    v2 = rotl32(v2);
+}
+
+OT_AVX2 static inline auto compress(
+    const __m256i m,
+    __m256i& v0,
+    __m256i& v1,
+    __m256i& v2,
+    __m256i& v3) noexcept -> void
+{
+    v3 = _mm256_xor_si256(v3, m);
+    round(v0, v1, v2, v3);
+    round(v0, v1, v2, v3);
+    v0 = _mm256_xor_si256(v0, m);
+}
+
+static inline auto word(const char* in) noexcept -> long long
+{
+    // NOTE x86 is little endian so no byte swapping is required
+    auto out = 0ll;
+    std::memcpy(&out, in, sizeof(out));
+
+    return out;
+}
+
+static inline auto last_word(const char* in, const std::size_t size) noexcept
+    -> long long
+{
+    auto out = static_cast<unsigned long long>(size & 0xffu) << 56u;
+    const auto tail = size % 8u;
+    const auto* i = in + (size - tail);
+
+    for (auto n = std::size_t{0}; n < tail; ++n) {
+        out |= static_cast<unsigned long long>(static_cast<unsigned char>(i[n]))
+               << (8u * n);
+    }
+
+    return static_cast<long long>(out);
+}
+
+auto avx2_available() noexcept -> bool
+{
+    return 0 != __builtin_cpu_supports("avx2");
+}
+
+OT_AVX2 auto avx2(
+    const std::uint64_t k0,
+    const std::uint64_t k1,
+    const Messages& data,
+    const std::size_t size,
+    Lanes& out) noexcept -> void
+{
+    const auto key0 = _mm256_set1_epi64x(static_cast<long long>(k0));
+    const auto key1 = _mm256_set1_epi64x(static_cast<long long>(k1));
+    auto v0 = _mm256_xor_si256(key0, _mm256_set1_epi64x(0x736f6d6570736575ll));
+    auto v1 = _mm256_xor_si256(key1, _mm256_set1_epi64x(0x646f72616e646f6dll));
+    auto v2 = _mm256_xor_si256(key0, _mm256_set1_epi64x(0x6c7967656e657261ll));
+    auto v3 = _mm256_xor_si256(key1, _mm256_set1_epi64x(0x7465646279746573ll));
+    const auto blocks = size / 8u;
+
+    for (auto n = std::size_t{0}; n < blocks; ++n) {
+        const auto offset = n * 8u;
+        const auto m = _mm256_set_epi64x(
+            word(data[3] + offset),
+            word(data[2] + offset),
+            word(data[1] + offset),
+            word(data[0] + offset));
+        compress(m, v0, v1, v2, v3);
+    }
+
+    const auto last = _mm256_set_epi64x(
+        last_word(data[3], size),
+        last_word(data[2], size),
+        last_word(data[1], size),
+        last_word(data[0], size));
+    compress(last, v0, v1, v2, v3);
+    v2 = _mm256_xor_si256(v2, _mm256_set1_epi64x(0xff));
+    round(v0, v1, v2, v3);
+    round(v0, v1, v2, v3);
+    round(v0, v1, v2, v3);
+    round(v0, v1, v2, v3);
+    const auto result = _mm256_xor_si256(
+        _mm256_xor_si256(v0, v1), _mm256_xor_si256(v2, v3));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data()), result);
+}
+}  // namespace opentxs::gcs::siphash
+
+#undef OT_AVX2
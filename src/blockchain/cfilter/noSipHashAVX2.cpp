@@ -0,0 +1,23 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "blockchain/cfilter/SipHash.hpp"  // IWYU pragma: associated
+
+namespace opentxs::gcs::siphash
+{
+auto avx2_available() noexcept -> bool { return false; }
+
+auto avx2(
+    const std::uint64_t k0,
+    const std::uint64_t k1,
+    const Messages& data,
+    const std::size_t size,
+    Lanes& out) noexcept -> void
+{
+    for (auto n = std::size_t{0}; n < lanes_; ++n) {
+        out[n] = scalar(k0, k1, data[n], size);
+    }
+}
+}  // namespace opentxs::gcs::siphash
@@ -154,6 +154,35 @@ auto DeterministicPrivate::accept(
     return index;
 }
 
+auto DeterministicPrivate::add_element(
+    const rLock&,
+    const Subchain type,
+    const Bip32Index index,
+    const opentxs::crypto::asymmetric::key::EllipticCurve& key) const
+    noexcept(false) -> void
+{
+    if (false == key.IsValid()) {
+        throw std::runtime_error("Failed to generate key");
+    }
+
+    auto& addressMap = data_.Get(type).map_;
+    const auto& blockchain = parent_.Parent().Parent();
+    const auto [it, added] = addressMap.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(index),
+        std::forward_as_tuple(std::make_unique<implementation::Element>(
+            api_,
+            blockchain,
+            Self(),
+            base_chain(target_),
+            type,
+            index,
+            key,
+            get_contact())));
+
+    if (false == added) { throw std::runtime_error("Failed to add key"); }
+}
+
 auto DeterministicPrivate::AllowedSubchains() const noexcept -> Set<Subchain>
 {
     return {data_.internal_.type_, data_.external_.type_};
@@ -258,12 +287,9 @@ auto DeterministicPrivate::check_lookahead(
     Batch& generated,
     const PasswordPrompt& reason) const noexcept(false) -> void
 {
-    auto needed = need_lookahead(lock, type);
+    const auto needed = need_lookahead(lock, type);
 
-    while (0u < needed) {
-        generated.emplace_back(generate_next(lock, type, reason));
-        --needed;
-    }
+    if (0u < needed) { generate_batch(lock, type, needed, generated, reason); }
 }
 
 auto DeterministicPrivate::confirm(
@@ -308,6 +334,24 @@ auto DeterministicPrivate::confirm(
     check_lookahead(lock, type, generated, reason);
 }
 
+auto DeterministicPrivate::derive_keys(
+    const rLock&,
+    const Subchain type,
+    const Bip32Index first,
+    const Bip32Index count,
+    const PasswordPrompt& reason) const noexcept(false) -> Keys
+{
+    auto out = Keys{};
+    out.reserve(count);
+    out.clear();
+
+    for (auto i = 0u; i < count; ++i) {
+        out.emplace_back(PrivateKey(type, first + i, reason));
+    }
+
+    return out;
+}
+
 auto DeterministicPrivate::element(
     const rLock&,
     const Subchain type,
@@ -430,7 +474,7 @@ auto DeterministicPrivate::generate(
     const Bip32Index desired,
     const PasswordPrompt& reason) const noexcept(false) -> Bip32Index
 {
-    auto& addressMap = data_.Get(type).map_;
+    const auto& addressMap = data_.Get(type).map_;
     auto& index = generated_.at(type);
 
     assert_true(addressMap.size() == index);
@@ -438,29 +482,42 @@ auto DeterministicPrivate::generate(
 
     if (max_index_ <= index) { throw std::runtime_error("Account is full"); }
 
-    const auto& key = PrivateKey(type, index, reason);
+    add_element(lock, type, index, PrivateKey(type, index, reason));
 
-    if (false == key.IsValid()) {
-        throw std::runtime_error("Failed to generate key");
+    return index++;
+}
+
+auto DeterministicPrivate::generate_batch(
+    const rLock& lock,
+    const Subchain type,
+    const Bip32Index count,
+    Batch& generated,
+    const PasswordPrompt& reason) const noexcept(false) -> void
+{
+    const auto& addressMap = data_.Get(type).map_;
+    auto& index = generated_.at(type);
+
+    assert_true(addressMap.size() == index);
+
+    if ((max_index_ <= index) || ((max_index_ - index) < count)) {
+        throw std::runtime_error("Account is full");
     }
 
-    const auto& blockchain = parent_.Parent().Parent();
-    const auto [it, added] = addressMap.emplace(
-        std::piecewise_construct,
-        std::forward_as_tuple(index),
-        std::forward_as_tuple(std::make_unique<implementation::Element>(
-            api_,
-            blockchain,
-            Self(),
-            base_chain(target_),
-            type,
-            index,
-            key,
-            get_contact())));
+    // NOTE all keys are derived and checked before any of them are added so
+    // a derivation failure leaves the subaccount unchanged
+    const auto keys = derive_keys(lock, type, index, count, reason);
+    constexpr auto valid = [](const auto& key) { return key.IsValid(); };
 
-    if (false == added) { throw std::runtime_error("Failed to add key"); }
+    if ((keys.size() != count) || (false == std::ranges::all_of(keys, valid))) {
+        throw std::runtime_error("Failed to generate keys");
+    }
 
-    return index++;
+    generated.reserve(generated.size() + count);
+
+    for (const auto& key : keys) {
+        add_element(lock, type, index, key);
+        generated.emplace_back(index++);
+    }
 }
 
 auto DeterministicPrivate::generate_next(
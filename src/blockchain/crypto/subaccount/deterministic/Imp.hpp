@@ -161,6 +161,8 @@ protected:
             bool externalContact) noexcept;
     };
 
+    using Keys = Vector<opentxs::crypto::asymmetric::key::EllipticCurve>;
+
     static constexpr Bip32Index window_{20u};
     static constexpr Bip32Index max_allocation_{2000u};
     static constexpr Bip32Index max_index_{2147483648u};
@@ -178,6 +180,14 @@ protected:
         const Subchain type,
         Batch& generated,
         const PasswordPrompt& reason) const noexcept(false) -> void;
+    /// Derive the keys for count consecutive indices starting at first. The
+    /// default implementation calls PrivateKey() for each index in turn.
+    virtual auto derive_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const Bip32Index count,
+        const PasswordPrompt& reason) const noexcept(false) -> Keys;
     auto element(const rLock& lock, const Subchain type, const Bip32Index index)
         const noexcept(false) -> const crypto::Element&
     {
@@ -262,6 +272,12 @@ private:
         Batch& generated,
         const PasswordPrompt& reason) const noexcept
         -> std::optional<Bip32Index>;
+    auto add_element(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index index,
+        const opentxs::crypto::asymmetric::key::EllipticCurve& key) const
+        noexcept(false) -> void;
     auto check(
         const rLock& lock,
         const Subchain type,
@@ -295,6 +311,12 @@ private:
         const Subchain type,
         const Bip32Index index,
         const PasswordPrompt& reason) const noexcept(false) -> Bip32Index;
+    auto generate_batch(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index count,
+        Batch& generated,
+        const PasswordPrompt& reason) const noexcept(false) -> void;
     [[nodiscard]] auto generate_next(
         const rLock& lock,
         const Subchain type,
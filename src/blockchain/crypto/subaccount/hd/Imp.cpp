@@ -9,7 +9,9 @@
 #include <opentxs/protobuf/BlockchainDeterministicAccountData.pb.h>
 #include <opentxs/protobuf/BlockchainHDAccountData.pb.h>
 #include <cstdint>
+#include <exception>
 #include <memory>
+#include <stdexcept>
 #include <tuple>
 #include <utility>
 
@@ -160,6 +162,26 @@ auto HDPrivate::account_already_exists(const rLock&) const noexcept -> bool
     return existing.contains(id_);
 }
 
+auto HDPrivate::derive_keys(
+    const rLock& lock,
+    const Subchain type,
+    const Bip32Index first,
+    const Bip32Index count,
+    const PasswordPrompt& reason) const noexcept(false) -> Keys
+{
+    if ((internal_type_ != type) && (external_type_ != type)) {
+        throw std::runtime_error{"Invalid subchain for this account"};
+    }
+
+    if (false == api::crypto::HaveHDKeys()) {
+        throw std::runtime_error{"HD key support is not enabled"};
+    }
+
+    const auto& parent = parent_key(lock, type, reason);
+
+    return derive_children(parent, first, count, reason);
+}
+
 auto HDPrivate::InitSelf(std::shared_ptr<Subaccount> me) noexcept -> void
 {
     self_.emplace(me);
@@ -193,22 +215,36 @@ auto HDPrivate::PrivateKey(
         return opentxs::crypto::asymmetric::key::EllipticCurve::Blank();
     }
 
+    try {
+        auto lock = rLock{lock_};
+
+        return parent_key(lock, type, reason).ChildKey(index, reason);
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return opentxs::crypto::asymmetric::key::EllipticCurve::Blank();
+    }
+}
+
+auto HDPrivate::parent_key(
+    const rLock&,
+    const Subchain type,
+    const PasswordPrompt& reason) const noexcept(false)
+    -> const opentxs::crypto::asymmetric::key::HD&
+{
     using enum Bip44Subchain;
     const auto change = (internal_type_ == type) ? internal : external;
     auto& key = (internal_type_ == type) ? cached_internal_ : cached_external_;
-    auto lock = rLock{lock_};
 
     if (false == key.IsValid()) {
         key = api_.Crypto().Seed().Internal().AccountKey(path_, change, reason);
 
         if (false == key.IsValid()) {
-            LogError()()("Failed to derive account key").Flush();
-
-            return opentxs::crypto::asymmetric::key::EllipticCurve::Blank();
+            throw std::runtime_error{"Failed to derive account key"};
         }
     }
 
-    return key.ChildKey(index, reason);
+    return key;
 }
 
 auto HDPrivate::save(const rLock& lock) const noexcept -> bool
@@ -130,7 +130,26 @@ private:
     mutable opentxs::crypto::asymmetric::key::HD cached_external_;
     mutable Me self_;
 
+    /// Each child is derived from the cached account key in a single step
+    /// so the range is divided between the threads of the parallel backend
+    static auto derive_children(
+        const opentxs::crypto::asymmetric::key::HD& parent,
+        const Bip32Index first,
+        const Bip32Index count,
+        const PasswordPrompt& reason) noexcept -> Keys;
+
     auto account_already_exists(const rLock& lock) const noexcept -> bool final;
+    auto derive_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const Bip32Index count,
+        const PasswordPrompt& reason) const noexcept(false) -> Keys final;
+    auto parent_key(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> const opentxs::crypto::asymmetric::key::HD&;
     auto save(const rLock& lock) const noexcept -> bool final;
 
     HDPrivate(
@@ -0,0 +1,34 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "blockchain/crypto/subaccount/hd/Imp.hpp"  // IWYU pragma: associated
+
+#include <algorithm>  // IWYU pragma: keep
+#include <execution>
+#include <ranges>
+
+#include "internal/util/P0330.hpp"
+#include "opentxs/crypto/asymmetric/key/HD.hpp"
+
+namespace opentxs::blockchain::crypto
+{
+auto HDPrivate::derive_children(
+    const opentxs::crypto::asymmetric::key::HD& parent,
+    const Bip32Index first,
+    const Bip32Index count,
+    const PasswordPrompt& reason) noexcept -> Keys
+{
+    auto out = Keys{};
+    out.resize(count);
+    using namespace std::execution;
+    const auto range = std::views::iota(0_uz, out.size());
+    std::for_each(par, range.begin(), range.end(), [&](const auto i) {
+        const auto index = first + static_cast<Bip32Index>(i);
+        out[i] = parent.ChildKey(index, reason);
+    });
+
+    return out;
+}
+}  // namespace opentxs::blockchain::crypto
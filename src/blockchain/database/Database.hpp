@@ -179,6 +179,13 @@ public:
     {
         return common_.BlockStore(id, bytes, monotonic);
     }
+    auto BlockStore(
+        std::span<const SerializedBlock> blocks,
+        alloc::Default alloc,
+        alloc::Default monotonic) noexcept -> Vector<ReadView> final
+    {
+        return common_.BlockStore(blocks, alloc, monotonic);
+    }
     auto BlockTip() const noexcept -> block::Position final
     {
         return blocks_.Tip();
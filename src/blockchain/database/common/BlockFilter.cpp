@@ -5,11 +5,9 @@
 
 #include "blockchain/database/common/BlockFilter.hpp"  // IWYU pragma: associated
 
-#include <google/protobuf/arena.h>
 #include <opentxs/protobuf/BlockchainFilterHeader.pb.h>
-#include <opentxs/protobuf/GCS.pb.h>
 #include <cstring>
-#include <new>
+#include <memory>
 #include <optional>
 #include <span>
 #include <stdexcept>
@@ -18,10 +16,11 @@
 #include <utility>
 
 #include "blockchain/database/common/Bulk.hpp"
+#include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/cfilter/GCS.hpp"
 #include "internal/util/P0330.hpp"
-#include "internal/util/Size.hpp"
+#include "internal/util/TSV.hpp"
 #include "internal/util/storage/file/Index.hpp"
 #include "internal/util/storage/file/Mapped.hpp"
 #include "internal/util/storage/file/Types.hpp"
@@ -42,7 +41,6 @@
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/WriteBuffer.hpp"
 #include "opentxs/util/Writer.hpp"
-#include "util/ByteLiterals.hpp"
 
 namespace opentxs::blockchain::database::common
 {
@@ -53,14 +51,56 @@ BlockFilter::BlockFilter(
     : api_(api)
     , lmdb_(lmdb)
     , bulk_(bulk)
+    , migrated_([&] {
+        auto out{false};
+        lmdb_.Load(
+            Table::Config,
+            tsv(Database::Key::CfilterFormat),
+            [&](const auto in) {
+                out = (sizeof(gcs::FlatHeader::current_format_) == in.size()) &&
+                      (gcs::FlatHeader::current_format_ ==
+                       static_cast<std::uint8_t>(in.front()));
+            });
+
+        return out;
+    }())
+    , migration_type_(0_uz)
+    , migration_position_()
+{
+}
+
+auto BlockFilter::finish_migration() noexcept -> bool
 {
+    const auto format = gcs::FlatHeader::current_format_;
+    const auto result = lmdb_.Store(
+        Table::Config,
+        tsv(Database::Key::CfilterFormat),
+        {reinterpret_cast<const char*>(std::addressof(format)), sizeof(format)});
+
+    if (result.first) {
+        LogVerbose()()("all cfilters migrated to flat storage format").Flush();
+        migrated_ = true;
+    } else {
+        LogError()()("failed to record cfilter storage format").Flush();
+    }
+
+    return false;
 }
 
 auto BlockFilter::ForgetCfilter(
     const cfilter::Type type,
     const ReadView blockHash) const noexcept -> bool
 {
-    return lmdb_.Delete(translate_filter(type), blockHash);
+    try {
+        auto tx = lmdb_.TransactionRW();
+        const auto output = bulk_.Forget(translate_filter(type), blockHash, tx);
+
+        return tx.Finalize(output);
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
 }
 
 auto BlockFilter::HaveCfilter(
@@ -172,13 +212,10 @@ auto BlockFilter::LoadCfilters(
     assert_true(files.size() == indices.size());
 
     for (const auto& file : files) {
-        try {
-            output.emplace_back(factory::GCS(
-                api_, protobuf::Factory<protobuf::GCS>(file), alloc.result_));
-        } catch (const std::exception& e) {
-            LogVerbose()()(e.what()).Flush();
-
-            break;
+        if (gcs::IsFlat(file)) {
+            output.emplace_back(factory::GCSView(api_, file, alloc.result_));
+        } else {
+            output.emplace_back(factory::GCS(api_, file, alloc.result_));
         }
     }
 
@@ -242,38 +279,138 @@ auto BlockFilter::LoadCfheader(
     return output;
 }
 
-auto BlockFilter::make_arena(unsigned long long capacity) noexcept
-    -> google::protobuf::Arena
+auto BlockFilter::MigrateCfilters() noexcept -> bool
 {
-    const auto options = [&] {
-        auto out = google::protobuf::ArenaOptions{};
-        out.start_block_size = convert_to_size(capacity);
-        out.max_block_size = convert_to_size(capacity);
+    if (migrated_) { return false; }
 
-        return out;
-    }();
+    if (migration_types_.size() <= migration_type_) {
+        return finish_migration();
+    }
+
+    try {
+        auto alloc = alloc::MonotonicUnsync{};
+        const auto type = migration_types_[migration_type_];
+        const auto table = translate_filter(type);
+        auto keys = Vector<block::Hash>{&alloc};
+        auto indices = Vector<storage::file::Index>{&alloc};
+        keys.reserve(migration_batch_);
+        indices.reserve(migration_batch_);
+        keys.clear();
+        indices.clear();
+        auto cb = [&, this](const auto key, const auto value) {
+            if (key == migration_position_) { return true; }
+
+            keys.emplace_back(key);
+            indices.emplace_back().Deserialize(value);
+
+            return keys.size() < migration_batch_;
+        };
+        using enum storage::lmdb::Dir;
+
+        if (migration_position_.empty()) {
+            lmdb_.Read(table, cb, Forward);
+        } else if (false == lmdb_.ReadFrom(
+                                table, migration_position_, cb, Forward)) {
+            // NOTE the resume position was removed from the table so start
+            // over from the beginning. Records which were already migrated
+            // will be skipped.
+            if (keys.empty()) {
+                migration_position_.clear();
+
+                return true;
+            }
+        }
+
+        if (keys.empty()) {
+            ++migration_type_;
+            migration_position_.clear();
+
+            return true;
+        }
+
+        migration_position_ = keys.back().Bytes();
+        const auto files = bulk_.Read(indices, &alloc);
+
+        assert_true(files.size() == keys.size());
 
-    return google::protobuf::Arena{options};
+        auto legacy = Vector<std::size_t>{&alloc};
+        legacy.reserve(keys.size());
+        legacy.clear();
+
+        for (auto n = 0_uz; n < keys.size(); ++n) {
+            const auto& file = files[n];
+
+            if (file.empty() || gcs::IsFlat(file)) { continue; }
+
+            legacy.emplace_back(n);
+        }
+
+        if (legacy.empty()) { return true; }
+
+        auto tx = lmdb_.TransactionRW();
+        auto filters = Vector<CFilterParams>{&alloc};
+        filters.reserve(legacy.size());
+        filters.clear();
+
+        for (const auto n : legacy) {
+            const auto& key = keys[n];
+            const auto& original = indices[n];
+            auto current = storage::file::Index{};
+
+            // NOTE the batch was read outside of this transaction so any
+            // cfilter which has since been replaced or removed must not be
+            // rewritten
+            try {
+                load_cfilter_index(type, key.Bytes(), tx, current);
+            } catch (...) {
+
+                continue;
+            }
+
+            const auto unchanged =
+                (current.MemoryPosition() == original.MemoryPosition()) &&
+                (current.ItemSize() == original.ItemSize());
+
+            if (false == unchanged) { continue; }
+
+            auto cfilter = factory::GCS(api_, files[n], &alloc);
+
+            if (cfilter.IsValid()) {
+                filters.emplace_back(key, std::move(cfilter));
+            }
+        }
+
+        if (filters.empty()) { return true; }
+
+        LogTrace()()("migrating ")(filters.size())(" cfilters").Flush();
+        const auto parsed = parse(filters, &alloc);
+
+        return tx.Finalize(store(parsed, type, tx));
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
 }
 
 auto BlockFilter::parse(
     const Vector<CFilterParams>& filters,
-    google::protobuf::Arena& arena,
     alloc::Default alloc) noexcept(false) -> Parsed
 {
     auto out = [&] {
-        auto data = std::make_tuple(Hashes{alloc}, Protos{alloc}, Sizes{alloc});
-        auto& [hashes, protos, sizes] = data;
+        auto data =
+            std::make_tuple(Hashes{alloc}, Filters{alloc}, Sizes{alloc});
+        auto& [hashes, cfilters, sizes] = data;
         hashes.reserve(filters.size());
-        protos.reserve(filters.size());
+        cfilters.reserve(filters.size());
         sizes.reserve(filters.size());
         hashes.clear();
-        protos.clear();
+        cfilters.clear();
         sizes.clear();
 
         return data;
     }();
-    auto& [hashes, protos, sizes] = out;
+    auto& [hashes, cfilters, sizes] = out;
 
     for (const auto& [block, cfilter] : filters) {
         if (false == cfilter.IsValid()) {
@@ -281,21 +418,9 @@ auto BlockFilter::parse(
         }
 
         const auto& hash = hashes.emplace_back(block.Bytes());
-        auto* pProto =
-            protos.emplace_back(google::protobuf::Arena::Create<protobuf::GCS>(
-                std::addressof(arena)));
-
-        if (nullptr == pProto) {
-            throw std::runtime_error{"failed to allocate protobuf"};
-        }
-
-        auto& proto = *pProto;
-
-        if (false == cfilter.Internal().Serialize(proto)) {
-            throw std::runtime_error{"Failed to serialize gcs"};
-        }
-
-        const auto& size = sizes.emplace_back(proto.ByteSizeLong());
+        cfilters.emplace_back(std::addressof(cfilter));
+        const auto& size =
+            sizes.emplace_back(cfilter.Internal().SerializedFlatSize());
 
         LogInsane()()("serialized cfilter for block ")
             .asHex(hash)(" to ")(size)(" bytes")
@@ -311,10 +436,10 @@ auto BlockFilter::store(
     storage::lmdb::Transaction& tx) const noexcept -> bool
 {
     try {
-        const auto& [hashes, protos, sizes] = parsed;
+        const auto& [hashes, cfilters, sizes] = parsed;
         const auto count = hashes.size();
 
-        assert_true(count == protos.size());
+        assert_true(count == cfilters.size());
         assert_true(count == sizes.size());
 
         auto write = bulk_.Write(tx, sizes);
@@ -329,30 +454,29 @@ auto BlockFilter::store(
 
         for (auto i = 0_uz; i < hashes.size(); ++i) {
             const auto& hash = hashes[i];
-            const auto* proto = protos[i];
+            const auto* cfilter = cfilters[i];
             const auto& bytes = sizes[i];
             auto& [index, location] = write[i];
             auto& [_, view] = location;
-            const auto sIndex = index.Serialize();
 
             if (view.size() != bytes) {
                 throw std::runtime_error{
                     "failed to get write position for cfilter"};
             }
 
-            assert_false(nullptr == proto);
+            assert_false(nullptr == cfilter);
 
             in.emplace_back(
-                [proto](auto&& writer) {
-                    return protobuf::write(*proto, std::move(writer));
+                [cfilter](auto&& writer) {
+                    return cfilter->Internal().SerializeFlat(std::move(writer));
                 },
                 bytes);
             out.emplace_back(std::move(location));
 
             const auto result =
-                lmdb_.Store(translate_filter(type), hash, sIndex.Bytes(), tx);
+                bulk_.Store(translate_filter(type), hash, index, tx);
 
-            if (result.first) {
+            if (result) {
                 LogTrace()()("saved ")(bytes)(" bytes at position ")(
                     index.MemoryPosition())(" for cfilter ")
                     .asHex(hash)
@@ -422,8 +546,7 @@ auto BlockFilter::StoreCfilters(
     alloc::Strategy alloc) const noexcept -> bool
 {
     try {
-        auto arena = make_arena(8_mib);
-        const auto parsed = parse(filters, arena, alloc.work_);
+        const auto parsed = parse(filters, alloc.work_);
         auto tx = lmdb_.TransactionRW();
         const auto result = store(parsed, type, tx);
 
@@ -447,8 +570,7 @@ auto BlockFilter::StoreCfilters(
                 "wrong number of filters compared to headers"};
         }
 
-        auto arena = make_arena(8_mib);
-        const auto parsed = parse(filters, arena, alloc.work_);
+        const auto parsed = parse(filters, alloc.work_);
         auto tx = lmdb_.TransactionRW();
 
         if (false == store_cfheaders(type, headers, tx)) {
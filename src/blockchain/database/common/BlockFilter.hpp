@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <span>
@@ -12,19 +13,13 @@
 
 #include "internal/blockchain/database/common/Common.hpp"
 #include "opentxs/Types.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/blockchain/cfilter/FilterType.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/cfilter/Types.hpp"
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
-namespace google
-{
-namespace protobuf
-{
-class Arena;
-}  // namespace protobuf
-}  // namespace google
-
 namespace opentxs
 {
 namespace api
@@ -53,11 +48,6 @@ class Bulk;
 }  // namespace database
 }  // namespace blockchain
 
-namespace protobuf
-{
-class GCS;
-}  // namespace protobuf
-
 namespace storage
 {
 namespace file
@@ -103,6 +93,11 @@ public:
         const cfilter::Type type,
         const ReadView blockHash,
         Writer&& header) const noexcept -> bool;
+    /** Rewrite one batch of cfilters stored in the legacy protobuf format
+     *
+     *  \returns true if more records may remain to be migrated
+     */
+    auto MigrateCfilters() noexcept -> bool;
     auto StoreCfheaders(
         const cfilter::Type type,
         const Vector<CFHeaderParams>& headers) const noexcept -> bool;
@@ -123,30 +118,37 @@ public:
 
 private:
     using Hashes = Vector<ReadView>;
-    using Protos = Vector<protobuf::GCS*>;
+    using Filters = Vector<const cfilter::GCS*>;
     using Sizes = Vector<std::size_t>;
-    using Parsed = std::tuple<Hashes, Protos, Sizes>;
+    using Parsed = std::tuple<Hashes, Filters, Sizes>;
 
     static const std::uint32_t blockchain_filter_header_version_{1};
     static const std::uint32_t blockchain_filter_headers_version_{1};
     static const std::uint32_t blockchain_filter_version_{1};
     static const std::uint32_t blockchain_filters_version_{1};
+    static constexpr auto migration_batch_ = 1000_uz;
+    static constexpr auto migration_types_ = std::array<cfilter::Type, 3>{
+        cfilter::Type::Basic_BIP158,
+        cfilter::Type::Basic_BCHVariant,
+        cfilter::Type::ES,
+    };
 
     const api::Session& api_;
     storage::lmdb::Database& lmdb_;
     Bulk& bulk_;
+    bool migrated_;
+    std::size_t migration_type_;
+    UnallocatedCString migration_position_;
 
-    static auto make_arena(unsigned long long capacity) noexcept
-        -> google::protobuf::Arena;
     static auto parse(
         const Vector<CFilterParams>& filters,
-        google::protobuf::Arena& arena,
         alloc::Default alloc) noexcept(false) -> Parsed;
     static auto translate_filter(const cfilter::Type type) noexcept(false)
         -> Table;
     static auto translate_header(const cfilter::Type type) noexcept(false)
         -> Table;
 
+    auto finish_migration() noexcept -> bool;
     auto load_cfilter_index(
         const cfilter::Type type,
         const ReadView blockHash,
@@ -5,6 +5,10 @@
 
 #include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <utility>
@@ -12,6 +16,7 @@
 #include "blockchain/database/common/Bulk.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
 #include "internal/blockchain/params/ChainData.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/storage/file/Index.hpp"
 #include "internal/util/storage/file/Mapped.hpp"
 #include "internal/util/storage/lmdb/Database.hpp"
@@ -34,7 +39,16 @@ struct Blocks::Imp {
     }
     auto Forget(const block::Hash& block) const noexcept -> bool
     {
-        return lmdb_.Delete(table_, block.Bytes());
+        try {
+            auto tx = lmdb_.TransactionRW();
+            const auto output = bulk_.Forget(table_, block.Bytes(), tx);
+
+            return tx.Finalize(output);
+        } catch (const std::exception& e) {
+            LogError()()(e.what()).Flush();
+
+            return false;
+        }
     }
     auto Load(
         blockchain::Type chain,
@@ -44,27 +58,22 @@ struct Blocks::Imp {
     {
         const auto count = hashes.size();
         const auto indices = [&] {
-            auto out = Vector<storage::file::Index>{monotonic};
-            out.reserve(count);
-            out.clear();
-
-            for (const auto& id : hashes) {
-                auto& index = out.emplace_back();
-
-                try {
-                    auto cb = [&](const auto in) { index.Deserialize(in); };
-                    lmdb_.Load(table_, id.Bytes(), cb);
+            auto out = Vector<storage::file::Index>{count, monotonic};
 
-                    if (index.empty()) {
-                        const auto error = CString{"block "}
-                                               .append(id.asHex())
-                                               .append(" not found in index");
+            try {
+                auto tx = lmdb_.TransactionRO();
 
-                        throw std::runtime_error{error.c_str()};
+                if (count < sorted_lookup_threshold_) {
+                    for (auto n = 0_uz; n < count; ++n) {
+                        load_index(hashes[n], tx, out[n]);
+                    }
+                } else {
+                    for (const auto n : sorted_order(hashes, monotonic)) {
+                        load_index(hashes[n], tx, out[n]);
                     }
-                } catch (const std::exception& e) {
-                    LogTrace()()(e.what()).Flush();
                 }
+            } catch (const std::exception& e) {
+                LogError()()(e.what()).Flush();
             }
 
             return out;
@@ -84,51 +93,99 @@ struct Blocks::Imp {
         const ReadView bytes,
         alloc::Default monotonic) const noexcept -> ReadView
     {
-        try {
-            const auto size = bytes.size();
-            auto tx = lmdb_.TransactionRW();
-            auto data = bulk_.Write(tx, {size});
+        const auto block = SerializedBlock{id, bytes};
+        const auto out = Store(
+            std::span<const SerializedBlock>{std::addressof(block), 1_uz},
+            monotonic,
+            monotonic);
 
-            assert_false(data.empty());
+        assert_true(1_uz == out.size());
 
-            auto& [index, location] = data.front();
-            const auto& [_, view] = location;
+        return out.front();
+    }
+    auto Store(
+        std::span<const SerializedBlock> blocks,
+        alloc::Default alloc,
+        alloc::Default monotonic) const noexcept -> Vector<ReadView>
+    {
+        const auto count = blocks.size();
+        auto out = Vector<ReadView>{count, alloc};
+
+        if (0_uz == count) { return out; }
 
-            if (view.size() != size) {
+        try {
+            const auto sizes = [&] {
+                auto v = Vector<std::size_t>{monotonic};
+                v.reserve(count);
+                v.clear();
+                std::ranges::transform(
+                    blocks, std::back_inserter(v), [](const auto& block) {
+                        return block.second.size();
+                    });
+
+                return v;
+            }();
+            auto tx = lmdb_.TransactionRW();
+            auto reserved = bulk_.Write(tx, sizes);
+
+            if (reserved.size() != count) {
                 throw std::runtime_error{
-                    "failed to get write position for block"};
+                    "failed to get write positions for blocks"};
             }
 
-            const auto written =
-                storage::file::Mapped::Write(bytes, location, monotonic);
+            auto data = Vector<ReadView>{monotonic};
+            auto files = Vector<storage::file::Location>{monotonic};
+            data.reserve(count);
+            files.reserve(count);
+            data.clear();
+            files.clear();
+
+            for (auto n = 0_uz; n < count; ++n) {
+                const auto& [id, bytes] = blocks[n];
+                const auto& [index, location] = reserved[n];
+                const auto& [_, view] = location;
+
+                if (view.size() != bytes.size()) {
+                    throw std::runtime_error{
+                        "failed to get write position for block"};
+                }
 
-            if (false == written) {
-                throw std::runtime_error{"failed to write block"};
-            }
+                const auto result = bulk_.Store(table_, id.Bytes(), index, tx);
 
-            const auto sIndex = index.Serialize();
-            const auto result =
-                lmdb_.Store(table_, id.Bytes(), sIndex.Bytes(), tx);
+                if (false == result) {
+                    throw std::runtime_error{
+                        "Failed to update index for block"};
+                }
 
-            if (result.first) {
-                LogDebug()()("saved ")(index.ItemSize())(" bytes at position ")(
-                    index.MemoryPosition())(" for block ")
+                LogDebug()()("saving ")(index.ItemSize())(
+                    " bytes at position ")(index.MemoryPosition())(
+                    " for block ")
                     .asHex(id)
                     .Flush();
-            } else {
-                throw std::runtime_error{"Failed to update index for block"};
+                data.emplace_back(bytes);
+                files.emplace_back(location);
+            }
+
+            if (false == write(data, files)) {
+                throw std::runtime_error{"failed to write blocks"};
             }
 
             if (false == tx.Finalize(true)) {
                 throw std::runtime_error{"database error"};
             }
 
-            return {view.data(), view.size()};
+            std::ranges::transform(
+                reserved, out.begin(), [](const auto& item) -> ReadView {
+                    const auto& [_, view] = item.second;
+
+                    return {view.data(), view.size()};
+                });
         } catch (const std::exception& e) {
             LogError()()(e.what()).Flush();
-
-            return {};
+            std::ranges::fill(out, ReadView{});
         }
+
+        return out;
     }
 
     Imp(storage::lmdb::Database& lmdb, Bulk& bulk) noexcept
@@ -140,6 +197,25 @@ struct Blocks::Imp {
     }
 
 private:
+    // NOTE block hashes are uniformly distributed so walking a cursor across
+    // the range covered by a batch would visit most of the table. Instead
+    // large batches are looked up in key order, which keeps successive
+    // searches on the same branch pages of the b-tree.
+    static constexpr auto sorted_lookup_threshold_ = 64_uz;
+
+    static auto sorted_order(
+        const std::span<const block::Hash> hashes,
+        alloc::Default monotonic) noexcept -> Vector<std::size_t>
+    {
+        auto out = Vector<std::size_t>{hashes.size(), monotonic};
+        std::iota(out.begin(), out.end(), 0_uz);
+        std::ranges::sort(out, [&](const auto lhs, const auto rhs) {
+            return hashes[lhs].Bytes() < hashes[rhs].Bytes();
+        });
+
+        return out;
+    }
+
     auto check_genesis(blockchain::Type chain) noexcept -> void
     {
         const auto& id = params::get(chain).GenesisHash();
@@ -152,6 +228,18 @@ private:
             Store(id, bytes, {});  // TODO monotonic allocator
         }
     }
+    auto load_index(
+        const block::Hash& id,
+        storage::lmdb::Transaction& tx,
+        storage::file::Index& index) const noexcept -> void
+    {
+        auto cb = [&](const auto in) { index.Deserialize(in); };
+        lmdb_.Load(table_, id.Bytes(), cb, tx);
+
+        if (index.empty()) {
+            LogTrace()()("block ")(id.asHex())(" not found in index").Flush();
+        }
+    }
 };
 
 Blocks::Blocks(storage::lmdb::Database& lmdb, Bulk& bulk) noexcept
@@ -186,5 +274,13 @@ auto Blocks::Store(
     return imp_->Store(id, bytes, monotonic);
 }
 
+auto Blocks::Store(
+    std::span<const SerializedBlock> blocks,
+    alloc::Default alloc,
+    alloc::Default monotonic) const noexcept -> Vector<ReadView>
+{
+    return imp_->Store(blocks, alloc, monotonic);
+}
+
 Blocks::~Blocks() = default;
 }  // namespace opentxs::blockchain::database::common
@@ -8,6 +8,8 @@
 #include <memory>
 #include <span>
 
+#include "internal/blockchain/database/Types.hpp"
+#include "internal/util/storage/file/Types.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/util/Allocator.hpp"
@@ -58,6 +60,10 @@ public:
         const block::Hash& id,
         const ReadView bytes,
         alloc::Default monotonic) const noexcept -> ReadView;
+    auto Store(
+        std::span<const SerializedBlock> blocks,
+        alloc::Default alloc,
+        alloc::Default monotonic) const noexcept -> Vector<ReadView>;
 
     Blocks(storage::lmdb::Database& lmdb, Bulk& bulk) noexcept;
 
@@ -67,5 +73,9 @@ private:
     struct Imp;
 
     std::unique_ptr<Imp> imp_;
+
+    static auto write(
+        std::span<const ReadView> data,
+        std::span<const storage::file::Location> files) noexcept -> bool;
 };
 }  // namespace opentxs::blockchain::database::common
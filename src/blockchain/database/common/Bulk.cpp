@@ -5,14 +5,28 @@
 
 #include "blockchain/database/common/Bulk.hpp"  // IWYU pragma: associated
 
+#include <array>
 #include <cstddef>
 
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/storage/file/Mapped.hpp"
+#include "internal/util/storage/file/Types.hpp"
+#include "opentxs/util/Allocator.hpp"
 
 namespace opentxs::blockchain::database::common
 {
+// NOTE every table whose values are indices into the bulk storage files
+constexpr auto bulk_tables_ = std::array<int, 5>{
+    Table::BlockIndex,
+    Table::FilterIndexBasic,
+    Table::FilterIndexBCH,
+    Table::FilterIndexES,
+    Table::TransactionIndex,
+};
+constexpr auto compaction_batch_ = 1000_uz;
+
 Bulk::Bulk(
     storage::lmdb::Database& lmdb,
     const std::filesystem::path& path) noexcept(false)
@@ -22,8 +36,18 @@ Bulk::Bulk(
           lmdb,
           Table::Config,
           static_cast<std::size_t>(common::Database::Key::NextBlockAddress),
+          storage::file::Layout::Packed,
           {})  // TODO allocator
 {
+    auto alloc = alloc::MonotonicUnsync{};
+    Reclaim(bulk_tables_, Table::BulkFree, &alloc);
+}
+
+auto Bulk::Compact() noexcept -> bool
+{
+    auto alloc = alloc::MonotonicUnsync{};
+
+    return Mapped::Compact(compaction_batch_, &alloc);
 }
 
 Bulk::~Bulk() = default;
@@ -28,6 +28,7 @@ namespace opentxs::blockchain::database::common
 class Bulk final : public storage::file::Mapped
 {
 public:
+    auto Compact() noexcept -> bool;
     auto get_deleter() noexcept -> delete_function final
     {
         return pmr::make_deleter(this);
@@ -0,0 +1,36 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "blockchain/database/common/Compactor.hpp"  // IWYU pragma: associated
+
+#include "blockchain/database/common/BlockFilter.hpp"
+#include "blockchain/database/common/Bulk.hpp"
+#include "opentxs/api/Session.hpp"
+#include "opentxs/api/Session.internal.hpp"
+
+namespace opentxs::blockchain::database::common
+{
+Compactor::Compactor(
+    const api::Session& api,
+    BlockFilter& filters,
+    Bulk& bulk) noexcept
+    : StateMachine([this] { return state_machine(); })
+    , api_(api)
+    , filters_(filters)
+    , bulk_(bulk)
+{
+}
+
+auto Compactor::state_machine() noexcept -> bool
+{
+    if (api_.Internal().ShuttingDown()) { return false; }
+
+    if (filters_.MigrateCfilters()) { return true; }
+
+    return bulk_.Compact();
+}
+
+Compactor::~Compactor() { Stop().get(); }
+}  // namespace opentxs::blockchain::database::common
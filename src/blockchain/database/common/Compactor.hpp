@@ -0,0 +1,63 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "core/StateMachine.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs
+{
+namespace api
+{
+class Session;
+}  // namespace api
+
+namespace blockchain
+{
+namespace database
+{
+namespace common
+{
+class BlockFilter;
+class Bulk;
+}  // namespace common
+}  // namespace database
+}  // namespace blockchain
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::database::common
+{
+/** Reclaims space in the bulk storage files in the background
+ *
+ *  Each execution of the state machine either migrates one batch of cfilters
+ *  stored in the legacy format or relocates one batch of records into space
+ *  which was free when the bulk storage files were opened. Space released
+ *  while the files are open is reclaimed the next time they are opened.
+ */
+class Compactor final : public opentxs::internal::StateMachine
+{
+public:
+    Compactor(
+        const api::Session& api,
+        BlockFilter& filters,
+        Bulk& bulk) noexcept;
+    Compactor() = delete;
+    Compactor(const Compactor&) = delete;
+    Compactor(Compactor&&) = delete;
+    auto operator=(const Compactor&) -> Compactor& = delete;
+    auto operator=(Compactor&&) -> Compactor& = delete;
+
+    ~Compactor() final;
+
+private:
+    const api::Session& api_;
+    BlockFilter& filters_;
+    Bulk& bulk_;
+
+    auto state_machine() noexcept -> bool;
+};
+}  // namespace opentxs::blockchain::database::common
@@ -27,6 +27,7 @@ extern "C" {
 #include "blockchain/database/common/BlockHeaders.hpp"
 #include "blockchain/database/common/Blocks.hpp"
 #include "blockchain/database/common/Bulk.hpp"
+#include "blockchain/database/common/Compactor.hpp"
 #include "blockchain/database/common/Config.hpp"
 #include "blockchain/database/common/Peers.hpp"
 #include "blockchain/database/common/Sync.hpp"
@@ -73,6 +74,7 @@ struct Database::Imp {
     Sync sync_;
     Wallet wallet_;
     Configuration config_;
+    Compactor compactor_;
 
     static auto block_storage_enabled() noexcept -> bool
     {
@@ -227,6 +229,7 @@ struct Database::Imp {
                       {Table::FilterIndexBCH, 0},
                       {Table::FilterIndexES, 0},
                       {Table::TransactionIndex, 0},
+                      {Table::BulkFree, MDB_INTEGERKEY},
                   };
 
                   for (const auto& [table, name] : SyncTables()) {
@@ -254,10 +257,13 @@ struct Database::Imp {
         , sync_(api_, lmdb_, blocks_path_)
         , wallet_(api_, blockchain, lmdb_, bulk_)
         , config_(api_, lmdb_)
+        , compactor_(api_, filters_, bulk_)
     {
         assert_true(crypto_shorthash_KEYBYTES == siphash_key_.size());
 
         static_assert(sizeof(ElementHash) == crypto_shorthash_BYTES);
+
+        compactor_.Trigger();
     }
 };
 
@@ -286,6 +292,7 @@ const storage::lmdb::TableNames Database::Imp::table_names_ = [] {
         {Table::FilterIndexBCH, "block_filters_bch_2"},
         {Table::FilterIndexES, "block_filters_opentxs_2"},
         {Table::TransactionIndex, "transactions"},
+        {Table::BulkFree, "bulk_free_extents"},
     };
 
     for (const auto& [table, name] : SyncTables()) {
@@ -368,6 +375,14 @@ auto Database::BlockStore(
     return imp_->blocks_.Store(id, bytes, monotonic);
 }
 
+auto Database::BlockStore(
+    std::span<const SerializedBlock> blocks,
+    alloc::Default alloc,
+    alloc::Default monotonic) const noexcept -> Vector<ReadView>
+{
+    return imp_->blocks_.Store(blocks, alloc, monotonic);
+}
+
 auto Database::Confirm(
     const blockchain::Type chain,
     const network::blockchain::AddressID& id) const noexcept -> void
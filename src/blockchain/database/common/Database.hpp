@@ -103,6 +103,7 @@ public:
         SiphashKey = 2,
         NextSyncAddress = 3,
         SyncServerEndpoint = 4,
+        CfilterFormat = 5,
     };
 
     using EnabledChain = std::pair<blockchain::Type, UnallocatedCString>;
@@ -128,6 +129,10 @@ public:
         const block::Hash& id,
         const ReadView bytes,
         alloc::Default monotonic) const noexcept -> ReadView;
+    auto BlockStore(
+        std::span<const SerializedBlock> blocks,
+        alloc::Default alloc,
+        alloc::Default monotonic) const noexcept -> Vector<ReadView>;
     auto Confirm(
         const blockchain::Type chain,
         const network::blockchain::AddressID& id) const noexcept -> void;
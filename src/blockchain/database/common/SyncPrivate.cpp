@@ -133,6 +133,7 @@ SyncPrivate::SyncPrivate(
           lmdb,
           Table::Config,
           static_cast<std::size_t>(common::Database::Key::NextSyncAddress),
+          storage::file::Layout::PageAligned,
           {})  // TODO allocator
     , api_(api)
     , tip_table_(Table::SyncTips)
@@ -110,7 +110,16 @@ auto Wallet::AssociateTransaction(
 auto Wallet::ForgetTransaction(
     const block::TransactionHash& txid) const noexcept -> bool
 {
-    return lmdb_.Delete(transaction_table_, txid.Bytes());
+    try {
+        auto tx = lmdb_.TransactionRW();
+        const auto output = bulk_.Forget(transaction_table_, txid.Bytes(), tx);
+
+        return tx.Finalize(output);
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
 }
 
 auto Wallet::LoadTransaction(
@@ -244,11 +253,9 @@ auto Wallet::StoreTransaction(
             throw std::runtime_error{"Failed to write transaction to storage"};
         }
 
-        const auto sIndex = index.Serialize();
-        const auto result =
-            lmdb_.Store(transaction_table_, hash, sIndex.Bytes(), tx);
+        const auto result = bulk_.Store(transaction_table_, hash, index, tx);
 
-        if (result.first) {
+        if (result) {
             LogTrace()()("saved ")(bytes)(" bytes at position ")(
                 index.MemoryPosition())(" for transaction ")
                 .asHex(hash)
@@ -43,6 +43,14 @@ auto Blocks::Store(const block::Hash&, const ReadView, alloc::Default)
     return {};
 }
 
+auto Blocks::Store(
+    std::span<const SerializedBlock> blocks,
+    alloc::Default alloc,
+    alloc::Default) const noexcept -> Vector<ReadView>
+{
+    return Vector<ReadView>{blocks.size(), {}, alloc};
+}
+
 Blocks::~Blocks() = default;
 }  // namespace opentxs::blockchain::database::common
 
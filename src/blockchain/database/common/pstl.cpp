@@ -3,14 +3,18 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 #include "blockchain/database/common/Peers.hpp"  // IWYU pragma: associated
 
 #include <algorithm>  // IWYU pragma: keep
 #include <chrono>
 #include <compare>
 #include <execution>
+#include <iterator>
+#include <memory>
 #include <utility>
 
+#include "internal/util/storage/file/Mapped.hpp"
 #include "internal/util/storage/lmdb/Database.hpp"  // IWYU pragma: keep
 #include "internal/util/storage/lmdb/Types.hpp"
 #include "opentxs/api/Session.hpp"
@@ -20,6 +24,20 @@
 
 namespace opentxs::blockchain::database::common
 {
+auto Blocks::write(
+    std::span<const ReadView> data,
+    std::span<const storage::file::Location> files) noexcept -> bool
+{
+    using namespace std::execution;
+
+    return std::all_of(par, data.begin(), data.end(), [&](const auto& view) {
+        const auto n = static_cast<std::size_t>(
+            std::distance(data.data(), std::addressof(view)));
+
+        return storage::file::Mapped::Write(view, files[n], {});
+    });
+}
+
 auto Peers::init_chains(
     const api::Session& api,
     const Time now,
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 #include "blockchain/database/common/Peers.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
@@ -11,6 +12,7 @@
 #include <ranges>
 #include <utility>
 
+#include "internal/util/storage/file/Mapped.hpp"
 #include "internal/util/storage/lmdb/Database.hpp"  // IWYU pragma: keep
 #include "internal/util/storage/lmdb/Types.hpp"
 #include "opentxs/api/Session.hpp"
@@ -20,6 +22,13 @@
 
 namespace opentxs::blockchain::database::common
 {
+auto Blocks::write(
+    std::span<const ReadView> data,
+    std::span<const storage::file::Location> files) noexcept -> bool
+{
+    return storage::file::Mapped::Write(data, files, {});
+}
+
 auto Peers::init_chains(
     const api::Session& api,
     const Time now,
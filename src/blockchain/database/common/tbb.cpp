@@ -3,8 +3,10 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 #include "blockchain/database/common/Peers.hpp"  // IWYU pragma: associated
 
+#include <atomic>
 #include <chrono>
 #include <compare>
 #include <cstring>
@@ -13,6 +15,7 @@
 
 #include "TBB.hpp"
 #include "internal/util/P0330.hpp"
+#include "internal/util/storage/file/Mapped.hpp"
 #include "internal/util/storage/lmdb/Database.hpp"  // IWYU pragma: keep
 #include "internal/util/storage/lmdb/Types.hpp"
 #include "opentxs/api/Session.hpp"
@@ -22,6 +25,26 @@
 
 namespace opentxs::blockchain::database::common
 {
+auto Blocks::write(
+    std::span<const ReadView> data,
+    std::span<const storage::file::Location> files) noexcept -> bool
+{
+    auto failed = std::atomic_bool{false};
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>{0_uz, data.size()},
+        [&](const auto& r) {
+            const auto count = r.size();
+            const auto written = storage::file::Mapped::Write(
+                data.subspan(r.begin(), count),
+                files.subspan(r.begin(), count),
+                {});
+
+            if (false == written) { failed.store(true); }
+        });
+
+    return false == failed.load();
+}
+
 auto Peers::init_chains(
     const api::Session& api,
     const Time now,
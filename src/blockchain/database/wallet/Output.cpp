@@ -16,10 +16,8 @@
 #include <functional>
 #include <iterator>
 #include <memory>
-#include <numeric>
 #include <optional>
 #include <ranges>
-#include <span>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
@@ -112,6 +110,8 @@ Output::Output(
 
         return out;
     }())
+    , published_balance_()
+    , published_balances_()
 {
 }
 
@@ -778,38 +778,21 @@ auto Output::get_balance(
     const AccountID& account,
     const crypto::Key* key) const noexcept -> Balance
 {
-    auto output = Balance{};
-    auto& [confirmed, unconfirmed] = output;
-    const auto* pNym = owner.empty() ? nullptr : &owner;
-    const auto* pAcct = account.empty() ? nullptr : &account;
-    auto cb = [&](const auto previous, const auto& outpoint) -> auto {
-        const auto& existing = cache.GetOutput(outpoint);
+    // NOTE if a more specific condition is requested then more general
+    // conditions are ignored, the same as in match()
+    if (nullptr != key) {
 
-        return previous + existing.Value();
-    };
+        return cache.GetBalance(*key);
+    } else if (false == account.empty()) {
 
-    const auto unconfirmedSpendTotal = [&] {
-        const auto txos =
-            match(cache, {UnconfirmedSpend}, pNym, pAcct, nullptr, key);
+        return cache.GetBalance(account);
+    } else if (false == owner.empty()) {
 
-        return std::accumulate(txos.begin(), txos.end(), Amount{0}, cb);
-    }();
-
-    {
-        const auto txos =
-            match(cache, {ConfirmedNew}, pNym, pAcct, nullptr, key);
-        confirmed = unconfirmedSpendTotal +
-                    std::accumulate(txos.begin(), txos.end(), Amount{0}, cb);
-    }
+        return cache.GetBalance(owner);
+    } else {
 
-    {
-        const auto txos =
-            match(cache, {UnconfirmedNew}, pNym, pAcct, nullptr, key);
-        unconfirmed = std::accumulate(txos.begin(), txos.end(), confirmed, cb) -
-                      unconfirmedSpendTotal;
+        return cache.GetBalance();
     }
-
-    return output;
 }
 
 auto Output::get_balances(const OutputCache& cache) const noexcept
@@ -817,8 +800,8 @@ auto Output::get_balances(const OutputCache& cache) const noexcept
 {
     auto output = NymBalances{};
 
-    for (const auto& nym : cache.GetNyms()) {
-        output[nym] = get_balance(cache, nym);
+    for (const auto& [nym, balance] : cache.GetBalances()) {
+        output.emplace(nym, balance);
     }
 
     return output;
@@ -1143,61 +1126,6 @@ auto Output::match(
     return output;
 }
 
-auto Output::pick_one(
-    const OutputCache& cache,
-    const identifier::Nym& spender,
-    const Outpoints& in,
-    Reserved& reserved,
-    std::optional<node::TxoTag> required,
-    alloc::Strategy alloc) noexcept
-    -> std::pair<std::optional<block::Outpoint>, bool>
-{
-    if (in.empty()) { return {std::nullopt, false}; }
-
-    const auto owned = [&] {
-        const auto& byNym = cache.GetNym(spender);
-        auto out = Vector<block::Outpoint>{alloc.work_};
-        out.reserve(std::min(in.size(), byNym.size()));
-        out.clear();
-        std::ranges::set_intersection(in, byNym, std::back_inserter(out));
-
-        return out;
-    }();
-
-    if (owned.empty()) { return {std::nullopt, false}; }
-
-    const auto available = [&] {
-        auto out = Vector<block::Outpoint>{alloc.work_};
-        out.reserve(owned.size());
-        out.clear();
-        std::ranges::set_difference(owned, reserved, std::back_inserter(out));
-
-        return out;
-    }();
-
-    if (available.empty()) { return {std::nullopt, false}; }
-
-    const auto sorted = sort_fifo(cache, available, alloc.WorkOnly());
-    const auto acceptable = [&](const auto& id) {
-        if (required.has_value()) {
-
-            return cache.GetOutput(id).Internal().Tags().contains(*required);
-        } else {
-
-            return true;
-        }
-    };
-    const auto selected = std::ranges::find_if(sorted, acceptable);
-
-    if (sorted.end() == selected) {
-
-        return std::make_pair(std::nullopt, true);
-    } else {
-
-        return std::make_pair(*selected, false);
-    }
-}
-
 auto Output::process(
     const Log& log,
     const AccountID& account,
@@ -1288,35 +1216,37 @@ auto Output::process_modify(
 
 auto Output::PublishBalance() const noexcept -> void
 {
-    publish_balance(cache());
+    const auto& cache = this->cache();
+    auto handle = to_balance_oracle_.lock();
+    auto& socket = *handle;
+    send_balance(socket, cache.GetBalance(), nullptr);
+
+    for (const auto& [nym, balance] : cache.GetBalances()) {
+        send_balance(socket, balance, std::addressof(nym));
+    }
 }
 
 auto Output::publish_balance(const OutputCache& cache) const noexcept -> void
 {
-    const auto total = get_balance(cache);
-    const auto byNym = get_balances(cache);
+    // NOTE only balances which changed since the previous call are sent.
+    // PublishBalance() is available to resend everything.
     auto handle = to_balance_oracle_.lock();
-    handle->SendDeferred([&] {
-        auto out = MakeWork(OT_ZMQ_BALANCE_ORACLE_SUBMIT);
-        out.AddFrame(chain_);
-        out.AddFrame(total.first);
-        out.AddFrame(total.second);
+    auto& socket = *handle;
 
-        return out;
-    }());
+    if (const auto& total = cache.GetBalance(); published_balance_ != total) {
+        send_balance(socket, total, nullptr);
+        published_balance_ = total;
+    }
 
-    for (const auto& [nym, balance] : byNym) {
-        // NOLINTBEGIN(clang-analyzer-core.CallAndMessage)
-        handle->SendDeferred([&]() {
-            auto out = MakeWork(OT_ZMQ_BALANCE_ORACLE_SUBMIT);
-            out.AddFrame(chain_);
-            out.AddFrame(balance.first);
-            out.AddFrame(balance.second);
-            out.AddFrame(nym);
+    for (const auto& [nym, balance] : cache.GetBalances()) {
+        auto i = published_balances_.find(nym);
 
-            return out;
-        }());
-        // NOLINTEND(clang-analyzer-core.CallAndMessage)
+        if ((published_balances_.end() != i) && (i->second == balance)) {
+            continue;
+        }
+
+        send_balance(socket, balance, std::addressof(nym));
+        published_balances_.insert_or_assign(i, nym, balance);
     }
 }
 
@@ -1359,24 +1289,24 @@ auto Output::ReserveUTXO(
     const identifier::Nym& spender,
     const identifier::Generic& proposal,
     const node::internal::SpendPolicy& policy,
-    alloc::Strategy alloc) noexcept -> std::pair<std::optional<UTXO>, bool>
+    alloc::Strategy) noexcept -> std::pair<std::optional<UTXO>, bool>
 {
     const auto& crypto = api_.Crypto();
-    log()("reserving outputs for proposal ")(proposal, crypto).Flush();
+    log()("reserving outputs for proposal ")(proposal, crypto)(" using ")(
+        print(policy.selection_))(" selection")
+        .Flush();
     static const auto blank =
         std::make_pair(std::optional<UTXO>{std::nullopt}, false);
     auto output = blank;
     auto& cache = this->cache();
 
     try {
-        // TODO implement smarter selection algorithm using policy
         auto tx = lmdb_.TransactionRW();
-        auto reserved = cache.GetReserved(alloc.WorkOnly());
         const auto select =
-            [&](const auto& outputs,
+            [&](const auto state,
                 const auto required) -> std::pair<std::optional<UTXO>, bool> {
             const auto outpoint =
-                pick_one(cache, spender, outputs, reserved, required, alloc);
+                cache.Select(spender, state, policy, required);
 
             if (outpoint.first.has_value()) {
 
@@ -1388,9 +1318,9 @@ auto Output::ReserveUTXO(
                 return blank;
             }
         };
-        const auto& confirmed = cache.GetState(ConfirmedNew);
-        log()(confirmed.size())(" confirmed outputs available").Flush();
-        output = select(confirmed, std::nullopt);
+        const auto& confirmed = cache.GetSpendable(spender, ConfirmedNew);
+        log()(confirmed.by_age_.size())(" confirmed outputs available").Flush();
+        output = select(ConfirmedNew, std::nullopt);
         const auto spendUnconfirmed =
             policy.unconfirmed_incoming_ || policy.unconfirmed_change_;
 
@@ -1401,11 +1331,13 @@ auto Output::ReserveUTXO(
             if (changeOnly) { log(", limited to change outputs only"); }
 
             log.Flush();
-            const auto& unconfirmed = cache.GetState(UnconfirmedNew);
-            log()(unconfirmed.size())(" unconfirmed outputs available").Flush();
+            const auto& unconfirmed =
+                cache.GetSpendable(spender, UnconfirmedNew);
+            log()(unconfirmed.by_age_.size())(" unconfirmed outputs available")
+                .Flush();
             constexpr auto changeTag = std::make_optional(node::TxoTag::Change);
             const auto tag = changeOnly ? changeTag : std::nullopt;
-            output = select(unconfirmed, tag);
+            output = select(UnconfirmedNew, tag);
         }
 
         if (output.first.has_value()) {
@@ -1453,30 +1385,23 @@ auto Output::ReserveUTXO(
     }
 }
 
-auto Output::sort_fifo(
-    const OutputCache& cache,
-    std::span<const block::Outpoint> in,
-    alloc::Strategy alloc) noexcept -> Vector<block::Outpoint>
+auto Output::send_balance(
+    network::zeromq::socket::Raw& socket,
+    const Balance& balance,
+    const identifier::Nym* nym) const noexcept -> void
 {
-    auto counter = 0_uz;
-    auto map = Map<block::Position, Set<block::Outpoint>>{alloc.work_};
-    map.clear();
-
-    for (const auto& id : in) {
-        const auto& output = cache.GetOutput(id);
-        map[output.Internal().MinedPosition()].emplace(id);
-        ++counter;
-    }
-
-    auto out = Vector<block::Outpoint>{alloc.result_};
-    out.reserve(counter);
-    out.clear();
+    // NOLINTBEGIN(clang-analyzer-core.CallAndMessage)
+    socket.SendDeferred([&]() {
+        auto out = MakeWork(OT_ZMQ_BALANCE_ORACLE_SUBMIT);
+        out.AddFrame(chain_);
+        out.AddFrame(balance.first);
+        out.AddFrame(balance.second);
 
-    for (const auto& [position, set] : map) {
-        for (const auto& id : set) { out.emplace_back(id); }
-    }
+        if (nullptr != nym) { out.AddFrame(*nym); }
 
-    return out;
+        return out;
+    }());
+    // NOLINTEND(clang-analyzer-core.CallAndMessage)
 }
 
 auto Output::StartReorg(
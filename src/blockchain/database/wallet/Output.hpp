@@ -7,7 +7,6 @@
 
 #include <cs_plain_guarded.h>
 #include <optional>
-#include <span>
 #include <utility>
 
 #include "blockchain/database/wallet/OutputCache.hpp"
@@ -219,6 +218,8 @@ private:
     const block::Height maturation_target_;
     mutable OutputCache cache_dont_use_without_populating_;
     mutable GuardedSocket to_balance_oracle_;
+    mutable std::optional<Balance> published_balance_;
+    mutable NymBalances published_balances_;
 
     [[nodiscard]] static auto get_inputs(
         const block::Transaction& transaction,
@@ -228,18 +229,6 @@ private:
         alloc::Strategy alloc) noexcept(false) -> Outpoints;
     [[nodiscard]] static auto is_confirmed(node::TxoState state) noexcept
         -> bool;
-    [[nodiscard]] static auto pick_one(
-        const OutputCache& cache,
-        const identifier::Nym& spender,
-        const Outpoints& in,
-        Reserved& reserved,
-        std::optional<node::TxoTag> required,
-        alloc::Strategy alloc) noexcept
-        -> std::pair<std::optional<block::Outpoint>, bool>;
-    [[nodiscard]] static auto sort_fifo(
-        const OutputCache& cache,
-        std::span<const block::Outpoint> in,
-        alloc::Strategy alloc) noexcept -> Vector<block::Outpoint>;
     [[nodiscard]] static auto states(node::TxoState in) noexcept -> States;
     static auto validate_inputs(
         const OutputCache& cache,
@@ -413,6 +402,10 @@ private:
         OutputCache& cache,
         storage::lmdb::Transaction& tx,
         alloc::Strategy alloc) const noexcept(false) -> void;
+    auto send_balance(
+        network::zeromq::socket::Raw& socket,
+        const Balance& balance,
+        const identifier::Nym* nym) const noexcept -> void;
     auto transaction_success(storage::lmdb::Transaction& tx) const
         noexcept(false) -> bool;
     [[nodiscard]] auto translate(Vector<UTXO>&& outputs) const noexcept
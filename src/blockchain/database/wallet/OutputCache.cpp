@@ -27,6 +27,7 @@
 #include "blockchain/database/wallet/Position.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/database/Types.hpp"
+#include "internal/blockchain/node/SpendPolicy.hpp"
 #include "internal/blockchain/protocol/bitcoin/base/block/Factory.hpp"
 #include "internal/blockchain/protocol/bitcoin/base/block/Output.hpp"
 #include "internal/util/TSV.hpp"
@@ -41,6 +42,7 @@
 #include "opentxs/blockchain/block/Outpoint.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/crypto/Types.hpp"
+#include "opentxs/blockchain/node/CoinSelection.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/node/TxoState.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/node/Types.hpp"
 #include "opentxs/blockchain/protocol/bitcoin/base/block/Output.hpp"
@@ -82,6 +84,24 @@ auto OutputCache::load_output_index(const MapKeyType& key, MapType& map)
 
     return empty_outputs_;
 }
+
+template <typename MapKeyType, typename MapType>
+auto OutputCache::get_spendable(
+    const MapKeyType& key,
+    node::TxoState state,
+    const MapType& map) noexcept -> const Spendable&
+{
+    if (auto i = map.find(key); map.end() != i) {
+        const auto& states = i->second;
+
+        if (auto j = states.find(state); states.end() != j) {
+
+            return j->second;
+        }
+    }
+
+    return empty_spendable_;
+}
 }  // namespace opentxs::blockchain::database::wallet
 
 namespace opentxs::blockchain::database::wallet
@@ -91,6 +111,7 @@ using enum storage::lmdb::Dir;
 
 const Outpoints OutputCache::empty_outputs_{};
 const Nyms OutputCache::empty_nyms_{};
+const OutputCache::Spendable OutputCache::empty_spendable_{};
 
 OutputCache::OutputCache(
     const api::Session& api,
@@ -114,6 +135,14 @@ OutputCache::OutputCache(
     , output_to_proposal_()
     , created_by_proposal_()
     , consumed_by_proposal_()
+    , owners_()
+    , balance_()
+    , nym_balances_()
+    , account_balances_()
+    , key_balances_()
+    , spendable_()
+    , nym_spendable_()
+    , account_spendable_()
     , populated_(false)
 {
     outputs_.reserve(reserve_);
@@ -121,6 +150,12 @@ OutputCache::OutputCache(
     positions_.reserve(reserve_);
 }
 
+auto OutputCache::add(const Balance& in, Balance& out) noexcept(false) -> void
+{
+    out.first += in.first;
+    out.second += in.second;
+}
+
 auto OutputCache::AddGenerationOutput(
     block::Height height,
     const block::Outpoint& output,
@@ -195,7 +230,11 @@ auto OutputCache::AddToAccount(
             throw std::runtime_error{"Failed to update account index"};
         }
 
-        set.emplace(output);
+        if (set.emplace(output).second) {
+            owners_[output].accounts_.emplace_back(id);
+            add(current_balance(output), account_balances_[id]);
+            update_spendable(output);
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -223,7 +262,10 @@ auto OutputCache::AddToKey(
             throw std::runtime_error{"Failed to update key index"};
         }
 
-        set.emplace(output);
+        if (set.emplace(output).second) {
+            owners_[output].keys_.emplace_back(id);
+            add(current_balance(output), key_balances_[id]);
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -251,7 +293,14 @@ auto OutputCache::AddToNym(
 
     if (false == rc) { throw std::runtime_error{"Failed to update nym index"}; }
 
-    index.emplace(output);
+    if (index.emplace(output).second) {
+        owners_[output].nyms_.emplace_back(id);
+        add(current_balance(output), nym_balances_[id]);
+        update_spendable(output);
+    } else {
+        nym_balances_.try_emplace(id);
+    }
+
     list.emplace(id);
 }
 
@@ -294,6 +343,7 @@ auto OutputCache::AddToState(
     assert_true(0 < outputs_.count(output));
 
     try {
+        const auto previous = get_state(output);
         auto& set = load_output_index(id, states_);
         auto rc = lmdb_
                       .Store(
@@ -309,6 +359,11 @@ auto OutputCache::AddToState(
 
         set.emplace(output);
 
+        if (false == previous.has_value()) {
+            update_balance(output, std::nullopt, id);
+            update_spendable(output);
+        }
+
         return true;
     } catch (const std::exception& e) {
         LogError()()(e.what()).Flush();
@@ -389,11 +444,92 @@ auto OutputCache::associate_proposal(
     }
 
     map.emplace(output, proposal);
+    update_spendable(output);
     log()("associated ")((kind == Kind::create) ? "created" : "consumed")(
         " output ")(output.str())(" to proposal ")(proposal, crypto)
         .Flush();
 }
 
+auto OutputCache::branch_and_bound(
+    const Set<Spendable::Valued>& byValue,
+    const node::internal::SpendPolicy& policy) noexcept
+    -> std::optional<block::Outpoint>
+{
+    // NOTE searches for a set of outputs whose value after input fees is at
+    // least the target but less than the target plus the cost of change. Each
+    // call returns the largest member of the first such set found and the next
+    // call repeats the search for whatever remains.
+    try {
+        const auto& target = policy.target_;
+        const auto upper = target + policy.change_cost_;
+        auto values = Vector<Amount>{};
+        auto ids = Vector<const block::Outpoint*>{};
+        auto available = Amount{0};
+        values.reserve(max_candidates_);
+        ids.reserve(max_candidates_);
+        // NOTE an output larger than the window can not be part of any match
+        const auto limit = byValue.lower_bound(
+            Spendable::Valued{upper + policy.input_cost_, {}});
+
+        // NOTE only the largest outputs inside the window are candidates so
+        // the cost of collecting them does not depend on the size of the
+        // wallet
+        for (auto i = std::make_reverse_iterator(limit);
+             (i != byValue.rend()) && (values.size() < max_candidates_);
+             ++i) {
+            const auto& [value, id] = *i;
+            const auto effective = value - policy.input_cost_;
+
+            if (effective <= 0) { break; }
+
+            values.emplace_back(effective);
+            ids.emplace_back(std::addressof(id));
+            available += effective;
+        }
+
+        if (available < target) { return std::nullopt; }
+
+        auto selection = Vector<bool>{};
+        auto current = Amount{0};
+        selection.reserve(values.size());
+
+        for (auto step = 0_uz; step < max_search_steps_; ++step) {
+            if ((current + available < target) || (current >= upper)) {
+                while ((false == selection.empty()) &&
+                       (false == selection.back())) {
+                    selection.pop_back();
+                    available += values[selection.size()];
+                }
+
+                if (selection.empty()) { break; }
+
+                selection.back() = false;
+                current -= values[selection.size() - 1_uz];
+            } else if (current >= target) {
+                const auto first = std::ranges::find(selection, true);
+
+                assert_true(selection.end() != first);
+
+                return *ids[std::distance(selection.begin(), first)];
+            } else {
+                const auto next = selection.size();
+
+                assert_true(next < values.size());
+
+                available -= values[next];
+                current += values[next];
+                selection.emplace_back(true);
+            }
+        }
+
+        return std::nullopt;
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return std::nullopt;
+    }
+}
+
 auto OutputCache::ChangePosition(
     const block::Position& oldPosition,
     const block::Position& newPosition,
@@ -449,6 +585,8 @@ auto OutputCache::ChangeState(
     try {
         for (const auto state : all_states()) { GetState(state); }
 
+        const auto previous = get_state(id);
+
         auto deleted = UnallocatedVector<node::TxoState>{};
 
         for (const auto state : all_states()) {
@@ -496,6 +634,8 @@ auto OutputCache::ChangeState(
 
         auto& to = states_[newState];
         to.emplace(id);
+        update_balance(id, previous, newState);
+        update_spendable(id);
 
         return rc;
     } catch (const std::exception& e) {
@@ -531,6 +671,14 @@ auto OutputCache::Clear() noexcept -> void
     positions_.clear();
     states_.clear();
     subchains_.clear();
+    owners_.clear();
+    balance_ = {};
+    nym_balances_.clear();
+    account_balances_.clear();
+    key_balances_.clear();
+    spendable_.clear();
+    nym_spendable_.clear();
+    account_spendable_.clear();
     populated_ = false;
 }
 
@@ -564,6 +712,32 @@ auto OutputCache::ConsumeOutput(
     associate_proposal(log, output, proposal, Kind::consume, tx);
 }
 
+auto OutputCache::contribution(
+    std::optional<node::TxoState> state,
+    const Amount& value) noexcept -> Balance
+{
+    // NOTE outputs being spent by an unconfirmed transaction still count
+    // towards the confirmed balance but not the unconfirmed balance
+    switch (state.value_or(node::TxoState::Error)) {
+        case node::TxoState::ConfirmedNew: {
+
+            return {value, value};
+        }
+        case node::TxoState::UnconfirmedNew: {
+
+            return {Amount{0}, value};
+        }
+        case node::TxoState::UnconfirmedSpend: {
+
+            return {value, Amount{0}};
+        }
+        default: {
+
+            return {};
+        }
+    }
+}
+
 auto OutputCache::CreateOutput(
     const Log& log,
     const identifier::Generic& proposal,
@@ -594,6 +768,16 @@ auto OutputCache::CreateOutput(
     associate_proposal(log, output, proposal, Kind::create, tx);
 }
 
+auto OutputCache::current_balance(const block::Outpoint& id) const
+    noexcept(false) -> Balance
+{
+    const auto state = get_state(id);
+
+    if (false == state.has_value()) { return {}; }
+
+    return contribution(state, load_output(id).Value());
+}
+
 auto OutputCache::DeleteGenerationAbove(
     block::Height good,
     OrphanedGeneration& out,
@@ -667,6 +851,7 @@ auto OutputCache::dissociate_proposal(
     }
 
     map.erase(output);
+    update_spendable(output);
     log()("dissociating output ")(output.str())(" from proposal ")(
         proposal, crypto)
         .Flush();
@@ -783,6 +968,47 @@ auto OutputCache::GetAssociation(
     }
 }
 
+auto OutputCache::GetBalance() const noexcept -> const Balance&
+{
+    return balance_;
+}
+
+auto OutputCache::GetBalance(const identifier::Nym& id) const noexcept
+    -> Balance
+{
+    if (auto i = nym_balances_.find(id); nym_balances_.end() != i) {
+
+        return i->second;
+    }
+
+    return {};
+}
+
+auto OutputCache::GetBalance(const AccountID& id) const noexcept -> Balance
+{
+    if (auto i = account_balances_.find(id); account_balances_.end() != i) {
+
+        return i->second;
+    }
+
+    return {};
+}
+
+auto OutputCache::GetBalance(const crypto::Key& id) const noexcept -> Balance
+{
+    if (auto i = key_balances_.find(id); key_balances_.end() != i) {
+
+        return i->second;
+    }
+
+    return {};
+}
+
+auto OutputCache::GetBalances() const noexcept -> const NymBalances&
+{
+    return nym_balances_;
+}
+
 auto OutputCache::GetConsumed(const identifier::Generic& id) const noexcept
     -> const Outpoints&
 {
@@ -937,18 +1163,80 @@ auto OutputCache::GetReserved(
     return out;
 }
 
+auto OutputCache::GetSpendable(
+    const identifier::Nym& id,
+    node::TxoState state) const noexcept -> const Spendable&
+{
+    return get_spendable(id, state, nym_spendable_);
+}
+
+auto OutputCache::GetSpendable(const AccountID& id, node::TxoState state)
+    const noexcept -> const Spendable&
+{
+    return get_spendable(id, state, account_spendable_);
+}
+
 auto OutputCache::GetState(const node::TxoState id) const noexcept
     -> const Outpoints&
 {
     return load_output_index(id, states_);
 }
 
+auto OutputCache::get_state(const block::Outpoint& id) const noexcept
+    -> std::optional<node::TxoState>
+{
+    for (const auto& [state, outputs] : states_) {
+        if (outputs.contains(id)) { return state; }
+    }
+
+    return std::nullopt;
+}
+
 auto OutputCache::GetSubchain(const SubchainID& id) const noexcept
     -> const Outpoints&
 {
     return load_output_index(id, subchains_);
 }
 
+auto OutputCache::index_spendable(
+    const block::Outpoint& id,
+    const SpendableEntry& entry,
+    bool add,
+    Spendable& index) noexcept -> void
+{
+    const auto aged = Spendable::Aged{entry.position_, id};
+    const auto valued = Spendable::Valued{entry.value_, id};
+
+    if (add) {
+        index.by_age_.emplace(aged);
+        index.by_value_.emplace(valued);
+
+        for (const auto tag : entry.tags_) {
+            index.by_tag_age_[tag].emplace(aged);
+            index.by_tag_value_[tag].emplace(valued);
+        }
+    } else {
+        index.by_age_.erase(aged);
+        index.by_value_.erase(valued);
+
+        for (const auto tag : entry.tags_) {
+            if (auto i = index.by_tag_age_.find(tag);
+                index.by_tag_age_.end() != i) {
+                i->second.erase(aged);
+
+                if (i->second.empty()) { index.by_tag_age_.erase(i); }
+            }
+
+            if (auto i = index.by_tag_value_.find(tag);
+                index.by_tag_value_.end() != i) {
+                i->second.erase(valued);
+
+                if (i->second.empty()) { index.by_tag_value_.erase(i); }
+            }
+        }
+    }
+}
+
 auto OutputCache::is_finished(const identifier::Generic& proposal) noexcept
     -> bool
 {
@@ -975,6 +1263,39 @@ auto OutputCache::is_finished(const identifier::Generic& proposal) noexcept
     }
 }
 
+auto OutputCache::is_reserved(const block::Outpoint& id) const noexcept -> bool
+{
+    const auto [start, limit] = output_to_proposal_.equal_range(id);
+    const auto consumes = [&, this](const auto& item) {
+        const auto& map = consumed_by_proposal_;
+
+        if (auto i = map.find(item.second); map.end() != i) {
+
+            return i->second.contains(id);
+        } else {
+
+            return false;
+        }
+    };
+
+    return std::any_of(start, limit, consumes);
+}
+
+auto OutputCache::is_spendable(node::TxoState state) noexcept -> bool
+{
+    switch (state) {
+        case node::TxoState::ConfirmedNew:
+        case node::TxoState::UnconfirmedNew: {
+
+            return true;
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
 auto OutputCache::load_output(const block::Outpoint& id) const noexcept(false)
     -> const protocol::bitcoin::base::block::Output&
 {
@@ -1183,6 +1504,8 @@ auto OutputCache::Populate() noexcept -> void
 
     assert_true(outputs_.size() == outputCount);
 
+    rebuild_balances();
+    rebuild_spendable();
     populated_ = true;
 }
 
@@ -1410,6 +1733,62 @@ auto OutputCache::Print() const noexcept -> void
     log.Flush();
 }
 
+auto OutputCache::rebuild_balances() noexcept -> void
+{
+    owners_.clear();
+    balance_ = {};
+    nym_balances_.clear();
+    account_balances_.clear();
+    key_balances_.clear();
+
+    for (const auto& [nym, outputs] : nyms_) {
+        nym_balances_.try_emplace(nym);
+
+        for (const auto& id : outputs) { owners_[id].nyms_.emplace_back(nym); }
+    }
+
+    for (const auto& [account, outputs] : accounts_) {
+        account_balances_.try_emplace(account);
+
+        for (const auto& id : outputs) {
+            owners_[id].accounts_.emplace_back(account);
+        }
+    }
+
+    for (const auto& [key, outputs] : keys_) {
+        key_balances_.try_emplace(key);
+
+        for (const auto& id : outputs) { owners_[id].keys_.emplace_back(key); }
+    }
+
+    try {
+        for (const auto& [state, outputs] : states_) {
+            for (const auto& id : outputs) {
+                update_balance(id, std::nullopt, state);
+            }
+        }
+    } catch (const std::exception& e) {
+        LogError()()("failed to calculate balances: ")(e.what()).Flush();
+    }
+}
+
+auto OutputCache::rebuild_spendable() noexcept -> void
+{
+    spendable_.clear();
+    nym_spendable_.clear();
+    account_spendable_.clear();
+
+    try {
+        for (const auto& [state, outputs] : states_) {
+            if (false == is_spendable(state)) { continue; }
+
+            for (const auto& id : outputs) { update_spendable(id); }
+        }
+    } catch (const std::exception& e) {
+        LogError()()("failed to index spendable outputs: ")(e.what()).Flush();
+    }
+}
+
 auto OutputCache::Release(
     const Log& log,
     const block::Outpoint& output,
@@ -1438,12 +1817,182 @@ auto OutputCache::Release(
     dissociate_proposal(log, output, proposal, tx);
 }
 
+auto OutputCache::Select(
+    const identifier::Nym& spender,
+    node::TxoState state,
+    const node::internal::SpendPolicy& policy,
+    std::optional<node::TxoTag> required) const noexcept
+    -> std::pair<std::optional<block::Outpoint>, bool>
+{
+    // NOTE the spendable index excludes reserved outputs and is kept in
+    // both orderings so every strategy starts with a single tree lookup
+    const auto& index = GetSpendable(spender, state);
+
+    if (index.by_age_.empty()) { return {std::nullopt, false}; }
+
+    if (false == required.has_value()) {
+
+        return {select_one(index.by_age_, index.by_value_, policy), false};
+    }
+
+    const auto& byAge = index.by_tag_age_;
+    const auto& byValue = index.by_tag_value_;
+    const auto i = byAge.find(*required);
+    const auto j = byValue.find(*required);
+
+    if ((byAge.end() == i) || (byValue.end() == j) || i->second.empty()) {
+
+        return std::make_pair(std::nullopt, true);
+    }
+
+    return {select_one(i->second, j->second, policy), false};
+}
+
+auto OutputCache::select_one(
+    const Set<Spendable::Aged>& byAge,
+    const Set<Spendable::Valued>& byValue,
+    const node::internal::SpendPolicy& policy) noexcept -> block::Outpoint
+{
+    switch (policy.selection_) {
+        case node::CoinSelection::Largest: {
+
+            return byValue.rbegin()->second;
+        }
+        case node::CoinSelection::BranchAndBound: {
+            const auto& target = policy.target_;
+
+            if (target <= 0) { return byAge.begin()->second; }
+
+            if (auto match = branch_and_bound(byValue, policy); match) {
+
+                return *match;
+            }
+
+            // NOTE if no combination funds the transaction without change
+            // then the smallest output which covers the target minimizes the
+            // change, otherwise the largest output is included and the next
+            // call continues with what remains
+            const auto key = Spendable::Valued{target, {}};
+
+            if (auto i = byValue.lower_bound(key); byValue.end() != i) {
+
+                return i->second;
+            } else {
+
+                return byValue.rbegin()->second;
+            }
+        }
+        case node::CoinSelection::Oldest:
+        default: {
+
+            return byAge.begin()->second;
+        }
+    }
+}
+
 auto OutputCache::UpdateOutput(
     const block::Outpoint& id,
     const protocol::bitcoin::base::block::Output& output,
     storage::lmdb::Transaction& tx) noexcept -> bool
 {
-    return write_output(id, output, tx);
+    if (false == write_output(id, output, tx)) { return false; }
+
+    try {
+        // NOTE the mined position and tags of the output may have changed
+        update_spendable(id);
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto OutputCache::update_balance(
+    const block::Outpoint& id,
+    std::optional<node::TxoState> from,
+    std::optional<node::TxoState> to) noexcept(false) -> void
+{
+    const auto& value = load_output(id).Value();
+    const auto before = contribution(from, value);
+    const auto after = contribution(to, value);
+
+    if (before == after) { return; }
+
+    const auto apply = [&](Balance& out) {
+        out.first += after.first;
+        out.first -= before.first;
+        out.second += after.second;
+        out.second -= before.second;
+    };
+    apply(balance_);
+
+    if (auto i = owners_.find(id); owners_.end() != i) {
+        const auto& [nyms, accounts, keys] = i->second;
+
+        for (const auto& nym : nyms) { apply(nym_balances_[nym]); }
+
+        for (const auto& account : accounts) {
+            apply(account_balances_[account]);
+        }
+
+        for (const auto& key : keys) { apply(key_balances_[key]); }
+    }
+}
+
+auto OutputCache::update_spendable(const block::Outpoint& id) noexcept(false)
+    -> void
+{
+    const auto owners = owners_.find(id);
+    const auto apply = [&, this](const SpendableEntry& entry, bool add) {
+        if (owners_.end() == owners) { return; }
+
+        const auto& [nyms, accounts, keys] = owners->second;
+
+        for (const auto& nym : nyms) {
+            if (add) {
+                index_spendable(
+                    id, entry, add, nym_spendable_[nym][entry.state_]);
+            } else if (auto i = nym_spendable_.find(nym);
+                       nym_spendable_.end() != i) {
+                index_spendable(id, entry, add, i->second[entry.state_]);
+            }
+        }
+
+        for (const auto& account : accounts) {
+            if (add) {
+                index_spendable(
+                    id, entry, add, account_spendable_[account][entry.state_]);
+            } else if (auto i = account_spendable_.find(account);
+                       account_spendable_.end() != i) {
+                index_spendable(id, entry, add, i->second[entry.state_]);
+            }
+        }
+    };
+
+    if (auto i = spendable_.find(id); spendable_.end() != i) {
+        apply(i->second, false);
+        spendable_.erase(i);
+    }
+
+    const auto state = get_state(id);
+
+    if (false == state.has_value()) { return; }
+
+    if (false == is_spendable(*state)) { return; }
+
+    if (is_reserved(id)) { return; }
+
+    const auto& output = load_output(id).Internal();
+    const auto [i, added] = spendable_.try_emplace(
+        id,
+        SpendableEntry{
+            *state, output.MinedPosition(), output.Value(), output.Tags()});
+
+    assert_true(added);
+
+    apply(i->second, true);
 }
 
 auto OutputCache::UpdatePosition(
@@ -1498,7 +2047,11 @@ auto OutputCache::write_output(
 
                 return keys_[key];
             }();
-            cache.emplace(id);
+
+            if (cache.emplace(id).second) {
+                owners_[id].keys_.emplace_back(key);
+                add(current_balance(id), key_balances_[key]);
+            }
         }
 
         const auto serialized = [&] {
@@ -19,6 +19,7 @@
 #include "opentxs/blockchain/block/Types.internal.hpp"
 #include "opentxs/blockchain/crypto/Types.hpp"
 #include "opentxs/blockchain/node/Types.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/identifier/Generic.hpp"
 #include "opentxs/identifier/Nym.hpp"
 #include "opentxs/util/Allocator.hpp"
@@ -35,6 +36,14 @@ class Session;
 
 namespace blockchain
 {
+namespace node
+{
+namespace internal
+{
+struct SpendPolicy;
+}  // namespace internal
+}  // namespace node
+
 namespace protocol
 {
 namespace bitcoin
@@ -66,10 +75,31 @@ namespace opentxs::blockchain::database::wallet
 class OutputCache
 {
 public:
+    using NymBalances = MapType<identifier::Nym, Balance>;
+
+    /// Unreserved outputs in a spendable state ordered by mined position and
+    /// by value, with the same orderings repeated for every tag
+    struct Spendable {
+        using Aged = std::pair<block::Position, block::Outpoint>;
+        using Valued = std::pair<Amount, block::Outpoint>;
+
+        Set<Aged> by_age_{};
+        Set<Valued> by_value_{};
+        Map<node::TxoTag, Set<Aged>> by_tag_age_{};
+        Map<node::TxoTag, Set<Valued>> by_tag_value_{};
+    };
+
     auto Exists(const block::Outpoint& id) const noexcept -> bool;
     auto Exists(const SubchainID& subchain, const block::Outpoint& id)
         const noexcept -> bool;
     auto GetAccount(const AccountID& id) const noexcept -> const Outpoints&;
+    /// Balances are maintained as outputs are added, change state, or are
+    /// associated with an owner so none of these functions iterate outputs
+    auto GetBalance() const noexcept -> const Balance&;
+    auto GetBalance(const identifier::Nym& id) const noexcept -> Balance;
+    auto GetBalance(const AccountID& id) const noexcept -> Balance;
+    auto GetBalance(const crypto::Key& id) const noexcept -> Balance;
+    auto GetBalances() const noexcept -> const NymBalances&;
     auto GetAssociation(
         const identifier::Generic& proposal,
         const block::Outpoint& output) const noexcept -> ProposalAssociation;
@@ -95,9 +125,33 @@ public:
     auto GetReserved(alloc::Strategy alloc) const noexcept -> Reserved;
     auto GetReserved(const identifier::Generic& proposal, alloc::Strategy alloc)
         const noexcept -> Vector<UTXO>;
+    /// Only ConfirmedNew and UnconfirmedNew outputs are indexed. Outputs
+    /// leave the index when a proposal consumes them and return if it
+    /// releases them.
+    auto GetSpendable(const identifier::Nym& id, node::TxoState state)
+        const noexcept -> const Spendable&;
+    auto GetSpendable(const AccountID& id, node::TxoState state) const noexcept
+        -> const Spendable&;
     auto GetState(const node::TxoState id) const noexcept -> const Outpoints&;
     auto GetSubchain(const SubchainID& id) const noexcept -> const Outpoints&;
     auto Print() const noexcept -> void;
+    /// Choose the next input for a transaction according to the coin
+    /// selection strategy in the policy
+    ///
+    /// Oldest and Largest are a single lookup in the spendable index.
+    /// BranchAndBound also searches the max_candidates_ largest outputs which
+    /// fit inside the changeless window for at most max_search_steps_ steps,
+    /// so each call costs O(log n + max_candidates_ + max_search_steps_) and
+    /// the search cost does not grow with the size of the wallet.
+    ///
+    /// The second member of the return value is true if an output with the
+    /// required tag was requested but none are available.
+    auto Select(
+        const identifier::Nym& spender,
+        node::TxoState state,
+        const node::internal::SpendPolicy& policy,
+        std::optional<node::TxoTag> required) const noexcept
+        -> std::pair<std::optional<block::Outpoint>, bool>;
 
     auto AddGenerationOutput(
         block::Height height,
@@ -214,9 +268,30 @@ private:
 
     enum class Kind : bool { create, consume };
 
+    using SpendableStates = Map<node::TxoState, Spendable>;
+
+    struct Owners {
+        UnallocatedVector<identifier::Nym> nyms_{};
+        UnallocatedVector<identifier::Generic> accounts_{};
+        UnallocatedVector<crypto::Key> keys_{};
+    };
+
+    struct SpendableEntry {
+        node::TxoState state_{};
+        block::Position position_{};
+        Amount value_{};
+        UnallocatedSet<node::TxoTag> tags_{};
+    };
+
     static constexpr auto reserve_ = 10000_uz;
+    // NOTE limits the number of outputs considered by each branch and bound
+    // search
+    static constexpr auto max_candidates_ = 32_uz;
+    // NOTE limits the number of nodes visited by each branch and bound search
+    static constexpr auto max_search_steps_ = 100000_uz;
     static const Outpoints empty_outputs_;
     static const Nyms empty_nyms_;
+    static const Spendable empty_spendable_;
 
     const api::Session& api_;
     const storage::lmdb::Database& lmdb_;
@@ -235,9 +310,46 @@ private:
     Multimap<block::Outpoint, identifier::Generic> output_to_proposal_;
     MapType<identifier::Generic, Outpoints> created_by_proposal_;
     MapType<identifier::Generic, Outpoints> consumed_by_proposal_;
+    MapType<block::Outpoint, Owners> owners_;
+    Balance balance_;
+    NymBalances nym_balances_;
+    MapType<identifier::Generic, Balance> account_balances_;
+    MapType<crypto::Key, Balance> key_balances_;
+    MapType<block::Outpoint, SpendableEntry> spendable_;
+    MapType<identifier::Nym, SpendableStates> nym_spendable_;
+    MapType<identifier::Generic, SpendableStates> account_spendable_;
     bool populated_;
 
+    static auto add(const Balance& in, Balance& out) noexcept(false) -> void;
+    [[nodiscard]] static auto branch_and_bound(
+        const Set<Spendable::Valued>& byValue,
+        const node::internal::SpendPolicy& policy) noexcept
+        -> std::optional<block::Outpoint>;
+    static auto contribution(
+        std::optional<node::TxoState> state,
+        const Amount& value) noexcept -> Balance;
+    template <typename MapKeyType, typename MapType>
+    static auto get_spendable(
+        const MapKeyType& key,
+        node::TxoState state,
+        const MapType& map) noexcept -> const Spendable&;
+    static auto index_spendable(
+        const block::Outpoint& id,
+        const SpendableEntry& entry,
+        bool add,
+        Spendable& index) noexcept -> void;
+    static auto is_spendable(node::TxoState state) noexcept -> bool;
+    [[nodiscard]] static auto select_one(
+        const Set<Spendable::Aged>& byAge,
+        const Set<Spendable::Valued>& byValue,
+        const node::internal::SpendPolicy& policy) noexcept -> block::Outpoint;
+
+    auto current_balance(const block::Outpoint& id) const noexcept(false)
+        -> Balance;
     auto get_position() const noexcept -> const db::Position&;
+    auto get_state(const block::Outpoint& id) const noexcept
+        -> std::optional<node::TxoState>;
+    auto is_reserved(const block::Outpoint& id) const noexcept -> bool;
     auto load_output(const block::Outpoint& id) const noexcept(false)
         -> const protocol::bitcoin::base::block::Output&;
     template <typename MapKeyType, typename MapType>
@@ -256,6 +368,13 @@ private:
         const identifier::Generic& proposal,
         storage::lmdb::Transaction& tx) noexcept(false) -> void;
     auto is_finished(const identifier::Generic& id) noexcept -> bool;
+    auto rebuild_balances() noexcept -> void;
+    auto rebuild_spendable() noexcept -> void;
+    auto update_balance(
+        const block::Outpoint& id,
+        std::optional<node::TxoState> from,
+        std::optional<node::TxoState> to) noexcept(false) -> void;
+    auto update_spendable(const block::Outpoint& id) noexcept(false) -> void;
     auto load_output(const block::Outpoint& id) noexcept(false)
         -> protocol::bitcoin::base::block::Output&
     {
@@ -13,9 +13,21 @@
 #include "opentxs/blockchain/Type.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/util/Log.hpp"
+#include "util/ByteLiterals.hpp"
 
 namespace opentxs::blockchain::node::internal
 {
+auto Config::BlockCacheBytes() const noexcept -> std::size_t
+{
+    if (0_uz < block_cache_bytes_) {
+
+        return block_cache_bytes_;
+    } else {
+
+        return 64_mib;
+    }
+}
+
 auto Config::PeerTarget(const blockchain::Type chain) const noexcept
     -> std::size_t
 {
@@ -59,6 +71,7 @@ auto Config::Print(alloc::Default alloc) const noexcept -> CString
     output << "  * provide sync server: " << print_bool(provide_sync_server_)
            << '\n';
     output << "  * disable wallet: " << print_bool(disable_wallet_) << '\n';
+    output << "  * block cache bytes: " << BlockCacheBytes() << '\n';
 
     return CString{alloc}.append(output.str());
 }
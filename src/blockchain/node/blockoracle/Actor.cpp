@@ -11,6 +11,7 @@
 #include <utility>
 #include <variant>
 
+#include "blockchain/node/blockoracle/Cache.hpp"
 #include "blockchain/node/blockoracle/Shared.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/blockchain/node/Endpoints.hpp"
@@ -102,6 +103,9 @@ BlockOracle::Actor::Actor(
           [this](const auto& tip) { set_tip(tip); },
           [](const auto&) {},
           alloc)
+    , pending_(alloc)
+    , pending_bytes_(0_uz)
+    , flush_queued_(false)
 {
 }
 
@@ -116,10 +120,14 @@ auto BlockOracle::Actor::broadcast_tip() noexcept -> void
         return msg;
     }());
     to_blockchain_api_.SendDeferred([&] {
+        const auto cache = shared_.CacheStatistics();
         auto msg = MakeWork(WorkType::BlockchainBlockOracleProgress);
         msg.AddFrame(chain_);
         msg.AddFrame(tip.height_);
         msg.AddFrame(tip.hash_);
+        msg.AddFrame(cache.hits_);
+        msg.AddFrame(cache.misses_);
+        msg.AddFrame(cache.evictions_);
 
         return msg;
     }());
@@ -147,6 +155,29 @@ auto BlockOracle::Actor::do_startup(allocator_type monotonic) noexcept -> bool
     return false;
 }
 
+auto BlockOracle::Actor::flush_blocks(allocator_type monotonic) noexcept
+    -> void
+{
+    if (pending_.empty()) { return; }
+
+    // NOTE the submitted messages own the serialized blocks so they are
+    // written from those buffers without being copied again
+    auto blocks = Vector<ReadView>{monotonic};
+    blocks.reserve(pending_.size());
+    blocks.clear();
+
+    for (const auto& msg : pending_) {
+        blocks.emplace_back(msg.Payload()[1].Bytes());
+    }
+
+    log_()(name_)(": writing ")(blocks.size())(" blocks (")(pending_bytes_)(
+        " bytes)")
+        .Flush();
+    shared_.Receive(blocks, monotonic);
+    pending_.clear();
+    pending_bytes_ = 0_uz;
+}
+
 auto BlockOracle::Actor::Init(std::shared_ptr<Actor> me) noexcept -> void
 {
     signal_startup(me);
@@ -246,6 +277,12 @@ auto BlockOracle::Actor::pipeline(
         case Work::submit_block: {
             process_submit_block(std::move(msg), monotonic);
         } break;
+        case Work::job_finished: {
+            process_job_finished(std::move(msg), monotonic);
+        } break;
+        case Work::flush_blocks: {
+            process_flush_blocks(monotonic);
+        } break;
         case Work::shutdown:
         case Work::init:
         case Work::statemachine: {
@@ -286,11 +323,32 @@ auto BlockOracle::Actor::process_block_ready(
     shared_.FinishWork();
 }
 
+auto BlockOracle::Actor::process_flush_blocks(allocator_type monotonic) noexcept
+    -> void
+{
+    flush_queued_ = false;
+    flush_blocks(monotonic);
+}
+
 auto BlockOracle::Actor::process_header(Message&& msg) noexcept -> void
 {
     // NOTE no action required
 }
 
+auto BlockOracle::Actor::process_job_finished(
+    Message&& msg,
+    allocator_type monotonic) noexcept -> void
+{
+    const auto body = msg.Payload();
+
+    assert_true(1_uz < body.size());
+
+    // NOTE closing a job requeues every block of the job which has not been
+    // received yet, so the blocks submitted before it must be written first
+    flush_blocks(monotonic);
+    shared_.CloseJob(body[1].as<JobID>());
+}
+
 auto BlockOracle::Actor::process_reorg(Message&& msg) noexcept -> void
 {
     // NOTE no action required
@@ -334,7 +392,17 @@ auto BlockOracle::Actor::process_submit_block(
 
     assert_true(1_uz < body.size());
 
-    shared_.Receive(body[1].Bytes(), monotonic);
+    pending_bytes_ += body[1].size();
+    pending_.emplace_back(std::move(msg));
+
+    if (pending_bytes_ >= flush_threshold_) {
+        flush_blocks(monotonic);
+    } else if (false == flush_queued_) {
+        // NOTE the flush signal is queued behind every block which has
+        // already arrived so they are all written in the same transaction
+        flush_queued_ = true;
+        pipeline_.Push(MakeWork(Work::flush_blocks));
+    }
 }
 
 auto BlockOracle::Actor::queue_blocks(allocator_type monotonic) noexcept -> bool
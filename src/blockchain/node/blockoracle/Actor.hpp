@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <span>
@@ -22,6 +23,7 @@
 #include "opentxs/network/zeromq/message/Envelope.hpp"
 #include "opentxs/util/Container.hpp"
 #include "util/Actor.hpp"
+#include "util/ByteLiterals.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs
@@ -93,6 +95,10 @@ private:
     using Requests = Map<block::Hash, Set<ConnectionID>>;
     using Notifications = Map<ConnectionID, Message>;
 
+    // NOTE submitted blocks are written together once this much data is
+    // pending, or when every message queued ahead of the flush has been read
+    static constexpr auto flush_threshold_ = std::size_t{32_mib};
+
     std::shared_ptr<const api::internal::Session> api_p_;
     std::shared_ptr<const node::Manager> node_p_;
     std::shared_ptr<Shared> shared_p_;
@@ -105,10 +111,14 @@ private:
     const blockchain::Type chain_;
     Requests requests_;
     Downloader downloader_;
+    Vector<Message> pending_;
+    std::size_t pending_bytes_;
+    bool flush_queued_;
 
     auto broadcast_tip() noexcept -> void;
     auto do_shutdown() noexcept -> void;
     auto do_startup(allocator_type monotonic) noexcept -> bool;
+    auto flush_blocks(allocator_type monotonic) noexcept -> void;
     auto notify_requestors(
         std::span<const block::Hash> ids,
         std::span<const BlockLocation> blocks,
@@ -122,7 +132,11 @@ private:
         -> void;
     auto process_block_ready(Message&& msg, allocator_type monotonic) noexcept
         -> void;
+    auto process_flush_blocks(allocator_type monotonic) noexcept -> void;
     auto process_header(Message&& msg) noexcept -> void;
+    auto process_job_finished(
+        Message&& msg,
+        allocator_type monotonic) noexcept -> void;
     auto process_reorg(Message&& msg) noexcept -> void;
     auto process_report(Message&& msg) noexcept -> void;
     auto process_request_blocks(
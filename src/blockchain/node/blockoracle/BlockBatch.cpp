@@ -18,14 +18,12 @@ namespace opentxs::blockchain::node::internal
 BlockBatch::Imp::Imp(
     download::JobID id,
     Vector<block::Hash>&& hashes,
-    DownloadCallback download,
     SimpleCallback&& finish,
     allocator_type alloc) noexcept
     : id_(id)
     , hashes_(std::move(hashes), alloc)
     , start_(sClock::now())
     , log_(LogTrace())
-    , callback_(std::move(download))
     , finish_(std::move(finish))
     , last_(start_)
     , submitted_(0)
@@ -33,13 +31,9 @@ BlockBatch::Imp::Imp(
     if (hashes_.empty()) {
         assert_true(-1 == id_);
         assert_false(finish_.operator bool());
-        assert_false(callback_.operator bool());
     }
 
-    if (-1 != id_) {
-        assert_false(nullptr == finish_);
-        assert_false(nullptr == callback_);
-    }
+    if (-1 != id_) { assert_false(nullptr == finish_); }
 }
 
 BlockBatch::Imp::Imp(Imp& rhs, allocator_type alloc) noexcept
@@ -47,17 +41,15 @@ BlockBatch::Imp::Imp(Imp& rhs, allocator_type alloc) noexcept
     , hashes_(rhs.hashes_, alloc)
     , start_(rhs.start_)
     , log_(rhs.log_)
-    , callback_(rhs.callback_)
     , finish_(rhs.finish_)
     , last_(rhs.last_)
     , submitted_(rhs.submitted_)
 {
-    rhs.callback_ = {};  // NOLINT(cert-oop58-cpp)
-    rhs.finish_ = {};    // NOLINT(cert-oop58-cpp)
+    rhs.finish_ = {};  // NOLINT(cert-oop58-cpp)
 }
 
 BlockBatch::Imp::Imp(allocator_type alloc) noexcept
-    : Imp(-1, Vector<block::Hash>{alloc}, {}, nullptr, alloc)
+    : Imp(-1, Vector<block::Hash>{alloc}, nullptr, alloc)
 {
 }
 
@@ -73,10 +65,8 @@ auto BlockBatch::Imp::Remaining() const noexcept -> std::size_t
     return target - std::min(submitted_, target);
 }
 
-auto BlockBatch::Imp::Submit(const std::string_view block) noexcept -> bool
+auto BlockBatch::Imp::Submit() noexcept -> bool
 {
-    if (callback_) { callback_(block); }
-
     ++submitted_;
     last_ = sClock::now();
     log_()(submitted_)(" of ")(hashes_.size())(" hashes submitted for job ")(
@@ -163,10 +153,7 @@ auto BlockBatch::Remaining() const noexcept -> std::size_t
     return imp_->Remaining();
 }
 
-auto BlockBatch::Submit(const std::string_view block) noexcept -> bool
-{
-    return imp_->Submit(block);
-}
+auto BlockBatch::Submit() noexcept -> bool { return imp_->Submit(); }
 
 auto BlockBatch::swap(BlockBatch& rhs) noexcept -> void
 {
@@ -8,7 +8,6 @@
 #include <chrono>
 #include <cstddef>
 #include <functional>
-#include <string_view>
 
 #include "internal/blockchain/node/Job.hpp"
 #include "internal/blockchain/node/blockoracle/BlockBatch.hpp"
@@ -32,8 +31,6 @@ namespace opentxs::blockchain::node::internal
 class BlockBatch::Imp final : public Allocated
 {
 public:
-    using DownloadCallback = std::function<void(const std::string_view)>;
-
     const download::JobID id_;
     const Vector<block::Hash> hashes_;
     const sTime start_;
@@ -53,11 +50,10 @@ public:
     {
         return pmr::make_deleter(this);
     }
-    auto Submit(const std::string_view block) noexcept -> bool;
+    auto Submit() noexcept -> bool;
 
     Imp(download::JobID id,
         Vector<block::Hash>&& hashes,
-        DownloadCallback download,
         SimpleCallback&& finish,
         allocator_type alloc) noexcept;
     Imp(allocator_type alloc = {}) noexcept;
@@ -67,7 +63,6 @@ public:
 
 private:
     const Log& log_;
-    DownloadCallback callback_;
     SimpleCallback finish_;
     sTime last_;
     std::size_t submitted_;
@@ -42,6 +42,8 @@ auto print(Job in) noexcept -> std::string_view
             {reorg, "reorg"sv},
             {request_blocks, "request_blocks"sv},
             {submit_block, "submit_block"sv},
+            {job_finished, "job_finished"sv},
+            {flush_blocks, "flush_blocks"sv},
             {block_ready, "block_ready"sv},
             {report, "report"sv},
             {init, "init"sv},
@@ -5,9 +5,14 @@
 
 #include "blockchain/node/blockoracle/Cache.hpp"  // IWYU pragma: associated
 
-#include <utility>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
 
-#include "internal/util/P0330.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/core/ByteArray.hpp"
 #include "opentxs/core/Data.hpp"
@@ -15,80 +20,199 @@
 
 namespace opentxs::blockchain::node::blockoracle
 {
-Cache::Cache(allocator_type alloc) noexcept
-    : data_(alloc)
-    , index_(alloc)
-    , reverse_(alloc)
-    , size_(0_uz)
+Cache::Sketch::Sketch(allocator_type alloc) noexcept
+    : counters_(depth_ * width_, std::uint8_t{0}, alloc)
+    , additions_(0_uz)
 {
 }
 
-auto Cache::add(const block::Hash& id, ReadView bytes) noexcept -> CachedBlock
+auto Cache::Sketch::age() noexcept -> void
 {
-    if (auto it = index_.find(id); index_.end() != it) {
+    for (auto& counter : counters_) { counter >>= 1u; }
 
-        return *it->second;
-    } else {
-        auto i = data_.insert(data_.end(), std::make_shared<ByteArray>(bytes));
-        auto [j, rc1] = index_.try_emplace(id, i);
+    additions_ /= 2_uz;
+}
 
-        assert_true(rc1);
+auto Cache::Sketch::Estimate(const block::Hash& id) const noexcept -> unsigned
+{
+    const auto slots = index(id);
+    auto out = unsigned{max_};
 
-        auto [_, rc2] = reverse_.try_emplace(i, j);
+    for (auto row = 0_uz; row < depth_; ++row) {
+        out = std::min<unsigned>(out, counters_[(row * width_) + slots[row]]);
+    }
 
-        assert_true(rc2);
+    return out;
+}
 
-        auto out = *i;
+auto Cache::Sketch::Increment(const block::Hash& id) noexcept -> void
+{
+    const auto slots = index(id);
+    auto added = false;
 
-        assert_false(nullptr == out);
-        size_ += out->size();
+    for (auto row = 0_uz; row < depth_; ++row) {
+        auto& counter = counters_[(row * width_) + slots[row]];
 
-        return *i;
+        if (counter < max_) {
+            ++counter;
+            added = true;
+        }
     }
+
+    if (added && (++additions_ >= sample_)) { age(); }
+}
+
+auto Cache::Sketch::index(const block::Hash& id) noexcept
+    -> std::array<std::size_t, depth_>
+{
+    static_assert(std::has_single_bit(width_));
+    static constexpr auto word = sizeof(std::uint64_t);
+    static constexpr auto shift =
+        std::numeric_limits<std::uint64_t>::digits - std::countr_zero(width_);
+    const auto bytes = id.Bytes();
+
+    assert_true(bytes.size() >= (depth_ * word));
+
+    auto out = std::array<std::size_t, depth_>{};
+
+    for (auto row = 0_uz; row < depth_; ++row) {
+        auto value = std::uint64_t{};
+        std::memcpy(
+            &value,
+            std::next(bytes.data(), static_cast<std::ptrdiff_t>(row * word)),
+            word);
+        // NOTE block hashes are already uniformly distributed but shard
+        // selection consumes some of the low order bits so take the index from
+        // the high order bits of a multiplicative hash instead
+        value *= 0x9e3779b97f4a7c15ull;
+        out[row] = static_cast<std::size_t>(value >> shift);
+    }
+
+    return out;
+}
+
+Cache::Sketch::~Sketch() = default;
+
+Cache::Shard::Shard(allocator_type alloc) noexcept
+    : data_(alloc)
+    , index_(alloc)
+    , sketch_(alloc)
+    , size_(0_uz)
+{
+}
+
+Cache::Shard::~Shard() = default;
+
+Cache::Cache(std::size_t limit, bool admission, allocator_type alloc) noexcept
+    : shard_limit_(std::max(limit / shard_count_, 1_uz))
+    , admission_(admission)
+    , shards_(make_shards(alloc, std::make_index_sequence<shard_count_>{}))
+    , hits_(0_uz)
+    , misses_(0_uz)
+    , evictions_(0_uz)
+{
 }
 
 auto Cache::Clear() noexcept -> void
 {
-    reverse_.clear();
-    index_.clear();
-    data_.clear();
+    for (auto& guarded : shards_) {
+        auto handle = guarded.lock();
+        auto& shard = *handle;
+        shard.index_.clear();
+        shard.data_.clear();
+        shard.size_ = 0_uz;
+    }
 }
 
 auto Cache::get_allocator() const noexcept -> allocator_type
 {
-    return data_.get_allocator();
+    return shards_.front().lock()->data_.get_allocator();
+}
+
+auto Cache::GetStatistics() const noexcept -> Statistics
+{
+    return {
+        hits_.load(std::memory_order_relaxed),
+        misses_.load(std::memory_order_relaxed),
+        evictions_.load(std::memory_order_relaxed)};
 }
 
 auto Cache::Load(const block::Hash& id) noexcept -> CachedBlock
 {
-    if (auto i = index_.find(id); index_.end() != i) {
+    auto handle = get_shard(id).lock();
+    auto& shard = *handle;
+    shard.sketch_.Increment(id);
+
+    if (auto i = shard.index_.find(id); shard.index_.end() != i) {
+        auto& entry = i->second;
+        shard.data_.splice(shard.data_.end(), shard.data_, entry);
+        hits_.fetch_add(1_uz, std::memory_order_relaxed);
 
-        return *i->second;
+        return entry->second;
     } else {
+        misses_.fetch_add(1_uz, std::memory_order_relaxed);
 
         return {};
     }
 }
 
-auto Cache::remove(Data::iterator i) noexcept -> Data::iterator
+auto Cache::get_shard(const block::Hash& id) noexcept -> GuardedShard&
 {
-    if (auto r = reverse_.find(i); reverse_.end() != r) {
-        size_ -= (*i)->size();
-        index_.erase(r->second);
-        reverse_.erase(r);
-
-        return data_.erase(i);
-    } else {
-        LogAbort()().Abort();
-    }
+    return shards_[std::hash<block::Hash>{}(id) % shard_count_];
 }
 
 auto Cache::Store(const block::Hash& id, ReadView bytes) noexcept -> CachedBlock
 {
-    auto out = add(id, bytes);
-    auto i = data_.begin();
+    auto handle = get_shard(id).lock();
+    auto& shard = *handle;
+    auto& data = shard.data_;
+
+    if (auto i = shard.index_.find(id); shard.index_.end() != i) {
+        auto& entry = i->second;
+        data.splice(data.end(), data, entry);
+
+        return entry->second;
+    }
+
+    auto out = std::make_shared<const ByteArray>(bytes);
+
+    assert_false(nullptr == out);
+
+    const auto required = out->size();
+
+    // NOTE blocks which can not be admitted are still returned to the caller,
+    // they are just not retained
+    if (required > shard_limit_) { return out; }
+
+    const auto candidate = shard.sketch_.Estimate(id);
+    auto end = data.begin();
+
+    for (auto available = shard_limit_ - shard.size_; available < required;
+         ++end) {
+        assert_false(data.end() == end);
+
+        const auto& [victim, block] = *end;
+
+        if (admission_ && (shard.sketch_.Estimate(victim) > candidate)) {
+
+            return out;
+        }
+
+        available += block->size();
+    }
+
+    for (auto i = data.begin(); i != end; i = data.erase(i)) {
+        shard.size_ -= i->second->size();
+        shard.index_.erase(i->first);
+        evictions_.fetch_add(1_uz, std::memory_order_relaxed);
+    }
+
+    auto i = data.emplace(data.end(), id, out);
+    const auto [_, added] = shard.index_.try_emplace(id, i);
+
+    assert_true(added);
 
-    while ((size_ > limit_) && (i != data_.end())) { i = remove(i); }
+    shard.size_ += required;
 
     return out;
 }
@@ -5,16 +5,21 @@
 
 #pragma once
 
+#include <cs_plain_guarded.h>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <utility>
 
 #include "internal/blockchain/node/blockoracle/Types.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/PMR.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/util/Allocated.hpp"
 #include "opentxs/util/Container.hpp"
-#include "util/ByteLiterals.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs
@@ -25,21 +30,37 @@ class ByteArray;
 
 namespace opentxs::blockchain::node::blockoracle
 {
+/// In-memory block cache
+///
+/// Blocks are distributed over independently locked shards, each of which
+/// holds an equal share of the byte limit and evicts in least recently used
+/// order. Every lookup is recorded in a per-shard frequency sketch and a new
+/// block is only admitted if it has been requested at least as often as the
+/// blocks it would displace, so a stream of blocks which are only ever used
+/// once can not flush blocks which are in demand.
 class Cache final : public opentxs::Allocated
 {
 public:
-    auto get_allocator() const noexcept -> allocator_type final;
+    struct Statistics {
+        std::size_t hits_{};
+        std::size_t misses_{};
+        std::size_t evictions_{};
+    };
 
-    auto Load(const block::Hash& id) noexcept -> CachedBlock;
+    auto get_allocator() const noexcept -> allocator_type final;
+    auto GetStatistics() const noexcept -> Statistics;
 
     auto Clear() noexcept -> void;
     auto get_deleter() noexcept -> delete_function final
     {
         return pmr::make_deleter(this);
     }
+    auto Load(const block::Hash& id) noexcept -> CachedBlock;
     auto Store(const block::Hash& id, ReadView bytes) noexcept -> CachedBlock;
 
-    Cache(allocator_type alloc) noexcept;
+    /// If admission is false every new block is retained, evicting the least
+    /// recently used blocks as necessary
+    Cache(std::size_t limit, bool admission, allocator_type alloc) noexcept;
     Cache() = delete;
     Cache(const Cache&) = delete;
     Cache(Cache&&) = delete;
@@ -49,18 +70,77 @@ public:
     ~Cache() final;
 
 private:
-    using Data = Deque<std::shared_ptr<const ByteArray>>;
-    using Index = Map<block::Hash, Data::iterator>;
-    using Reverse = Map<Data::iterator, Index::iterator>;
+    // NOTE count-min sketch with four bit saturating counters which are
+    // halved periodically so that old popularity decays
+    class Sketch
+    {
+    public:
+        auto Estimate(const block::Hash& id) const noexcept -> unsigned;
+
+        auto Increment(const block::Hash& id) noexcept -> void;
+
+        Sketch(allocator_type alloc) noexcept;
+        Sketch() = delete;
+        Sketch(const Sketch&) = delete;
+        Sketch(Sketch&&) = delete;
+        auto operator=(const Sketch&) -> Sketch& = delete;
+        auto operator=(Sketch&&) -> Sketch& = delete;
+
+        ~Sketch();
+
+    private:
+        static constexpr auto depth_ = 4_uz;
+        static constexpr auto width_ = 512_uz;
+        static constexpr auto sample_ = 10_uz * width_;
+        static constexpr auto max_ = std::uint8_t{15};
 
-    static constexpr auto limit_ = 64_mib;
+        Vector<std::uint8_t> counters_;
+        std::size_t additions_;
 
-    Data data_;
-    Index index_;
-    Reverse reverse_;
-    std::size_t size_;
+        static auto index(const block::Hash& id) noexcept
+            -> std::array<std::size_t, depth_>;
+
+        auto age() noexcept -> void;
+    };
+    struct Shard {
+        using Entry = std::pair<block::Hash, CachedBlock>;
+        using Data = List<Entry>;
+        using Index = Map<block::Hash, Data::iterator>;
+
+        Data data_;
+        Index index_;
+        Sketch sketch_;
+        std::size_t size_;
+
+        Shard(allocator_type alloc) noexcept;
+        Shard() = delete;
+        Shard(const Shard&) = delete;
+        Shard(Shard&&) = delete;
+        auto operator=(const Shard&) -> Shard& = delete;
+        auto operator=(Shard&&) -> Shard& = delete;
+
+        ~Shard();
+    };
+    using GuardedShard = libguarded::plain_guarded<Shard>;
+
+    static constexpr auto shard_count_ = 8_uz;
+
+    const std::size_t shard_limit_;
+    const bool admission_;
+    mutable std::array<GuardedShard, shard_count_> shards_;
+    std::atomic<std::size_t> hits_;
+    std::atomic<std::size_t> misses_;
+    std::atomic<std::size_t> evictions_;
+
+    template <std::size_t... I>
+    static auto make_shards(
+        allocator_type alloc,
+        std::index_sequence<I...>) noexcept
+        -> std::array<GuardedShard, shard_count_>
+    {
+        return {{((void)I, GuardedShard{alloc})...}};
+    }
 
-    auto add(const block::Hash& id, ReadView bytes) noexcept -> CachedBlock;
-    auto remove(Data::iterator i) noexcept -> Data::iterator;
+    auto get_shard(const block::Hash& id) noexcept -> GuardedShard&;
 };
 }  // namespace opentxs::blockchain::node::blockoracle
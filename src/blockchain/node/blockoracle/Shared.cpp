@@ -86,7 +86,12 @@ BlockOracle::Shared::Shared(
     , ibd_target_(params::get(chain_).CheckpointPosition().height_)
     , use_persistent_storage_(
           BlockchainProfile::mobile != node_.Internal().GetConfig().profile_)
-    , cache_(alloc)
+    // NOTE without persistent storage the cache is the only copy of a
+    // downloaded block so every block must be admitted
+    , cache_(
+          node_.Internal().GetConfig().BlockCacheBytes(),
+          use_persistent_storage_,
+          alloc)
     , futures_(api_, name_, chain_, alloc)
     , queue_(
           log_,
@@ -148,7 +153,7 @@ auto BlockOracle::Shared::bad_block(
         }
         auto operator()(const CachedBlock& block) noexcept
         {
-            this_.cache_.lock()->Clear();
+            this_.cache_.Clear();
         }
     };
 
@@ -171,6 +176,18 @@ auto BlockOracle::Shared::block_is_ready(
     update_.lock()->Queue(id, block);
 }
 
+auto BlockOracle::Shared::CacheStatistics() const noexcept
+    -> Cache::Statistics
+{
+    return cache_.GetStatistics();
+}
+
+auto BlockOracle::Shared::CloseJob(download::JobID job) const noexcept -> void
+{
+    publish_queue(queue_.lock()->Finish(job));
+    update_.lock()->FinishJob();
+}
+
 auto BlockOracle::Shared::check_block(BlockData& data) const noexcept -> void
 {
     auto alloc = alloc::Strategy{};
@@ -230,8 +247,9 @@ auto BlockOracle::Shared::FetchAllBlocks() const noexcept -> bool
 
 auto BlockOracle::Shared::FinishJob(download::JobID job) const noexcept -> void
 {
-    publish_queue(queue_.lock()->Finish(job));
-    update_.lock()->FinishJob();
+    // NOTE the actor writes downloaded blocks so the job must be closed there,
+    // after the blocks which were submitted for it
+    update_.lock()->JobFinished(job);
 }
 
 auto BlockOracle::Shared::FinishWork() noexcept -> void
@@ -441,8 +459,6 @@ auto BlockOracle::Shared::GetWork(alloc::Default alloc) const noexcept
             alloc,
             id,
             std::move(hashes),
-            // TODO monotonic allocator
-            [me](const auto bytes) { me->Receive(bytes, {}); },
             [me, job = id] { me->FinishJob(job); });
         update_.lock()->StartJob();
 
@@ -589,13 +605,11 @@ auto BlockOracle::Shared::load_blocks(
                 }
             });
     } else {
-        auto handle = cache_.lock();
-        auto& cache = *handle;
         std::ranges::transform(
             blocks,
             std::back_inserter(out),
             [&](const auto& id) -> BlockLocation {
-                auto block = cache.Load(id);
+                auto block = cache_.Load(id);
 
                 if (block) {
 
@@ -629,28 +643,48 @@ auto BlockOracle::Shared::publish_queue(QueueData queue) const noexcept -> void
 }
 
 auto BlockOracle::Shared::Receive(
-    const ReadView serialized,
-    allocator_type monotonic) const noexcept -> bool
+    std::span<const ReadView> serialized,
+    allocator_type monotonic) const noexcept -> void
 {
     auto alloc = alloc::Strategy{get_allocator(), monotonic};
     const auto& log = log_;
-    using block::Parser;
-    auto block = block::Block{alloc.work_};
-    const auto valid = Parser::Construct(
-        api_.Crypto(), chain_, serialized, block, alloc.WorkOnly());
-    const auto& id = block.ID();
+    auto valid = Vector<database::SerializedBlock>{alloc.work_};
+    valid.reserve(serialized.size());
+    valid.clear();
+
+    for (const auto& bytes : serialized) {
+        using block::Parser;
+        auto block = block::Block{alloc.work_};
+
+        if (Parser::Construct(
+                api_.Crypto(), chain_, bytes, block, alloc.WorkOnly())) {
+            const auto& id = block.ID();
+            log()(name_)(": validated block ").asHex(id).Flush();
+            check_header(block.Header());
+            node_.Internal().Mempool().Prune(block, monotonic);
+            valid.emplace_back(id, bytes);
+        } else {
+            LogError()()(name_)(
+                ": received an invalid block with apparent hash ")
+                .asHex(block.ID())
+                .Flush();
+        }
+    }
 
-    if (valid) {
-        log()(name_)(": validated block ").asHex(id).Flush();
-        check_header(block.Header());
+    const auto saved = save_blocks(valid, monotonic);
 
-        return receive(block, serialized, monotonic);
-    } else {
-        LogError()()(name_)(": received an invalid block with apparent hash ")
-            .asHex(id)
-            .Flush();
+    assert_true(saved.size() == valid.size());
 
-        return false;
+    for (auto n = 0_uz; n < valid.size(); ++n) {
+        const auto& id = valid[n].first;
+        const auto& location = saved[n];
+
+        if (is_valid(location)) {
+            log()("saved block ").asHex(id).Flush();
+            block_is_ready(id, location, monotonic);
+        } else {
+            log()("failed to save block ").asHex(id).Flush();
+        }
     }
 }
 
@@ -702,11 +736,41 @@ auto BlockOracle::Shared::save_block(
     return MissingBlock{};
 }
 
+auto BlockOracle::Shared::save_blocks(
+    std::span<const database::SerializedBlock> blocks,
+    allocator_type monotonic) const noexcept -> Vector<BlockLocation>
+{
+    auto out = Vector<BlockLocation>{monotonic};
+    out.reserve(blocks.size());
+    out.clear();
+
+    if (use_persistent_storage_) {
+        // NOTE every block in the span is committed in one transaction
+        for (const auto& location : save_to_database(blocks, monotonic)) {
+            if (valid(location)) {
+                out.emplace_back(location);
+            } else {
+                out.emplace_back(MissingBlock{});
+            }
+        }
+    } else {
+        for (const auto& [id, bytes] : blocks) {
+            if (auto saved = save_to_cache(id, bytes); saved.operator bool()) {
+                out.emplace_back(std::move(saved));
+            } else {
+                out.emplace_back(MissingBlock{});
+            }
+        }
+    }
+
+    return out;
+}
+
 auto BlockOracle::Shared::save_to_cache(
     const block::Hash& id,
     const ReadView bytes) const noexcept -> CachedBlock
 {
-    return cache_.lock()->Store(id, bytes);
+    return cache_.Store(id, bytes);
 }
 
 auto BlockOracle::Shared::save_to_database(
@@ -717,6 +781,13 @@ auto BlockOracle::Shared::save_to_database(
     return db_.BlockStore(id, bytes, monotonic);
 }
 
+auto BlockOracle::Shared::save_to_database(
+    std::span<const database::SerializedBlock> blocks,
+    allocator_type monotonic) const noexcept -> Vector<PersistentBlock>
+{
+    return db_.BlockStore(blocks, monotonic, monotonic);
+}
+
 auto BlockOracle::Shared::SetTip(const block::Position& tip) noexcept -> bool
 {
     return db_.SetBlockTip(tip);
@@ -15,6 +15,7 @@
 #include "blockchain/node/blockoracle/Futures.hpp"
 #include "blockchain/node/blockoracle/Queue.hpp"
 #include "blockchain/node/blockoracle/Update.hpp"
+#include "internal/blockchain/database/Types.hpp"
 #include "internal/blockchain/node/Job.hpp"
 #include "internal/blockchain/node/blockoracle/BlockOracle.hpp"
 #include "internal/blockchain/node/blockoracle/Types.hpp"
@@ -87,6 +88,8 @@ public:
     const bool download_blocks_;
 
     auto BlockExists(const block::Hash& block) const noexcept -> bool;
+    auto CacheStatistics() const noexcept -> Cache::Statistics;
+    auto CloseJob(download::JobID job) const noexcept -> void;
     auto DownloadQueue() const noexcept -> std::size_t;
     auto FetchAllBlocks() const noexcept -> bool;
     auto FinishJob(download::JobID job) const noexcept -> void;
@@ -101,8 +104,8 @@ public:
         -> BlockResult;
     auto Load(Hashes hashes, allocator_type alloc, allocator_type monotonic)
         const noexcept -> BlockResults;
-    auto Receive(const ReadView block, allocator_type monotonic) const noexcept
-        -> bool;
+    auto Receive(std::span<const ReadView> blocks, allocator_type monotonic)
+        const noexcept -> void;
     auto SubmitBlock(
         const blockchain::block::Block& in,
         allocator_type monotonic) const noexcept -> bool;
@@ -128,7 +131,6 @@ public:
     ~Shared() final;
 
 private:
-    using GuardedCache = libguarded::plain_guarded<Cache>;
     using GuardedFutures = libguarded::plain_guarded<Futures>;
     using GuardedQueue = libguarded::plain_guarded<Queue>;
     using GuardedUpdate = libguarded::plain_guarded<Update>;
@@ -141,7 +143,7 @@ private:
     database::Block& db_;
     const block::Height ibd_target_;
     const bool use_persistent_storage_;
-    mutable GuardedCache cache_;
+    mutable Cache cache_;
     mutable GuardedFutures futures_;
     mutable GuardedQueue queue_;
     mutable GuardedUpdate update_;
@@ -185,12 +187,18 @@ private:
         const block::Hash& id,
         const ReadView bytes,
         allocator_type monotonic) const noexcept -> BlockLocation;
+    auto save_blocks(
+        std::span<const database::SerializedBlock> blocks,
+        allocator_type monotonic) const noexcept -> Vector<BlockLocation>;
     auto save_to_cache(const block::Hash& id, const ReadView bytes)
         const noexcept -> CachedBlock;
     auto save_to_database(
         const block::Hash& id,
         const ReadView bytes,
         allocator_type monotonic) const noexcept -> PersistentBlock;
+    auto save_to_database(
+        std::span<const database::SerializedBlock> blocks,
+        allocator_type monotonic) const noexcept -> Vector<PersistentBlock>;
     auto work_available() const noexcept -> void;
 };
 #pragma GCC diagnostic pop
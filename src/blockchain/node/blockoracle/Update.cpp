@@ -86,6 +86,17 @@ auto Update::is_full(const network::zeromq::Message& msg) noexcept -> bool
     return msg.Payload().size() > limit;
 }
 
+auto Update::JobFinished(JobID job) noexcept -> void
+{
+    using enum blockoracle::Job;
+    to_actor_.SendDeferred([&] {
+        auto out = MakeWork(job_finished);
+        out.AddFrame(job);
+
+        return out;
+    }());
+}
+
 auto Update::next_message() noexcept -> Cache::value_type&
 {
     if (pending_.empty()) {
@@ -55,6 +55,7 @@ public:
     {
         return pmr::make_deleter(this);
     }
+    auto JobFinished(JobID job) noexcept -> void;
     auto Queue(const block::Hash& id, const BlockLocation& block) noexcept
         -> void;
     auto StartJob() noexcept -> void;
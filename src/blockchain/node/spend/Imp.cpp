@@ -52,8 +52,9 @@
 #include "opentxs/blockchain/crypto/Subaccount.hpp"
 #include "opentxs/blockchain/crypto/Subchain.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/crypto/Wallet.hpp"
-#include "opentxs/blockchain/node/Funding.hpp"     // IWYU pragma: keep
-#include "opentxs/blockchain/node/SendResult.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/node/CoinSelection.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/node/Funding.hpp"        // IWYU pragma: keep
+#include "opentxs/blockchain/node/SendResult.hpp"     // IWYU pragma: keep
 #include "opentxs/blockchain/node/Types.hpp"
 #include "opentxs/core/ByteArray.hpp"
 #include "opentxs/core/Data.hpp"
@@ -92,6 +93,7 @@ SpendPrivate::SpendPrivate(
     , pc_recipients_()
     , notifications_()
     , policy_(Funding::Default)
+    , coin_selection_(CoinSelection::Oldest)
     , spend_unconfirmed_change_(true)
     , spend_unconfirmed_incoming_(params::get(chain).SpendUnconfirmed())
     , use_enhanced_notifications_(true)
@@ -499,6 +501,11 @@ auto SpendPrivate::Finalize(const Log& log, alloc::Strategy alloc) noexcept(
     std::ranges::for_each(notifications_, check);
 }
 
+auto SpendPrivate::CoinSelection() const noexcept -> node::CoinSelection
+{
+    return coin_selection_;
+}
+
 auto SpendPrivate::Funding() const noexcept -> node::Funding { return policy_; }
 
 auto SpendPrivate::ID() const noexcept -> const identifier::Generic&
@@ -624,7 +631,10 @@ auto SpendPrivate::PaymentCodeRecipients() const noexcept
 
 auto SpendPrivate::Policy() const noexcept -> internal::SpendPolicy
 {
-    return {spend_unconfirmed_incoming_, spend_unconfirmed_change_};
+    return {
+        spend_unconfirmed_incoming_,
+        spend_unconfirmed_change_,
+        coin_selection_};
 }
 
 auto SpendPrivate::sender_payment_code() const noexcept(false)
@@ -854,6 +864,13 @@ auto SpendPrivate::serialize_sweep(
     }
 }
 
+auto SpendPrivate::SetCoinSelection(node::CoinSelection value) noexcept -> bool
+{
+    coin_selection_ = value;
+
+    return true;
+}
+
 auto SpendPrivate::SetMemo(std::string_view memo) noexcept -> bool
 {
     memo_.assign(memo);
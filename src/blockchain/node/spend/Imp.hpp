@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+// IWYU pragma: no_include "opentxs/blockchain/node/CoinSelection.hpp"
 // IWYU pragma: no_include "opentxs/blockchain/node/Funding.hpp"
 
 #pragma once
@@ -82,6 +83,7 @@ public:
         -> void final;
     auto AddressRecipients() const noexcept
         -> std::span<const AddressRecipient> final;
+    auto CoinSelection() const noexcept -> node::CoinSelection final;
     auto Funding() const noexcept -> node::Funding final;
     auto ID() const noexcept -> const identifier::Generic& final;
     auto IsExpired() const noexcept -> bool final;
@@ -118,6 +120,8 @@ public:
     [[nodiscard]] auto SendToPaymentCode(
         const PaymentCode& recipient,
         const Amount& amount) noexcept -> bool final;
+    [[nodiscard]] auto SetCoinSelection(node::CoinSelection value) noexcept
+        -> bool final;
     [[nodiscard]] auto SetMemo(std::string_view) noexcept -> bool final;
     [[nodiscard]] auto SetSpendUnconfirmedChange(bool value) noexcept
         -> bool final;
@@ -171,6 +175,9 @@ private:
     Vector<PaymentCodeRecipient> pc_recipients_;
     boost::container::flat_set<PaymentCode> notifications_;
     node::Funding policy_;
+    // NOTE the proposal protobuf has no field for this value so proposals
+    // restored from storage use the default
+    node::CoinSelection coin_selection_;
     bool spend_unconfirmed_change_;
     bool spend_unconfirmed_incoming_;
     bool use_enhanced_notifications_;
@@ -29,6 +29,11 @@ Spend::Spend(Spend&& rhs) noexcept
 {
 }
 
+auto Spend::CoinSelection() const noexcept -> node::CoinSelection
+{
+    return imp_->CoinSelection();
+}
+
 auto Spend::Funding() const noexcept -> node::Funding
 {
     return imp_->Funding();
@@ -77,6 +82,11 @@ auto Spend::SendToPaymentCode(
     return imp_->SendToPaymentCode(recipient, amount);
 }
 
+auto Spend::SetCoinSelection(node::CoinSelection value) noexcept -> bool
+{
+    return imp_->SetCoinSelection(value);
+}
+
 auto Spend::SetMemo(std::string_view memo) noexcept -> bool
 {
     return imp_->SetMemo(memo);
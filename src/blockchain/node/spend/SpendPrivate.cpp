@@ -5,8 +5,9 @@
 
 #include "blockchain/node/spend/SpendPrivate.hpp"  // IWYU pragma: associated
 
-#include "opentxs/blockchain/node/Funding.hpp"     // IWYU pragma: keep
-#include "opentxs/blockchain/node/SendResult.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/node/CoinSelection.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/node/Funding.hpp"        // IWYU pragma: keep
+#include "opentxs/blockchain/node/SendResult.hpp"     // IWYU pragma: keep
 #include "opentxs/identifier/Generic.hpp"
 #include "opentxs/identifier/Nym.hpp"
 
@@ -14,6 +15,11 @@ namespace opentxs::blockchain::node
 {
 SpendPrivate::SpendPrivate() noexcept = default;
 
+auto SpendPrivate::CoinSelection() const noexcept -> node::CoinSelection
+{
+    return {};
+}
+
 auto SpendPrivate::Funding() const noexcept -> node::Funding { return {}; }
 
 auto SpendPrivate::ID() const noexcept -> const identifier::Generic&
@@ -50,6 +56,11 @@ auto SpendPrivate::SendToPaymentCode(const PaymentCode&, const Amount&) noexcept
     return {};
 }
 
+auto SpendPrivate::SetCoinSelection(node::CoinSelection) noexcept -> bool
+{
+    return {};
+}
+
 auto SpendPrivate::SetMemo(std::string_view) noexcept -> bool { return {}; }
 
 auto SpendPrivate::SetSpendUnconfirmedChange(bool) noexcept -> bool
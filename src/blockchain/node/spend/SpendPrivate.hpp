@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+// IWYU pragma: no_include "opentxs/blockchain/node/CoinSelection.hpp"
 // IWYU pragma: no_include "opentxs/blockchain/node/Funding.hpp"
 
 #pragma once
@@ -33,6 +34,7 @@ namespace opentxs::blockchain::node
 class SpendPrivate : public internal::Spend
 {
 public:
+    virtual auto CoinSelection() const noexcept -> node::CoinSelection;
     virtual auto Funding() const noexcept -> node::Funding;
     virtual auto ID() const noexcept -> const identifier::Generic&;
     virtual auto Memo() const noexcept -> std::string_view;
@@ -57,6 +59,8 @@ public:
     [[nodiscard]] virtual auto SendToPaymentCode(
         const PaymentCode& recipient,
         const Amount& amount) noexcept -> bool;
+    [[nodiscard]] virtual auto SetCoinSelection(
+        node::CoinSelection value) noexcept -> bool;
     [[nodiscard]] virtual auto SetMemo(std::string_view) noexcept -> bool;
     [[nodiscard]] virtual auto SetSpendUnconfirmedChange(bool value) noexcept
         -> bool;
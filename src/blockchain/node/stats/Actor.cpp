@@ -143,8 +143,16 @@ auto Actor::process_block(Message&& msg) noexcept -> void
         LogAbort()()(name_)(": invalid message").Abort();
     }
 
-    data_.SetBlockTip(
-        body[1].as<Type>(), {body[2].as<block::Height>(), body[3].Bytes()});
+    const auto chain = body[1].as<Type>();
+    data_.SetBlockTip(chain, {body[2].as<block::Height>(), body[3].Bytes()});
+
+    if (6_uz < body.size()) {
+        data_.SetBlockCache(
+            chain,
+            {body[4].as<std::size_t>(),
+             body[5].as<std::size_t>(),
+             body[6].as<std::size_t>()});
+    }
 }
 
 auto Actor::process_block_header(Message&& msg) noexcept -> void
@@ -25,6 +25,7 @@ Data::Data() noexcept
     , cfilter_tips_()
     , sync_tips_()
     , peer_count_()
+    , block_cache_()
     , to_actor_(std::nullopt)
 {
 }
@@ -29,6 +29,12 @@ namespace opentxs::blockchain::node::stats
 class Data
 {
 public:
+    struct BlockCache {
+        std::size_t hits_{};
+        std::size_t misses_{};
+        std::size_t evictions_{};
+    };
+
     using PositionMap = Map<Type, block::Position>;
 
     PositionMap header_tips_;
@@ -36,6 +42,7 @@ public:
     PositionMap cfilter_tips_;
     PositionMap sync_tips_;
     Map<Type, std::size_t> peer_count_;
+    Map<Type, BlockCache> block_cache_;
 
     auto Trigger() const noexcept -> void;
 
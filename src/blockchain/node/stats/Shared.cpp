@@ -30,6 +30,36 @@ Shared::Shared() noexcept
 {
 }
 
+auto Shared::block_cache(Type chain) const noexcept -> Data::BlockCache
+{
+    const auto handle = data_.lock_shared();
+    const auto& data = *handle;
+
+    if (auto out = get_block_cache(data, chain); out.has_value()) {
+
+        return *out;
+    } else {
+        data.Trigger();
+
+        return {};
+    }
+}
+
+auto Shared::BlockCacheEvictions(Type chain) const noexcept -> std::size_t
+{
+    return block_cache(chain).evictions_;
+}
+
+auto Shared::BlockCacheHits(Type chain) const noexcept -> std::size_t
+{
+    return block_cache(chain).hits_;
+}
+
+auto Shared::BlockCacheMisses(Type chain) const noexcept -> std::size_t
+{
+    return block_cache(chain).misses_;
+}
+
 auto Shared::BlockHeaderTip(Type chain) const noexcept -> block::Position
 {
     const auto handle = data_.lock_shared();
@@ -54,6 +84,20 @@ auto Shared::CfilterTip(Type chain) const noexcept -> block::Position
     return get_position(data, data.cfilter_tips_, chain);
 }
 
+auto Shared::get_block_cache(const Data& data, Type chain) noexcept
+    -> std::optional<Data::BlockCache>
+{
+    const auto& map = data.block_cache_;
+
+    if (const auto i = map.find(chain); map.end() != i) {
+
+        return i->second;
+    } else {
+
+        return std::nullopt;
+    }
+}
+
 auto Shared::get_position(
     const Data& data,
     const Data::PositionMap& map,
@@ -85,6 +129,12 @@ auto Shared::PeerCount(Type chain) const noexcept -> std::size_t
     }
 }
 
+auto Shared::SetBlockCache(Type chain, Data::BlockCache counters) noexcept
+    -> void
+{
+    data_.lock()->block_cache_[chain] = counters;
+}
+
 auto Shared::SetBlockHeaderTip(Type chain, block::Position tip) noexcept -> void
 {
     auto handle = data_.lock();
@@ -8,6 +8,7 @@
 #include <cs_shared_guarded.h>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
 
 #include "blockchain/node/stats/Data.hpp"
@@ -42,12 +43,17 @@ class Shared
 public:
     const CString endpoint_;
 
+    auto BlockCacheEvictions(Type chain) const noexcept -> std::size_t;
+    auto BlockCacheHits(Type chain) const noexcept -> std::size_t;
+    auto BlockCacheMisses(Type chain) const noexcept -> std::size_t;
     auto BlockHeaderTip(Type chain) const noexcept -> block::Position;
     auto BlockTip(Type chain) const noexcept -> block::Position;
     auto CfilterTip(Type chain) const noexcept -> block::Position;
     auto PeerCount(Type chain) const noexcept -> std::size_t;
     auto SyncTip(Type chain) const noexcept -> block::Position;
 
+    auto SetBlockCache(Type chain, Data::BlockCache counters) noexcept
+        -> void;
     auto SetBlockHeaderTip(Type chain, block::Position tip) noexcept -> void;
     auto SetBlockTip(Type chain, block::Position tip) noexcept -> void;
     auto SetCfilterTip(Type chain, block::Position tip) noexcept -> void;
@@ -70,6 +76,8 @@ private:
 
     GuardedData data_;
 
+    static auto get_block_cache(const Data& data, Type chain) noexcept
+        -> std::optional<Data::BlockCache>;
     static auto get_position(
         const Data& data,
         const Data::PositionMap& map,
@@ -78,5 +86,7 @@ private:
         Data::PositionMap& map,
         Type chain,
         block::Position tip) noexcept -> void;
+
+    auto block_cache(Type chain) const noexcept -> Data::BlockCache;
 };
 }  // namespace opentxs::blockchain::node::stats
@@ -58,6 +58,21 @@ auto Stats::operator=(Stats&& rhs) noexcept -> Stats&
     return *this;
 }
 
+auto Stats::BlockCacheEvictions(Type chain) const noexcept -> std::size_t
+{
+    return imp_->shared_->BlockCacheEvictions(chain);
+}
+
+auto Stats::BlockCacheHits(Type chain) const noexcept -> std::size_t
+{
+    return imp_->shared_->BlockCacheHits(chain);
+}
+
+auto Stats::BlockCacheMisses(Type chain) const noexcept -> std::size_t
+{
+    return imp_->shared_->BlockCacheMisses(chain);
+}
+
 auto Stats::BlockHeaderTip(Type chain) const noexcept -> block::Position
 {
     return imp_->shared_->BlockHeaderTip(chain);
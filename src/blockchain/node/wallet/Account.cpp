@@ -103,6 +103,7 @@ using enum opentxs::network::zeromq::socket::Direction;
 
 Account::Imp::Imp(
     Reorg& reorg,
+    std::shared_ptr<const ScanCoordinator> scan,
     const crypto::Account& account,
     std::shared_ptr<const api::session::internal::Client> api,
     std::shared_ptr<const node::Manager> node,
@@ -130,6 +131,7 @@ Account::Imp::Imp(
           })
     , api_p_(std::move(api))
     , node_p_(std::move(node))
+    , scan_coordinator_(std::move(scan))
     , api_(api_p_->asClientPublic())
     , account_(account)
     , node_(*node_p_)
@@ -169,6 +171,7 @@ Account::Imp::Imp(
 
 Account::Imp::Imp(
     Reorg& reorg,
+    std::shared_ptr<const ScanCoordinator> scan,
     const crypto::Account& account,
     std::shared_ptr<const api::session::internal::Client> api,
     std::shared_ptr<const node::Manager> node,
@@ -176,6 +179,7 @@ Account::Imp::Imp(
     network::zeromq::BatchID batch,
     allocator_type alloc) noexcept
     : Imp(reorg,
+          std::move(scan),
           account,
           std::move(api),
           std::move(node),
@@ -203,6 +207,7 @@ auto Account::Imp::check(
         auto ptr = std::allocate_shared<DeterministicStateData>(
             alloc::PMR<DeterministicStateData>{asio.Alloc(batchID)},
             reorg_,
+            scan_coordinator_,
             subaccount,
             api_p_,
             node_p_,
@@ -247,6 +252,7 @@ auto Account::Imp::check_notification(crypto::Notification& subaccount) noexcept
         auto ptr = std::allocate_shared<NotificationStateData>(
             alloc::PMR<NotificationStateData>{asio.Alloc(batchID)},
             reorg_,
+            scan_coordinator_,
             subaccount,
             code,
             api_p_,
@@ -644,6 +650,7 @@ namespace opentxs::blockchain::node::wallet
 {
 Account::Account(
     Reorg& reorg,
+    std::shared_ptr<const ScanCoordinator> scan,
     const crypto::Account& account,
     std::shared_ptr<const api::session::internal::Client> api,
     std::shared_ptr<const node::Manager> node,
@@ -658,6 +665,7 @@ Account::Account(
         return std::allocate_shared<Imp>(
             alloc::PMR<Imp>{asio.Alloc(batchID)},
             reorg,
+            std::move(scan),
             account,
             std::move(api),
             std::move(node),
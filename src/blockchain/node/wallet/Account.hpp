@@ -68,6 +68,11 @@ class Mempool;
 struct HeaderOraclePrivate;
 }  // namespace internal
 
+namespace wallet
+{
+class ScanCoordinator;
+}  // namespace wallet
+
 class HeaderOracle;
 class Manager;
 }  // namespace node
@@ -94,6 +99,7 @@ public:
     auto Init(std::shared_ptr<Imp> me) noexcept -> void;
 
     Imp(Reorg& reorg,
+        std::shared_ptr<const ScanCoordinator> scan,
         const crypto::Account& account,
         std::shared_ptr<const api::session::internal::Client> api,
         std::shared_ptr<const node::Manager> node,
@@ -112,6 +118,7 @@ private:
 
     std::shared_ptr<const api::session::internal::Client> api_p_;
     std::shared_ptr<const node::Manager> node_p_;
+    std::shared_ptr<const ScanCoordinator> scan_coordinator_;
     const api::session::Client& api_;
     const crypto::Account& account_;
     const node::Manager& node_;
@@ -182,6 +189,7 @@ private:
     auto work(allocator_type monotonic) noexcept -> bool;
 
     Imp(Reorg& reorg,
+        std::shared_ptr<const ScanCoordinator> scan,
         const crypto::Account& account,
         std::shared_ptr<const api::session::internal::Client> api,
         std::shared_ptr<const node::Manager> node,
@@ -6,6 +6,7 @@
 #include "blockchain/node/wallet/Accounts.hpp"  // IWYU pragma: associated
 
 #include <chrono>
+#include <memory>
 #include <span>
 #include <stdexcept>
 #include <string_view>
@@ -17,6 +18,7 @@
 #include "internal/blockchain/node/Endpoints.hpp"
 #include "internal/blockchain/node/Manager.hpp"
 #include "internal/blockchain/node/wallet/Account.hpp"
+#include "internal/blockchain/node/wallet/ScanCoordinator.hpp"
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/network/zeromq/Pipeline.hpp"
 #include "internal/network/zeromq/socket/Pipeline.hpp"
@@ -141,6 +143,7 @@ Accounts::Imp::Imp(
     , startup_reorg_(std::nullopt)
     , reorg_data_(std::nullopt)
     , reorg_(pipeline_, alloc)
+    , scan_coordinator_(std::make_shared<ScanCoordinator>(node_p_))
 {
 }
 
@@ -312,7 +315,13 @@ auto Accounts::Imp::process_nym(const identifier::Nym& nym) noexcept -> void
             .Flush();
         const auto& account = api_.Crypto().Blockchain().Account(nym, chain_);
         account.Internal().Startup();
-        wallet::Account{reorg_, account, api_p_, node_p_, to_children_endpoint_}
+        wallet::Account{
+            reorg_,
+            scan_coordinator_,
+            account,
+            api_p_,
+            node_p_,
+            to_children_endpoint_}
             .Init();
     }
 }
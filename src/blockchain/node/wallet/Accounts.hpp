@@ -53,6 +53,11 @@ namespace internal
 class Mempool;
 }  // namespace internal
 
+namespace wallet
+{
+class ScanCoordinator;
+}  // namespace wallet
+
 class Manager;
 }  // namespace node
 }  // namespace blockchain
@@ -121,6 +126,7 @@ private:
     std::optional<StateSequence> startup_reorg_;
     std::optional<Reorg> reorg_data_;
     ReorgMaster reorg_;
+    std::shared_ptr<const ScanCoordinator> scan_coordinator_;
 
     auto do_reorg() noexcept -> void;
     auto do_shutdown() noexcept -> void;
@@ -0,0 +1,176 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "internal/blockchain/node/wallet/ScanCoordinator.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "internal/util/P0330.hpp"
+#include "opentxs/Context.hpp"
+#include "opentxs/blockchain/cfilter/GCS.hpp"
+#include "opentxs/blockchain/node/FilterOracle.hpp"
+#include "opentxs/blockchain/node/Manager.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::blockchain::node::wallet
+{
+ScanCoordinator::ScanCoordinator(
+    const std::shared_ptr<const node::Manager>& node) noexcept
+    : node_(node)
+    , type_(node->FilterOracle().DefaultType())
+    , queue_()
+{
+}
+
+auto ScanCoordinator::process(std::span<std::shared_ptr<Request>> batch) const
+    noexcept(false) -> void
+{
+    using User = std::pair<Request*, std::size_t>;
+    const auto node = node_.lock();
+
+    if (nullptr == node) { throw std::runtime_error{"node is shut down"}; }
+
+    auto mr = alloc::MonotonicUnsync{};
+    const auto alloc = alloc::Default{std::addressof(mr)};
+    auto index = Map<block::Hash, std::size_t>{alloc};
+    auto blocks = Vector<block::Hash>{alloc};
+    index.clear();
+    blocks.clear();
+
+    for (const auto& request : batch) {
+        for (const auto& hash : request->blocks_) {
+            if (index.try_emplace(hash, blocks.size()).second) {
+                blocks.emplace_back(hash);
+            }
+        }
+    }
+
+    // NOTE every distinct block in the batch is loaded once, regardless of how
+    // many requests include it
+    const auto cfilters =
+        node->FilterOracle().LoadFilters(type_, blocks, {alloc, alloc});
+    const auto valid = [&](std::size_t n) {
+        return (n < cfilters.size()) && cfilters[n].IsValid();
+    };
+    auto users = Vector<Vector<User>>{alloc};
+    users.clear();
+    users.resize(blocks.size());
+
+    for (const auto& request : batch) {
+        const auto& hashes = request->blocks_;
+        auto available = 0_uz;
+
+        // NOTE a request is answered up to the first block whose cfilter is
+        // missing so that its results always describe a contiguous range
+        for (const auto& hash : hashes) {
+            if (false == valid(index.at(hash))) { break; }
+
+            ++available;
+        }
+
+        request->matched_.resize(available);
+        request->elements_.resize(available);
+
+        for (auto i = 0_uz; i < available; ++i) {
+            users[index.at(hashes[i])].emplace_back(request.get(), i);
+        }
+    }
+
+    for (auto n = 0_uz, stop = blocks.size(); n < stop; ++n) {
+        const auto& group = users[n];
+
+        if (group.empty()) { continue; }
+
+        const auto& cfilter = cfilters[n];
+        const auto count = cfilter.ElementCount();
+        auto all = gcs::Hashes{alloc};
+        auto offsets = Vector<std::size_t>{alloc};
+        all.clear();
+        offsets.clear();
+        offsets.reserve(group.size());
+
+        for (const auto& [request, i] : group) {
+            offsets.emplace_back(all.size());
+            std::ranges::copy(request->targets_[i], std::back_inserter(all));
+            request->elements_[i] = count;
+        }
+
+        // NOTE the targets of each request are sorted, so the hits routed to
+        // any one request remain sorted
+        for (const auto& hit : cfilter.Internal().Match(all, alloc)) {
+            const auto offset =
+                static_cast<std::size_t>(std::distance(all.cbegin(), hit));
+            const auto owner = std::distance(
+                offsets.begin(), std::ranges::upper_bound(offsets, offset));
+            const auto& [request, i] =
+                group[static_cast<std::size_t>(owner - 1)];
+            request->matched_[i].emplace_back(*hit);
+        }
+    }
+}
+
+auto ScanCoordinator::run() const noexcept -> void
+{
+    while (true) {
+        auto batch = Batch{};
+
+        {
+            auto handle = queue_.lock();
+
+            if (handle->pending_.empty()) {
+                handle->running_ = false;
+
+                return;
+            }
+
+            batch.swap(handle->pending_);
+        }
+
+        try {
+            process(batch);
+        } catch (const std::exception& e) {
+            LogError()()("failed to match ")(batch.size())(" requests: ")(
+                e.what())
+                .Flush();
+
+            for (auto& request : batch) { request->failed_ = true; }
+        }
+
+        for (auto& request : batch) { std::invoke(request->done_); }
+    }
+}
+
+auto ScanCoordinator::Submit(std::shared_ptr<Request> request) const noexcept
+    -> void
+{
+    assert_false(nullptr == request);
+
+    const auto start = [&] {
+        auto handle = queue_.lock();
+        handle->pending_.emplace_back(std::move(request));
+
+        if (handle->running_) {
+
+            return false;
+        } else {
+            handle->running_ = true;
+
+            return true;
+        }
+    }();
+
+    // NOTE requests which arrive while a job is running are collected by that
+    // job when it finishes its current batch, so at most one job exists at a
+    // time and no caller ever waits for it
+    if (start) { RunJob([me = shared_from_this()] { me->run(); }); }
+}
+
+ScanCoordinator::~ScanCoordinator() = default;
+}  // namespace opentxs::blockchain::node::wallet
@@ -752,8 +752,13 @@ auto BitcoinTransactionBuilderPrivate::BuildNormalTransaction() noexcept
     }
 
     while (false == is_funded()) {
-        using node::internal::SpendPolicy;
-        const auto policy = proposal_.Internal().Policy();
+        auto policy = proposal_.Internal().Policy();
+        policy.target_ =
+            output_value_ + notification_value_ + required_fee() - input_value_;
+        // NOTE dust() is the fee for one p2pkh input and also the excess
+        // below which finalize_outputs() drops the change output
+        policy.input_cost_ = dust();
+        policy.change_cost_ = dust();
         log()("asking database for outputs to fund proposal ")(id_, crypto)
             .Flush();
         auto candidate = db_.ReserveUTXO(log, spender(), id_, policy, alloc);
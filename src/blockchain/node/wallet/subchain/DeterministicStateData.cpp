@@ -44,6 +44,7 @@ namespace opentxs::blockchain::node::wallet
 {
 DeterministicStateData::DeterministicStateData(
     Reorg& reorg,
+    std::shared_ptr<const ScanCoordinator> scan,
     crypto::Deterministic& subaccount,
     std::shared_ptr<const api::internal::Session> api,
     std::shared_ptr<const node::Manager> node,
@@ -53,6 +54,7 @@ DeterministicStateData::DeterministicStateData(
     allocator_type alloc) noexcept
     : SubchainStateData(
           reorg,
+          std::move(scan),
           subaccount,
           std::move(api),
           std::move(node),
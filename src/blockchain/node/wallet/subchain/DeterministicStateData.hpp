@@ -52,6 +52,7 @@ namespace node
 namespace wallet
 {
 class Reorg;
+class ScanCoordinator;
 }  // namespace wallet
 
 class Manager;
@@ -76,6 +77,7 @@ public:
 
     DeterministicStateData(
         Reorg& reorg,
+        std::shared_ptr<const ScanCoordinator> scan,
         crypto::Deterministic& subaccount,
         std::shared_ptr<const api::internal::Session> api,
         std::shared_ptr<const node::Manager> node,
@@ -56,6 +56,7 @@ namespace opentxs::blockchain::node::wallet
 {
 NotificationStateData::NotificationStateData(
     Reorg& reorg,
+    std::shared_ptr<const ScanCoordinator> scan,
     crypto::Notification& subaccount,
     const opentxs::PaymentCode& code,
     std::shared_ptr<const api::internal::Session> api,
@@ -66,6 +67,7 @@ NotificationStateData::NotificationStateData(
     allocator_type alloc) noexcept
     : SubchainStateData(
           reorg,
+          std::move(scan),
           subaccount,
           std::move(api),
           std::move(node),
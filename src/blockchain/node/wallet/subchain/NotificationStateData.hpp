@@ -51,6 +51,7 @@ namespace node
 namespace wallet
 {
 class Reorg;
+class ScanCoordinator;
 }  // namespace wallet
 
 class Manager;
@@ -74,6 +75,7 @@ public:
 
     NotificationStateData(
         Reorg& reorg,
+        std::shared_ptr<const ScanCoordinator> scan,
         crypto::Notification& subaccount,
         const opentxs::PaymentCode& code,
         std::shared_ptr<const api::internal::Session> api,
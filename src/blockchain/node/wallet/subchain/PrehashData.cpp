@@ -7,8 +7,11 @@
 
 #include <algorithm>
 #include <compare>
+#include <initializer_list>
 #include <iterator>
+#include <memory>
 #include <shared_mutex>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -35,13 +38,16 @@ auto SubchainStateData::PrehashData::hash(
     const auto key = blockchain::internal::BlockHashToFilterKey(block.Bytes());
     const auto& [indices, bytes] = targets;
     auto& [hashes, map] = dest;
-    auto i = indices.cbegin();
-    auto t = bytes.cbegin();
-    auto end = indices.cend();
+    const auto count = std::min(indices.size(), bytes.size());
+    const auto start = hashes.size();
+    hashes.resize(start + count);
+    gcs::Siphash(
+        key,
+        std::span{bytes}.first(count),
+        std::span{hashes}.subspan(start, count));
 
-    for (; i < end; ++i, ++t) {
-        auto& hash = hashes.emplace_back(gcs::Siphash(api_, key, *t));
-        map[hash].emplace_back(&(*i));
+    for (auto n = 0_uz; n < count; ++n) {
+        map[hashes[start + n]].emplace_back(std::addressof(indices[n]));
     }
 
     dedup(hashes);
@@ -51,7 +57,6 @@ auto SubchainStateData::PrehashData::hash(
 namespace opentxs::blockchain::node::wallet
 {
 SubchainStateData::PrehashData::PrehashData(
-    const api::Session& api,
     const BlockTargets& targets,
     const std::string_view name,
     wallet::MatchCache::Results& results,
@@ -59,10 +64,10 @@ SubchainStateData::PrehashData::PrehashData(
     std::size_t jobs,
     allocator_type alloc) noexcept
     : job_count_(jobs)
-    , api_(api)
     , targets_(targets)
     , name_(name)
     , data_(alloc)
+    , failed_(false)
 {
     assert_true(0 < job_count_);
 
@@ -85,6 +90,41 @@ SubchainStateData::PrehashData::PrehashData(
     assert_true(targets_.size() == data_.size());
 }
 
+auto SubchainStateData::PrehashData::Failed() const noexcept -> bool
+{
+    return failed_.load();
+}
+
+auto SubchainStateData::PrehashData::Union(alloc::Default alloc) const noexcept
+    -> Vector<gcs::Hashes>
+{
+    auto out = Vector<gcs::Hashes>{alloc};
+    out.clear();
+    out.reserve(data_.size());
+
+    for (const auto& row : data_) {
+        const auto& [height, p20, p32, p33, p64, p65, pTxo] = row;
+        auto& all = out.emplace_back();
+        all.reserve(
+            p20.first.size() + p32.first.size() + p33.first.size() +
+            p64.first.size() + p65.first.size() + pTxo.first.size());
+
+        for (const auto* hashes :
+             {&p20.first,
+              &p32.first,
+              &p33.first,
+              &p64.first,
+              &p65.first,
+              &pTxo.first}) {
+            std::ranges::copy(*hashes, std::back_inserter(all));
+        }
+
+        dedup(all);
+    }
+
+    return out;
+}
+
 auto SubchainStateData::PrehashData::hash(
     const BlockTarget& target,
     BlockData& row) noexcept -> void
@@ -103,20 +143,25 @@ auto SubchainStateData::PrehashData::hash(
 auto SubchainStateData::PrehashData::match(
     const std::string_view procedure,
     const Log& log,
-    const Vector<cfilter::GCS>& cfilters,
+    const ScanCoordinator::Request& request,
     std::atomic_bool& atLeastOnce,
     const std::size_t job,
     wallet::MatchCache::Results& results,
     MatchResults& matched,
     alloc::Default monotonic) noexcept -> void
 {
-    const auto end = std::min(targets_.size(), cfilters.size());
+    if (request.failed_) {
+        failed_.store(true);
+
+        return;
+    }
+
+    const auto end = std::min(targets_.size(), request.matched_.size());
     auto cache = std::make_tuple(
         Positions{monotonic}, Positions{monotonic}, FilterMap{monotonic});
 
     for (auto i = job; i < end; i += job_count_) {
         atLeastOnce.store(true);
-        const auto& cfilter = cfilters.at(i);
         const auto& selected = targets_.at(i);
         const auto& data = data_.at(i);
         const auto position =
@@ -126,13 +171,15 @@ auto SubchainStateData::PrehashData::match(
             procedure,
             log,
             position,
-            cfilter,
+            request.matched_.at(i),
+            request.elements_.at(i),
             selected,
             data,
             cache,
             result,
             monotonic);
     }
+
     matched.modify([&](auto& out) {
         const auto& [iClean, iDirty, iSizes] = cache;
         auto& [oClean, oDirty, oSizes] = out;
@@ -146,48 +193,35 @@ auto SubchainStateData::PrehashData::match(
     const std::string_view procedure,
     const Log& log,
     const block::Position& position,
-    const cfilter::GCS& cfilter,
+    const gcs::Hashes& matched,
+    const std::uint32_t elements,
     const BlockTarget& targets,
     const BlockData& prehashed,
     AsyncResults& cache,
     wallet::MatchIndex& results,
     alloc::Default monotonic) const noexcept -> void
 {
-    const auto GetKeys = [&](const auto& data) {
-        auto out = Set<crypto::Bip32Index>{monotonic};
-        out.clear();
+    const auto& [height, p20, p32, p33, p64, p65, pTxo] = prehashed;
+    const auto Select = [&](const auto& data, auto& out) {
         const auto& [hashes, map] = data;
-        const auto start = hashes.cbegin();
-        const auto matches = cfilter.Internal().Match(hashes, monotonic);
-
-        for (const auto& match : matches) {
-            const auto dist = std::distance(start, match);
-
-            assert_true(0 <= dist);
-
-            const auto& hash = hashes.at(static_cast<std::size_t>(dist));
 
-            for (const auto* item : map.at(hash)) { out.emplace(*item); }
+        for (const auto& hash : hashes) {
+            if (std::ranges::binary_search(matched, hash)) {
+                for (const auto* item : map.at(hash)) { out.emplace(*item); }
+            }
         }
+    };
+    const auto GetKeys = [&](const auto& data) {
+        auto out = Set<crypto::Bip32Index>{monotonic};
+        out.clear();
+        Select(data, out);
 
         return out;
     };
     const auto GetOutpoints = [&](const auto& data) {
         auto out = Set<block::Outpoint>{monotonic};
         out.clear();
-        const auto& [hashes, map] = data;
-        const auto start = hashes.cbegin();
-        const auto matches = cfilter.Internal().Match(hashes, monotonic);
-
-        for (const auto& match : matches) {
-            const auto dist = std::distance(start, match);
-
-            assert_true(0 <= dist);
-
-            const auto& hash = hashes.at(static_cast<std::size_t>(dist));
-
-            for (const auto* item : map.at(hash)) { out.emplace(*item); }
-        }
+        Select(data, out);
 
         return out;
     };
@@ -211,7 +245,6 @@ auto SubchainStateData::PrehashData::match(
         output.second += selected.first.size();
     };
     const auto& selected = targets.second;
-    const auto& [height, p20, p32, p33, p64, p65, pTxo] = prehashed;
     const auto& [s20, s32, s33, s64, s65, sTxo] = selected;
     auto output = std::pair<std::size_t, std::size_t>{};
     GetResults(
@@ -268,7 +301,7 @@ auto SubchainStateData::PrehashData::match(
         dirty.emplace(position);
     }
 
-    sizes.emplace(position.height_, cfilter.ElementCount());
+    sizes.emplace(position.height_, elements);
 }
 
 auto SubchainStateData::PrehashData::prepare(const std::size_t job) noexcept
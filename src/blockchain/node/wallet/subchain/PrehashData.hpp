@@ -17,10 +17,10 @@
 
 #include "blockchain/node/wallet/subchain/SubchainStateData.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/MatchCache.hpp"
+#include "internal/blockchain/node/wallet/ScanCoordinator.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
-#include "opentxs/blockchain/cfilter/GCS.hpp"
 #include "opentxs/blockchain/crypto/Types.hpp"
 #include "opentxs/crypto/Types.hpp"
 #include "opentxs/util/Allocator.hpp"
@@ -30,11 +30,6 @@
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs
 {
-namespace api
-{
-class Session;
-}  // namespace api
-
 namespace blockchain
 {
 namespace block
@@ -60,10 +55,16 @@ class SubchainStateData::PrehashData
 public:
     const std::size_t job_count_;
 
+    /// Returns true if any cfilter could not be matched by the most recent
+    /// call to Match
+    auto Failed() const noexcept -> bool;
+    /// Returns the union of every element type for each block, suitable for
+    /// submission to the scan coordinator
+    auto Union(alloc::Default alloc) const noexcept -> Vector<gcs::Hashes>;
     auto Match(
         const std::string_view procedure,
         const Log& log,
-        const Vector<cfilter::GCS>& cfilters,
+        const ScanCoordinator::Request& request,
         std::atomic_bool& atLeastOnce,
         wallet::MatchCache::Results& results,
         MatchResults& matched,
@@ -71,7 +72,6 @@ public:
     auto Prepare() noexcept -> void;
 
     PrehashData(
-        const api::Session& api,
         const BlockTargets& targets,
         const std::string_view name,
         wallet::MatchCache::Results& results,
@@ -81,11 +81,10 @@ public:
 
 private:
     using Hash = std::uint64_t;
-    using Hashes = Vector<Hash>;
     using ElementHashMap = Map<Hash, Vector<const crypto::Bip32Index*>>;
     using TxoHashMap = Map<Hash, Vector<const block::Outpoint*>>;
-    using ElementData = std::pair<Hashes, ElementHashMap>;
-    using TxoData = std::pair<Hashes, TxoHashMap>;
+    using ElementData = std::pair<gcs::Hashes, ElementHashMap>;
+    using TxoData = std::pair<gcs::Hashes, TxoHashMap>;
     using BlockData = std::tuple<
         block::Height,
         ElementData,  // 20 byte
@@ -96,10 +95,10 @@ private:
         TxoData>;
     using Data = Vector<BlockData>;
 
-    const api::Session& api_;
     const BlockTargets& targets_;
     const std::string_view name_;
     Data data_;
+    std::atomic_bool failed_;
 
     auto hash(const BlockTarget& target, BlockData& row) noexcept -> void;
     template <typename Input, typename Output>
@@ -110,7 +109,7 @@ private:
     auto match(
         const std::string_view procedure,
         const Log& log,
-        const Vector<cfilter::GCS>& cfilters,
+        const ScanCoordinator::Request& request,
         std::atomic_bool& atLeastOnce,
         const std::size_t job,
         wallet::MatchCache::Results& results,
@@ -120,7 +119,8 @@ private:
         const std::string_view procedure,
         const Log& log,
         const block::Position& position,
-        const cfilter::GCS& cfilter,
+        const gcs::Hashes& matched,
+        const std::uint32_t elements,
         const BlockTarget& targets,
         const BlockData& prehashed,
         AsyncResults& cache,
@@ -0,0 +1,32 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "blockchain/node/wallet/subchain/ScanJob.hpp"  // IWYU pragma: associated
+
+#include <memory>
+#include <string_view>
+
+namespace opentxs::blockchain::node::wallet
+{
+using namespace std::literals;
+
+SubchainStateData::ScanJob::ScanJob(
+    const bool rescan,
+    const Time start,
+    const block::Height startHeight,
+    const block::Height stopHeight,
+    allocator_type alloc) noexcept
+    : rescan_(rescan)
+    , procedure_(rescan ? "rescan"sv : "scan"sv)
+    , start_(start)
+    , start_height_(startHeight)
+    , stop_height_(stopHeight)
+    , selected_(alloc)
+    , results_(alloc)
+    , prehash_(std::nullopt)
+    , request_(std::make_shared<ScanCoordinator::Request>())
+{
+}
+}  // namespace opentxs::blockchain::node::wallet
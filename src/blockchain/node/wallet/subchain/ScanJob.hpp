@@ -0,0 +1,51 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "blockchain/node/wallet/subchain/PrehashData.hpp"
+#include "blockchain/node/wallet/subchain/SubchainStateData.hpp"
+#include "blockchain/node/wallet/subchain/statemachine/MatchCache.hpp"
+#include "internal/blockchain/node/wallet/ScanCoordinator.hpp"
+#include "opentxs/Time.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/util/Allocator.hpp"
+
+namespace opentxs::blockchain::node::wallet
+{
+/// State of a scan or rescan which has been submitted to the scan coordinator
+/// and is waiting for its results
+class SubchainStateData::ScanJob
+{
+public:
+    const bool rescan_;
+    const std::string_view procedure_;
+    const Time start_;
+    const block::Height start_height_;
+    const block::Height stop_height_;
+    BlockTargets selected_;
+    wallet::MatchCache::Results results_;
+    std::optional<PrehashData> prehash_;
+    std::shared_ptr<ScanCoordinator::Request> request_;
+
+    ScanJob(
+        const bool rescan,
+        const Time start,
+        const block::Height startHeight,
+        const block::Height stopHeight,
+        allocator_type alloc) noexcept;
+    ScanJob() = delete;
+    ScanJob(const ScanJob&) = delete;
+    ScanJob(ScanJob&&) = delete;
+    auto operator=(const ScanJob&) -> ScanJob& = delete;
+    auto operator=(ScanJob&&) -> ScanJob& = delete;
+
+    ~ScanJob() = default;
+};
+}  // namespace opentxs::blockchain::node::wallet
@@ -13,7 +13,6 @@
 #include <array>
 #include <chrono>
 #include <compare>
-#include <future>
 #include <iterator>
 #include <memory>
 #include <numeric>
@@ -24,6 +23,7 @@
 #include <utility>
 
 #include "blockchain/node/wallet/subchain/PrehashData.hpp"
+#include "blockchain/node/wallet/subchain/ScanJob.hpp"
 #include "blockchain/node/wallet/subchain/ScriptForm.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/MatchIndex.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/Matches.hpp"
@@ -51,8 +51,6 @@
 #include "internal/util/Bytes.hpp"
 #include "internal/util/P0330.hpp"
 #include "internal/util/Thread.hpp"
-#include "internal/util/alloc/MonotonicSync.hpp"
-#include "opentxs/Context.hpp"
 #include "opentxs/Time.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/WorkType.internal.hpp"
@@ -131,6 +129,7 @@ auto print(SubchainJobs in) noexcept -> std::string_view
             {filter, "filter"sv},
             {mempool, "mempool"sv},
             {start_scan, "start_scan"sv},
+            {finish_scan, "finish_scan"sv},
             {prepare_reorg, "prepare_reorg"sv},
             {update, "update"sv},
             {process, "process"sv},
@@ -166,6 +165,7 @@ using enum opentxs::network::zeromq::socket::Type;
 
 SubchainStateData::SubchainStateData(
     Reorg& reorg,
+    std::shared_ptr<const ScanCoordinator> scan,
     crypto::Subaccount& subaccount,
     std::shared_ptr<const api::internal::Session> api,
     std::shared_ptr<const node::Manager> node,
@@ -211,8 +211,10 @@ SubchainStateData::SubchainStateData(
           })
     , api_p_(std::move(api))
     , node_p_(std::move(node))
+    , scan_coordinator_p_(std::move(scan))
     , api_(api_p_->Self())
     , node_(*node_p_)
+    , scan_coordinator_(*scan_coordinator_p_)
     , db_(node_.Internal().DB())
     , mempool_oracle_(node_.Internal().Mempool())
     , subaccount_(subaccount)
@@ -270,6 +272,7 @@ SubchainStateData::SubchainStateData(
 
 SubchainStateData::SubchainStateData(
     Reorg& reorg,
+    std::shared_ptr<const ScanCoordinator> scan,
     crypto::Subaccount& subaccount,
     std::shared_ptr<const api::internal::Session> api,
     std::shared_ptr<const node::Manager> node,
@@ -279,6 +282,7 @@ SubchainStateData::SubchainStateData(
     allocator_type alloc) noexcept
     : SubchainStateData(
           reorg,
+          std::move(scan),
           subaccount,
           std::move(api),
           std::move(node),
@@ -424,6 +428,112 @@ auto SubchainStateData::do_startup(allocator_type monotonic) noexcept -> bool
     return false;
 }
 
+auto SubchainStateData::FinishScan(
+    ScanJob& job,
+    block::Position& highestTested,
+    Vector<ScanStatus>& out,
+    allocator_type monotonic) const noexcept -> std::optional<block::Position>
+{
+    try {
+        const auto& log = log_;
+        const auto& name = name_;
+        const auto& procedure = job.procedure_;
+        const auto& request = *job.request_;
+        const auto startHeight = job.start_height_;
+        auto atLeastOnce = std::atomic_bool{false};
+        auto highestClean = std::optional<block::Position>{std::nullopt};
+        log_()(name)(" ")(procedure)(" received results for ")(
+            request.matched_.size())(" cfilters after ")(
+            std::chrono::nanoseconds{Clock::now() - job.start_})
+            .Flush();
+        auto data = MatchResults{std::make_tuple(
+            Positions{monotonic}, Positions{monotonic}, FilterMap{monotonic})};
+        auto& prehash = job.prehash_.value();
+        prehash.Match(
+            procedure,
+            log,
+            request,
+            atLeastOnce,
+            job.results_,
+            data,
+            monotonic);
+
+        if (prehash.Failed()) {
+            LogError()()(name)(" ")(procedure)(
+                " failed to match cfilters from ")(startHeight)(" to ")(
+                job.stop_height_)
+                .Flush();
+
+            throw std::runtime_error{""};
+        }
+
+        {
+            auto handle = data.lock_shared();
+            const auto& [clean, dirty, sizes] = *handle;
+
+            if (auto size = dirty.size(); 0 < size) {
+                log_()(name)(" requesting ")(
+                    size)(" block hashes from block oracle")
+                    .Flush();
+                to_block_oracle_.SendDeferred([&](const auto& positions) {
+                    auto work =
+                        MakeWork(node::blockoracle::Job::request_blocks);
+
+                    for (const auto& position : positions) {
+                        const auto& [height, hash] = position;
+                        work.AddFrame(hash);
+                        out.emplace_back(ScanState::dirty, position);
+                    }
+
+                    return work;
+                }(dirty));
+            }
+
+            highestClean = highest_clean(*handle, highestTested);
+
+            if (false == job.rescan_) {
+                std::ranges::transform(
+                    sizes,
+                    std::back_inserter(filter_sizes_),
+                    [](const auto& in) { return in.second; });
+
+                // NOTE these statements calculate a 1000 block (or whatever
+                // cfilter_size_window_ is set to) simple moving average of
+                // cfilter element sizes
+
+                while (cfilter_size_window_ < filter_sizes_.size()) {
+                    filter_sizes_.pop_front();
+                }
+
+                const auto totalCfilterElements = std::accumulate(
+                    filter_sizes_.begin(), filter_sizes_.end(), 0_uz);
+                elements_per_cfilter_.store(std::max(
+                    1_uz, totalCfilterElements / filter_sizes_.size()));
+            }
+        }
+
+        if (atLeastOnce.load()) {
+            if (false == job.results_.empty()) {
+                match_cache_.lock()->Add(std::move(job.results_));
+            }
+
+            const auto count = out.size();
+            log()(name)(" ")(procedure)(" found ")(
+                count)(" new potential matches between blocks ")(
+                startHeight)(" and ")(highestTested.height_)(" in ")(
+                std::chrono::nanoseconds{Clock::now() - job.start_})
+                .Flush();
+        } else {
+            log_()(name)(" ")(procedure)(" interrupted").Flush();
+        }
+
+        return highestClean;
+    } catch (...) {
+
+        return std::nullopt;
+    }
+}
+
 auto SubchainStateData::get_account_targets(
     const Elements& elements,
     alloc::Default alloc) const noexcept -> Targets
@@ -582,6 +692,141 @@ auto SubchainStateData::pipeline(
     }
 }
 
+auto SubchainStateData::prepare_scan(
+    const bool rescan,
+    const block::Position best,
+    const block::Height stop,
+    const block::Position& highestTested,
+    SimpleCallback done,
+    allocator_type monotonic) const noexcept(false) -> std::shared_ptr<ScanJob>
+{
+    using namespace std::literals;
+    const auto procedure = rescan ? "rescan"sv : "scan"sv;
+    const auto start = Clock::now();
+    const auto startHeight = highestTested.height_ + 1;
+    const auto elementsPerFilter = [this] {
+        const auto cached = elements_per_cfilter_.load();
+
+        if (0_uz == cached) {
+            const auto chainDefault =
+                params::get(chain_).CfilterBatchEstimate();
+
+            return std::max<std::size_t>(1_uz, chainDefault);
+        } else {
+
+            return cached;
+        }
+    }();
+
+    assert_true(0_uz < elementsPerFilter);
+
+    constexpr auto GetBatchSize = [](std::size_t cfilter, std::size_t user) {
+        constexpr auto cfilterWeight = 1_uz;
+        constexpr auto walletWeight = 5_uz;
+        constexpr auto target = 425000_uz;
+        constexpr auto max = 10000_uz;
+
+        return std::min<std::size_t>(
+            std::max<std::size_t>(
+                (target * (cfilterWeight * walletWeight)) /
+                    ((cfilterWeight * cfilter) + (walletWeight * user)),
+                1_uz),
+            max);
+    };
+    static_assert(GetBatchSize(1, 1) == 10000);
+    static_assert(GetBatchSize(25, 40) == 9444);
+    static_assert(GetBatchSize(1000, 40) == 1770);
+    static_assert(GetBatchSize(25, 400) == 1049);
+    static_assert(GetBatchSize(1000, 400) == 708);
+    static_assert(GetBatchSize(25, 4000) == 106);
+    static_assert(GetBatchSize(25, 40000) == 10);
+    static_assert(GetBatchSize(1000, 40000) == 10);
+    static_assert(GetBatchSize(25, 400000) == 1);
+    static_assert(GetBatchSize(25, 4000000) == 1);
+    static_assert(GetBatchSize(10000, 4000000) == 1);
+    auto elementcache = element_cache_.lock_shared();
+    const auto& elements = elementcache->GetElements();
+    const auto elementCount = std::max<std::size_t>(elements.size(), 1_uz);
+    // NOTE attempting to scan too many filters at once causes this
+    // function to take excessive time to execute, which means the Scan
+    // and Rescan Actors will be unable to process new messages for an
+    // extended amount of time which has many negative side effects. The
+    // GetBatchSize function attempts to prevent this from happening by
+    // limiting the batch size to a reasonable value based on the
+    // average cfilter element count (estimated) and match set for this
+    // subchain (known).
+    const auto threads = choose_thread_count(elementCount);
+
+    assert_true(0_uz < threads);
+
+    const auto scanBatch = std::min(
+        maximum_scan_, GetBatchSize(elementsPerFilter, elementCount) * threads);
+    log()(name_)(" filter size: ")(elementsPerFilter)(" wallet size: ")(
+        elementCount)(" batch size: ")(scanBatch)
+        .Flush();
+    const auto stopHeight = std::min(
+        std::min<block::Height>(startHeight + scanBatch - 1, best.height_),
+        stop);
+
+    if (startHeight > stopHeight) {
+        log()(name_)(" attempted to ")(procedure)(" filters from ")(
+            startHeight)(" to ")(stopHeight)(" but this is impossible")
+            .Flush();
+
+        throw std::runtime_error{""};
+    }
+
+    log()(name_)(" ")(procedure)("ning filters from ")(startHeight)(" to ")(
+        stopHeight)
+        .Flush();
+    const auto target = static_cast<std::size_t>(stopHeight - startHeight + 1);
+    const auto blocks =
+        node_.HeaderOracle().BestHashes(startHeight, target, monotonic);
+
+    if (blocks.empty()) { throw std::runtime_error{""}; }
+
+    auto out = std::allocate_shared<ScanJob>(
+        alloc::PMR<ScanJob>{get_allocator()},
+        rescan,
+        start,
+        startHeight,
+        stopHeight,
+        get_allocator());
+    auto& job = *out;
+    auto& selected = job.selected_;
+    select_targets(*elementcache, blocks, elements, startHeight, selected);
+    elementcache.reset();
+
+    assert_false(selected.empty());
+
+    auto& prehash = job.prehash_.emplace(
+        selected,
+        name_,
+        job.results_,
+        startHeight,
+        std::min(threads, selected.size()),
+        get_allocator());
+    prehash.Prepare();
+    log_()(name_)(" ")(procedure)(" calculated target hashes for ")(
+        blocks.size())(" cfilters in ")(
+        std::chrono::nanoseconds{Clock::now() - start})
+        .Flush();
+    auto& request = *job.request_;
+    request.blocks_.reserve(selected.size());
+    std::ranges::transform(
+        selected, std::back_inserter(request.blocks_), [](const auto& in) {
+            return in.first;
+        });
+    request.targets_ = prehash.Union(request.targets_.get_allocator());
+    request.done_ = std::move(done);
+    // NOTE the coordinator loads and matches the cfilters on a thread
+    // pool thread, combined with the requests of any other subchain
+    // covering the same blocks, and executes done when finished
+    scan_coordinator_.Submit(job.request_);
+
+    return out;
+}
+
 auto SubchainStateData::process_prepare_reorg(Message&& in) noexcept -> void
 {
     const auto body = in.Payload();
@@ -718,270 +963,38 @@ auto SubchainStateData::ReorgTarget(
 auto SubchainStateData::Rescan(
     const block::Position best,
     const block::Height stop,
-    block::Position& highestTested,
-    Vector<ScanStatus>& out,
-    allocator_type monotonic) const noexcept -> std::optional<block::Position>
+    const block::Position& highestTested,
+    SimpleCallback done,
+    allocator_type monotonic) const noexcept -> std::shared_ptr<ScanJob>
 {
-    return scan(true, best, stop, highestTested, out, monotonic);
+    return scan(true, best, stop, highestTested, std::move(done), monotonic);
 }
 
 auto SubchainStateData::Scan(
     const block::Position best,
     const block::Height stop,
-    block::Position& highestTested,
-    Vector<ScanStatus>& out,
-    allocator_type monotonic) const noexcept -> std::optional<block::Position>
+    const block::Position& highestTested,
+    SimpleCallback done,
+    allocator_type monotonic) const noexcept -> std::shared_ptr<ScanJob>
 {
-    return scan(false, best, stop, highestTested, out, monotonic);
+    return scan(false, best, stop, highestTested, std::move(done), monotonic);
 }
 
 auto SubchainStateData::scan(
     const bool rescan,
     const block::Position best,
     const block::Height stop,
-    block::Position& highestTested,
-    Vector<ScanStatus>& out,
-    allocator_type monotonic) const noexcept -> std::optional<block::Position>
+    const block::Position& highestTested,
+    SimpleCallback done,
+    allocator_type monotonic) const noexcept -> std::shared_ptr<ScanJob>
 {
     try {
-        using namespace std::literals;
-        const auto procedure = rescan ? "rescan"sv : "scan"sv;
-        const auto& log = log_;
-        const auto& name = name_;
-        const auto start = Clock::now();
-        const auto startHeight = highestTested.height_ + 1;
-        auto atLeastOnce = std::atomic_bool{false};
-        auto highestClean = std::optional<block::Position>{std::nullopt};
-        auto resultMap = wallet::MatchCache::Results{get_allocator()};
-        scan(
-            log,
-            start,
-            rescan,
-            best,
-            stop,
-            startHeight,
-            procedure,
-            atLeastOnce,
-            highestClean,
-            highestTested,
-            resultMap,
-            out,
-            monotonic);
 
-        if (atLeastOnce.load()) {
-            if (false == resultMap.empty()) {
-                match_cache_.lock()->Add(std::move(resultMap));
-            }
-
-            const auto count = out.size();
-            log()(name)(" ")(procedure)(" found ")(
-                count)(" new potential matches between blocks ")(
-                startHeight)(" and ")(highestTested.height_)(" in ")(
-                std::chrono::nanoseconds{Clock::now() - start})
-                .Flush();
-        } else {
-            log_()(name)(" ")(procedure)(" interrupted").Flush();
-        }
-
-        return highestClean;
+        return prepare_scan(
+            rescan, best, stop, highestTested, std::move(done), monotonic);
     } catch (...) {
 
-        return std::nullopt;
-    }
-}
-
-auto SubchainStateData::scan(
-    const Log& log,
-    const Time start,
-    const bool rescan,
-    const block::Position& best,
-    const block::Height stop,
-    const block::Height startHeight,
-    const std::string_view procedure,
-    std::atomic_bool& atLeastOnce,
-    std::optional<block::Position>& highestClean,
-    block::Position& highestTested,
-    wallet::MatchCache::Results& results,
-    Vector<ScanStatus>& out,
-    allocator_type monotonic) const noexcept(false) -> void
-{
-    const auto elementsPerFilter = [this] {
-        const auto cached = elements_per_cfilter_.load();
-
-        if (0_uz == cached) {
-            const auto chainDefault =
-                params::get(chain_).CfilterBatchEstimate();
-
-            return std::max<std::size_t>(1_uz, chainDefault);
-        } else {
-
-            return cached;
-        }
-    }();
-
-    assert_true(0_uz < elementsPerFilter);
-
-    constexpr auto GetBatchSize = [](std::size_t cfilter, std::size_t user) {
-        constexpr auto cfilterWeight = 1_uz;
-        constexpr auto walletWeight = 5_uz;
-        constexpr auto target = 425000_uz;
-        constexpr auto max = 10000_uz;
-
-        return std::min<std::size_t>(
-            std::max<std::size_t>(
-                (target * (cfilterWeight * walletWeight)) /
-                    ((cfilterWeight * cfilter) + (walletWeight * user)),
-                1_uz),
-            max);
-    };
-    static_assert(GetBatchSize(1, 1) == 10000);
-    static_assert(GetBatchSize(25, 40) == 9444);
-    static_assert(GetBatchSize(1000, 40) == 1770);
-    static_assert(GetBatchSize(25, 400) == 1049);
-    static_assert(GetBatchSize(1000, 400) == 708);
-    static_assert(GetBatchSize(25, 4000) == 106);
-    static_assert(GetBatchSize(25, 40000) == 10);
-    static_assert(GetBatchSize(1000, 40000) == 10);
-    static_assert(GetBatchSize(25, 400000) == 1);
-    static_assert(GetBatchSize(25, 4000000) == 1);
-    static_assert(GetBatchSize(10000, 4000000) == 1);
-    auto elementcache = element_cache_.lock_shared();
-    const auto& elements = elementcache->GetElements();
-    const auto elementCount = std::max<std::size_t>(elements.size(), 1_uz);
-    // NOTE attempting to scan too many filters at once causes this
-    // function to take excessive time to execute, which means the Scan
-    // and Rescan Actors will be unable to process new messages for an
-    // extended amount of time which has many negative side effects. The
-    // GetBatchSize function attempts to prevent this from happening by
-    // limiting the batch size to a reasonable value based on the
-    // average cfilter element count (estimated) and match set for this
-    // subchain (known).
-    const auto threads = choose_thread_count(elementCount);
-
-    assert_true(0_uz < threads);
-
-    const auto scanBatch = std::min(
-        maximum_scan_, GetBatchSize(elementsPerFilter, elementCount) * threads);
-    log()(name_)(" filter size: ")(elementsPerFilter)(" wallet size: ")(
-        elementCount)(" batch size: ")(scanBatch)
-        .Flush();
-    const auto stopHeight = std::min(
-        std::min<block::Height>(startHeight + scanBatch - 1, best.height_),
-        stop);
-
-    if (startHeight > stopHeight) {
-        log()(name_)(" attempted to ")(procedure)(" filters from ")(
-            startHeight)(" to ")(stopHeight)(" but this is impossible")
-            .Flush();
-
-        throw std::runtime_error{""};
-    }
-
-    log()(name_)(" ")(procedure)("ning filters from ")(startHeight)(" to ")(
-        stopHeight)
-        .Flush();
-    const auto target = static_cast<std::size_t>(stopHeight - startHeight + 1);
-    const auto blocks =
-        node_.HeaderOracle().BestHashes(startHeight, target, monotonic);
-
-    if (blocks.empty()) { throw std::runtime_error{""}; }
-
-    auto filterPromise = std::promise<Vector<cfilter::GCS>>{};
-    auto filterFuture = filterPromise.get_future();
-    RunJob([me = shared_from_this(), &filterPromise, &blocks] {
-        auto alloc = me->get_allocator();
-        auto mr = alloc::MonotonicSync{alloc.resource()};
-        filterPromise.set_value(me->node_.FilterOracle().LoadFilters(
-            me->filter_type_, blocks, {alloc, std::addressof(mr)}));
-    });
-    auto selected = BlockTargets{monotonic};
-    select_targets(*elementcache, blocks, elements, startHeight, selected);
-    elementcache.reset();
-
-    assert_false(selected.empty());
-
-    auto prehash = PrehashData{
-        api_,
-        selected,
-        name_,
-        results,
-        startHeight,
-        std::min(threads, selected.size()),
-        monotonic};
-    prehash.Prepare();
-    const auto havePrehash = Clock::now();
-    log_()(name_)(" ")(procedure)(" calculated target hashes for ")(
-        blocks.size())(" cfilters in ")(
-        std::chrono::nanoseconds{havePrehash - start})
-        .Flush();
-    const auto cfilters = [&] {
-        auto output = filterFuture.get();
-        output.erase(
-            std::ranges::find_if(
-                output,
-                [](const auto& filter) { return false == filter.IsValid(); }),
-            output.end());
-
-        return output;
-    }();
-    const auto haveCfilters = Clock::now();
-    log_()(name_)(" ")(procedure)(" loaded cfilters in ")(
-        std::chrono::nanoseconds{haveCfilters - havePrehash})
-        .Flush();
-    const auto cfilterCount = cfilters.size();
-
-    assert_true(cfilterCount <= blocks.size());
-
-    auto data = MatchResults{std::make_tuple(
-        Positions{monotonic}, Positions{monotonic}, FilterMap{monotonic})};
-
-    assert_true(0_uz < selected.size());
-
-    prehash.Match(
-        procedure, log, cfilters, atLeastOnce, results, data, monotonic);
-
-    {
-        auto handle = data.lock_shared();
-        const auto& [clean, dirty, sizes] = *handle;
-
-        if (auto size = dirty.size(); 0 < size) {
-            log_()(name_)(" requesting ")(
-                size)(" block hashes from block oracle")
-                .Flush();
-            to_block_oracle_.SendDeferred([&](const auto& positions) {
-                auto work = MakeWork(node::blockoracle::Job::request_blocks);
-
-                for (const auto& position : positions) {
-                    const auto& [height, hash] = position;
-                    work.AddFrame(hash);
-                    out.emplace_back(ScanState::dirty, position);
-                }
-
-                return work;
-            }(dirty));
-        }
-
-        highestClean = highest_clean(*handle, highestTested);
-
-        if (false == rescan) {
-            std::ranges::transform(
-                sizes, std::back_inserter(filter_sizes_), [](const auto& in) {
-                    return in.second;
-                });
-
-            // NOTE these statements calculate a 1000 block (or whatever
-            // cfilter_size_window_ is set to) simple moving average of
-            // cfilter element sizes
-
-            while (cfilter_size_window_ < filter_sizes_.size()) {
-                filter_sizes_.pop_front();
-            }
-
-            const auto totalCfilterElements = std::accumulate(
-                filter_sizes_.begin(), filter_sizes_.end(), 0_uz);
-            elements_per_cfilter_.store(
-                std::max(1_uz, totalCfilterElements / filter_sizes_.size()));
-        }
+        return {};
     }
 }
 
@@ -1254,6 +1267,7 @@ auto SubchainStateData::state_normal(const Work work, Message&& msg) noexcept
         case Work::filter:
         case Work::mempool:
         case Work::start_scan:
+        case Work::finish_scan:
         case Work::update:
         case Work::process:
         case Work::watchdog:
@@ -1292,6 +1306,7 @@ auto SubchainStateData::state_pre_shutdown(
         case Work::filter:
         case Work::mempool:
         case Work::start_scan:
+        case Work::finish_scan:
         case Work::update:
         case Work::process:
         case Work::watchdog:
@@ -1332,6 +1347,7 @@ auto SubchainStateData::state_reorg(const Work work, Message&& msg) noexcept
         case Work::filter:
         case Work::mempool:
         case Work::start_scan:
+        case Work::finish_scan:
         case Work::update:
         case Work::process:
         case Work::watchdog:
@@ -31,6 +31,7 @@
 #include "internal/util/P0330.hpp"
 #include "internal/util/Timer.hpp"
 #include "opentxs/Time.hpp"
+#include "opentxs/Types.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/Outpoint.hpp"
@@ -96,6 +97,7 @@ namespace statemachine
 class Job;
 }  // namespace statemachine
 
+class ScanCoordinator;
 class ScriptForm;
 struct MatchIndex;
 }  // namespace wallet
@@ -131,6 +133,7 @@ class SubchainStateData
 private:
     std::shared_ptr<const api::internal::Session> api_p_;
     std::shared_ptr<const node::Manager> node_p_;
+    std::shared_ptr<const ScanCoordinator> scan_coordinator_p_;
 
 public:
     using ElementCache =
@@ -143,8 +146,11 @@ public:
         std::function<void(const Vector<block::Position>&)>;
     using State = JobState;
 
+    class ScanJob;
+
     const api::Session& api_;
     const node::Manager& node_;
+    const ScanCoordinator& scan_coordinator_;
     database::Wallet& db_;
     const node::internal::Mempool& mempool_oracle_;
     crypto::Subaccount& subaccount_;
@@ -180,6 +186,12 @@ public:
     {
         return scan_threshold_ + maximum_scan_;
     }
+    auto FinishScan(
+        ScanJob& job,
+        block::Position& highestTested,
+        Vector<ScanStatus>& out,
+        allocator_type monotonic) const noexcept
+        -> std::optional<block::Position>;
     auto GetReorg() const noexcept -> wallet::Reorg& { return reorg_; }
     auto IndexElement(
         const cfilter::Type type,
@@ -198,21 +210,24 @@ public:
         const block::Position& reorg,
         const block::Position& current) const noexcept -> block::Position;
     auto ReportScan(const block::Position& pos) const noexcept -> void;
+    /// Submit a range of cfilters to the scan coordinator
+    ///
+    /// done is executed on a thread pool thread when the results are ready,
+    /// after which FinishScan must be called from the actor which owns the
+    /// returned job. Returns nullptr if the scan could not be started.
     auto Rescan(
         const block::Position best,
         const block::Height stop,
-        block::Position& highestTested,
-        Vector<ScanStatus>& out,
-        allocator_type monotonic) const noexcept
-        -> std::optional<block::Position>;
+        const block::Position& highestTested,
+        SimpleCallback done,
+        allocator_type monotonic) const noexcept -> std::shared_ptr<ScanJob>;
     auto RescanFinished() const noexcept -> void;
     auto Scan(
         const block::Position best,
         const block::Height stop,
-        block::Position& highestTested,
-        Vector<ScanStatus>& out,
-        allocator_type monotonic) const noexcept
-        -> std::optional<block::Position>;
+        const block::Position& highestTested,
+        SimpleCallback done,
+        allocator_type monotonic) const noexcept -> std::shared_ptr<ScanJob>;
     auto TriggerRescan() const noexcept -> void;
 
     auto Init(std::shared_ptr<SubchainStateData> me) noexcept -> void final;
@@ -233,6 +248,7 @@ protected:
 
     SubchainStateData(
         Reorg& reorg,
+        std::shared_ptr<const ScanCoordinator> scan,
         crypto::Subaccount& subaccount,
         std::shared_ptr<const api::internal::Session> api,
         std::shared_ptr<const node::Manager> node,
@@ -316,6 +332,14 @@ private:
         const block::Matches& matches,
         block::Transaction tx,
         allocator_type monotonic) const noexcept -> void = 0;
+    auto prepare_scan(
+        const bool rescan,
+        const block::Position best,
+        const block::Height stop,
+        const block::Position& highestTested,
+        SimpleCallback done,
+        allocator_type monotonic) const noexcept(false)
+        -> std::shared_ptr<ScanJob>;
     auto reorg_children() const noexcept -> std::size_t;
     auto supported_scripts(const crypto::Element& element) const noexcept
         -> UnallocatedVector<ScriptForm>;
@@ -323,24 +347,9 @@ private:
         const bool rescan,
         const block::Position best,
         const block::Height stop,
-        block::Position& highestTested,
-        Vector<ScanStatus>& out,
-        allocator_type monotonic) const noexcept
-        -> std::optional<block::Position>;
-    auto scan(
-        const Log& log,
-        const Time start,
-        const bool rescan,
-        const block::Position& best,
-        const block::Height stop,
-        const block::Height startHeight,
-        const std::string_view procedure,
-        std::atomic_bool& atLeastOnce,
-        std::optional<block::Position>& highestClean,
-        block::Position& highestTested,
-        wallet::MatchCache::Results& results,
-        Vector<ScanStatus>& out,
-        allocator_type monotonic) const noexcept(false) -> void;
+        const block::Position& highestTested,
+        SimpleCallback done,
+        allocator_type monotonic) const noexcept -> std::shared_ptr<ScanJob>;
     auto select_all(
         const block::Position& block,
         const Elements& in,
@@ -386,6 +395,7 @@ private:
 
     SubchainStateData(
         Reorg& reorg,
+        std::shared_ptr<const ScanCoordinator> scan,
         crypto::Subaccount& subaccount,
         std::shared_ptr<const api::internal::Session> api,
         std::shared_ptr<const node::Manager> node,
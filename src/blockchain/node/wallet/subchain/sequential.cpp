@@ -13,7 +13,7 @@ namespace opentxs::blockchain::node::wallet
 auto SubchainStateData::PrehashData::Match(
     const std::string_view procedure,
     const Log& log,
-    const Vector<cfilter::GCS>& cfilters,
+    const ScanCoordinator::Request& request,
     std::atomic_bool& atLeastOnce,
     wallet::MatchCache::Results& results,
     MatchResults& matched,
@@ -23,7 +23,7 @@ auto SubchainStateData::PrehashData::Match(
         match(
             procedure,
             log,
-            cfilters,
+            request,
             atLeastOnce,
             n,
             results,
@@ -326,6 +326,11 @@ auto Job::process_filter(Message&&, block::Position&&, allocator_type) noexcept
     LogAbort()()(name_)(": unhandled message type").Abort();
 }
 
+auto Job::process_finish_scan(Message&&, allocator_type) noexcept -> void
+{
+    LogAbort()()(name_)(": unhandled message type").Abort();
+}
+
 auto Job::process_key(Message&& in, allocator_type) noexcept -> void
 {
     LogAbort()()(name_)(": unhandled message type").Abort();
@@ -434,6 +439,9 @@ auto Job::state_normal(
         case Work::start_scan: {
             process_start_scan(std::move(msg), monotonic);
         } break;
+        case Work::finish_scan: {
+            process_finish_scan(std::move(msg), monotonic);
+        } break;
         case Work::prepare_reorg: {
             process_prepare_reorg(std::move(msg));
         } break;
@@ -486,6 +494,7 @@ auto Job::state_pre_shutdown(const Work work, Message&& msg) noexcept -> void
         case Work::filter:
         case Work::mempool:
         case Work::start_scan:
+        case Work::finish_scan:
         case Work::update:
         case Work::process:
         case Work::rescan:
@@ -523,6 +532,7 @@ auto Job::state_reorg(const Work work, Message&& msg) noexcept -> void
         } break;
         case Work::mempool:
         case Work::start_scan:
+        case Work::finish_scan:
         case Work::prepare_reorg:
         case Work::process:
         case Work::reprocess:
@@ -15,6 +15,7 @@
 #include "internal/blockchain/node/wallet/Types.hpp"
 #include "internal/blockchain/node/wallet/subchain/statemachine/Job.hpp"
 #include "internal/blockchain/node/wallet/subchain/statemachine/Types.hpp"
+#include "internal/util/Log.hpp"
 #include "internal/util/Timer.hpp"
 #include "opentxs/network/zeromq/Types.hpp"
 #include "opentxs/network/zeromq/socket/Types.hpp"
@@ -101,6 +102,13 @@ protected:
     auto add_last_reorg(Message& out) const noexcept -> void;
     auto last_reorg() const noexcept -> std::optional<StateSequence>;
     auto state() const noexcept -> State { return state_.load(); }
+    // NOTE jobs log at trace level, so per block messages guarded by this
+    // function are compiled out along with trace logging
+    auto tracing() const noexcept -> bool
+    {
+        return opentxs::internal::Log::Active<opentxs::internal::Log::trace_>(
+            log_);
+    }
 
     virtual auto do_reorg(
         const node::HeaderOracle& oracle,
@@ -171,6 +179,9 @@ private:
         Message&& in,
         block::Position&& tip,
         allocator_type monotonic) noexcept -> void;
+    virtual auto process_finish_scan(
+        Message&& in,
+        allocator_type monotonic) noexcept -> void;
     virtual auto process_key(Message&& in, allocator_type monotonic) noexcept
         -> void;
     virtual auto process_mempool(
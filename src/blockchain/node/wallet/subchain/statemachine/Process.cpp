@@ -292,7 +292,9 @@ auto Process::Imp::process_blocks(
 
         if (auto index = downloading_index_.find(id);
             downloading_index_.end() != index) {
-            log_()(name_)(" processing block ")(id.asHex()).Flush();
+            if (tracing()) {
+                log_()(name_)(" processing block ")(id.asHex()).Flush();
+            }
 
             for (const auto& tx : block.get()) { txid_cache_.emplace(tx.ID()); }
 
@@ -385,7 +387,11 @@ auto Process::Imp::process_reprocess(
     blocks.reserve(count);
 
     for (auto& [type, position] : dirty) {
-        log_()(name_)(" scheduling re-processing for block ")(position).Flush();
+        if (tracing()) {
+            log_()(name_)(" scheduling re-processing for block ")(position)
+                .Flush();
+        }
+
         blocks.emplace_back(std::move(position));
     }
 
@@ -403,7 +409,12 @@ auto Process::Imp::queue_downloads(allocator_type monotonic) noexcept -> void
 
     for (auto n = 0_uz; n < count; ++n) {
         auto& position = waiting_.front();
-        log_()(name_)(" adding block ")(position)(" to download queue").Flush();
+
+        if (tracing()) {
+            log_()(name_)(" adding block ")(position)(" to download queue")
+                .Flush();
+        }
+
         blocks.emplace_back(std::move(position));
         waiting_.pop_front();
     }
@@ -430,7 +441,12 @@ auto Process::Imp::queue_process() noexcept -> bool
         assert_true(processing_.end() != i);
 
         auto& [position, block] = *i;
-        log_()(name_)(" adding block ")(position)(" to process queue").Flush();
+
+        if (tracing()) {
+            log_()(name_)(" adding block ")(position)(" to process queue")
+                .Flush();
+        }
+
         auto me = shared_from_this();
         auto post = std::make_shared<ScopeGuard>(
             [me] { ++me->running_; }, [me] { --me->running_; });
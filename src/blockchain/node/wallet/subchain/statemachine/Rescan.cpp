@@ -12,6 +12,7 @@
 #include <span>
 #include <utility>
 
+#include "blockchain/node/wallet/subchain/ScanJob.hpp"
 #include "blockchain/node/wallet/subchain/SubchainStateData.hpp"
 #include "internal/blockchain/database/Wallet.hpp"
 #include "internal/blockchain/node/wallet/Reorg.hpp"
@@ -21,6 +22,7 @@
 #include "internal/network/zeromq/Pipeline.hpp"
 #include "internal/network/zeromq/socket/Pipeline.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/alloc/Logging.hpp"
 #include "opentxs/WorkType.internal.hpp"
 #include "opentxs/api/Network.hpp"
@@ -80,6 +82,9 @@ Rescan::Imp::Imp(
     , filter_tip_(std::nullopt)
     , highest_dirty_(parent_.null_position_)
     , dirty_(alloc)
+    , scan_job_()
+    , scan_from_()
+    , scan_sequence_(0)
 {
 }
 
@@ -112,6 +117,15 @@ auto Rescan::Imp::before(const block::Position& position) const noexcept
         std::max<block::Height>(position.height_ - 1, 0));
 }
 
+auto Rescan::Imp::cancel_scan() noexcept -> void
+{
+    if (nullptr != scan_job_) {
+        log_()(name_)(" discarding results of rescan from ")(scan_from_)
+            .Flush();
+        scan_job_.reset();
+    }
+}
+
 auto Rescan::Imp::can_advance() const noexcept -> bool
 {
     const auto target = [this] {
@@ -186,6 +200,7 @@ auto Rescan::Imp::do_reorg(
     if (false == parent_.need_reorg_) { return true; }
 
     const auto& [position, tx] = params;
+    cancel_scan();
 
     if (last_scanned_.has_value()) {
         const auto target =
@@ -296,6 +311,7 @@ auto Rescan::Imp::process_dirty(const Set<block::Position>& dirty) noexcept
 
 auto Rescan::Imp::process_do_rescan(Message&& in) noexcept -> void
 {
+    cancel_scan();
     last_scanned_.reset();
     highest_dirty_ = parent_.null_position_;
     dirty_.clear();
@@ -330,6 +346,72 @@ auto Rescan::Imp::process_filter(
     do_work(monotonic);
 }
 
+auto Rescan::Imp::process_finish_scan(
+    Message&& in,
+    allocator_type monotonic) noexcept -> void
+{
+    const auto body = in.Payload();
+
+    assert_true(1_uz < body.size());
+
+    if ((nullptr == scan_job_) ||
+        (body[1].as<std::size_t>() != scan_sequence_)) {
+        log_()(name_)(" ignoring stale rescan results").Flush();
+
+        return;
+    }
+
+    auto job = std::move(scan_job_);
+    scan_job_.reset();
+    auto highestTested = scan_from_;
+    auto dirty = Vector<ScanStatus>{get_allocator()};
+    auto highestClean =
+        parent_.FinishScan(*job, highestTested, dirty, monotonic);
+
+    if (highestClean.has_value()) {
+        log_()(name_)(" last scanned updated to ")(highestClean.value())
+            .Flush();
+        set_last_scanned(std::move(highestClean));
+        // TODO The interval used for rescanning should never include any dirty
+        // blocks so is it possible for prune() to ever do anything?
+        prune();
+    } else {
+        // NOTE either the first tested block was dirty or else the scan was
+        // interrupted for a state change
+    }
+
+    if (false == last_scanned_.has_value()) {
+        LogError()()(
+            name_)(": contract violated, possibly due to in-process subchain "
+                   "rescan operation")
+            .Flush();
+        parent_.TriggerRescan();
+
+        return;
+    }
+
+    if (auto count = dirty.size(); 0u < count) {
+        log_()(name_)(" re-processing ")(count)(" items:").Flush();
+        auto work = MakeWork(Work::reprocess);
+        add_last_reorg(work);
+
+        for (auto& status : dirty) {
+            auto& [type, position] = status;
+
+            if (tracing()) { log_(" * ")(position).Flush(); }
+
+            encode(status, work);
+            dirty_.emplace(std::move(position));
+        }
+
+        to_process_.SendDeferred(std::move(work));
+    } else {
+        log_()(name_)(" all blocks are clean after rescan").Flush();
+    }
+
+    do_work(monotonic);
+}
+
 auto Rescan::Imp::prune() noexcept -> void
 {
     if (false == last_scanned_.has_value()) {
@@ -400,6 +482,22 @@ auto Rescan::Imp::rescan_finished() const noexcept -> bool
     return false;
 }
 
+auto Rescan::Imp::scan_finished() noexcept -> SimpleCallback
+{
+    // NOTE the callback is executed by the scan coordinator on a thread pool
+    // thread so it only signals this actor to finish the job
+    return [weak = weak_from_this(), sequence = ++scan_sequence_] {
+        if (auto me = weak.lock(); me) {
+            me->pipeline_.Push([&] {
+                auto out = MakeWork(Work::finish_scan);
+                out.AddFrame(sequence);
+
+                return out;
+            }());
+        }
+    };
+}
+
 auto Rescan::Imp::set_last_scanned(const block::Position& value) noexcept
     -> void
 {
@@ -462,6 +560,12 @@ auto Rescan::Imp::work(allocator_type monotonic) noexcept -> bool
         Job::work(monotonic);
     }};
 
+    if (nullptr != scan_job_) {
+        log_()(name_)(" rescan in progress").Flush();
+
+        return false;
+    }
+
     if (false == parent_.scan_dirty_) {
         log_()(name_)(" rescan is not necessary").Flush();
 
@@ -487,49 +591,20 @@ auto Rescan::Imp::work(allocator_type monotonic) noexcept -> bool
         return false;
     }
 
-    auto dirty = Vector<ScanStatus>{get_allocator()};
-    auto highestClean = parent_.Rescan(
-        filter_tip_.value(), stop(), highestTested, dirty, monotonic);
-
-    if (highestClean.has_value()) {
-        log_()(name_)(" last scanned updated to ")(highestClean.value())
-            .Flush();
-        set_last_scanned(std::move(highestClean));
-        // TODO The interval used for rescanning should never include any dirty
-        // blocks so is it possible for prune() to ever do anything?
-        prune();
-    } else {
-        // NOTE either the first tested block was dirty or else the scan was
-        // interrupted for a state change
-    }
+    scan_from_ = std::move(highestTested);
+    scan_job_ = parent_.Rescan(
+        filter_tip_.value(),
+        stopHeight,
+        scan_from_,
+        scan_finished(),
+        monotonic);
 
-    if (false == last_scanned_.has_value()) {
-        LogError()()(
-            name_)(": contract violated, possibly due to in-process subchain "
-                   "rescan operation")
-            .Flush();
-        parent_.TriggerRescan();
+    if (nullptr != scan_job_) {
+        log_()(name_)(" waiting for rescan results").Flush();
 
         return false;
     }
 
-    if (auto count = dirty.size(); 0u < count) {
-        log_()(name_)(" re-processing ")(count)(" items:").Flush();
-        auto work = MakeWork(Work::reprocess);
-        add_last_reorg(work);
-
-        for (auto& status : dirty) {
-            auto& [type, position] = status;
-            log_(" * ")(position).Flush();
-            encode(status, work);
-            dirty_.emplace(std::move(position));
-        }
-
-        to_process_.SendDeferred(std::move(work));
-    } else {
-        log_()(name_)(" all blocks are clean after rescan").Flush();
-    }
-
     return can_advance();
 }
 }  // namespace opentxs::blockchain::node::wallet
@@ -7,14 +7,17 @@
 
 #include "internal/blockchain/node/wallet/subchain/statemachine/Rescan.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 
+#include "blockchain/node/wallet/subchain/SubchainStateData.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/Job.hpp"
 #include "internal/blockchain/node/wallet/Reorg.hpp"
 #include "internal/blockchain/node/wallet/subchain/statemachine/Types.hpp"
 #include "internal/util/PMR.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
+#include "opentxs/Types.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/network/zeromq/Types.hpp"
 #include "opentxs/util/Container.hpp"
@@ -31,11 +34,6 @@ namespace internal
 struct HeaderOraclePrivate;
 }  // namespace internal
 
-namespace wallet
-{
-class SubchainStateData;
-}  // namespace wallet
-
 class HeaderOracle;
 }  // namespace node
 }  // namespace blockchain
@@ -53,9 +51,12 @@ class Raw;
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
 namespace opentxs::blockchain::node::wallet
 {
-class Rescan::Imp final : public statemachine::Job
+class Rescan::Imp final : public statemachine::Job,
+                          public std::enable_shared_from_this<Imp>
 {
 public:
     auto get_deleter() noexcept -> delete_function final
@@ -81,6 +82,9 @@ private:
     std::optional<block::Position> filter_tip_;
     block::Position highest_dirty_;
     Set<block::Position> dirty_;
+    std::shared_ptr<SubchainStateData::ScanJob> scan_job_;
+    block::Position scan_from_;
+    std::size_t scan_sequence_;
 
     auto before(const block::Position& position) const noexcept
         -> block::Position;
@@ -94,6 +98,7 @@ private:
 
     auto adjust_last_scanned(
         const std::optional<block::Position>& highestClean) noexcept -> void;
+    auto cancel_scan() noexcept -> void;
     auto do_process_update(Message&& msg, allocator_type monotonic) noexcept
         -> void final;
     auto do_reorg(
@@ -109,7 +114,10 @@ private:
         Message&& in,
         block::Position&& tip,
         allocator_type monotonic) noexcept -> void final;
+    auto process_finish_scan(Message&& in, allocator_type monotonic) noexcept
+        -> void final;
     auto prune() noexcept -> void;
+    auto scan_finished() noexcept -> SimpleCallback;
     auto set_last_scanned(const block::Position& value) noexcept -> void;
     auto set_last_scanned(const std::optional<block::Position>& value) noexcept
         -> void;
@@ -117,4 +125,5 @@ private:
         -> void;
     auto work(allocator_type monotonic) noexcept -> bool final;
 };
+#pragma GCC diagnostic pop
 }  // namespace opentxs::blockchain::node::wallet
@@ -10,6 +10,7 @@
 #include <memory>
 #include <utility>
 
+#include "blockchain/node/wallet/subchain/ScanJob.hpp"
 #include "blockchain/node/wallet/subchain/SubchainStateData.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/MatchCache.hpp"
 #include "internal/blockchain/database/Wallet.hpp"
@@ -76,9 +77,20 @@ Scan::Imp::Imp(
     , last_scanned_(std::nullopt)
     , filter_tip_(std::nullopt)
     , index_ready_(false)
+    , scan_job_()
+    , scan_from_()
+    , scan_sequence_(0_uz)
 {
 }
 
+auto Scan::Imp::cancel_scan() noexcept -> void
+{
+    if (nullptr != scan_job_) {
+        log_()(name_)(" discarding results of scan from ")(scan_from_).Flush();
+        scan_job_.reset();
+    }
+}
+
 auto Scan::Imp::caught_up() const noexcept -> bool
 {
     return current() == filter_tip_.value_or(parent_.null_position_);
@@ -103,6 +115,7 @@ auto Scan::Imp::do_reorg(
     if (false == parent_.need_reorg_) { return true; }
 
     const auto& [position, tx] = params;
+    cancel_scan();
 
     if (last_scanned_.has_value()) {
         const auto target =
@@ -160,6 +173,7 @@ auto Scan::Imp::forward_to_next(Message&& msg) noexcept -> void
 
 auto Scan::Imp::process_do_rescan(Message&& in) noexcept -> void
 {
+    cancel_scan();
     last_scanned_.reset();
     parent_.match_cache_.lock()->Reset();
     to_process_.SendDeferred(std::move(in));
@@ -187,6 +201,58 @@ auto Scan::Imp::process_filter(
     do_work(monotonic);
 }
 
+auto Scan::Imp::process_finish_scan(
+    Message&& in,
+    allocator_type monotonic) noexcept -> void
+{
+    const auto body = in.Payload();
+
+    assert_true(1_uz < body.size());
+
+    if ((nullptr == scan_job_) ||
+        (body[1].as<std::size_t>() != scan_sequence_)) {
+        log_()(name_)(" ignoring stale scan results").Flush();
+
+        return;
+    }
+
+    auto job = std::move(scan_job_);
+    scan_job_.reset();
+    auto clean = Vector<ScanStatus>{monotonic};
+    clean.clear();
+    auto dirty = Vector<ScanStatus>{monotonic};
+    dirty.clear();
+    auto highestTested = scan_from_;
+    const auto highestClean =
+        parent_.FinishScan(*job, highestTested, dirty, monotonic);
+    last_scanned_ = std::move(highestTested);
+    log_()(name_)(" last scanned updated to ")(current()).Flush();
+
+    if (auto count = dirty.size(); 0_uz < count) {
+        log_()(name_)(" ")(count)(" blocks queued for processing ").Flush();
+        to_process_.SendDeferred([&] {
+            auto out = MakeWork(Work::update);
+            add_last_reorg(out);
+            encode(dirty, out);
+
+            return out;
+        }());
+    }
+
+    if (highestClean.has_value()) {
+        clean.emplace_back(ScanState::scan_clean, highestClean.value());
+        to_process_.SendDeferred([&] {
+            auto out = MakeWork(Work::update);
+            add_last_reorg(out);
+            encode(clean, out);
+
+            return out;
+        }());
+    }
+
+    do_work(monotonic);
+}
+
 auto Scan::Imp::process_start_scan(Message&&, allocator_type monotonic) noexcept
     -> void
 {
@@ -197,6 +263,22 @@ auto Scan::Imp::process_start_scan(Message&&, allocator_type monotonic) noexcept
     do_work(monotonic);
 }
 
+auto Scan::Imp::scan_finished() noexcept -> SimpleCallback
+{
+    // NOTE the callback is executed by the scan coordinator on a thread pool
+    // thread so it only signals this actor to finish the job
+    return [weak = weak_from_this(), sequence = ++scan_sequence_] {
+        if (auto me = weak.lock(); me) {
+            me->pipeline_.Push([&] {
+                auto out = MakeWork(Work::finish_scan);
+                out.AddFrame(sequence);
+
+                return out;
+            }());
+        }
+    };
+}
+
 auto Scan::Imp::tip() const noexcept -> const block::Position&
 {
     if (filter_tip_.has_value()) {
@@ -214,6 +296,12 @@ auto Scan::Imp::work(allocator_type monotonic) noexcept -> bool
 
     auto post = ScopeGuard{[&] { Job::work(monotonic); }};
 
+    if (nullptr != scan_job_) {
+        log_()(name_)(" scan in progress").Flush();
+
+        return false;
+    }
+
     if (false == filter_tip_.has_value()) {
         log_()(name_)(
             " scanning not possible until a filter tip value is received ")
@@ -251,40 +339,18 @@ auto Scan::Imp::work(allocator_type monotonic) noexcept -> bool
         return false;
     }
 
-    auto clean = Vector<ScanStatus>{monotonic};
-    clean.clear();
-    auto dirty = Vector<ScanStatus>{monotonic};
-    dirty.clear();
-    auto highestTested = current();
-    const auto highestClean = parent_.Scan(
+    scan_from_ = current();
+    scan_job_ = parent_.Scan(
         filter_tip_.value(),
         std::numeric_limits<block::Height>::max(),
-        highestTested,
-        dirty,
+        scan_from_,
+        scan_finished(),
         monotonic);
-    last_scanned_ = std::move(highestTested);
-    log_()(name_)(" last scanned updated to ")(current()).Flush();
 
-    if (auto count = dirty.size(); 0_uz < count) {
-        log_()(name_)(" ")(count)(" blocks queued for processing ").Flush();
-        to_process_.SendDeferred([&] {
-            auto out = MakeWork(Work::update);
-            add_last_reorg(out);
-            encode(dirty, out);
+    if (nullptr != scan_job_) {
+        log_()(name_)(" waiting for scan results").Flush();
 
-            return out;
-        }());
-    }
-
-    if (highestClean.has_value()) {
-        clean.emplace_back(ScanState::scan_clean, highestClean.value());
-        to_process_.SendDeferred([&] {
-            auto out = MakeWork(Work::update);
-            add_last_reorg(out);
-            encode(clean, out);
-
-            return out;
-        }());
+        return false;
     }
 
     return (false == caught_up());
@@ -7,15 +7,18 @@
 
 #include "internal/blockchain/node/wallet/subchain/statemachine/Scan.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 
+#include "blockchain/node/wallet/subchain/SubchainStateData.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/Job.hpp"
 #include "internal/blockchain/node/wallet/Reorg.hpp"
 #include "internal/blockchain/node/wallet/subchain/statemachine/Types.hpp"
 #include "internal/util/PMR.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/network/zeromq/Types.hpp"
+#include "opentxs/Types.hpp"
 #include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -30,11 +33,6 @@ namespace internal
 struct HeaderOraclePrivate;
 }  // namespace internal
 
-namespace wallet
-{
-class SubchainStateData;
-}  // namespace wallet
-
 class HeaderOracle;
 }  // namespace node
 }  // namespace blockchain
@@ -52,9 +50,12 @@ class Raw;
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
 namespace opentxs::blockchain::node::wallet
 {
-class Scan::Imp final : public statemachine::Job
+class Scan::Imp final : public statemachine::Job,
+                        public std::enable_shared_from_this<Imp>
 {
 public:
     auto get_deleter() noexcept -> delete_function final
@@ -78,11 +79,16 @@ private:
     std::optional<block::Position> last_scanned_;
     std::optional<block::Position> filter_tip_;
     bool index_ready_;
+    std::shared_ptr<SubchainStateData::ScanJob> scan_job_;
+    block::Position scan_from_;
+    std::size_t scan_sequence_;
 
     auto caught_up() const noexcept -> bool;
     auto current() const noexcept -> const block::Position&;
     auto tip() const noexcept -> const block::Position&;
 
+    auto cancel_scan() noexcept -> void;
+
     auto do_reorg(
         const node::HeaderOracle& oracle,
         const node::internal::HeaderOraclePrivate& data,
@@ -94,9 +100,13 @@ private:
         Message&& in,
         block::Position&& tip,
         allocator_type monotonic) noexcept -> void final;
+    auto process_finish_scan(Message&& in, allocator_type monotonic) noexcept
+        -> void final;
     auto process_start_scan(Message&& in, allocator_type monotonic) noexcept
         -> void final;
     auto scan(Vector<ScanStatus>& out) noexcept -> void;
+    auto scan_finished() noexcept -> SimpleCallback;
     auto work(allocator_type monotonic) noexcept -> bool final;
 };
+#pragma GCC diagnostic pop
 }  // namespace opentxs::blockchain::node::wallet
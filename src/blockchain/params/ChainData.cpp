@@ -284,6 +284,11 @@ auto ChainData::P2PMagicBits() const noexcept -> std::uint32_t
     return imp_->p2p_magic_bits_;
 }
 
+auto ChainData::P2PMaxMessageSize() const noexcept -> std::size_t
+{
+    return imp_->p2p_max_message_bytes_;
+}
+
 auto ChainData::P2PSeeds() const noexcept -> const Vector<std::string_view>&
 {
     return imp_->dns_seeds_;
@@ -117,6 +117,7 @@ ChainDataPrivate::ChainDataPrivate(
                       Data::Bip158>(bip158_))
     , zmq_(std::make_pair(data.parent_bip44_, data.subchain_))
     , max_notifications_(data.max_notifications_)
+    , p2p_max_message_bytes_(data.p2p_max_message_bytes_)
     , cfheaders_([&] {
         auto out = CfheaderCheckpoints{};
 
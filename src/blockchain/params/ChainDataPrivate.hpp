@@ -103,6 +103,7 @@ public:
     const Data::Bip158Reverse bip158_reverse_;
     const std::pair<crypto::Bip44Type, network::blockchain::Subchain> zmq_;
     const std::size_t max_notifications_;
+    const std::size_t p2p_max_message_bytes_;
     mutable GuardedCheckpoints cfheaders_;
 
     auto GenesisBlock(const api::Crypto& crypto) const noexcept
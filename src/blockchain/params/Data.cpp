@@ -5,6 +5,9 @@
 
 #include "blockchain/params/Data.hpp"  // IWYU pragma: associated
 
+#include <cstdint>
+#include <limits>
+
 #include "internal/util/P0330.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/UnitType.hpp"             // IWYU pragma: keep
@@ -111,6 +114,7 @@ auto Chains() noexcept -> const ChainMap&
                            "049dc75e0d584a300293ef3d3980"sv}},
                      },
                      2_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::Bitcoin_testnet3,
                  {
@@ -185,6 +189,7 @@ auto Chains() noexcept -> const ChainMap&
                            "04e2f587e146bf6c662d35278a40"sv}},
                      },
                      8_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::BitcoinCash,
                  {
@@ -266,6 +271,7 @@ auto Chains() noexcept -> const ChainMap&
                            "049dc75e0d584a300293ef3d3980"sv}},
                      },
                      8_uz,
+                     256_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::BitcoinCash_testnet3,
                  {
@@ -345,6 +351,7 @@ auto Chains() noexcept -> const ChainMap&
                            "04e2f587e146bf6c662d35278a40"sv}},
                      },
                      8_uz,
+                     256_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::BitcoinCash_testnet4,
                  {
@@ -424,6 +431,7 @@ auto Chains() noexcept -> const ChainMap&
                            "04a01a958ade0a4933acf0bef8b0"sv}},
                      },
                      8_uz,
+                     256_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::Ethereum,
                  {
@@ -466,6 +474,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ethereum_ropsten,
                  {
@@ -508,6 +517,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ethereum_goerli,
                  {
@@ -550,6 +560,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ethereum_sepolia,
                  {
@@ -592,6 +603,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ethereum_holesovice,
                  {
@@ -634,6 +646,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Litecoin,
                  {
@@ -708,6 +721,7 @@ auto Chains() noexcept -> const ChainMap&
                            "049de8963322099e81f3bf7c4600"sv}},
                      },
                      8_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::Litecoin_testnet4,
                  {
@@ -780,6 +794,7 @@ auto Chains() noexcept -> const ChainMap&
                            "048b3d6095a4b01eb30ce44017c0"sv}},
                      },
                      8_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::PKT,
                  {
@@ -852,6 +867,7 @@ auto Chains() noexcept -> const ChainMap&
                            "02649a429ba06300"sv}},
                      },
                      8_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::PKT_testnet,
                  {
@@ -924,6 +940,7 @@ auto Chains() noexcept -> const ChainMap&
                            "02649a429ba06300"sv}},
                      },
                      8_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::BitcoinSV,
                  {
@@ -1002,6 +1019,7 @@ auto Chains() noexcept -> const ChainMap&
                            "049dc75e0d584a300293ef3d3980"sv}},
                      },
                      8_uz,
+                     std::numeric_limits<std::uint32_t>::max(),
                  }},
                 {blockchain::Type::BitcoinSV_testnet3,
                  {
@@ -1080,6 +1098,7 @@ auto Chains() noexcept -> const ChainMap&
                            "04e2f587e146bf6c662d35278a40"sv}},
                      },
                      8_uz,
+                     std::numeric_limits<std::uint32_t>::max(),
                  }},
                 {blockchain::Type::eCash,
                  {
@@ -1162,6 +1181,7 @@ auto Chains() noexcept -> const ChainMap&
                            "049dc75e0d584a300293ef3d3980"sv}},
                      },
                      8_uz,
+                     256_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::eCash_testnet3,
                  {
@@ -1243,6 +1263,7 @@ auto Chains() noexcept -> const ChainMap&
                            "04e2f587e146bf6c662d35278a40"sv}},
                      },
                      8_uz,
+                     256_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::Casper,
                  {
@@ -1285,6 +1306,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Casper_testnet,
                  {
@@ -1327,6 +1349,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Dash,
                  {
@@ -1397,6 +1420,7 @@ auto Chains() noexcept -> const ChainMap&
                            "047f3e1e9be1085bde55aa378ac0"sv}},
                      },
                      8_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::Dash_testnet3,
                  {
@@ -1467,6 +1491,7 @@ auto Chains() noexcept -> const ChainMap&
                            "042a1bbff5a1733041f84275fef0"sv}},
                      },
                      8_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::UnitTest,
                  {
@@ -1537,6 +1562,7 @@ auto Chains() noexcept -> const ChainMap&
                            "042547f6de198130360443dfcdc0"sv}},
                      },
                      8_uz,
+                     32_uz * 1024_uz * 1024_uz,
                  }},
                 {blockchain::Type::Tron,
                  {
@@ -1571,6 +1597,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::BinanceChain,
                  {
@@ -1605,6 +1632,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::BinanceSmartChain,
                  {
@@ -1639,6 +1667,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Algorand,
                  {
@@ -1673,6 +1702,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Arweave,
                  {
@@ -1707,6 +1737,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Avalanche,
                  {
@@ -1741,6 +1772,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::BitcoinGold,
                  {
@@ -1775,6 +1807,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::BitShares,
                  {
@@ -1809,6 +1842,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Cardano,
                  {
@@ -1843,6 +1877,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Celo,
                  {
@@ -1877,6 +1912,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Chiliz,
                  {
@@ -1911,6 +1947,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Cosmos,
                  {
@@ -1945,6 +1982,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Decred,
                  {
@@ -1979,6 +2017,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Dogecoin,
                  {
@@ -2013,6 +2052,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Elrond,
                  {
@@ -2047,6 +2087,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::EOS,
                  {
@@ -2081,6 +2122,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::EthereumClassic,
                  {
@@ -2115,6 +2157,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ethereum_morden,
                  {
@@ -2149,6 +2192,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::POA,
                  {
@@ -2183,6 +2227,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Expance,
                  {
@@ -2217,6 +2262,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ethereum_kovan,
                  {
@@ -2251,6 +2297,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ethereum_olympic,
                  {
@@ -2285,6 +2332,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ethereum_rinkeby,
                  {
@@ -2319,6 +2367,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::POA_sokol,
                  {
@@ -2353,6 +2402,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Factom,
                  {
@@ -2387,6 +2437,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Fantom,
                  {
@@ -2421,6 +2472,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Filecoin,
                  {
@@ -2455,6 +2507,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Flow,
                  {
@@ -2489,6 +2542,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Harmony,
                  {
@@ -2523,6 +2577,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Hedera,
                  {
@@ -2557,6 +2612,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Helium,
                  {
@@ -2591,6 +2647,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Huobi,
                  {
@@ -2625,6 +2682,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::ICON,
                  {
@@ -2659,6 +2717,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::InternetComputer,
                  {
@@ -2693,6 +2752,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::IOTA,
                  {
@@ -2727,6 +2787,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Kadena,
                  {
@@ -2761,6 +2822,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Klaytn,
                  {
@@ -2795,6 +2857,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Kusama,
                  {
@@ -2829,6 +2892,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::MaidSafeCoin,
                  {
@@ -2863,6 +2927,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Mina,
                  {
@@ -2897,6 +2962,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Monero,
                  {
@@ -2931,6 +2997,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Near,
                  {
@@ -2965,6 +3032,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::NEM,
                  {
@@ -2999,6 +3067,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Neo,
                  {
@@ -3033,6 +3102,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Nxt,
                  {
@@ -3067,6 +3137,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::OKB,
                  {
@@ -3101,6 +3172,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Polkadot,
                  {
@@ -3135,6 +3207,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Polygon,
                  {
@@ -3169,6 +3242,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Qtum,
                  {
@@ -3203,6 +3277,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Quant,
                  {
@@ -3237,6 +3312,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ravencoin,
                  {
@@ -3271,6 +3347,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ripple,
                  {
@@ -3305,6 +3382,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Secret,
                  {
@@ -3339,6 +3417,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Siacoin,
                  {
@@ -3373,6 +3452,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Solana,
                  {
@@ -3407,6 +3487,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Stacks,
                  {
@@ -3441,6 +3522,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Steem,
                  {
@@ -3475,6 +3557,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Stellar,
                  {
@@ -3509,6 +3592,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Terra,
                  {
@@ -3543,6 +3627,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Dogecoin_testnet,
                  {
@@ -3577,6 +3662,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::MaidSafeCoin_testnet,
                  {
@@ -3611,6 +3697,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Monero_testnet,
                  {
@@ -3645,6 +3732,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::NEM_testnet,
                  {
@@ -3679,6 +3767,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Nxt_testnet,
                  {
@@ -3713,6 +3802,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Ripple_testnet,
                  {
@@ -3747,6 +3837,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Siacoin_testnet,
                  {
@@ -3781,6 +3872,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Steem_testnet,
                  {
@@ -3815,6 +3907,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Waves_testnet,
                  {
@@ -3849,6 +3942,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Tezos,
                  {
@@ -3883,6 +3977,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::THETA,
                  {
@@ -3917,6 +4012,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::ThetaFuel,
                  {
@@ -3951,6 +4047,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::THORChain,
                  {
@@ -3985,6 +4082,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::VeChain,
                  {
@@ -4019,6 +4117,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Waves,
                  {
@@ -4053,6 +4152,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::XDC,
                  {
@@ -4087,6 +4187,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Zcash,
                  {
@@ -4121,6 +4222,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
                 {blockchain::Type::Zilliqa,
                  {
@@ -4155,6 +4257,7 @@ auto Chains() noexcept -> const ChainMap&
                      {},
                      {},
                      {},
+                     {},
                  }},
             };
 
@@ -75,6 +75,7 @@ struct Data {
     Bip158 bip158_{};
     GenesisBip158 genesis_bip158_{};
     std::size_t max_notifications_{};
+    std::size_t p2p_max_message_bytes_{};
 };
 using ChainMap = boost::container::flat_map<blockchain::Type, Data>;
 
@@ -29,6 +29,15 @@ auto Row::next_index() noexcept -> std::ptrdiff_t
     return ++counter;
 }
 
+auto confirmations(
+    const blockchain::block::Height mined,
+    const blockchain::block::Height best) noexcept -> int
+{
+    if ((0 > mined) || (mined > best)) { return 0; }
+
+    return static_cast<int>(best - mined) + 1;
+}
+
 auto make_progress(
     blockchain::block::Height& actual,
     blockchain::block::Height& target) noexcept -> double
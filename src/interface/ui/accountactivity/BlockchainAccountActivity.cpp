@@ -9,6 +9,7 @@
 #include <opentxs/protobuf/PaymentEvent.pb.h>
 #include <opentxs/protobuf/PaymentWorkflow.pb.h>
 #include <opentxs/protobuf/PaymentWorkflowEnums.pb.h>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <future>
@@ -118,6 +119,8 @@ BlockchainAccountActivity::BlockchainAccountActivity(
           "BlockchainAccountActivity"))
     , progress_()
     , height_(0)
+    , row_heights_()
+    , mined_rows_()
 {
     const auto connected =
         balance_socket_->Start(api_.Endpoints().BlockchainBalance().data());
@@ -169,8 +172,34 @@ auto BlockchainAccountActivity::display_balance(
     return blockchain::internal::Format(chain_, value);
 }
 
+auto BlockchainAccountActivity::index_row(
+    const AccountActivityRowID& id,
+    const blockchain::block::Height mined) noexcept -> void
+{
+    if (auto i = row_heights_.find(id); row_heights_.end() != i) {
+        auto& previous = i->second;
+
+        if (previous == mined) { return; }
+
+        if (auto j = mined_rows_.find(previous); mined_rows_.end() != j) {
+            auto& rows = j->second;
+            rows.erase(id);
+
+            if (rows.empty()) { mined_rows_.erase(j); }
+        }
+
+        previous = mined;
+    } else {
+        row_heights_.emplace(id, mined);
+    }
+
+    if (0 <= mined) { mined_rows_[mined].emplace(id); }
+}
+
 auto BlockchainAccountActivity::load_thread() noexcept -> void
 {
+    row_heights_.clear();
+    mined_rows_.clear();
     const auto transactions =
         [&]() -> UnallocatedVector<blockchain::block::TransactionHash> {
         try {
@@ -230,6 +259,29 @@ auto BlockchainAccountActivity::Notify(
     }
 }
 
+auto BlockchainAccountActivity::notify_confirmations(
+    const blockchain::block::Height previous,
+    const blockchain::block::Height current) noexcept -> void
+{
+    constexpr auto cap = max_notify_confirmations_;
+    const auto display = [&](auto mined, auto height) {
+        return std::min(internal::confirmations(mined, height), cap);
+    };
+    const auto low = std::min(previous, current) - cap + 2;
+    const auto high = std::max(previous, current);
+    auto lock = rLock{recursive_lock_};
+
+    for (auto i = mined_rows_.lower_bound(low), end = mined_rows_.end();
+         (end != i) && (i->first <= high);
+         ++i) {
+        const auto& [mined, rows] = *i;
+
+        if (display(mined, previous) == display(mined, current)) { continue; }
+
+        for (const auto& id : rows) { notify_row(lock, id); }
+    }
+}
+
 auto BlockchainAccountActivity::pipeline(const Message& in) noexcept -> void
 {
     if (false == running_.load()) { return; }
@@ -348,8 +400,6 @@ auto BlockchainAccountActivity::process_balance(const Message& in) noexcept
     } else if (oldConfirmed != confirmed) {
         UpdateNotify();
     }
-
-    load_thread();
 }
 
 auto BlockchainAccountActivity::process_block(const Message& in) noexcept
@@ -401,10 +451,11 @@ auto BlockchainAccountActivity::process_contact(const Message& in) noexcept
 auto BlockchainAccountActivity::process_height(
     const blockchain::block::Height height) noexcept -> void
 {
-    if (height == height_) { return; }
+    const auto previous = height_.exchange(height);
 
-    height_ = height;
-    load_thread();
+    if (height == previous) { return; }
+
+    notify_confirmations(previous, height);
 }
 
 auto BlockchainAccountActivity::process_reorg(const Message& in) noexcept
@@ -418,7 +469,11 @@ auto BlockchainAccountActivity::process_reorg(const Message& in) noexcept
 
     if (chain != chain_) { return; }
 
-    process_height(body[5].as<blockchain::block::Height>());
+    // NOTE a reorg may change the mined height of any transaction
+    const auto height = body[5].as<blockchain::block::Height>();
+    const auto previous = height_.exchange(height);
+    load_thread();
+    notify_confirmations(previous, height);
 }
 
 auto BlockchainAccountActivity::process_state(const Message& in) noexcept
@@ -525,13 +580,7 @@ auto BlockchainAccountActivity::process_txid(
     if (false == bTx.Chains({}).contains(chain_)) { return std::nullopt; }
 
     const auto sortKey{bTx.Timestamp()};
-    const auto conf = [&]() -> int {
-        const auto height = tx.Internal().asBitcoin().ConfirmationHeight();
-
-        if ((0 > height) || (height > height_)) { return 0; }
-
-        return static_cast<int>(height_ - height) + 1;
-    }();
+    const auto mined = tx.Internal().asBitcoin().ConfirmationHeight();
     auto description =
         api_.Crypto().Blockchain().ActivityDescription(primary_id_, chain_, tx);
     auto custom = CustomData{
@@ -541,9 +590,10 @@ auto BlockchainAccountActivity::process_txid(
         new blockchain::Type{chain_},
         new UnallocatedCString{std::move(description)},
         new UnallocatedCString{txid.Bytes()},
-        new int{conf},
+        new blockchain::block::Height{mined},
     };
     add_item(rowID, sortKey, custom);
+    index_row(rowID, mined);
 
     return rowID;
 }
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <optional>
 #include <span>
@@ -59,6 +60,10 @@ class BlockchainAccountActivity final : public AccountActivity
 {
 public:
     auto API() const noexcept -> const api::Session& final { return api_; }
+    auto ChainHeight() const noexcept -> blockchain::block::Height final
+    {
+        return height_.load();
+    }
     auto ContractID() const noexcept -> UnallocatedCString final
     {
         return opentxs::blockchain::UnitID(api_, chain_)
@@ -196,19 +201,39 @@ private:
         statemachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
     };
 
+    using RowHeights =
+        UnallocatedMap<AccountActivityRowID, blockchain::block::Height>;
+    using MinedRows = UnallocatedMap<
+        blockchain::block::Height,
+        UnallocatedSet<AccountActivityRowID>>;
+
+    // NOTE rows compute their confirmations from the mined height when they
+    // are read. A new block only notifies rows whose confirmation count is
+    // below this value, since deeper rows no longer change in a way that
+    // matters to a user.
+    static constexpr auto max_notify_confirmations_ = 6;
+
     const blockchain::Type chain_;
     mutable Amount confirmed_;
     OTZMQListenCallback balance_cb_;
     OTZMQDealerSocket balance_socket_;
     Progress progress_;
-    blockchain::block::Height height_;
+    std::atomic<blockchain::block::Height> height_;
+    RowHeights row_heights_;
+    MinedRows mined_rows_;
 
     static auto print(Work type) noexcept -> const char*;
 
     auto display_balance(opentxs::Amount value) const noexcept
         -> UnallocatedCString final;
 
+    auto index_row(
+        const AccountActivityRowID& id,
+        const blockchain::block::Height mined) noexcept -> void;
     auto load_thread() noexcept -> void;
+    auto notify_confirmations(
+        const blockchain::block::Height previous,
+        const blockchain::block::Height current) noexcept -> void;
     auto pipeline(const Message& in) noexcept -> void final;
     auto process_balance(const Message& in) noexcept -> void;
     auto process_block(const Message& in) noexcept -> void;
@@ -80,13 +80,18 @@ BlockchainBalanceItem::BlockchainBalanceItem(
     , txid_(txid)
     , amount_(amount)
     , memo_(memo)
-    , confirmations_(extract_custom<int>(custom, 6))
+    , mined_(extract_custom<blockchain::block::Height>(custom, 6))
 {
     // NOTE Avoids memory leaks
     extract_custom<protobuf::PaymentWorkflow>(custom, 0);
     extract_custom<protobuf::PaymentEvent>(custom, 1);
 }
 
+auto BlockchainBalanceItem::Confirmations() const noexcept -> int
+{
+    return internal::confirmations(mined_.load(), parent_.ChainHeight());
+}
+
 auto BlockchainBalanceItem::Contacts() const noexcept
     -> UnallocatedVector<UnallocatedCString>
 {
@@ -132,7 +137,7 @@ auto BlockchainBalanceItem::reindex(
         tx.NetBalanceChange(api_.Crypto().Blockchain(), nym_id_);
     const auto memo = tx.Memo(api_.Crypto().Blockchain());
     const auto text = extract_custom<UnallocatedCString>(custom, 4);
-    const auto conf = extract_custom<int>(custom, 6);
+    const auto mined = extract_custom<blockchain::block::Height>(custom, 6);
 
     assert_true(chain_ == chain);
     assert_true(txid_ == txid);
@@ -153,7 +158,7 @@ auto BlockchainBalanceItem::reindex(
         output |= true;
     }
 
-    if (auto previous = confirmations_.exchange(conf); previous != conf) {
+    if (auto previous = mined_.exchange(mined); previous != mined) {
         output |= true;
     }
 
@@ -11,6 +11,7 @@
 #include "internal/interface/ui/UI.hpp"
 #include "internal/util/Mutex.hpp"
 #include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/blockchain/block/TransactionHash.hpp"
 #include "opentxs/core/Amount.hpp"
 #include "opentxs/identifier/Account.hpp"
@@ -44,7 +45,7 @@ public:
     {
         return effective_amount();
     }
-    auto Confirmations() const noexcept -> int final { return confirmations_; }
+    auto Confirmations() const noexcept -> int final;
     auto Contacts() const noexcept
         -> UnallocatedVector<UnallocatedCString> final;
     auto DisplayAmount() const noexcept -> UnallocatedCString final;
@@ -83,7 +84,7 @@ private:
     const blockchain::block::TransactionHash txid_;
     opentxs::Amount amount_;
     UnallocatedCString memo_;
-    std::atomic_int confirmations_;
+    std::atomic<blockchain::block::Height> mined_;
 
     auto effective_amount() const noexcept -> opentxs::Amount final
     {
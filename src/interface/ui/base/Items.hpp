@@ -5,9 +5,18 @@
 
 #pragma once
 
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/ranked_index.hpp>
+#include <boost/multi_index/tag.hpp>
+#include <boost/multi_index_container.hpp>
+#include <boost/tuple/tuple.hpp>
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <optional>
+#include <stdexcept>
 
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
@@ -36,37 +45,95 @@ public:
         RowID id_;
         RowPointer item_;
     };
-    using Data = UnallocatedList<Row>;
-    using Iterator = typename Data::iterator;
-    using Index = UnallocatedMap<RowID, Iterator>;
+
+private:
+    struct ByID {
+    };
+    struct ByPosition {
+    };
+
+    class Compare
+    {
+    public:
+        auto operator()(const Row& lhs, const Row& rhs) const noexcept -> bool
+        {
+            return parent_->before(lhs.key_, lhs.id_, rhs.key_, rhs.id_);
+        }
+
+        Compare(const ListItems* parent = nullptr) noexcept
+            : parent_(parent)
+        {
+        }
+
+    private:
+        const ListItems* parent_;
+    };
+
+    // NOTE the ranked index maintains subtree sizes so the position of a row
+    // and the row at a position are both found in logarithmic time
+    using Data = boost::multi_index_container<
+        Row,
+        boost::multi_index::indexed_by<
+            boost::multi_index::ranked_unique<
+                boost::multi_index::tag<ByPosition>,
+                boost::multi_index::identity<Row>,
+                Compare>,
+            boost::multi_index::ordered_unique<
+                boost::multi_index::tag<ByID>,
+                boost::multi_index::member<Row, RowID, &Row::id_>>>>;
+    using Rows = typename Data::template index<ByPosition>::type;
+    using IDs = typename Data::template index<ByID>::type;
+
+public:
+    using Iterator = typename Rows::iterator;
     using Insert = std::pair<Iterator, internal::Row*>;
     using Position = std::pair<Iterator, std::size_t>;
     using Move = std::pair<Insert, Insert>;
 
     auto active() const noexcept -> UnallocatedVector<RowID>
     {
+        const auto& ids = data_.template get<ByID>();
         auto output = UnallocatedVector<RowID>{};
-        output.reserve(index_.size());
+        output.reserve(ids.size());
         std::ranges::transform(
-            index_, std::back_inserter(output), [](const auto& in) -> auto {
-                return in.first;
+            ids, std::back_inserter(output), [](const auto& in) -> auto {
+                return in.id_;
             });
 
         return output;
     }
+    /// Returns true if a row with the first key and id belongs before a row
+    /// with the second key and id
+    auto before(
+        const SortKey& lKey,
+        const RowID& lID,
+        const SortKey& rKey,
+        const RowID& rID) const noexcept -> bool
+    {
+        return sort(rKey, rID, lKey, lID);
+    }
     auto last(const RowID& row) const noexcept -> bool
     {
         if (0u == data_.size()) { return true; }
 
-        if (auto i = index_.find(row); index_.end() == i) { return true; }
+        const auto& ids = data_.template get<ByID>();
 
-        const auto& [key, id, item] = data_.back();
+        if (ids.end() == ids.find(row)) { return true; }
+
+        const auto& [key, id, item] = rows().back();
 
         return row == id;
     }
     auto size() const noexcept { return data_.size(); }
 
-    auto at(const std::size_t pos) -> Row&
+    auto append(
+        const SortKey& key,
+        const RowID& id,
+        const RowPointer& item) noexcept -> RowPointer
+    {
+        return insert_before(rows().end(), key, id, item);
+    }
+    auto at(const std::size_t pos) -> const Row&
     {
         if (pos < offset_) {
             throw std::out_of_range("Invalid position (offset)");
@@ -78,30 +145,22 @@ public:
             throw std::out_of_range("Invalid position");
         }
 
-        auto output = data_.begin();
-        std::advance(output, eff);
-
-        return *output;
+        return *rows().nth(eff);
     }
-    auto get(const RowID& id) -> Row& { return *index_.at(id); }
-    auto begin() noexcept -> Iterator { return data_.begin(); }
-    auto delete_row(const RowID& id, Iterator position) noexcept -> void
+    auto get(const RowID& id) -> const Row& { return *find(id); }
+    auto begin() noexcept -> Iterator { return rows().begin(); }
+    auto delete_row(const RowID&, Iterator position) noexcept -> void
     {
-        data_.erase(position);
-        index_.erase(id);
+        rows().erase(position);
     }
-    auto end() noexcept -> Iterator { return data_.end(); }
+    auto end() noexcept -> Iterator { return rows().end(); }
     auto find_delete_position(const RowID& id) noexcept
         -> std::optional<Position>
     {
         try {
-            const auto it = index_.at(id);
-
-            return Position{
-                it,
-                static_cast<std::size_t>(std::distance(data_.begin(), it)) +
-                    offset_};
+            const auto it = find(id);
 
+            return Position{it, rows().rank(it) + offset_};
         } catch (...) {
 
             return std::nullopt;
@@ -110,77 +169,30 @@ public:
     auto find_insert_position(const SortKey& key, const RowID& id) noexcept
         -> Insert
     {
-        auto output = Insert{data_.end(), nullptr};
-        auto& [it, before] = output;
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i) {
-            const auto& [rKey, rId, item] = *i;
-
-            if (sort(key, id, rKey, rId)) {
-
-                continue;
-            } else {
-                it = i;
-
-                break;
-            }
-        }
-
-        if (data_.begin() != it) {
-            const auto& [rKey, rId, item] = *std::prev(it);
-            before = item.get();
-        }
+        const auto it = rows().lower_bound(Row{key, id, {}});
 
-        return output;
+        return Insert{it, previous(it)};
     }
     auto find_move_position(
         const RowID& oldId,
         const SortKey& newKey,
         const RowID& newID) noexcept -> std::optional<Move>
     {
-        auto output = Move{{data_.end(), nullptr}, {data_.end(), nullptr}};
-        auto& [from, to] = output;
-        auto& [it, before] = to;
-
         try {
-            const auto iter = index_.at(oldId);
-            from = Insert{iter, [&]() -> internal::Row* {
-                              if (data_.begin() == iter) {
-
-                                  return nullptr;
-                              } else {
+            const auto from = find(oldId);
+            const auto to = rows().lower_bound(Row{newKey, newID, {}});
 
-                                  return std::prev(iter)->item_.get();
-                              }
-                          }()};
+            return Move{{from, previous(from)}, {to, previous(to)}};
         } catch (...) {
 
             return std::nullopt;
         }
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i) {
-            const auto& [rKey, rId, item] = *i;
-
-            if (sort(newKey, newID, rKey, rId)) {
-                before = item.get();
-
-                continue;
-            }
-
-            it = i;
-
-            break;
-        }
-
-        return output;
     }
     auto get_index(const RowID& id) noexcept -> std::optional<std::size_t>
     {
         try {
 
-            return static_cast<std::size_t>(
-                       std::distance(data_.begin(), index_.at(id))) +
-                   offset_;
+            return rows().rank(find(id)) + offset_;
         } catch (...) {
 
             return std::nullopt;
@@ -192,43 +204,67 @@ public:
         const RowID& id,
         const RowPointer& item) noexcept -> RowPointer
     {
-        auto& index = index_[id];
-        index = data_.emplace(position, Row{key, id, item});
-
-        return index->item_;
+        return rows().emplace_hint(position, Row{key, id, item})->item_;
     }
     auto move_before(
-        const RowID& oldId,
-        Iterator oldPosition,
+        Iterator position,
         const SortKey& newKey,
-        const RowID& newID,
-        Iterator newPosition) noexcept -> void
+        const RowID& newID) noexcept -> void
     {
-        index_.erase(oldId);
-        auto& oldData = *oldPosition;
-        auto& index = index_[newID];
-        index = data_.emplace(newPosition, Row{newKey, newID, oldData.item_});
-        data_.erase(oldPosition);
+        rows().modify(position, [&](auto& row) {
+            row.key_ = newKey;
+            row.id_ = newID;
+        });
     }
 
     ListItems(std::size_t offset, bool reverse) noexcept
         : offset_(offset)
         , reverse_sort_(reverse)
-        , data_()
-        , index_()
+        , data_(boost::make_tuple(
+              boost::make_tuple(
+                  boost::multi_index::identity<Row>{}, Compare{this}),
+              typename IDs::ctor_args{}))
     {
     }
+    ListItems() = delete;
+    ListItems(const ListItems&) = delete;
+    ListItems(ListItems&&) = delete;
+    auto operator=(const ListItems&) -> ListItems& = delete;
+    auto operator=(ListItems&&) -> ListItems& = delete;
 
 private:
     const std::size_t offset_;
     const bool reverse_sort_;
     Data data_;
-    Index index_;
 
     auto compare_id(const RowID& lhs, const RowID& rhs) const noexcept -> bool;
     auto compare_key(const SortKey& lhs, const SortKey& rhs) const noexcept
         -> bool;
+    auto rows() const noexcept -> const Rows&
+    {
+        return data_.template get<ByPosition>();
+    }
+
+    auto find(const RowID& id) noexcept(false) -> Iterator
+    {
+        const auto& ids = data_.template get<ByID>();
+        const auto it = ids.find(id);
+
+        if (ids.end() == it) { throw std::out_of_range("Row not found"); }
 
+        return data_.template project<ByPosition>(it);
+    }
+    auto previous(Iterator it) noexcept -> internal::Row*
+    {
+        if (rows().begin() == it) {
+
+            return nullptr;
+        } else {
+
+            return std::prev(it)->item_.get();
+        }
+    }
+    auto rows() noexcept -> Rows& { return data_.template get<ByPosition>(); }
     auto sort(
         const SortKey& incomingKey,
         const RowID& incomingID,
@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <future>
+#include <memory>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -256,9 +258,13 @@ protected:
     {
         auto lock = rLock{recursive_lock_};
 
-        for (auto& [id, key, custom, children] : items) {
-            auto& item = add_item(lock, id, key, custom);
-            item.AddChildren(std::move(children));
+        if (0u == items_.size()) {
+            load_items(lock, items);
+        } else {
+            for (auto& [id, key, custom, children] : items) {
+                auto& item = add_item(lock, id, key, custom);
+                item.AddChildren(std::move(children));
+            }
         }
     }
     auto finish_startup() noexcept -> void
@@ -270,6 +276,13 @@ protected:
         } catch (...) {
         }
     }
+    auto notify_row(const rLock&, const RowID& id) noexcept -> void
+    {
+        try {
+            row_modified(qt_parent(), items_.get(id).item_.get());
+        } catch (...) {
+        }
+    }
     virtual auto qt_parent() noexcept -> internal::Row* { return nullptr; }
     auto row_modified(
         ui::internal::Row* parent,
@@ -369,6 +382,54 @@ private:
 
         return *pointer;
     }
+    // NOTE an empty list is populated by sorting the incoming rows once and
+    // appending them in order instead of searching for each insert position
+    auto load_items(const rLock& lock, ChildDefinitions& items) noexcept
+        -> void
+    {
+        auto ids = UnallocatedSet<RowID>{};
+        auto sorted = UnallocatedVector<ChildObjectDataType*>{};
+        sorted.reserve(items.size());
+
+        for (auto& item : items) {
+            if (false == ids.emplace(item.id_).second) {
+                // NOTE duplicate rows must be applied in their original order
+                for (auto& [id, key, custom, children] : items) {
+                    auto& row = add_item(lock, id, key, custom);
+                    row.AddChildren(std::move(children));
+                }
+
+                return;
+            }
+
+            sorted.emplace_back(std::addressof(item));
+        }
+
+        std::ranges::sort(sorted, [this](const auto* lhs, const auto* rhs) {
+            return items_.before(lhs->key_, lhs->id_, rhs->key_, rhs->id_);
+        });
+        auto* parent = qt_parent();
+        auto* prev = static_cast<ui::internal::Row*>(nullptr);
+
+        for (auto* item : sorted) {
+            auto& [id, key, custom, children] = *item;
+            auto pointer = construct_row(id, key, custom);
+
+            assert_false(nullptr == pointer);
+
+            auto row = items_.append(key, id, pointer);
+
+            if (nullptr != qt_model_) {
+                qt_model_->InsertRow(parent, prev, row);
+            }
+
+            post_insert(*pointer);
+            pointer->AddChildren(std::move(children));
+            prev = pointer.get();
+        }
+
+        if (false == sorted.empty()) { UpdateNotify(); }
+    }
     auto move_item(
         const rLock&,
         const RowID& id,
@@ -395,7 +456,7 @@ private:
                 qt_model_->MoveRow(parent, newBefore, item);
             }
 
-            items_.move_before(id, source, key, id, dest);
+            items_.move_before(source, key, id);
         }
 
         pre_reindex(*item);
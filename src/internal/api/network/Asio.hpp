@@ -135,6 +135,13 @@ public:
         const OTZMQWorkType type,
         const std::size_t bytes,
         SocketImp socket) const noexcept -> bool = 0;
+    virtual auto ReceiveMessages(
+        const opentxs::network::zeromq::Envelope& id,
+        const OTZMQWorkType type,
+        const std::size_t headerBytes,
+        const Socket::BodySize& bodySize,
+        const Socket::VerifyBody& verifyBody,
+        SocketImp socket) const noexcept -> bool = 0;
     virtual auto Transmit(
         const opentxs::network::zeromq::Envelope& id,
         const ReadView bytes,
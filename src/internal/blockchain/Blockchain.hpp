@@ -83,6 +83,7 @@ public:
     auto eof() -> bool;
     auto read(std::size_t nbits) -> std::uint64_t;
 
+    BitReader(const ReadView data);
     BitReader(const Vector<std::byte>& data);
     BitReader() = delete;
     BitReader(const BitReader&) = delete;
@@ -91,7 +92,6 @@ public:
     auto operator=(BitReader&&) -> BitReader& = delete;
 
 private:
-    const Vector<std::byte>& raw_data_;
     const std::uint8_t* data_;
     std::size_t len_;
     std::uint64_t accum_;
@@ -205,4 +205,14 @@ auto GCS(
     const ReadView key,
     ReadView encoded,
     alloc::Default alloc) noexcept -> blockchain::cfilter::GCS;
+/// Construct a filter which references a record in the flat storage layout
+///
+/// The serialized bytes must outlive the returned object. Records loaded from
+/// the block filter database satisfy this for the lifetime of the process
+/// since mapped space is only released or reused when the files are opened.
+/// Copies of the returned object own their data.
+auto GCSView(
+    const api::Session& api,
+    const ReadView flat,
+    alloc::Default alloc) noexcept -> blockchain::cfilter::GCS;
 }  // namespace opentxs::factory
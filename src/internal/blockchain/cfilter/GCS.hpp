@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <boost/endian/buffers.hpp>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/cfilter/GCS.hpp"
@@ -24,6 +28,8 @@ namespace protobuf
 {
 class GCS;
 }  // namespace protobuf
+
+class Writer;
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
@@ -36,6 +42,32 @@ using Hash = std::uint64_t;
 using Hashes = Vector<Hash>;
 using Range = std::uint64_t;
 
+/// Header of a cfilter stored in the flat layout
+///
+/// The header is followed immediately by the Golomb-coded filter bytes. The
+/// first byte can not begin a valid protobuf message which allows flat and
+/// legacy records to coexist in the same table during migration.
+struct FlatHeader {
+    static constexpr auto marker_ = std::uint8_t{0xff};
+    static constexpr auto current_format_ = std::uint8_t{1};
+
+    std::uint8_t marker_byte_;
+    std::uint8_t format_;
+    std::uint8_t bits_;
+    std::uint8_t reserved_;
+    boost::endian::little_uint32_buf_t version_;
+    boost::endian::little_uint32_buf_t fp_rate_;
+    boost::endian::little_uint32_buf_t count_;
+    std::array<std::byte, 16> key_;
+};
+
+static_assert(sizeof(FlatHeader) == 32);
+
+auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    alloc::Default alloc) noexcept(false) -> Elements;
 auto GolombDecode(
     const std::uint32_t N,
     const std::uint8_t P,
@@ -51,6 +83,10 @@ auto HashToRange(
     const Range range,
     const ReadView item) noexcept(false) -> Element;
 auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element;
+auto HashToRange(
+    const Range range,
+    std::span<const Hash> hashes,
+    std::span<Element> out) noexcept(false) -> void;
 auto HashedSetConstruct(
     const api::Session& api,
     const ReadView key,
@@ -58,10 +94,19 @@ auto HashedSetConstruct(
     const std::uint32_t M,
     const blockchain::cfilter::Targets& items,
     alloc::Default alloc) noexcept(false) -> Elements;
+auto IsFlat(const ReadView serialized) noexcept -> bool;
 auto Siphash(
     const api::Session& api,
     const ReadView key,
     const ReadView item) noexcept(false) -> Hash;
+/// Compute SipHash-2-4 of every item using the same key
+///
+/// Items of equal length are hashed several at a time if the cpu supports
+/// it, so callers should prefer this over hashing items one at a time.
+auto Siphash(
+    const ReadView key,
+    std::span<const ReadView> items,
+    std::span<Hash> out) noexcept(false) -> void;
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::cfilter::internal
@@ -75,6 +120,8 @@ public:
         const noexcept -> PrehashedMatches = 0;
     virtual auto Range() const noexcept -> gcs::Range = 0;
     virtual auto Serialize(protobuf::GCS& out) const noexcept -> bool = 0;
+    virtual auto SerializeFlat(Writer&& out) const noexcept -> bool = 0;
+    virtual auto SerializedFlatSize() const noexcept -> std::size_t = 0;
     virtual auto Test(const gcs::Hashes& targets, alloc::Default monotonic)
         const noexcept -> bool = 0;
 
@@ -55,6 +55,10 @@ public:
         const block::Hash& id,
         const ReadView bytes,
         alloc::Default monotonic) noexcept -> ReadView = 0;
+    virtual auto BlockStore(
+        std::span<const SerializedBlock> blocks,
+        alloc::Default alloc,
+        alloc::Default monotonic) noexcept -> Vector<ReadView> = 0;
     virtual auto SetBlockTip(const block::Position& position) noexcept
         -> bool = 0;
 
@@ -64,6 +64,8 @@ using BestHashes = UnallocatedMap<block::Height, block::Hash>;
 using Hashes = UnallocatedSet<block::Hash>;
 using HashVector = Vector<block::Hash>;
 using Segments = UnallocatedSet<ChainSegment>;
+// block hash, serialized block
+using SerializedBlock = std::pair<block::Hash, ReadView>;
 // parent block hash, disconnected block hash
 using DisconnectedList = UnallocatedMultimap<block::Hash, block::Hash>;
 using ElementMap = Map<crypto::Bip32Index, Vector<Vector<std::byte>>>;
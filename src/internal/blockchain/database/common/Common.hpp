@@ -67,6 +67,7 @@ enum Table {
     FilterIndexBCH = 20,
     FilterIndexES = 21,
     TransactionIndex = 22,
+    BulkFree = 23,
 };
 
 auto ChainToSyncTable(const opentxs::blockchain::Type chain) noexcept(false)
@@ -19,7 +19,10 @@ struct Config {
     BlockchainProfile profile_{BlockchainProfile::desktop};
     bool provide_sync_server_{false};
     bool disable_wallet_{false};
+    std::size_t block_cache_bytes_{0};
 
+    /// Returns block_cache_bytes_, or the default limit if it is unset
+    auto BlockCacheBytes() const noexcept -> std::size_t;
     auto PeerTarget(blockchain::Type) const noexcept -> std::size_t;
     auto Print(alloc::Default alloc = {}) const noexcept -> CString;
 };
@@ -5,10 +5,21 @@
 
 #pragma once
 
+#include "opentxs/blockchain/node/CoinSelection.hpp"  // IWYU pragma: keep
+#include "opentxs/core/Amount.hpp"
+
 namespace opentxs::blockchain::node::internal
 {
 struct SpendPolicy {
     bool unconfirmed_incoming_{false};
     bool unconfirmed_change_{true};
+    CoinSelection selection_{CoinSelection::Oldest};
+    /// Value still required to fund the transaction. Set by the transaction
+    /// builder before each input is requested.
+    Amount target_{};
+    /// Fee added to the transaction by each additional input
+    Amount input_cost_{};
+    /// Excess value below which the transaction is built without change
+    Amount change_cost_{};
 };
 }  // namespace opentxs::blockchain::node::internal
@@ -8,7 +8,6 @@
 #include <chrono>
 #include <cstddef>
 #include <memory>
-#include <string_view>
 
 #include "opentxs/util/Allocated.hpp"
 #include "opentxs/util/Container.hpp"
@@ -42,7 +41,7 @@ public:
     auto Remaining() const noexcept -> std::size_t;
 
     auto get_deleter() noexcept -> delete_function final;
-    auto Submit(const std::string_view block) noexcept -> bool;
+    auto Submit() noexcept -> bool;
     auto swap(BlockBatch& rhs) noexcept -> void;
 
     BlockBatch(allocator_type alloc = {}) noexcept;
@@ -58,6 +58,8 @@ enum class Job : OTZMQWorkType {
     reorg = value(WorkType::BlockchainReorg),
     request_blocks = OT_ZMQ_INTERNAL_SIGNAL + 0u,
     submit_block = OT_ZMQ_INTERNAL_SIGNAL + 1u,
+    job_finished = OT_ZMQ_INTERNAL_SIGNAL + 2u,
+    flush_blocks = OT_ZMQ_INTERNAL_SIGNAL + 3u,
     block_ready = OT_ZMQ_BLOCK_ORACLE_BLOCK_READY,
     report = OT_ZMQ_BLOCKCHAIN_REPORT_STATUS,
     init = OT_ZMQ_INIT_SIGNAL,
@@ -47,6 +47,7 @@ class Mempool;
 namespace wallet
 {
 class Reorg;
+class ScanCoordinator;
 }  // namespace wallet
 
 class Manager;
@@ -64,6 +65,7 @@ public:
 
     Account(
         Reorg& reorg,
+        std::shared_ptr<const ScanCoordinator> scan,
         const crypto::Account& account,
         std::shared_ptr<const api::session::internal::Client> api,
         std::shared_ptr<const node::Manager> node,
@@ -0,0 +1,96 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cs_plain_guarded.h>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "internal/blockchain/cfilter/GCS.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/cfilter/Types.hpp"
+#include "opentxs/util/Allocator.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs
+{
+namespace blockchain
+{
+namespace cfilter
+{
+class GCS;
+}  // namespace cfilter
+
+namespace node
+{
+class Manager;
+}  // namespace node
+}  // namespace blockchain
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::node::wallet
+{
+/// Loads and matches cfilters on behalf of every subchain of a wallet
+///
+/// Subchains submit a range of blocks along with their prehashed targets and
+/// return to their event loop. A thread pool job collects every request which
+/// is pending at the time it runs, loads each distinct cfilter once, matches it
+/// once against the union of the targets of every request which covers that
+/// block, and routes each hit back to the request that asked for it. The
+/// completion callback of each request is then executed so the owner can
+/// resume processing on its own thread.
+class ScanCoordinator : public std::enable_shared_from_this<ScanCoordinator>
+{
+public:
+    struct Request {
+        /// Blocks to test, in chain order
+        Vector<block::Hash> blocks_{};
+        /// Sorted and deduplicated targets for each entry in blocks_
+        Vector<gcs::Hashes> targets_{};
+        /// Executed on a thread pool thread when matching is complete
+        SimpleCallback done_{};
+        /// Targets present in each cfilter
+        ///
+        /// Contains fewer entries than blocks_ if a cfilter was not available
+        Vector<gcs::Hashes> matched_{};
+        /// Element count of each tested cfilter
+        Vector<std::uint32_t> elements_{};
+        bool failed_{false};
+    };
+
+    /// Queue a request for matching and return immediately
+    auto Submit(std::shared_ptr<Request> request) const noexcept -> void;
+
+    ScanCoordinator(const std::shared_ptr<const node::Manager>& node) noexcept;
+    ScanCoordinator() = delete;
+    ScanCoordinator(const ScanCoordinator&) = delete;
+    ScanCoordinator(ScanCoordinator&&) = delete;
+    auto operator=(const ScanCoordinator&) -> ScanCoordinator& = delete;
+    auto operator=(ScanCoordinator&&) -> ScanCoordinator& = delete;
+
+    ~ScanCoordinator();
+
+private:
+    using Batch = Vector<std::shared_ptr<Request>>;
+
+    struct Queue {
+        Batch pending_{};
+        bool running_{false};
+    };
+
+    const std::weak_ptr<const node::Manager> node_;
+    const cfilter::Type type_;
+    mutable libguarded::plain_guarded<Queue> queue_;
+
+    auto process(std::span<std::shared_ptr<Request>> batch) const
+        noexcept(false) -> void;
+    auto run() const noexcept -> void;
+};
+}  // namespace opentxs::blockchain::node::wallet
@@ -111,6 +111,7 @@ public:
     auto P2PDefaultPort() const noexcept -> std::uint16_t;
     auto P2PDefaultProtocol() const noexcept -> network::blockchain::Protocol;
     auto P2PMagicBits() const noexcept -> std::uint32_t;
+    auto P2PMaxMessageSize() const noexcept -> std::size_t;
     auto P2PSeeds() const noexcept -> const Vector<std::string_view>&;
     auto P2PVersion() const noexcept
         -> network::blockchain::bitcoin::message::ProtocolVersion;
@@ -636,6 +636,11 @@ struct AccountActivity : virtual public List,
 
     virtual auto last(const implementation::AccountActivityRowID& id)
         const noexcept -> bool = 0;
+    /// Best chain height for blockchain accounts, or -1 for other accounts
+    virtual auto ChainHeight() const noexcept -> blockchain::block::Height
+    {
+        return -1;
+    }
     // WARNING potential race condition. Child rows must never call this
     // except when directed by parent object
     virtual auto Contract() const noexcept -> const contract::Unit& = 0;
@@ -1674,6 +1679,11 @@ struct UnitListItem final : virtual public Row,
 };
 }  // namespace blank
 
+/// Confirmations of a transaction mined at the specified height, or zero if
+/// the transaction is unconfirmed or mined above the best chain
+auto confirmations(
+    const blockchain::block::Height mined,
+    const blockchain::block::Height best) noexcept -> int;
 auto make_progress(
     blockchain::block::Height& actual,
     blockchain::block::Height& target) noexcept -> double;
@@ -6,12 +6,14 @@
 #pragma once
 
 #include <cstddef>
-#include <functional>
 #include <memory>
 #include <optional>
 #include <string_view>
 #include <utility>
 
+#include "opentxs/network/asio/Socket.hpp"
+#include "opentxs/util/Container.hpp"
+
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs
 {
@@ -35,14 +37,8 @@ namespace blockchain
 class Address;
 }  // namespace blockchain
 
-namespace asio
-{
-class Socket;
-}  // namespace asio
-
 namespace zeromq
 {
-class Frame;
 class Message;
 }  // namespace zeromq
 }  // namespace network
@@ -56,7 +52,8 @@ namespace opentxs::network::blockchain
 class ConnectionManager
 {
 public:
-    using BodySize = std::function<std::size_t(const zeromq::Frame& header)>;
+    using BodySize = network::asio::Socket::BodySize;
+    using VerifyBody = network::asio::Socket::VerifyBody;
 
     static auto TCP(
         const api::Session& api,
@@ -64,14 +61,16 @@ public:
         const int id,
         const Address& address,
         const std::size_t headerSize,
-        BodySize&& gbs) noexcept -> std::unique_ptr<ConnectionManager>;
+        BodySize gbs,
+        VerifyBody vb) noexcept -> std::unique_ptr<ConnectionManager>;
     static auto TCPIncoming(
         const api::Session& api,
         const Log& log,
         const int id,
         const Address& address,
         const std::size_t headerSize,
-        BodySize&& gbs,
+        BodySize gbs,
+        VerifyBody vb,
         network::asio::Socket&& socket) noexcept
         -> std::unique_ptr<ConnectionManager>;
     static auto ZMQ(
@@ -96,11 +95,10 @@ public:
     virtual auto do_connect() noexcept
         -> std::pair<bool, std::optional<std::string_view>> = 0;
     virtual auto do_init() noexcept -> std::optional<std::string_view> = 0;
+    /// Returns the protocol messages contained in a received batch
     virtual auto on_body(zeromq::Message&&) noexcept
-        -> std::optional<zeromq::Message> = 0;
+        -> Vector<zeromq::Message> = 0;
     virtual auto on_connect() noexcept -> void = 0;
-    virtual auto on_header(zeromq::Message&&) noexcept
-        -> std::optional<zeromq::Message> = 0;
     virtual auto on_init() noexcept -> zeromq::Message = 0;
     virtual auto on_register(zeromq::Message&&) noexcept -> void = 0;
     virtual auto shutdown_external() noexcept -> void = 0;
@@ -199,6 +199,7 @@ auto BitcoinP2PMessage(
     const network::blockchain::bitcoin::message::ProtocolVersion version,
     ReadView header,
     ReadView payload,
+    const bool verified,
     alloc::Default alloc) noexcept
     -> network::blockchain::bitcoin::message::internal::Message;
 auto BitcoinP2PMessage(
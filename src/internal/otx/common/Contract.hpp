@@ -65,6 +65,9 @@ public:
     virtual auto GetIdentifier(identifier::Generic& theIdentifier) const
         -> void;
     auto GetName(String& strName) const -> void { strName.Set(name_->Get()); }
+    /** The complete raw file including signatures, without copying it. The
+     * view is invalidated by the next change to the contract. */
+    auto RawFile() const noexcept -> ReadView { return raw_file_->Bytes(); }
     auto SaveContractRaw(String& strOutput) const -> bool;
     virtual auto VerifySignature(const identity::Nym& theNym) const -> bool;
     virtual auto VerifyWithKey(const crypto::asymmetric::Key& theKey) const
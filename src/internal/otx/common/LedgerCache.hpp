@@ -0,0 +1,75 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "opentxs/Export.hpp"
+#include "opentxs/identifier/Generic.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs
+{
+/// Bounded write-through cache of the serialized inboxes, outboxes, nymboxes
+/// and box receipts belonging to a single session.
+///
+/// Every write still reaches the data store before the cache is updated so the
+/// files on disk remain authoritative. The cache also remembers which box
+/// contents have already passed signature verification against a given set of
+/// public keys so repeated loads of an unchanged box do not verify the same
+/// signature again.
+class OPENTXS_NO_EXPORT LedgerCache
+{
+public:
+    static auto Key(
+        std::string_view dataFolder,
+        std::string_view one,
+        std::string_view two,
+        std::string_view three,
+        std::string_view four) noexcept -> UnallocatedCString;
+
+    auto Erase(const UnallocatedCString& key) noexcept -> void;
+    auto Load(const UnallocatedCString& key) noexcept
+        -> std::optional<UnallocatedCString>;
+    auto SetVerified(
+        const identifier::Generic& contents,
+        const identifier::Generic& keys) noexcept -> void;
+    auto Store(const UnallocatedCString& key, std::string_view file) noexcept
+        -> void;
+    auto Verified(
+        const identifier::Generic& contents,
+        const identifier::Generic& keys) const noexcept -> bool;
+
+    LedgerCache() noexcept;
+    LedgerCache(const LedgerCache&) = delete;
+    LedgerCache(LedgerCache&&) = delete;
+    auto operator=(const LedgerCache&) -> LedgerCache& = delete;
+    auto operator=(LedgerCache&&) -> LedgerCache& = delete;
+
+    ~LedgerCache() = default;
+
+private:
+    using Entry = std::pair<UnallocatedCString, UnallocatedCString>;
+    using Files = UnallocatedList<Entry>;
+    using Signature = std::pair<identifier::Generic, identifier::Generic>;
+
+    static constexpr auto max_bytes_ = std::size_t{64u * 1024u * 1024u};
+    static constexpr auto max_signatures_ = std::size_t{65536u};
+
+    mutable std::mutex lock_;
+    std::size_t bytes_;
+    Files files_;
+    UnallocatedMap<UnallocatedCString, Files::iterator> index_;
+    UnallocatedDeque<Signature> signature_order_;
+    UnallocatedSet<Signature> signatures_;
+
+    auto erase(const UnallocatedCString& key) noexcept -> void;
+};
+}  // namespace opentxs
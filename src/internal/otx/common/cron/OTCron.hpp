@@ -7,8 +7,12 @@
 
 #include <irrxml/irrXML.hpp>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include "internal/otx/common/Contract.hpp"
 #include "opentxs/Time.hpp"
@@ -44,6 +48,7 @@ class Armored;
 class OTCronItem;
 class OTMarket;
 class PasswordPrompt;
+class String;
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
@@ -96,7 +101,11 @@ public:
     inline auto ActivateCron() -> bool
     {
         if (!is_activated_) {
-            return is_activated_ = true;
+            is_activated_ = true;
+
+            if (wake_) { wake_(); }
+
+            return true;
         } else {
             return false;
         }
@@ -157,6 +166,14 @@ public:
     void ProcessCronItems();
 
     auto computeTimeout() -> std::chrono::milliseconds;
+    /** The earliest time at which a cron item is due, if there are any */
+    auto NextDue() const -> std::optional<Time>;
+    /** The callback is executed whenever a change may require a cron pass
+     * sooner than previously scheduled */
+    inline void SetWakeCallback(std::function<void()> callback)
+    {
+        wake_ = std::move(callback);
+    }
 
     inline void SetNotaryID(const identifier::Notary& NOTARY_ID)
     {
@@ -171,7 +188,13 @@ public:
     inline auto GetServerNym() const -> Nym_p { return server_nym_; }
 
     auto LoadCron() -> bool;
+    /** Writes the cron index, the market list and the transaction numbers.
+     * Cron items are stored in their own files and only written here if they
+     * have never been stored before. */
     auto SaveCron() -> bool;
+    /** Call after modifying a cron item. Only that item is written, plus the
+     * cron index if cron's transaction numbers changed in the meantime. */
+    auto SaveCronItem(const OTCronItem& item) -> bool;
 
     void InitCron();
 
@@ -192,6 +215,17 @@ private:
 
     friend api::session::notary::FactoryPrivate;
 
+    struct ScheduledItem {
+        Time added_{};
+        Time due_{};
+        // hash of the serialized item as of the last time it was stored
+        std::optional<std::size_t> stored_{};
+    };
+    /** Cron items by transaction number */
+    using ItemSchedule = UnallocatedMap<std::int64_t, ScheduledItem>;
+    /** Transaction numbers ordered by the time the item is next due */
+    using DueQueue = UnallocatedSet<std::pair<Time, std::int64_t>>;
+
     // Number of transaction numbers Cron  will grab for itself, when it gets
     // low, before each round.
     static std::int32_t _trans_refill_amount;
@@ -207,6 +241,8 @@ private:
     // Cron Items are found on both lists.
     mapOfCronItems cron_items_;
     multimapOfCronItems cron_items_multi_;
+    ItemSchedule schedule_;
+    DueQueue due_;
     // Always store this in any object that's associated with a specific server.
     identifier::Notary notary_id_;
     // I can't put receipts in people's inboxes without a supply of these.
@@ -216,6 +252,23 @@ private:
     bool is_activated_{false};
     // I'll need this for later.
     Nym_p server_nym_{nullptr};
+    // list_transaction_numbers_ has changed since the last SaveCron()
+    bool numbers_changed_{false};
+    // Item files which the saved cron file may still name. They are deleted
+    // after the next successful SaveCron().
+    UnallocatedSet<std::int64_t> erased_{};
+    std::function<void()> wake_{};
+
+    static auto item_filename(std::int64_t lTransactionNum)
+        -> UnallocatedCString;
+    static auto item_hash(const OTCronItem& item) noexcept -> std::size_t;
+
+    auto erase_item(std::int64_t lTransactionNum) -> void;
+    auto load_item(const String& strData, const Time tDateAdded) -> bool;
+    auto purge_erased() -> void;
+    auto reschedule(std::int64_t lTransactionNum, const Time due) -> void;
+    auto store_item(const OTCronItem& item) -> bool;
+    auto unschedule(std::int64_t lTransactionNum) -> void;
 
     explicit OTCron(const api::Session& server);
 };
@@ -167,6 +167,9 @@ public:
     {
         return process_interval_;
     }
+    /** The earliest time at which ProcessCron() will do more than return
+     * immediately. OTCron does not wake the item again before this time. */
+    auto GetNextProcessDate() const -> Time;
 
     inline auto GetCron() const -> OTCron* { return cron_; }
     void setServerNym(Nym_p serverNym) { server_nym_ = serverNym; }
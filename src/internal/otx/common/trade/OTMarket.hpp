@@ -6,12 +6,14 @@
 #pragma once
 
 #include <irrxml/irrXML.hpp>
+#include <cstddef>
 #include <cstdint>
 
 #include "internal/otx/common/Contract.hpp"
 #include "opentxs/Time.hpp"
 #include "opentxs/core/Amount.hpp"
 #include "opentxs/identifier/Notary.hpp"
+#include "opentxs/identifier/Nym.hpp"
 #include "opentxs/identifier/UnitDefinition.hpp"
 #include "opentxs/util/Container.hpp"
 
@@ -31,7 +33,6 @@ class Session;
 namespace identifier
 {
 class Generic;
-class Nym;
 }  // namespace identifier
 
 namespace OTDB
@@ -46,18 +47,11 @@ class OTCron;
 class OTOffer;
 class OTTrade;
 class PasswordPrompt;
+class String;
 
 #define MAX_MARKET_QUERY_DEPTH                                                 \
     50  // todo add this to the ini file. (Now that we actually have one.)
 
-// Multiple offers, mapped by price limit.
-// Using multi-map since there will be more than one offer for each single
-// price.
-// (Map would only allow a single item on the map for each price.)
-using mapOfOffers = UnallocatedMultimap<Amount, OTOffer*>;
-// The same offers are also mapped (uniquely) to transaction number.
-using mapOfOffersTrnsNum = UnallocatedMap<Amount, OTOffer*>;
-
 // A market has a list of OTOffers for all the bids, and another list of
 // OTOffers for all the asks.
 // Presumably the server will have different markets for different instrument
@@ -112,9 +106,12 @@ public:
 
     auto GetHighestBidPrice() -> Amount;
     auto GetLowestAskPrice() -> Amount;
+    // Total amount available from all the bids (or asks) at a given price.
+    auto GetBidDepth(const Amount& lPrice) const -> Amount;
+    auto GetAskDepth(const Amount& lPrice) const -> Amount;
 
-    auto GetBidCount() -> mapOfOffers::size_type { return bids_.size(); }
-    auto GetAskCount() -> mapOfOffers::size_type { return asks_.size(); }
+    auto GetBidCount() -> std::size_t { return bid_count_; }
+    auto GetAskCount() -> std::size_t { return ask_count_; }
     void SetInstrumentDefinitionID(
         const identifier::UnitDefinition& INSTRUMENT_DEFINITION_ID)
     {
@@ -171,8 +168,14 @@ public:
 
     inline void SetCronPointer(OTCron& theCron) { cron_ = &theCron; }
     inline auto GetCron() -> OTCron* { return cron_; }
+    // Links an offer which is already on the market to the trade it belongs
+    // to.
+    void LinkTrade(OTOffer& theOffer, OTTrade& theTrade);
     auto LoadMarket() -> bool;
+    // Writes a signed snapshot of the entire market.
     auto SaveMarket(const PasswordPrompt& reason) -> bool;
+    // Records the current state of an offer which is on the market.
+    auto SaveOffer(OTOffer& theOffer, const PasswordPrompt& reason) -> bool;
 
     void InitMarket();
 
@@ -200,15 +203,54 @@ private:
 
     using ot_super = Contract;
 
+    // All of the offers on one side of the market at a single price limit, in
+    // the order they were added to the market, along with the total amount
+    // they have available.
+    struct PriceLevel {
+        UnallocatedList<OTOffer*> offers_{};
+        Amount depth_{0};
+    };
+    using PriceLevels = UnallocatedMap<Amount, PriceLevel>;
+    // Where an offer is in the book, the amount it had available the last
+    // time its price level was updated, and the Nym it belongs to (once it
+    // has been linked to its trade.)
+    struct Position {
+        PriceLevels::iterator level_{};
+        UnallocatedList<OTOffer*>::iterator offer_{};
+        Amount available_{0};
+        identifier::Nym nym_{};
+    };
+    using Positions = UnallocatedMap<std::int64_t, Position>;
+    using NymOffers =
+        UnallocatedMap<identifier::Nym, UnallocatedSet<std::int64_t>>;
+
+    // Changes since the last snapshot are appended to the market journal.
+    // Once this many have been recorded, a new snapshot is written instead.
+    static constexpr auto snapshot_interval_ = std::size_t{256};
+
     OTCron* cron_{nullptr};  // The Cron object that owns this Market.
 
     OTDB::TradeListMarket* trade_list_{nullptr};
 
-    mapOfOffers bids_;  // The buyers, ordered by price limit
-    mapOfOffers asks_;  // The sellers, ordered by price limit
-
-    mapOfOffersTrnsNum offers_;  // All of the offers on a single list,
-                                 // ordered by transaction number.
+    PriceLevels bids_;  // The buyers, ordered by price limit
+    PriceLevels asks_;  // The sellers, ordered by price limit
+    std::size_t bid_count_{0};
+    std::size_t ask_count_{0};
+
+    Positions offers_;  // All of the offers on a single list,
+                        // ordered by transaction number.
+    NymOffers nym_offers_;  // Transaction numbers of the offers belonging
+                            // to each Nym, for those offers which have been
+                            // linked to their trade.
+    std::size_t journal_entries_{0};
+    // The journal which holds changes made since the last snapshot. The
+    // snapshot records this number so that a journal it already includes is
+    // never replayed.
+    std::uint64_t journal_sequence_{0};
+    // Set when a change could be written neither to the journal nor to a
+    // snapshot. Appending later changes would leave a gap in the journal, so
+    // every change is written as a snapshot until one succeeds.
+    bool snapshot_required_{false};
 
     identifier::Notary notary_id_;  // Always store this in any object that's
                                     // associated with a specific server.
@@ -252,6 +294,22 @@ private:
         const identifier::UnitDefinition& CURRENCY_TYPE_ID,
         const Amount& lScale);
 
+    void add_to_nym(
+        const std::int64_t lTransactionNum,
+        const identifier::Nym& nym);
+    auto append_journal(
+        const UnallocatedCString& entry,
+        const PasswordPrompt& reason) -> bool;
+    void erase_journal(const std::uint64_t sequence);
+    auto insert_offer(OTOffer& theOffer) -> bool;
+    auto journal_name(const std::uint64_t sequence) const
+        -> UnallocatedCString;
+    auto offer_entry(OTOffer& theOffer) const -> UnallocatedCString;
+    auto remove_offer(const std::int64_t lTransactionNum) -> OTOffer*;
+    auto replay_journal() -> bool;
+    auto replay_offer(const Time tDateAdded, const String& strOffer) -> bool;
+    void update_depth(OTOffer& theOffer);
+
     void rollback_four_accounts(
         Account& p1,
         bool b1,
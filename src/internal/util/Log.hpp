@@ -6,6 +6,14 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
+#include <string_view>
+
+#include "opentxs/util/Log.hpp"
+
+#ifndef OT_LOG_MAX_LEVEL
+#define OT_LOG_MAX_LEVEL 5
+#endif
 
 namespace opentxs
 {
@@ -18,13 +26,52 @@ namespace opentxs::internal
 class Log
 {
 public:
+    /// Writes a formatted message to the console
+    using Print = std::function<void(
+        int level,
+        Console console,
+        std::string_view text,
+        std::string_view thread)>;
+
     static constexpr auto flush_ = std::byte{0x00};
     static constexpr auto terminate_ = std::byte{0x01};
+    static constexpr auto abort_ = int{-2};
+    static constexpr auto error_ = int{-1};
+    static constexpr auto console_ = int{0};
+    static constexpr auto detail_ = int{1};
+    static constexpr auto verbose_ = int{2};
+    static constexpr auto debug_ = int{3};
+    static constexpr auto trace_ = int{4};
+    static constexpr auto insane_ = int{5};
+    // NOTE messages above this level are not compiled into the library
+    static constexpr auto max_level_ = int{OT_LOG_MAX_LEVEL};
 
+    /// Returns true if a message written to log would be delivered
+    ///
+    /// Level must be the level of log. Statements guarded by this function
+    /// are removed at compile time, including the construction of their
+    /// arguments, if the level is above OT_LOG_MAX_LEVEL.
+    template <int Level>
+    static auto Active(const opentxs::Log& log) noexcept -> bool
+    {
+        if constexpr (Level > max_level_) {
+
+            return false;
+        } else {
+
+            return log.Internal().Active();
+        }
+    }
     static auto Endpoint() noexcept -> const char*;
     static auto SetVerbosity(const int level) noexcept -> void;
     static auto Shutdown() noexcept -> void;
-    static auto Start() noexcept -> void;
+    /// Starts the log thread
+    ///
+    /// The log thread writes every message with print. Messages are only
+    /// forwarded to Endpoint() if publish is true.
+    static auto Start(Print print, bool publish) noexcept -> void;
+
+    virtual auto Active() const noexcept -> bool = 0;
 
     Log() = default;
     Log(const Log&) = delete;
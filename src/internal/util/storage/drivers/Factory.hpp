@@ -70,6 +70,15 @@ auto StoragePlugin(
     const std::atomic<storage::Bucket>& primaryBucket,
     const storage::Config& config) noexcept
     -> std::shared_ptr<storage::driver::Plugin>;
+/// Instantiates a plugin which uses primary instead of the driver selected by
+/// config
+auto StoragePlugin(
+    const api::Crypto& crypto,
+    const api::session::Factory& factory,
+    const std::atomic<storage::Bucket>& primaryBucket,
+    const storage::Config& config,
+    std::unique_ptr<storage::Driver> primary) noexcept
+    -> std::shared_ptr<storage::driver::Plugin>;
 auto StorageSqlite3(
     const api::Crypto& crypto,
     const storage::Config& config) noexcept -> std::unique_ptr<storage::Driver>;
@@ -5,6 +5,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+
+#include "opentxs/Types.hpp"
 #include "opentxs/storage/Types.hpp"
 #include "opentxs/storage/Types.internal.hpp"
 #include "opentxs/util/storage/Driver.hpp"
@@ -38,6 +42,11 @@ namespace opentxs::storage::driver
 class Plugin
 {
 public:
+    /// Maximum time a root update may be deferred before it is committed
+    static constexpr auto commit_interval_ = std::chrono::milliseconds{250};
+    /// Number of root updates which triggers a commit
+    static constexpr auto commit_threshold_ = std::size_t{64};
+
     virtual auto Load(
         const Hash& key,
         ErrorReporting checking,
@@ -46,14 +55,41 @@ public:
     virtual auto LoadRoot() const noexcept -> Hash = 0;
     virtual auto Primary() const noexcept -> const Driver& = 0;
 
-    virtual auto DoGC(const tree::GCParams& params) noexcept -> bool = 0;
+    /// Perform one step of an incremental garbage collection run
+    ///
+    /// Up to limit objects reachable from params.root_ are copied into the
+    /// active bucket, skipping any which are already present there, and the
+    /// progress counters in params are advanced. The step which processes the
+    /// final object also empties the stale bucket.
+    virtual auto DoGC(tree::GCParams& params, std::size_t limit) noexcept
+        -> bool = 0;
     virtual auto EmptyBucket(Bucket bucket) const noexcept -> bool = 0;
     virtual auto FindBestRoot() noexcept -> Hash = 0;
+    /// Commit all pending objects and the most recent root hash
+    ///
+    /// If the commit fails the batch is kept and false is returned so the
+    /// caller can retry later.
+    virtual auto Flush() const noexcept -> bool = 0;
     virtual auto InitBackup() -> void = 0;
     virtual auto InitEncryptedBackup(opentxs::crypto::symmetric::Key& key)
         -> void = 0;
     virtual auto Primary() noexcept -> Driver& = 0;
+    /// Set the function to call when a deferred root update needs a Flush
+    ///
+    /// The callback runs once when a new batch is started and again whenever
+    /// a commit attempt fails, so a caller can schedule a Flush only while
+    /// uncommitted state exists.
+    virtual auto SetPendingCallback(SimpleCallback cb) noexcept -> void = 0;
     virtual auto Store(ReadView value, Hash& key) const noexcept -> bool = 0;
+    /// Queue a new root hash for publication
+    ///
+    /// Root updates are group committed: the objects stored since the last
+    /// commit and the latest root are written to the drivers in a single
+    /// transaction once enough updates have accumulated or commit_interval_
+    /// has elapsed. Only the driver transactions are coalesced; every update
+    /// still serializes and hashes its own nodes. Until the commit LoadRoot
+    /// and Load serve the pending state from memory, and a crash rolls back
+    /// to the last committed root which is always complete.
     virtual auto StoreRoot(const Hash& hash) const noexcept -> bool = 0;
 
     Plugin(const Plugin&) = delete;
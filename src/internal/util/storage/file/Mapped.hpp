@@ -61,7 +61,46 @@ public:
     auto Read(const std::span<const Index> indices, allocator_type alloc)
         const noexcept -> Vector<ReadView>;
 
+    /** Relocate records into the space found by Reclaim
+     *
+     *  Up to batch records are moved from the end of the file into free
+     *  extents and their index entries are updated in a single transaction.
+     *  Space vacated by relocated records is not released until the next time
+     *  Reclaim is called since readers may still hold views into it.
+     *
+     *  \returns true if more work remains to be done
+     */
+    auto Compact(std::size_t batch, allocator_type monotonic) noexcept -> bool;
     auto Erase(const Index& index, lmdb::Transaction& tx) noexcept -> bool;
+    /** Delete an index entry and record the space it referred to as free
+     *
+     *  \returns false if the key does not exist in the table
+     */
+    auto Forget(int table, ReadView key, lmdb::Transaction& tx) noexcept
+        -> bool;
+    /** Release space occupied by records which are no longer referenced
+     *
+     *  Free extents are read from freeTable, which is maintained by Compact,
+     *  Forget, and Store. The specified tables, each of which must contain
+     *  serialized Index values, are only scanned to build freeTable the first
+     *  time it is used. Unreferenced space is returned to the filesystem where
+     *  the platform supports it and becomes available to Compact.
+     *
+     *  \warning This must be called before the first Read since it may unmap
+     *  files and discard their contents.
+     */
+    auto Reclaim(
+        std::span<const int> tables,
+        int freeTable,
+        allocator_type monotonic) noexcept -> bool;
+    /** Update an index entry and record the space of any record it replaces
+     *  as free
+     */
+    auto Store(
+        int table,
+        ReadView key,
+        const Index& index,
+        lmdb::Transaction& tx) noexcept -> bool;
     auto Write(lmdb::Transaction& tx, const Vector<std::size_t>& items) noexcept
         -> WriteParam;
 
@@ -81,6 +120,7 @@ protected:
         lmdb::Database& lmdb,
         int positionTable,
         std::size_t positionKey,
+        Layout layout,
         allocator_type alloc) noexcept(false);
 
 private:
@@ -90,5 +130,9 @@ private:
 
     static auto preload(std::span<ReadView> bytes) noexcept -> void;
     static auto preload_platform(std::span<ReadView> bytes) noexcept -> void;
+    static auto release_platform(
+        const std::filesystem::path& file,
+        std::size_t offset,
+        std::size_t bytes) noexcept -> void;
 };
 }  // namespace opentxs::storage::file
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <string_view>
@@ -42,17 +43,46 @@ using Metadata = std::tuple<Hash, UnallocatedCString, std::uint64_t, bool>;
  */
 using Index = UnallocatedMap<identifier::Generic, Metadata>;
 
+/** State of a garbage collection run
+ *
+ *  Collection proceeds in steps which each copy a bounded number of objects.
+ *  position_ counts the objects reachable from root_ which have been processed
+ *  so far and is persisted so an interrupted run resumes where it stopped. The
+ *  remaining members describe the current process only.
+ */
 struct GCParams {
     bool running_{};
     Time last_{};
     Hash root_{};
     Bucket from_{};
+    std::uint64_t position_{};
+    std::uint64_t total_{};
+    std::uint64_t copied_{};
+    std::uint64_t skipped_{};
+    Time started_{};
+
+    /// Objects processed per second since this process started or resumed
+    auto Throughput() const noexcept -> double
+    {
+        const auto elapsed =
+            std::chrono::duration<double>{Clock::now() - started_}.count();
+
+        if (0.0 < elapsed) {
+
+            return static_cast<double>(copied_ + skipped_) / elapsed;
+        } else {
+
+            return 0.0;
+        }
+    }
 };
 
 // WARNING update print function if new values are added or removed
 enum class Job : OTZMQWorkType {
     shutdown = value(WorkType::Shutdown),
     finished = OT_ZMQ_INTERNAL_SIGNAL + 0,
+    flush = OT_ZMQ_INTERNAL_SIGNAL + 1,
+    pending = OT_ZMQ_INTERNAL_SIGNAL + 2,
     init = OT_ZMQ_INIT_SIGNAL,
     statemachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
 };  // IWYU pragma: export
@@ -68,6 +68,82 @@
 
 namespace zmq = opentxs::network::zeromq;
 
+namespace opentxs::network
+{
+LegacyEncoding::LegacyEncoding() noexcept
+    : format_(Format::unknown)
+{
+}
+
+auto LegacyEncoding::Get() const noexcept -> Format { return format_.load(); }
+
+auto LegacyEncoding::Reply(
+    const Format format,
+    const zeromq::Message& reply) noexcept -> bool
+{
+    if (Format::unknown != format) { return false; }
+
+    const auto body = reply.Payload();
+    const auto binary = [&] {
+        if (3u != body.size()) { return false; }
+
+        try {
+
+            return WorkType::OTXLegacyBinary == body[2].as<WorkType>();
+        } catch (...) {
+
+            return false;
+        }
+    }();
+
+    if (binary) {
+        format_.store(Format::binary);
+
+        return false;
+    } else if ((2u == body.size()) && (0u == body[1].size())) {
+        // NOTE older notaries do not parse tagged requests and reply with an
+        // empty message without processing the request, so it is safe to
+        // send it again
+        format_.store(Format::untagged);
+
+        return true;
+    } else {
+
+        return false;
+    }
+}
+
+auto LegacyEncoding::Request(
+    const Format format,
+    const String& raw,
+    const Armored& armored) -> zeromq::Message
+{
+    auto out = zeromq::Message{};
+
+    switch (format) {
+        case Format::untagged: {
+            out.AddFrame(armored.Get());
+        } break;
+        case Format::binary: {
+            out.AddFrame(WorkType::OTXLegacyBinary);
+            out.AddFrame(ReadView{raw.Get(), raw.GetLength()});
+        } break;
+        case Format::unknown:
+        default: {
+            out.AddFrame(WorkType::OTXLegacyXML);
+            out.AddFrame(armored.Get());
+        }
+    }
+
+    return out;
+}
+
+auto LegacyEncoding::Reset() noexcept -> void
+{
+    format_.store(Format::unknown);
+}
+}  // namespace opentxs::network
+
 namespace opentxs::network
 {
 auto ServerConnection::Factory(
@@ -158,6 +234,7 @@ ServerConnection::Imp::Imp(
     , sockets_ready_(Flag::Factory(false))
     , status_(Flag::Factory(false))
     , use_proxy_(Flag::Factory(false))
+    , encoding_()
     , registration_lock_()
     , registered_for_push_()
 {
@@ -435,6 +512,8 @@ auto ServerConnection::Imp::reset_socket(const Lock& lock) -> void
     assert_true(verify_lock(lock));
 
     sockets_ready_->Off();
+    // NOTE the socket may reconnect to a different notary version
+    encoding_.Reset();
 }
 
 auto ServerConnection::Imp::reset_timer() -> void
@@ -502,22 +581,35 @@ auto ServerConnection::Imp::Send(
 
     auto raw = String::Factory();
     message.SaveContractRaw(raw);
-    auto envelope = Armored::Factory(api_.Crypto(), raw);
+    const auto socketLock = Lock{lock_};
+    using enum LegacyEncoding::Format;
+    auto encoding = encoding_.Get();
+    const auto envelope = [&] {
+        if (binary == encoding) {
+
+            return Armored::Factory(api_.Crypto());
+        } else {
 
-    if (false == envelope->Exists()) {
+            return Armored::Factory(api_.Crypto(), raw);
+        }
+    }();
+
+    if ((binary != encoding) && (false == envelope->Exists())) {
         LogError()()("Failed to armor message").Flush();
 
         return output;
     }
 
-    const auto socketLock = Lock{lock_};
     Cleanup cleanup(socketLock, *this, status, reply);
-    auto sendresult = get_sync(socketLock).Send([&] {
-        auto out = zeromq::Message{};
-        out.AddFrame(envelope->Get());
-
-        return out;
-    }());
+    auto sendresult = get_sync(socketLock).Send(
+        LegacyEncoding::Request(encoding, raw, envelope));
+
+    if (encoding_.Reply(encoding, sendresult.second)) {
+        LogVerbose()()("Notary does not accept tagged requests").Flush();
+        encoding = encoding_.Get();
+        sendresult = get_sync(socketLock).Send(
+            LegacyEncoding::Request(encoding, raw, envelope));
+    }
 
     if (status_->On()) { publish(); }
 
@@ -556,7 +648,8 @@ auto ServerConnection::Imp::Send(
                 }();
 
                 switch (type) {
-                    case WorkType::OTXLegacyXML: {
+                    case WorkType::OTXLegacyXML:
+                    case WorkType::OTXLegacyBinary: {
 
                         return body[1];
                     }
@@ -572,16 +665,22 @@ auto ServerConnection::Imp::Send(
         }
 
         const auto serialized = [&] {
-            const auto armored = [&] {
-                auto out = Armored::Factory(api_.Crypto());
-                out->Set(UnallocatedCString{payload.Bytes()}.c_str());
+            if (binary == encoding) {
+                const auto bytes = payload.Bytes();
 
-                return out;
-            }();
-            auto out = String::Factory();
-            armored->GetString(out);
+                return String::Factory(bytes.data(), bytes.size());
+            } else {
+                const auto armored = [&] {
+                    auto out = Armored::Factory(api_.Crypto());
+                    out->Set(UnallocatedCString{payload.Bytes()}.c_str());
 
-            return out;
+                    return out;
+                }();
+                auto out = String::Factory();
+                armored->GetString(out);
+
+                return out;
+            }
         }();
         const auto loaded = replymessage->LoadContractFromString(serialized);
 
@@ -71,12 +71,54 @@ class ServerPrivate;
 }  // namespace context
 }  // namespace otx
 
+class Armored;
 class PasswordPrompt;
+class String;
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
 namespace opentxs::network
 {
+/// Selects the format of legacy requests sent over one notary connection
+///
+/// Requests are tagged and armored until the notary reveals whether it also
+/// accepts unarmored requests.
+class LegacyEncoding
+{
+public:
+    enum class Format : std::uint8_t {
+        unknown,
+        untagged,
+        binary,
+    };
+
+    static auto Request(
+        const Format format,
+        const String& raw,
+        const Armored& armored) -> zeromq::Message;
+
+    auto Get() const noexcept -> Format;
+
+    /// Updates the format from the reply to a request sent as format
+    ///
+    /// Returns true if the notary did not process the request, in which case
+    /// it must be sent again in the format returned by Get.
+    auto Reply(const Format format, const zeromq::Message& reply) noexcept
+        -> bool;
+    auto Reset() noexcept -> void;
+
+    LegacyEncoding() noexcept;
+    LegacyEncoding(const LegacyEncoding&) = delete;
+    LegacyEncoding(LegacyEncoding&&) = delete;
+    auto operator=(const LegacyEncoding&) -> LegacyEncoding& = delete;
+    auto operator=(LegacyEncoding&&) -> LegacyEncoding& = delete;
+
+    ~LegacyEncoding() = default;
+
+private:
+    std::atomic<Format> format_;
+};
+
 class ServerConnection::Imp final : Lockable
 {
 public:
@@ -117,6 +159,7 @@ private:
     OTFlag sockets_ready_;
     OTFlag status_;
     OTFlag use_proxy_;
+    LegacyEncoding encoding_;
     mutable std::mutex registration_lock_;
     UnallocatedMap<identifier::Nym, bool> registered_for_push_;
 
@@ -5,11 +5,13 @@
 
 #include "opentxs/network/asio/Socket.hpp"  // IWYU pragma: associated
 
+#include <cstring>
 #include <memory>
 #include <utility>
 
 #include "BoostAsio.hpp"
 #include "internal/api/network/Asio.hpp"
+#include "internal/util/P0330.hpp"
 #include "network/asio/Socket.hpp"
 #include "opentxs/network/asio/Endpoint.hpp"
 #include "opentxs/util/Log.hpp"
@@ -73,6 +75,41 @@ auto Socket::Imp::Buffer::Transmit(
 
     return std::addressof(params);
 }
+
+auto Socket::Imp::Reader::Consume(std::size_t bytes) noexcept -> void
+{
+    assert_true(bytes <= (end_ - begin_));
+
+    begin_ += bytes;
+
+    if (begin_ == end_) {
+        begin_ = 0_uz;
+        end_ = 0_uz;
+    }
+}
+
+auto Socket::Imp::Reader::Data() const noexcept -> ReadView
+{
+    const auto* start = reinterpret_cast<const char*>(buffer_.data());
+
+    return {start + begin_, end_ - begin_};
+}
+
+auto Socket::Imp::Reader::Prepare(std::size_t bytes) noexcept -> Buffer::Write
+{
+    if ((buffer_.size() - end_) < bytes) {
+        if (0_uz < begin_) {
+            const auto used = end_ - begin_;
+            std::memmove(buffer_.data(), buffer_.data() + begin_, used);
+            begin_ = 0_uz;
+            end_ = used;
+        }
+
+        if ((buffer_.size() - end_) < bytes) { buffer_.resize(end_ + bytes); }
+    }
+
+    return boost::asio::buffer(buffer_.data() + end_, buffer_.size() - end_);
+}
 }  // namespace opentxs::network::asio
 
 namespace opentxs::network::asio
@@ -81,6 +118,7 @@ Socket::Imp::Imp(const Endpoint& endpoint, Asio& asio) noexcept
     : endpoint_(endpoint)
     , asio_(asio)
     , buffer_()
+    , reader_()
     , socket_(asio_.IOContext())
 {
 }
@@ -89,6 +127,7 @@ Socket::Imp::Imp(Asio& asio, Endpoint&& endpoint, tcp::socket&& socket) noexcept
     : endpoint_(std::move(endpoint))
     , asio_(asio)
     , buffer_()
+    , reader_()
     , socket_(std::move(socket))
 {
 }
@@ -136,6 +175,17 @@ auto Socket::Imp::Receive(
     return asio_.Receive(id, type, bytes, shared_from_this());
 }
 
+auto Socket::Imp::ReceiveMessages(
+    const zeromq::Envelope& id,
+    const OTZMQWorkType type,
+    const std::size_t headerBytes,
+    const BodySize& bodySize,
+    const VerifyBody& verifyBody) noexcept -> bool
+{
+    return asio_.ReceiveMessages(
+        id, type, headerBytes, bodySize, verifyBody, shared_from_this());
+}
+
 auto Socket::Imp::Transmit(
     const zeromq::Envelope& notify,
     const ReadView data) noexcept -> bool
@@ -178,6 +228,17 @@ auto Socket::Receive(
     return Imp::Get(imp_).Receive(id, type, bytes);
 }
 
+auto Socket::ReceiveMessages(
+    const zeromq::Envelope& id,
+    const OTZMQWorkType type,
+    const std::size_t headerBytes,
+    const BodySize& bodySize,
+    const VerifyBody& verifyBody) noexcept -> bool
+{
+    return Imp::Get(imp_).ReceiveMessages(
+        id, type, headerBytes, bodySize, verifyBody);
+}
+
 auto Socket::Transmit(
     const zeromq::Envelope& notify,
     const ReadView data) noexcept -> bool
@@ -82,11 +82,28 @@ public:
         UnallocatedMap<std::size_t, ReceiveParams> receive_{};
     };
 
+    // NOTE holds bytes received by ReceiveMessages() which have not yet been
+    // delivered. Consumed space at the front is reclaimed by moving the
+    // remaining bytes down whenever a read needs more room.
+    struct Reader {
+        auto Commit(std::size_t bytes) noexcept -> void { end_ += bytes; }
+        auto Consume(std::size_t bytes) noexcept -> void;
+        auto Data() const noexcept -> ReadView;
+        auto Prepare(std::size_t bytes) noexcept -> Buffer::Write;
+
+    private:
+        std::size_t begin_{};
+        std::size_t end_{};
+        UnallocatedVector<std::byte> buffer_{};
+    };
+
     using GuardedBuffer = libguarded::plain_guarded<Buffer>;
+    using GuardedReader = libguarded::plain_guarded<Reader>;
 
     const Endpoint endpoint_;
     api::network::internal::Asio& asio_;
     GuardedBuffer buffer_;
+    GuardedReader reader_;
     tcp::socket socket_;
 
     static auto Destroy(void* imp) noexcept -> void;
@@ -98,6 +115,12 @@ public:
         const zeromq::Envelope& notify,
         const OTZMQWorkType type,
         const std::size_t bytes) noexcept -> bool;
+    auto ReceiveMessages(
+        const zeromq::Envelope& notify,
+        const OTZMQWorkType type,
+        const std::size_t headerBytes,
+        const BodySize& bodySize,
+        const VerifyBody& verifyBody) noexcept -> bool;
     auto Transmit(const zeromq::Envelope& notify, const ReadView data) noexcept
         -> bool;
 
@@ -180,8 +180,10 @@ Peer::Peer(
     std::optional<asio::Socket> socket,
     const zeromq::BatchID batch,
     allocator_type alloc) noexcept
-    : Imp(std::move(api),
-          std::move(network),
+    // NOTE api and network are copied rather than moved because the framing
+    // functions are constructed from them in the same argument list
+    : Imp(api,
+          network,
           peerID,
           std::move(address),
           std::move(gossip),
@@ -189,6 +191,8 @@ Peer::Peer(
           1min,
           10min,
           HeaderType::size_,
+          body_size(network->Internal().Chain()),
+          verify_body(api, network->Internal().Chain()),
           fromParent,
           std::move(socket),
           batch,
@@ -260,6 +264,33 @@ Peer::Peer(
 {
 }
 
+auto Peer::body_size(opentxs::blockchain::Type chain) noexcept
+    -> ConnectionManager::BodySize
+{
+    // NOTE message sizes are supplied by the remote peer so they are bounded
+    // by the largest message the chain permits before any buffer space is
+    // reserved for them
+    const auto limit =
+        opentxs::blockchain::params::get(chain).P2PMaxMessageSize();
+
+    return [chain, limit](ReadView bytes) -> std::optional<std::size_t> {
+        const auto header = HeaderType{bytes};
+
+        if (false == header.IsValid(chain)) { return std::nullopt; }
+
+        if (const auto size = header.PayloadSize(); size <= limit) {
+
+            return size;
+        } else {
+            LogError()()("message size ")(size)(" exceeds limit of ")(limit)(
+                " for ")(print(chain))
+                .Flush();
+
+            return std::nullopt;
+        }
+    };
+}
+
 auto Peer::can_gossip(const blockchain::Address& address) const noexcept -> bool
 {
     if (address.Internal().Incoming()) { return false; }
@@ -341,12 +372,6 @@ auto Peer::check_verification(allocator_type monotonic) noexcept -> void
     if (verified) { transition_state_run(monotonic); }
 }
 
-auto Peer::extract_body_size(const zeromq::Frame& header) const noexcept
-    -> std::size_t
-{
-    return message::internal::Header{header.Bytes()}.PayloadSize();
-}
-
 auto Peer::get_local_services(
     const message::ProtocolVersion version,
     const opentxs::blockchain::Type network,
@@ -691,7 +716,9 @@ auto Peer::process_protocol(
     allocator_type monotonic) noexcept(false) -> void
 {
     const auto data = message.get();
-    update_block_job(data, monotonic);
+    // NOTE the block oracle writes the block, so it must be sent before the
+    // job is updated since completing the job causes the block oracle to
+    // requeue every block it has not yet received
     to_block_oracle_.SendDeferred(
         [&] {
             using enum opentxs::blockchain::node::blockoracle::Job;
@@ -701,6 +728,7 @@ auto Peer::process_protocol(
             return work;
         }(),
         true);
+    update_block_job(monotonic);
 }
 
 auto Peer::process_protocol(
@@ -1820,5 +1848,22 @@ auto Peer::transmit_txid(const Txid& txid, allocator_type monotonic) noexcept
     transmit_protocol_inv(Inv{inv_tx_, txid.Bytes()}, monotonic);
 }
 
+auto Peer::verify_body(
+    std::weak_ptr<const api::internal::Session> api,
+    opentxs::blockchain::Type chain) noexcept -> ConnectionManager::VerifyBody
+{
+    // NOTE a weak reference avoids extending the lifetime of the session
+    // through pending socket reads
+    return [api = std::move(api), chain](ReadView header, ReadView body) {
+        if (auto p = api.lock(); p) {
+
+            return HeaderType{header}.Verify(p->Self(), chain, body);
+        } else {
+
+            return false;
+        }
+    };
+}
+
 Peer::~Peer() = default;
 }  // namespace opentxs::network::blockchain::bitcoin
@@ -189,6 +189,8 @@ private:
     Handshake handshake_;
     Verification verification_;
 
+    static auto body_size(opentxs::blockchain::Type chain) noexcept
+        -> ConnectionManager::BodySize;
     static auto get_local_services(
         const message::ProtocolVersion version,
         const opentxs::blockchain::Type network,
@@ -196,14 +198,16 @@ private:
         allocator_type alloc) noexcept
         -> Set<opentxs::network::blockchain::bitcoin::Service>;
     static auto is_implemented(message::Command) noexcept -> bool;
+    static auto verify_body(
+        std::weak_ptr<const api::internal::Session> api,
+        opentxs::blockchain::Type chain) noexcept
+        -> ConnectionManager::VerifyBody;
 
     auto can_gossip(const blockchain::Address& address) const noexcept -> bool;
     auto ignore_message(message::Command type) const noexcept -> bool;
 
     auto check_handshake(allocator_type monotonic) noexcept -> void final;
     auto check_verification(allocator_type monotonic) noexcept -> void;
-    auto extract_body_size(const zeromq::Frame& header) const noexcept
-        -> std::size_t final;
     auto process_addresses(
         std::span<Address> data,
         allocator_type monotonic) noexcept -> void;
@@ -77,6 +77,18 @@ auto BitcoinP2PMessage(
             return {alloc};
         }
         case 3: {
+            // NOTE messages split from a body batch were framed by the socket
+            // reader which already verified their checksums
+            const auto verified = [&] {
+                try {
+                    using network::blockchain::PeerJob;
+
+                    return PeerJob::body == payload[0].as<PeerJob>();
+                } catch (...) {
+
+                    return false;
+                }
+            }();
 
             return BitcoinP2PMessage(
                 api,
@@ -85,6 +97,7 @@ auto BitcoinP2PMessage(
                 version,
                 payload[1].Bytes(),
                 payload[2].Bytes(),
+                verified,
                 alloc);
         }
         default: {
@@ -119,6 +132,7 @@ auto BitcoinP2PMessage(
     const network::blockchain::bitcoin::message::ProtocolVersion version,
     ReadView headerBytes,
     ReadView payloadBytes,
+    const bool verified,
     alloc::Default alloc) noexcept
     -> network::blockchain::bitcoin::message::internal::Message
 {
@@ -132,7 +146,8 @@ auto BitcoinP2PMessage(
             throw std::runtime_error{"invalid header"};
         }
 
-        if (false == header.Verify(api, chain, payloadBytes)) {
+        if ((false == verified) &&
+            (false == header.Verify(api, chain, payloadBytes))) {
 
             throw std::runtime_error{
                 "checksum failure for "s.append(print(chain))
@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <future>
 #include <span>
+#include <utility>
 
 #include "BoostAsio.hpp"
 #include "internal/api/network/Asio.hpp"
@@ -19,8 +20,6 @@
 #include "opentxs/api/Network.hpp"
 #include "opentxs/api/Session.hpp"
 #include "opentxs/api/network/Asio.hpp"
-#include "opentxs/api/session/Factory.hpp"
-#include "opentxs/core/ByteArray.hpp"
 #include "opentxs/network/asio/Endpoint.hpp"
 #include "opentxs/network/asio/Socket.hpp"
 #include "opentxs/network/blockchain/Address.hpp"
@@ -30,6 +29,7 @@
 #include "opentxs/network/zeromq/message/Envelope.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
+#include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 
 namespace asio = boost::asio;
@@ -45,10 +45,10 @@ struct TCPConnectionManager : virtual public ConnectionManager {
     DeferredConstruction<zeromq::Envelope> connection_id_;
     const std::size_t header_bytes_;
     const BodySize get_body_size_;
+    const VerifyBody verify_body_;
     std::promise<void> connection_id_promise_;
     std::shared_future<void> connection_id_future_;
     network::asio::Socket socket_;
-    ByteArray header_;
     bool running_;
 
     auto send() const noexcept -> zeromq::Message final { return {}; }
@@ -80,58 +80,34 @@ struct TCPConnectionManager : virtual public ConnectionManager {
         return (ready == connection_id_future_.wait_for(zero));
     }
     auto on_body(zeromq::Message&& message) noexcept
-        -> std::optional<zeromq::Message> final
+        -> Vector<zeromq::Message> final
     {
         auto body = message.Payload();
 
         assert_true(1 < body.size());
+        assert_true(1_uz == (body.size() % 2_uz));
 
         run();
+        auto out = Vector<zeromq::Message>{};
+        out.reserve(body.size() / 2_uz);
+
+        for (auto i = 1_uz; i < body.size(); i += 2_uz) {
+            auto& m = out.emplace_back();
+            m.StartBody();
+            // NOTE the body tag tells the message factory that the checksum
+            // was verified when the message was framed
+            m.AddFrame(PeerJob::body);
+            m.AddFrame(std::move(body[i]));
+            m.AddFrame(std::move(body[i + 1_uz]));
+        }
 
-        return [&] {
-            auto out = zeromq::Message{};
-            out.StartBody();
-            out.AddFrame(PeerJob::p2p);
-            out.AddFrame(header_);
-            out.AddFrame(std::move(body[1]));
-
-            return out;
-        }();
+        return out;
     }
     auto on_connect() noexcept -> void final
     {
         log_()()("Connect to ")(endpoint_.str())(" successful").Flush();
         run();
     }
-    auto on_header(zeromq::Message&& message) noexcept
-        -> std::optional<zeromq::Message> final
-    {
-        auto body = message.Payload();
-
-        assert_true(1 < body.size());
-
-        auto& header = body[1];
-        const auto size = get_body_size_(header);
-
-        if (0 < size) {
-            header_.Assign(header.Bytes());
-            receive(static_cast<OTZMQWorkType>(PeerJob::body), size);
-
-            return std::nullopt;
-        } else {
-            run();
-
-            return [&] {
-                auto out = zeromq::Message{};
-                out.StartBody();
-                out.AddFrame(PeerJob::p2p);
-                out.AddFrame(std::move(header));
-                out.AddFrame();
-
-                return out;
-            }();
-        }
-    }
     auto on_init() noexcept -> zeromq::Message final
     {
         return [&] {
@@ -158,15 +134,15 @@ struct TCPConnectionManager : virtual public ConnectionManager {
         } catch (...) {
         }
     }
-    auto receive(const OTZMQWorkType type, const std::size_t bytes) noexcept
-        -> void
-    {
-        if (running_) { socket_.Receive(connection_id_, type, bytes); }
-    }
     auto run() noexcept -> void
     {
         if (running_) {
-            receive(static_cast<OTZMQWorkType>(PeerJob::header), header_bytes_);
+            socket_.ReceiveMessages(
+                connection_id_,
+                static_cast<OTZMQWorkType>(PeerJob::body),
+                header_bytes_,
+                get_body_size_,
+                verify_body_);
         }
     }
     auto shutdown_external() noexcept -> void final
@@ -196,7 +172,8 @@ struct TCPConnectionManager : virtual public ConnectionManager {
         const int id,
         const Address& address,
         const std::size_t headerSize,
-        BodySize&& gbs) noexcept
+        BodySize gbs,
+        VerifyBody vb) noexcept
         : api_(api)
         , log_(log)
         , id_(id)
@@ -204,18 +181,14 @@ struct TCPConnectionManager : virtual public ConnectionManager {
         , connection_id_()
         , header_bytes_(headerSize)
         , get_body_size_(std::move(gbs))
+        , verify_body_(std::move(vb))
         , connection_id_promise_()
         , connection_id_future_(connection_id_promise_.get_future())
         , socket_(api_.Network().Asio().Internal().MakeSocket(endpoint_))
-        , header_([&] {
-            auto out = api_.Factory().Data();
-            out.resize(headerSize);
-
-            return out;
-        }())
         , running_(true)
     {
         assert_false(nullptr == get_body_size_);
+        assert_false(nullptr == verify_body_);
     }
 
     ~TCPConnectionManager() override { socket_.Close(); }
@@ -248,7 +221,8 @@ protected:
         const int id,
         const std::size_t headerSize,
         network::asio::Endpoint&& endpoint,
-        BodySize&& gbs,
+        BodySize gbs,
+        VerifyBody vb,
         network::asio::Socket&& socket) noexcept
         : api_(api)
         , log_(log)
@@ -257,18 +231,14 @@ protected:
         , connection_id_()
         , header_bytes_(headerSize)
         , get_body_size_(std::move(gbs))
+        , verify_body_(std::move(vb))
         , connection_id_promise_()
         , connection_id_future_(connection_id_promise_.get_future())
         , socket_(std::move(socket))
-        , header_([&] {
-            auto out = api_.Factory().Data();
-            out.resize(headerSize);
-
-            return out;
-        }())
         , running_(true)
     {
         assert_false(nullptr == get_body_size_);
+        assert_false(nullptr == verify_body_);
     }
 };
 
@@ -285,7 +255,8 @@ struct TCPIncomingConnectionManager final : public TCPConnectionManager {
         const int id,
         const Address& address,
         const std::size_t headerSize,
-        BodySize&& gbs,
+        BodySize gbs,
+        VerifyBody vb,
         network::asio::Socket&& socket) noexcept
         : TCPConnectionManager(
               api,
@@ -294,6 +265,7 @@ struct TCPIncomingConnectionManager final : public TCPConnectionManager {
               headerSize,
               make_endpoint(address),
               std::move(gbs),
+              std::move(vb),
               std::move(socket))
     {
     }
@@ -307,10 +279,11 @@ auto ConnectionManager::TCP(
     const int id,
     const Address& address,
     const std::size_t headerSize,
-    BodySize&& gbs) noexcept -> std::unique_ptr<ConnectionManager>
+    BodySize gbs,
+    VerifyBody vb) noexcept -> std::unique_ptr<ConnectionManager>
 {
     return std::make_unique<TCPConnectionManager>(
-        api, log, id, address, headerSize, std::move(gbs));
+        api, log, id, address, headerSize, std::move(gbs), std::move(vb));
 }
 
 auto ConnectionManager::TCPIncoming(
@@ -319,11 +292,19 @@ auto ConnectionManager::TCPIncoming(
     const int id,
     const Address& address,
     const std::size_t headerSize,
-    BodySize&& gbs,
+    BodySize gbs,
+    VerifyBody vb,
     opentxs::network::asio::Socket&& socket) noexcept
     -> std::unique_ptr<ConnectionManager>
 {
     return std::make_unique<TCPIncomingConnectionManager>(
-        api, log, id, address, headerSize, std::move(gbs), std::move(socket));
+        api,
+        log,
+        id,
+        address,
+        headerSize,
+        std::move(gbs),
+        std::move(vb),
+        std::move(socket));
 }
 }  // namespace opentxs::network::blockchain
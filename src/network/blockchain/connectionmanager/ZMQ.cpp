@@ -71,16 +71,11 @@ struct ZMQConnectionManager : virtual public ConnectionManager {
         return (ready == init_future_.wait_for(zero));
     }
     auto on_body(zeromq::Message&&) noexcept
-        -> std::optional<zeromq::Message> final
+        -> Vector<zeromq::Message> final
     {
         LogAbort()().Abort();
     }
     auto on_connect() noexcept -> void override {}
-    auto on_header(zeromq::Message&&) noexcept
-        -> std::optional<zeromq::Message> final
-    {
-        LogAbort()().Abort();
-    }
     auto on_init() noexcept -> zeromq::Message override
     {
         LogAbort()().Abort();
@@ -121,6 +121,8 @@ Peer::Imp::Imp(
     std::chrono::milliseconds inactivityInterval,
     std::chrono::milliseconds peersInterval,
     std::size_t headerBytes,
+    ConnectionManager::BodySize bodySize,
+    ConnectionManager::VerifyBody verifyBody,
     std::string_view fromParent,
     std::optional<asio::Socket> socket,
     zeromq::BatchID batch,
@@ -233,11 +235,12 @@ Peer::Imp::Imp(
     , connection_p_(init_connection_manager(
           api_,
           network_,
-          *this,
           remote_address_,
           log_,
           id_,
           headerBytes,
+          std::move(bodySize),
+          std::move(verifyBody),
           std::move(socket)))
     , connection_(*connection_p_)
     , state_(State::pre_init)
@@ -594,11 +597,12 @@ auto Peer::Imp::Init(std::shared_ptr<Imp> me) noexcept -> void
 auto Peer::Imp::init_connection_manager(
     const api::Session& api,
     const opentxs::blockchain::node::Manager& node,
-    const Imp& parent,
     const blockchain::Address& address,
     const Log& log,
     int id,
     std::size_t headerBytes,
+    ConnectionManager::BodySize bodySize,
+    ConnectionManager::VerifyBody verifyBody,
     std::optional<asio::Socket> socket) noexcept
     -> std::unique_ptr<ConnectionManager>
 {
@@ -622,14 +626,19 @@ auto Peer::Imp::init_connection_manager(
                 id,
                 address,
                 headerBytes,
-                [&](const auto& h) { return parent.extract_body_size(h); },
+                std::move(bodySize),
+                std::move(verifyBody),
                 std::move(*socket));
         } else {
 
             return network::blockchain::ConnectionManager::TCP(
-                api, log, id, address, headerBytes, [&](const auto& h) {
-                    return parent.extract_body_size(h);
-                });
+                api,
+                log,
+                id,
+                address,
+                headerBytes,
+                std::move(bodySize),
+                std::move(verifyBody));
         }
     }
 }
@@ -702,8 +711,7 @@ auto Peer::Imp::is_allowed_state(Work work) const noexcept -> bool
                 case statetimeout:
                 case activitytimeout:
                 case needping:
-                case body:
-                case header: {
+                case body: {
 
                     return true;
                 }
@@ -728,7 +736,6 @@ auto Peer::Imp::is_allowed_state(Work work) const noexcept -> bool
                 case activitytimeout:
                 case needping:
                 case body:
-                case header:
                 case broadcasttx:
                 case jobavailablegetheaders:
                 case jobavailableblock:
@@ -836,7 +843,6 @@ auto Peer::Imp::pipeline_trusted(
         case Work::sendresult:
         case Work::p2p:
         case Work::body:
-        case Work::header:
         case Work::init:
         case Work::statemachine: {
             unhandled_type(work, "on trusted socket"sv);
@@ -879,9 +885,6 @@ auto Peer::Imp::pipeline_untrusted(
             process_body(std::move(msg), monotonic);
             do_work(monotonic);
         } break;
-        case Work::header: {
-            process_header(std::move(msg), monotonic);
-        } break;
         case Work::shutdown:
         case Work::blockheader:
         case Work::reorg:
@@ -1002,9 +1005,10 @@ auto Peer::Imp::process_body(Message&& msg, allocator_type monotonic) noexcept
     -> void
 {
     update_activity();
-    auto m = connection_.on_body(std::move(msg));
 
-    if (m.has_value()) { process_protocol(std::move(m.value()), monotonic); }
+    for (auto& m : connection_.on_body(std::move(msg))) {
+        process_protocol(std::move(m), monotonic);
+    }
 }
 
 auto Peer::Imp::process_connect(allocator_type monotonic) noexcept -> void
@@ -1083,15 +1087,6 @@ auto Peer::Imp::process_gossip_address(
     transmit_addresses(out, monotonic);
 }
 
-auto Peer::Imp::process_header(Message&& msg, allocator_type monotonic) noexcept
-    -> void
-{
-    update_activity();
-    auto m = connection_.on_header(std::move(msg));
-
-    if (m.has_value()) { process_protocol(std::move(m.value()), monotonic); }
-}
-
 auto Peer::Imp::process_jobavailableblock(
     Message&& msg,
     allocator_type monotonic) noexcept -> void
@@ -1460,11 +1455,9 @@ auto Peer::Imp::update_address(
     database_.AddOrUpdate({remote_address_});
 }
 
-auto Peer::Imp::update_block_job(
-    const ReadView block,
-    allocator_type monotonic) noexcept -> bool
+auto Peer::Imp::update_block_job(allocator_type monotonic) noexcept -> bool
 {
-    auto visitor = UpdateBlockJob{block};
+    static const auto visitor = UpdateBlockJob{};
 
     return update_job(visitor, monotonic);
 }
@@ -21,6 +21,7 @@
 
 #include "internal/blockchain/node/blockoracle/BlockBatch.hpp"  // IWYU pragma: keep
 #include "internal/blockchain/node/headeroracle/HeaderJob.hpp"
+#include "internal/network/blockchain/ConnectionManager.hpp"
 #include "internal/network/blockchain/Peer.hpp"
 #include "internal/util/Timer.hpp"
 #include "opentxs/Time.hpp"
@@ -92,8 +93,6 @@ class Message;
 }  // namespace internal
 }  // namespace message
 }  // namespace bitcoin
-
-class ConnectionManager;
 }  // namespace blockchain
 
 namespace zeromq
@@ -199,9 +198,7 @@ protected:
     auto update_address(
         Set<opentxs::network::blockchain::bitcoin::Service> services) noexcept
         -> void;
-    auto update_block_job(
-        const ReadView block,
-        allocator_type monotonic) noexcept -> bool;
+    auto update_block_job(allocator_type monotonic) noexcept -> bool;
     auto update_get_headers_job(allocator_type monotonic) noexcept -> void;
     auto update_position(
         opentxs::blockchain::block::Position& target,
@@ -218,6 +215,8 @@ protected:
         std::chrono::milliseconds inactivityInterval,
         std::chrono::milliseconds peersInterval,
         std::size_t headerBytes,
+        ConnectionManager::BodySize bodySize,
+        ConnectionManager::VerifyBody verifyBody,
         std::string_view fromParent,
         std::optional<asio::Socket> socket,
         zeromq::BatchID batch,
@@ -287,11 +286,12 @@ private:
     static auto init_connection_manager(
         const api::Session& api,
         const opentxs::blockchain::node::Manager& node,
-        const Imp& parent,
         const blockchain::Address& address,
         const Log& log,
         int id,
         std::size_t headerBytes,
+        ConnectionManager::BodySize bodySize,
+        ConnectionManager::VerifyBody verifyBody,
         std::optional<asio::Socket> socket) noexcept
         -> std::unique_ptr<ConnectionManager>;
     template <typename J>
@@ -316,8 +316,6 @@ private:
     auto do_disconnect(allocator_type monotonic) noexcept -> void;
     auto do_shutdown() noexcept -> void;
     auto do_startup(allocator_type monotonic) noexcept -> bool;
-    virtual auto extract_body_size(const zeromq::Frame& header) const noexcept
-        -> std::size_t = 0;
     auto pipeline(const Work work, Message&& msg, allocator_type) noexcept
         -> void;
     auto pipeline_trusted(
@@ -352,8 +350,6 @@ private:
     auto process_gossip_address(
         std::span<network::blockchain::Address> addresses,
         allocator_type monotonic) noexcept -> void;
-    auto process_header(Message&& msg, allocator_type monotonic) noexcept
-        -> void;
     auto process_jobavailableblock(
         Message&& msg,
         allocator_type monotonic) noexcept -> void;
@@ -9,26 +9,23 @@
 
 namespace opentxs::network::blockchain::internal
 {
-Peer::Imp::UpdateBlockJob::UpdateBlockJob(ReadView data) noexcept
-    : data_(data)
-{
-}
-
-auto Peer::Imp::UpdateBlockJob::operator()(std::monostate& job) noexcept
+auto Peer::Imp::UpdateBlockJob::operator()(std::monostate& job) const noexcept
     -> JobUpdate
 {
     return {false, false};
 }
 
 auto Peer::Imp::UpdateBlockJob::operator()(
-    opentxs::blockchain::node::internal::HeaderJob& job) noexcept -> JobUpdate
+    opentxs::blockchain::node::internal::HeaderJob& job) const noexcept
+    -> JobUpdate
 {
     return {false, false};
 }
 
 auto Peer::Imp::UpdateBlockJob::operator()(
-    opentxs::blockchain::node::internal::BlockBatch& job) noexcept -> JobUpdate
+    opentxs::blockchain::node::internal::BlockBatch& job) const noexcept
+    -> JobUpdate
 {
-    return {true, job.Submit(data_)};
+    return {true, job.Submit()};
 }
 }  // namespace opentxs::network::blockchain::internal
@@ -9,7 +9,6 @@
 
 #include "internal/network/blockchain/Peer.hpp"
 #include "network/blockchain/peer/Imp.hpp"
-#include "opentxs/Types.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs
@@ -33,17 +32,10 @@ namespace opentxs::network::blockchain::internal
 class Peer::Imp::UpdateBlockJob
 {
 public:
-    auto operator()(std::monostate& job) noexcept -> JobUpdate;
-    auto operator()(
-        opentxs::blockchain::node::internal::HeaderJob& job) noexcept
-        -> JobUpdate;
-    auto operator()(
-        opentxs::blockchain::node::internal::BlockBatch& job) noexcept
-        -> JobUpdate;
-
-    UpdateBlockJob(ReadView data) noexcept;
-
-private:
-    const ReadView data_;
+    auto operator()(std::monostate& job) const noexcept -> JobUpdate;
+    auto operator()(opentxs::blockchain::node::internal::HeaderJob& job)
+        const noexcept -> JobUpdate;
+    auto operator()(opentxs::blockchain::node::internal::BlockBatch& job)
+        const noexcept -> JobUpdate;
 };
 }  // namespace opentxs::network::blockchain::internal
@@ -5,9 +5,7 @@
 
 #include "opentxs/api/LogPrivate.hpp"  // IWYU pragma: associated
 
-#include <chrono>
 #include <cstdlib>
-#include <span>
 #include <utility>
 
 #include "internal/network/zeromq/Context.hpp"
@@ -15,9 +13,7 @@
 #include "internal/network/zeromq/socket/Publish.hpp"
 #include "internal/network/zeromq/socket/Pull.hpp"
 #include "internal/util/Log.hpp"
-#include "opentxs/Time.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
-#include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/network/zeromq/socket/Direction.hpp"  // IWYU pragma: keep
 #include "opentxs/network/zeromq/socket/Types.hpp"
@@ -36,40 +32,29 @@ LogPrivate::LogPrivate(
     , publish_socket_(zmq.Internal().PublishSocket())
     , publish_{!endpoint.empty()}
 {
-    auto rc = socket_->Start(opentxs::internal::Log::Endpoint());
+    // NOTE the log thread writes every message to the console itself so
+    // zeromq is only involved if messages are published
+    if (publish_) {
+        auto rc = socket_->Start(opentxs::internal::Log::Endpoint());
 
-    if (false == rc) { std::abort(); }
+        if (false == rc) { std::abort(); }
 
-    if (publish_) {
         rc = publish_socket_->Start(endpoint);
 
         if (false == rc) { std::abort(); }
     }
 
-    opentxs::internal::Log::Start();
+    opentxs::internal::Log::Start(
+        [this](auto level, auto console, auto text, auto thread) {
+            print(level, console, text, thread);
+        },
+        publish_);
 }
 
 auto LogPrivate::callback(opentxs::network::zeromq::Message&& in) noexcept
     -> void
 {
-    const auto body = in.Payload();
-    const auto level = body[0].as<int>();
-    const auto text = body[1].Bytes();
-    const auto thread = body[2].Bytes();
-    const auto action = body[3].as<LogAction>();
-    const auto console = body[4].as<Console>();
-
-    if (false == text.empty()) {
-        print(level, console, text, thread);
-
-        if (publish_) { publish_socket_->Send(std::move(in)); }
-    }
-
-    if (LogAction::terminate == action) {
-        if (publish_) { sleep(1s); }
-
-        std::abort();
-    }
+    publish_socket_->Send(std::move(in));
 }
 
 LogPrivate::~LogPrivate() { opentxs::internal::Log::Shutdown(); }
@@ -55,6 +55,7 @@ private:
     OTZMQPublishSocket publish_socket_;
     const bool publish_;
 
+    // NOTE only receives messages when they are published
     auto callback(opentxs::network::zeromq::Message&& message) noexcept -> void;
     auto print(
         const int level,
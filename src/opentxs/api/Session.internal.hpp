@@ -65,6 +65,7 @@ namespace identifier
 class Nym;
 }  // namespace identifier
 
+class LedgerCache;
 class Options;
 class PasswordPrompt;
 class Secret;
@@ -109,6 +110,7 @@ public:
     virtual auto GetShared() const noexcept
         -> std::shared_ptr<const api::internal::Session> = 0;
     virtual auto Instance() const noexcept -> int = 0;
+    virtual auto Ledgers() const noexcept -> opentxs::LedgerCache& = 0;
     virtual auto Lock() const -> std::mutex& = 0;
     virtual auto MasterKey(const opentxs::Lock& lock) const
         -> const opentxs::crypto::symmetric::Key& = 0;
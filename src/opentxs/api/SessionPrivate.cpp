@@ -128,6 +128,7 @@ SessionPrivate::SessionPrivate(
     , init_promise_()
     , init_(init_promise_.get_future())
     , shutdown_promise_()
+    , ledger_cache_()
 {
     auto& caller = parent.Internal().GetPasswordCaller();
     external_password_callback_ = &caller;
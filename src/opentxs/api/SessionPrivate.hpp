@@ -14,6 +14,7 @@
 #include <mutex>
 #include <optional>
 
+#include "internal/otx/common/LedgerCache.hpp"
 #include "internal/util/Mutex.hpp"
 #include "opentxs/Time.hpp"
 #include "opentxs/api/Context.hpp"
@@ -144,6 +145,10 @@ public:
         const bool twice,
         const UnallocatedCString& key) const -> bool final;
     auto Instance() const noexcept -> int final { return instance_; }
+    auto Ledgers() const noexcept -> opentxs::LedgerCache& final
+    {
+        return ledger_cache_;
+    }
     auto Paths() const noexcept -> const api::internal::Paths& final;
     auto Lock() const -> std::mutex& final { return master_key_lock_; }
     auto MasterKey(const opentxs::Lock& lock) const
@@ -230,6 +235,7 @@ private:
     std::promise<void> init_promise_;
     const std::shared_future<void> init_;
     std::promise<void> shutdown_promise_;
+    mutable opentxs::LedgerCache ledger_cache_;
 
     void bump_password_timer(const opentxs::Lock& lock) const;
     // TODO void password_timeout() const;
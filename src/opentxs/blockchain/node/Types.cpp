@@ -9,6 +9,7 @@
 #include <frozen/unordered_map.h>
 
 #include "internal/network/zeromq/socket/Sender.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/node/CoinSelection.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/node/Funding.hpp"        // IWYU pragma: keep
 #include "opentxs/blockchain/node/SendResult.hpp"     // IWYU pragma: keep
 #include "opentxs/blockchain/node/TxoState.hpp"       // IWYU pragma: keep
@@ -16,6 +17,26 @@
 
 namespace opentxs::blockchain::node
 {
+auto print(CoinSelection in) noexcept -> std::string_view
+{
+    using namespace std::literals;
+    using enum CoinSelection;
+    static constexpr auto map =
+        frozen::make_unordered_map<CoinSelection, std::string_view>({
+            {Oldest, "oldest first"sv},
+            {Largest, "largest first"sv},
+            {BranchAndBound, "branch and bound"sv},
+        });
+
+    if (const auto* i = map.find(in); map.end() != i) {
+
+        return i->second;
+    } else {
+
+        return "unknown CoinSelection"sv;
+    }
+}
+
 auto print(Funding in) noexcept -> std::string_view
 {
     using namespace std::literals;
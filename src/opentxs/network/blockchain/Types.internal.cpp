@@ -154,7 +154,6 @@ auto print(PeerJob in) noexcept -> std::string_view
             {activitytimeout, "activitytimeout"sv},
             {needping, "needping"sv},
             {body, "body"sv},
-            {header, "header"sv},
             {broadcasttx, "broadcasttx"sv},
             {jobavailablegetheaders, "jobavailablegetheaders"sv},
             {jobavailableblock, "jobavailableblock"sv},
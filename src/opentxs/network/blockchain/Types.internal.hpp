@@ -48,7 +48,6 @@ enum class PeerJob : OTZMQWorkType {
     activitytimeout = OT_ZMQ_INTERNAL_SIGNAL + 124,
     needping = OT_ZMQ_INTERNAL_SIGNAL + 125,
     body = OT_ZMQ_INTERNAL_SIGNAL + 126,
-    header = OT_ZMQ_INTERNAL_SIGNAL + 127,
     broadcasttx = OT_ZMQ_BLOCKCHAIN_BROADCAST_TX,
     jobavailablegetheaders = OT_ZMQ_HEADER_ORACLE_JOB_READY,
     jobavailableblock = OT_ZMQ_BLOCK_ORACLE_JOB_AVAILABLE,
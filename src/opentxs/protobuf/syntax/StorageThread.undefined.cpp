@@ -11,11 +11,6 @@
 
 namespace opentxs::protobuf::inline syntax
 {
-auto version_2(const StorageThread& input, const Log& log) -> bool
-{
-    UNDEFINED_VERSION(2);
-}
-
 auto version_3(const StorageThread& input, const Log& log) -> bool
 {
     UNDEFINED_VERSION(3);
@@ -0,0 +1,37 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/protobuf/syntax/StorageThreadChunk.hpp"  // IWYU pragma: associated
+
+#include <opentxs/protobuf/StorageThreadChunk.pb.h>
+#include <opentxs/protobuf/StorageThreadItem.pb.h>  // IWYU pragma: keep
+
+#include "opentxs/protobuf/Types.internal.hpp"
+#include "opentxs/protobuf/syntax/Macros.hpp"
+#include "opentxs/protobuf/syntax/StorageThreadItem.hpp"  // IWYU pragma: keep
+#include "opentxs/protobuf/syntax/VerifyStorage.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::protobuf::inline syntax
+{
+auto version_1(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    if (input.has_hash()) {
+        if (0 < input.item_size()) { FAIL_1("chunk reference contains items"); }
+
+        if (0 == input.count()) { FAIL_1("empty chunk"); }
+
+        if (input.unread() > input.count()) { FAIL_1("invalid unread count"); }
+    } else if (input.has_filter()) {
+        FAIL_1("filter without chunk reference");
+    }
+
+    OPTIONAL_SUBOBJECTS(item, StorageThreadChunkAllowedItem());
+
+    return true;
+}
+}  // namespace opentxs::protobuf::inline syntax
+
+#include "opentxs/protobuf/syntax/Macros.undefine.inc"  // IWYU pragma: keep
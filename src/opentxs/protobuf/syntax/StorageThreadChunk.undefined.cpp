@@ -0,0 +1,110 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/protobuf/syntax/StorageThreadChunk.hpp"  // IWYU pragma: associated
+
+#include <opentxs/protobuf/StorageThreadChunk.pb.h>  // IWYU pragma: keep
+
+#include "opentxs/protobuf/syntax/Macros.hpp"
+
+namespace opentxs::protobuf::inline syntax
+{
+auto version_2(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(2);
+}
+
+auto version_3(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(3);
+}
+
+auto version_4(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(4);
+}
+
+auto version_5(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(5);
+}
+
+auto version_6(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(6);
+}
+
+auto version_7(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(7);
+}
+
+auto version_8(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(8);
+}
+
+auto version_9(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(9);
+}
+
+auto version_10(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(10);
+}
+
+auto version_11(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(11);
+}
+
+auto version_12(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(12);
+}
+
+auto version_13(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(13);
+}
+
+auto version_14(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(14);
+}
+
+auto version_15(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(15);
+}
+
+auto version_16(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(16);
+}
+
+auto version_17(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(17);
+}
+
+auto version_18(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(18);
+}
+
+auto version_19(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(19);
+}
+
+auto version_20(const StorageThreadChunk& input, const Log& log) -> bool
+{
+    UNDEFINED_VERSION(20);
+}
+}  // namespace opentxs::protobuf::inline syntax
+
+#include "opentxs/protobuf/syntax/Macros.undefine.inc"  // IWYU pragma: keep
@@ -301,7 +301,24 @@ auto StorageServersAllowedStorageItemHash() noexcept -> const VersionMap&
 
     return output;
 }
+auto StorageThreadAllowedChunk() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {2, {1, 1}},
+    };
+
+    return output;
+}
 auto StorageThreadAllowedItem() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {1, {1, 1}},
+        {2, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageThreadChunkAllowedItem() noexcept -> const VersionMap&
 {
     static const auto output = VersionMap{
         {1, {1, 1}},
@@ -46,6 +46,8 @@ auto StoragePaymentWorkflowsAllowedStorageWorkflowIndex() noexcept
 auto StoragePurseAllowedStorageItemHash() noexcept -> const VersionMap&;
 auto StorageSeedsAllowedStorageItemHash() noexcept -> const VersionMap&;
 auto StorageServersAllowedStorageItemHash() noexcept -> const VersionMap&;
+auto StorageThreadAllowedChunk() noexcept -> const VersionMap&;
 auto StorageThreadAllowedItem() noexcept -> const VersionMap&;
+auto StorageThreadChunkAllowedItem() noexcept -> const VersionMap&;
 auto StorageUnitsAllowedStorageItemHash() noexcept -> const VersionMap&;
 }  // namespace opentxs::protobuf::inline syntax
@@ -14,9 +14,12 @@
 
 #include "internal/core/Armored.hpp"
 #include "internal/core/String.hpp"
+#include "internal/crypto/key/Keypair.hpp"
+#include "internal/identity/Nym.hpp"
 #include "internal/otx/common/Account.hpp"
 #include "internal/otx/common/Cheque.hpp"
 #include "internal/otx/common/Item.hpp"
+#include "internal/otx/common/LedgerCache.hpp"
 #include "internal/otx/common/NumList.hpp"
 #include "internal/otx/common/OTTransaction.hpp"
 #include "internal/otx/common/OTTransactionType.hpp"
@@ -37,6 +40,7 @@
 #include "opentxs/api/session/Wallet.hpp"
 #include "opentxs/api/session/Wallet.internal.hpp"
 #include "opentxs/core/Data.hpp"
+#include "opentxs/crypto/asymmetric/Key.hpp"
 #include "opentxs/identifier/AccountSubtype.hpp"  // IWYU pragma: keep
 #include "opentxs/identifier/Generic.hpp"
 #include "opentxs/identifier/Notary.hpp"
@@ -122,8 +126,9 @@ auto Ledger::GetTypeString(otx::ledgerType theType) -> const char*
     return TypeStringsLedger[nType];
 }
 
-// This calls OTTransactionType::VerifyAccount(), which calls
-// VerifyContractID() as well as VerifySignature().
+// This calls VerifyContractID() as well as VerifySignature(), like
+// OTTransactionType::VerifyAccount(), except that the signature is only
+// verified once per session for any given box contents and signing keys.
 //
 // But first, this OTLedger version also loads the box receipts,
 // if doing so is appropriate. (message ledger == not appropriate.)
@@ -165,7 +170,56 @@ auto Ledger::VerifyAccount(const identity::Nym& theNym) -> bool
         }
     }
 
-    return OTTransactionType::VerifyAccount(theNym);
+    if (false == VerifyContractID()) {
+        LogError()()("Error verifying account ID.").Flush();
+
+        return false;
+    }
+
+    // NOTE boxes are loaded on nearly every request so the outcome of
+    // verifying unchanged contents is remembered for the life of the session
+    const auto contents = [&] {
+        auto preimage = UnallocatedCString{xml_unsigned_->Get()};
+
+        for (const auto& sig : list_signatures_) {
+            preimage.append(sig->Get());
+        }
+
+        return api_.Factory().IdentifierFromPreimage(preimage);
+    }();
+    // NOTE the outcome depends on the keys VerifySignature would try rather
+    // than on the nym ID, so a nym whose credentials changed verifies again
+    const auto keys = [&] {
+        auto preimage = UnallocatedCString{theNym.ID().Bytes()};
+
+        for (const auto& sig : list_signatures_) {
+            auto candidates = crypto::key::Keypair::Keys{};
+            theNym.Internal().GetPublicKeysBySignature(candidates, sig, 'S');
+
+            for (const auto* key : candidates) {
+                assert_false(nullptr == key);
+
+                preimage.append(key->PublicKey());
+            }
+        }
+
+        preimage.append(theNym.GetPublicSignKey().PublicKey());
+
+        return api_.Factory().IdentifierFromPreimage(preimage);
+    }();
+    auto& cache = api_.Internal().Ledgers();
+
+    if (cache.Verified(contents, keys)) { return true; }
+
+    if (false == VerifySignature(theNym)) {
+        LogError()()("Error verifying signature.").Flush();
+
+        return false;
+    }
+
+    cache.SetVerified(contents, keys);
+
+    return true;
 }
 
 // This makes sure that ALL transactions inside the ledger are saved as box
@@ -493,9 +547,13 @@ auto Ledger::LoadGeneric(otx::ledgerType theType, const String& pString) -> bool
     }
 
     auto strRawFile = String::Factory();
+    const auto cacheKey = LedgerCache::Key(
+        api_.DataFolder().string(), path1, path2, path3, "");
 
     if (pString.Exists()) {  // Loading FROM A STRING.
         strRawFile->Set(pString.Get());
+    } else if (auto cached = api_.Internal().Ledgers().Load(cacheKey); cached) {
+        strRawFile->Set(cached->c_str());
     } else {  // Loading FROM A FILE.
         if (!OTDB::Exists(
                 api_, api_.DataFolder().string(), path1, path2, path3, "")) {
@@ -521,6 +579,7 @@ auto Ledger::LoadGeneric(otx::ledgerType theType, const String& pString) -> bool
         }
 
         strRawFile->Set(strFileContents.c_str());
+        api_.Internal().Ledgers().Store(cacheKey, strFileContents);
     }
 
     // NOTE: No need to deal with OT ARMORED INBOX file format here, since
@@ -590,12 +649,19 @@ auto Ledger::SaveGeneric(otx::ledgerType theType) -> bool
         path2,
         path3,
         "");  // <=== SAVING TO DATA STORE.
+    auto& cache = api_.Internal().Ledgers();
+    const auto cacheKey = LedgerCache::Key(
+        api_.DataFolder().string(), path1, path2, path3, "");
+
     if (!bSaved) {
+        // NOTE the state of the file is unknown after a failed write
+        cache.Erase(cacheKey);
         LogError()()("Error writing ")(pszType)(" to file: ")(path1)('/')(
             filename_.get())
             .Flush();
         return false;
     } else {
+        cache.Store(cacheKey, strFinal->Get());
         LogVerbose()()("Successfully saved ")(pszType)(": ")(path1)('/')(
             filename_.get())
             .Flush();
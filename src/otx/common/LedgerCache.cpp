@@ -0,0 +1,119 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "internal/otx/common/LedgerCache.hpp"  // IWYU pragma: associated
+
+#include "internal/util/Mutex.hpp"
+
+namespace opentxs
+{
+LedgerCache::LedgerCache() noexcept
+    : lock_()
+    , bytes_(0)
+    , files_()
+    , index_()
+    , signature_order_()
+    , signatures_()
+{
+}
+
+auto LedgerCache::Erase(const UnallocatedCString& key) noexcept -> void
+{
+    const auto lock = Lock{lock_};
+    erase(key);
+}
+
+auto LedgerCache::erase(const UnallocatedCString& key) noexcept -> void
+{
+    if (auto i = index_.find(key); index_.end() != i) {
+        bytes_ -= i->second->second.size();
+        files_.erase(i->second);
+        index_.erase(i);
+    }
+}
+
+auto LedgerCache::Key(
+    std::string_view dataFolder,
+    std::string_view one,
+    std::string_view two,
+    std::string_view three,
+    std::string_view four) noexcept -> UnallocatedCString
+{
+    auto out = UnallocatedCString{dataFolder};
+
+    for (const auto& part : {one, two, three, four}) {
+        if (part.empty()) { continue; }
+
+        out.append("/");
+        out.append(part);
+    }
+
+    return out;
+}
+
+auto LedgerCache::Load(const UnallocatedCString& key) noexcept
+    -> std::optional<UnallocatedCString>
+{
+    const auto lock = Lock{lock_};
+
+    if (auto i = index_.find(key); index_.end() != i) {
+        // NOTE move the entry to the front so the least recently used files
+        // are evicted first
+        files_.splice(files_.begin(), files_, i->second);
+
+        return i->second->second;
+    } else {
+
+        return std::nullopt;
+    }
+}
+
+auto LedgerCache::SetVerified(
+    const identifier::Generic& contents,
+    const identifier::Generic& keys) noexcept -> void
+{
+    const auto lock = Lock{lock_};
+    auto key = Signature{contents, keys};
+
+    if (false == signatures_.emplace(key).second) { return; }
+
+    signature_order_.emplace_back(std::move(key));
+
+    while (signature_order_.size() > max_signatures_) {
+        signatures_.erase(signature_order_.front());
+        signature_order_.pop_front();
+    }
+}
+
+auto LedgerCache::Store(
+    const UnallocatedCString& key,
+    std::string_view file) noexcept -> void
+{
+    const auto lock = Lock{lock_};
+    erase(key);
+
+    if (file.size() > max_bytes_) { return; }
+
+    files_.emplace_front(key, file);
+    index_.emplace(key, files_.begin());
+    bytes_ += file.size();
+
+    while (bytes_ > max_bytes_) {
+        const auto& [oldest, contents] = files_.back();
+        bytes_ -= contents.size();
+        index_.erase(oldest);
+        files_.pop_back();
+    }
+}
+
+auto LedgerCache::Verified(
+    const identifier::Generic& contents,
+    const identifier::Generic& keys) const noexcept -> bool
+{
+    const auto lock = Lock{lock_};
+
+    return signatures_.contains(Signature{contents, keys});
+}
+}  // namespace opentxs
@@ -626,6 +626,45 @@ auto QueryPlainString(
         threeStr);
 }
 
+auto AppendPlainString(
+    const api::Session& api,
+    const UnallocatedCString& strContents,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    auto ot_strFolder = String::Factory(strFolder),
+         ot_oneStr = String::Factory(oneStr),
+         ot_twoStr = String::Factory(twoStr),
+         ot_threeStr = String::Factory(threeStr);
+    assert_true(ot_strFolder->Exists(), "ot_strFolder is null");
+
+    if (!ot_oneStr->Exists()) {
+        assert_true(
+            !ot_twoStr->Exists() && !ot_threeStr->Exists(), "bad options");
+        ot_oneStr = String::Factory(strFolder.c_str());
+        ot_strFolder = String::Factory(".");
+    }
+    Storage* pStorage = details::s_pStorage;
+
+    assert_true(
+        (strFolder.length() > 3) || (0 == strFolder.compare(0, 1, ".")));
+    assert_true((oneStr.length() < 1) || (oneStr.length() > 3));
+
+    if (nullptr == pStorage) { return false; }
+
+    return pStorage->AppendPlainString(
+        api,
+        strContents,
+        dataFolder,
+        ot_strFolder->Get(),
+        ot_oneStr->Get(),
+        twoStr,
+        threeStr);
+}
+
 // Store/Retrieve an object. (Storable.)
 
 auto StoreObject(
@@ -2008,6 +2047,19 @@ auto Storage::QueryPlainString(
     return theString;
 }
 
+auto Storage::AppendPlainString(
+    const api::Session& api,
+    const UnallocatedCString& strContents,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    return onAppendPlainString(
+        api, strContents, dataFolder, strFolder, oneStr, twoStr, threeStr);
+}
+
 auto Storage::StoreObject(
     const api::Session& api,
     Storable& theContents,
@@ -2584,6 +2636,41 @@ auto StorageFS::onQueryPlainString(
     return bSuccess;
 }
 
+auto StorageFS::onAppendPlainString(
+    const api::Session& api,
+    const UnallocatedCString& theBuffer,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    UnallocatedCString strOutput;
+
+    if (0 >
+        ConstructAndCreatePath(
+            api, strOutput, dataFolder, strFolder, oneStr, twoStr, threeStr)) {
+        LogError()()("Error writing to ")(strOutput)(".").Flush();
+        return false;
+    }
+
+    std::ofstream ofs(
+        strOutput.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+
+    if (ofs.fail()) {
+        LogError()()("Error opening file: ")(strOutput)(".").Flush();
+        return false;
+    }
+
+    ofs.clear();
+    ofs << theBuffer;
+    ofs.flush();
+    const bool bSuccess = ofs.good();
+    ofs.close();
+
+    return bSuccess;
+}
+
 // Erase a value by location.
 //
 auto StorageFS::onEraseValueByKey(
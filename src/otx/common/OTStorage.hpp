@@ -422,6 +422,15 @@ protected:
         const UnallocatedCString& twoStr,
         const UnallocatedCString& threeStr) -> bool = 0;
 
+    virtual auto onAppendPlainString(
+        const api::Session& api,
+        const UnallocatedCString& theBuffer,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) -> bool = 0;
+
     virtual auto onEraseValueByKey(
         const api::Session& api,
         const UnallocatedCString& dataFolder,
@@ -508,6 +517,16 @@ public:
         const UnallocatedCString& twoStr,
         const UnallocatedCString& threeStr) -> UnallocatedCString;
 
+    // Add to the end of a plain string, creating it if it doesn't exist.
+    auto AppendPlainString(
+        const api::Session& api,
+        const UnallocatedCString& strContents,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) -> bool;
+
     // Store/Retrieve an object. (Storable.)
 
     auto StoreObject(
@@ -654,6 +673,16 @@ auto QueryPlainString(
     const UnallocatedCString& twoStr,
     const UnallocatedCString& threeStr) -> UnallocatedCString;
 
+// Add to the end of a plain string, creating it if it doesn't exist.
+auto AppendPlainString(
+    const api::Session& api,
+    const UnallocatedCString& strContents,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool;
+
 // Store/Retrieve an object. (Storable.)
 //
 auto StoreObject(
@@ -1703,6 +1732,15 @@ protected:
         const UnallocatedCString& twoStr,
         const UnallocatedCString& threeStr) -> bool override;
 
+    auto onAppendPlainString(
+        const api::Session& api,
+        const UnallocatedCString& theBuffer,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) -> bool override;
+
     auto onEraseValueByKey(
         const api::Session& api,
         const UnallocatedCString& dataFolder,
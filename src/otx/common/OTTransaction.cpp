@@ -19,6 +19,7 @@
 #include "internal/otx/common/Cheque.hpp"
 #include "internal/otx/common/Item.hpp"
 #include "internal/otx/common/Ledger.hpp"
+#include "internal/otx/common/LedgerCache.hpp"
 #include "internal/otx/common/Message.hpp"
 #include "internal/otx/common/NumList.hpp"
 #include "internal/otx/common/OTTransactionType.hpp"
@@ -3060,6 +3061,13 @@ auto OTTransaction::DeleteBoxReceipt(Ledger& theLedger) -> bool
         strFolder2name->Get(),
         strFolder3name->Get(),
         strFilename->Get());
+    api_.Internal().Ledgers().Erase(LedgerCache::Key(
+        api_.DataFolder().string(),
+        strFolder1name->Get(),
+        strFolder2name->Get(),
+        strFolder3name->Get(),
+        strFilename->Get()));
+
     if (!bDeleted) {
         LogError()()("Error deleting (writing over) file: ")(
             strFolder1name.get())('/')(strFolder2name.get())('/')(
@@ -3138,12 +3146,22 @@ auto OTTransaction::SaveBoxReceipt(std::int64_t lLedgerType) -> bool
         strFolder2name->Get(),
         strFolder3name->Get(),
         strFilename->Get());
+    auto& cache = api_.Internal().Ledgers();
+    const auto cacheKey = LedgerCache::Key(
+        api_.DataFolder().string(),
+        strFolder1name->Get(),
+        strFolder2name->Get(),
+        strFolder3name->Get(),
+        strFilename->Get());
 
     if (!bSaved) {
+        cache.Erase(cacheKey);
         LogError()()("Error writing file: ")(strFolder1name.get())('/')(
             strFolder2name.get())('/')(strFolder3name.get())('/')(
             strFilename.get())(". Contents: ")(raw_file_.get())(".")
             .Flush();
+    } else {
+        cache.Store(cacheKey, strFinal->Get());
     }
 
     return bSaved;
@@ -5,8 +5,11 @@
 
 #include "internal/otx/common/cron/OTCron.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -57,16 +60,23 @@ std::int32_t OTCron::_cron_max_items_per_nym{10};
 
 Time OTCron::last_executed_{};
 
+// Cron items are stored individually in this subfolder of the cron folder.
+static constexpr auto cron_item_folder_{"items"};
+
 OTCron::OTCron(const api::Session& server)
     : Contract(server)
     , markets_()
     , cron_items_()
     , cron_items_multi_()
+    , schedule_()
+    , due_()
     , notary_id_()
     , list_transaction_numbers_()
     , is_activated_(false)
     , server_nym_(nullptr)  // just here for convenience, not responsible to
                             // cleanup this pointer.
+    , numbers_changed_(false)
+    , wake_()
 {
     InitCron();
     LogDebug()()("Finished calling InitCron 0.").Flush();
@@ -86,6 +96,9 @@ auto OTCron::LoadCron() -> bool
 
     if (bSuccess) { bSuccess = VerifySignature(*(GetServerNym())); }
 
+    // The transaction numbers were only just loaded from the file
+    if (bSuccess) { numbers_changed_ = false; }
+
     return bSuccess;
 }
 
@@ -97,6 +110,19 @@ auto OTCron::SaveCron() -> bool
 
     assert_false(nullptr == GetServerNym());
 
+    // Items which have never been stored in their own file (newly added, or
+    // loaded from a cron file which still embedded them) must be written
+    // before the index refers to them.
+    for (const auto& [lTransactionNum, scheduled] : schedule_) {
+        if (scheduled.stored_.has_value()) { continue; }
+
+        auto pItem = GetItemByOfficialNum(lTransactionNum);
+
+        assert_true(false != bool(pItem));
+
+        if (false == store_item(*pItem)) { return false; }
+    }
+
     ReleaseSignatures();
 
     // Sign it, save it internally to string, and then save that out to the
@@ -108,10 +134,182 @@ auto OTCron::SaveCron() -> bool
             .Flush();
         return false;
     } else {
+        numbers_changed_ = false;
+        purge_erased();
+
         return true;
     }
 }
 
+auto OTCron::SaveCronItem(const OTCronItem& item) -> bool
+{
+    if (false == store_item(item)) { return false; }
+
+    // Cron items which are processed usually consume transaction numbers
+    if (numbers_changed_) { return SaveCron(); }
+
+    return true;
+}
+
+auto OTCron::item_filename(std::int64_t lTransactionNum) -> UnallocatedCString
+{
+    return api::internal::Paths::GetFilenameCrn(lTransactionNum);
+}
+
+auto OTCron::item_hash(const OTCronItem& item) noexcept -> std::size_t
+{
+    return std::hash<ReadView>{}(item.RawFile());
+}
+
+auto OTCron::erase_item(std::int64_t lTransactionNum) -> void
+{
+    const auto it = schedule_.find(lTransactionNum);
+
+    // NOTE the file can not be deleted until the cron file which names it has
+    // been replaced
+    if ((schedule_.end() != it) && it->second.stored_.has_value()) {
+        erased_.emplace(lTransactionNum);
+    }
+}
+
+auto OTCron::load_item(const String& strData, const Time tDateAdded) -> bool
+{
+    auto pItem{api_.Factory().Internal().Session().CronItem(strData)};
+
+    if (false == bool(pItem)) {
+        LogError()()("Unable to create cron item from data in cron file.")
+            .Flush();
+        return false;
+    }
+
+    // Why not do this here (when loading from storage), as well as when
+    // first adding the item to cron,
+    // and thus save myself the trouble of verifying the signature EVERY
+    // ITERATION of ProcessCron().
+    //
+    const std::shared_ptr<OTCronItem> item{pItem.release()};
+    if (!item->VerifySignature(*server_nym_)) {
+        LogError()()("ERROR SECURITY: Server "
+                     "signature failed to "
+                     "verify on a cron item while loading: ")(
+            item->GetTransactionNum())(".")
+            .Flush();
+        return false;
+    } else if (AddCronItem(
+                   item,
+                   false,          // bSaveReceipt=false. The receipt is
+                                   // only saved once: When item FIRST
+                                   // added to cron...
+                   tDateAdded)) {  // ...But here, the item was
+                                   // ALREADY in cron, and is
+                                   // merely being loaded from
+                                   // disk.
+        // Thus, it would be wrong to try to create the "original
+        // record" as if it were brand
+        // new and still had the user's signature on it. (Once added to
+        // Cron, the signatures are
+        // released and the SERVER signs it from there. That's why the
+        // user's version is saved
+        // as a receipt in the first place -- so we have a record of the
+        // user's authorization.)
+        LogVerbose()()("Successfully loaded cron item and added to list. ")
+            .Flush();
+
+        return true;
+    } else {
+        LogError()()("Though loaded / verified "
+                     "successfully, "
+                     "unable to add cron item (from cron file) to cron "
+                     " list.")
+            .Flush();
+        return false;
+    }
+}
+
+auto OTCron::purge_erased() -> void
+{
+    const char* szFoldername = api_.Internal().Paths().Cron();
+
+    for (const auto lTransactionNum : erased_) {
+        const auto filename = item_filename(lTransactionNum);
+
+        if (false == OTDB::EraseValueByKey(
+                         api_,
+                         api_.DataFolder().string(),
+                         szFoldername,
+                         cron_item_folder_,
+                         filename,
+                         "")) {
+            LogError()()("Failed to erase cron item file: ")(szFoldername)(
+                '/')(cron_item_folder_)('/')(filename)(".")
+                .Flush();
+        }
+    }
+
+    erased_.clear();
+}
+
+auto OTCron::reschedule(std::int64_t lTransactionNum, const Time due) -> void
+{
+    auto it = schedule_.find(lTransactionNum);
+
+    assert_true(schedule_.end() != it);
+
+    auto& scheduled = it->second;
+    due_.erase({scheduled.due_, lTransactionNum});
+    scheduled.due_ = due;
+    due_.emplace(due, lTransactionNum);
+}
+
+auto OTCron::store_item(const OTCronItem& item) -> bool
+{
+    const auto lTransactionNum = item.GetTransactionNum();
+    auto it = schedule_.find(lTransactionNum);
+
+    if (schedule_.end() == it) {
+        LogError()()("Cron item ")(lTransactionNum)(" is not on cron.")
+            .Flush();
+        return false;
+    }
+
+    // NOTE most processed items do not change, so compare a hash of the
+    // signed item instead of copying it
+    auto& stored = it->second.stored_;
+    const auto hash = item_hash(item);
+
+    if (stored.has_value() && (hash == stored.value())) { return true; }
+
+    const auto filename = item_filename(lTransactionNum);
+    const char* szFoldername = api_.Internal().Paths().Cron();
+
+    if (false == OTDB::StorePlainString(
+                     api_,
+                     UnallocatedCString{item.RawFile()},
+                     api_.DataFolder().string(),
+                     szFoldername,
+                     cron_item_folder_,
+                     filename,
+                     "")) {
+        LogError()()("Error saving cron item file: ")(szFoldername)('/')(
+            cron_item_folder_)('/')(filename)(".")
+            .Flush();
+        return false;
+    }
+
+    stored.emplace(hash);
+    erased_.erase(lTransactionNum);
+
+    return true;
+}
+
+auto OTCron::unschedule(std::int64_t lTransactionNum) -> void
+{
+    if (auto it = schedule_.find(lTransactionNum); schedule_.end() != it) {
+        due_.erase({it->second.due_, lTransactionNum});
+        schedule_.erase(it);
+    }
+}
+
 // Loops through ALL markets, and calls pMarket->GetNym_OfferList(NYM_ID,
 // *pOfferList) for each.
 // Returns a list of all the offers that a specific Nym has on all the markets.
@@ -270,8 +468,8 @@ auto OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
 
         pMarketData->last_sale_date_ = pMarket->GetLastSaleDate();
 
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
+        const std::size_t theBidCount = pMarket->GetBidCount();
+        const std::size_t theAskCount = pMarket->GetAskCount();
 
         pMarketData->number_bids_ = std::to_string(theBidCount);
         pMarketData->number_asks_ = std::to_string(theAskCount);
@@ -357,6 +555,7 @@ auto OTCron::GetTransactionCount() const -> std::int32_t
 void OTCron::AddTransactionNumber(const std::int64_t& lTransactionNum)
 {
     list_transaction_numbers_.push_back(lTransactionNum);
+    numbers_changed_ = true;
 }
 
 // Once this starts returning 0, OTCron can no longer process trades and
@@ -368,6 +567,7 @@ auto OTCron::GetNextTransactionNumber() -> std::int64_t
     const std::int64_t lTransactionNum = list_transaction_numbers_.front();
 
     list_transaction_numbers_.pop_front();
+    numbers_changed_ = true;
 
     return lTransactionNum;
 }
@@ -424,6 +624,7 @@ auto OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
 
         auto strData = String::Factory();
 
+        // NOTE cron files written by older versions embed every item
         if (!LoadEncodedTextField(api_.Crypto(), xml, strData) ||
             !strData->Exists()) {
             LogError()()(
@@ -431,57 +632,49 @@ auto OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
                 "value.")
                 .Flush();
             return (-1);  // error condition
-        } else {
-            auto pItem{api_.Factory().Internal().Session().CronItem(strData)};
+        } else if (!load_item(strData, tDateAdded)) {
+            return (-1);
+        }
 
-            if (false == bool(pItem)) {
-                LogError()()(
-                    "Unable to create cron item from data in cron file.")
-                    .Flush();
-                return (-1);
-            }
+        nReturnVal = 1;
+    } else if (!strcmp("storedCronItem", xml->getNodeName())) {
+        const std::int64_t lTransactionNum =
+            String::StringToLong(xml->getAttributeValue("transactionNum"));
+        const auto str_date_added =
+            String::Factory(xml->getAttributeValue("dateAdded"));
+        const auto tDateAdded =
+            (!str_date_added->Exists() ? Time{}
+                                       : parseTimestamp(str_date_added->Get()));
+        const auto filename = item_filename(lTransactionNum);
+        const char* szFoldername = api_.Internal().Paths().Cron();
+        const auto strData = String::Factory(OTDB::QueryPlainString(
+            api_,
+            api_.DataFolder().string(),
+            szFoldername,
+            cron_item_folder_,
+            filename,
+            ""));
+
+        if (!strData->Exists()) {
+            LogError()()("Missing cron item file: ")(szFoldername)('/')(
+                cron_item_folder_)('/')(filename)(".")
+                .Flush();
+            return (-1);
+        } else if (!load_item(strData, tDateAdded)) {
+            return (-1);
+        }
 
-            // Why not do this here (when loading from storage), as well as when
-            // first adding the item to cron,
-            // and thus save myself the trouble of verifying the signature EVERY
-            // ITERATION of ProcessCron().
-            //
-            const std::shared_ptr<OTCronItem> item{pItem.release()};
-            if (!item->VerifySignature(*server_nym_)) {
-                LogError()()("ERROR SECURITY: Server "
-                             "signature failed to "
-                             "verify on a cron item while loading: ")(
-                    item->GetTransactionNum())(".")
-                    .Flush();
-                return (-1);
-            } else if (AddCronItem(
-                           item,
-                           false,          // bSaveReceipt=false. The receipt is
-                                           // only saved once: When item FIRST
-                                           // added to cron...
-                           tDateAdded)) {  // ...But here, the item was
-                                           // ALREADY in cron, and is
-                                           // merely being loaded from
-                                           // disk.
-                // Thus, it would be wrong to try to create the "original
-                // record" as if it were brand
-                // new and still had the user's signature on it. (Once added to
-                // Cron, the signatures are
-                // released and the SERVER signs it from there. That's why the
-                // user's version is saved
-                // as a receipt in the first place -- so we have a record of the
-                // user's authorization.)
-                LogVerbose()()(
-                    "Successfully loaded cron item and added to list. ")
-                    .Flush();
-            } else {
-                LogError()()("Though loaded / verified "
-                             "successfully, "
-                             "unable to add cron item (from cron file) to cron "
-                             " list.")
-                    .Flush();
-                return (-1);
-            }
+        if (auto it = schedule_.find(lTransactionNum); schedule_.end() != it) {
+            const auto pItem = GetItemByOfficialNum(lTransactionNum);
+
+            assert_true(false != bool(pItem));
+
+            it->second.stored_.emplace(item_hash(*pItem));
+        } else {
+            LogError()()("Cron item file ")(filename)(
+                " contains a different transaction number.")
+                .Flush();
+            return (-1);
         }
 
         nReturnVal = 1;
@@ -577,18 +770,17 @@ void OTCron::UpdateContents(const PasswordPrompt& reason)
         tag.add_tag(tagMarket);
     }
 
-    // Save the Cron Items
+    // Save the Cron Item index (the items themselves are saved in the cron
+    // items folder.)
     for (auto& it : cron_items_multi_) {
         auto pItem = it.second;
         assert_true(false != bool(pItem));
 
         const auto tDateAdded{it.first};
-        auto strItem = String::Factory(*pItem);  // Extract the cron item
-                                                 // contract into string form.
-        auto ascItem = Armored::Factory(
-            api_.Crypto(), strItem);  // Base64-encode that for storage.
 
-        TagPtr tagCronItem(new Tag("cronItem", ascItem->Get()));
+        TagPtr tagCronItem(new Tag("storedCronItem"));
+        tagCronItem->add_attribute(
+            "transactionNum", std::to_string(pItem->GetTransactionNum()));
         tagCronItem->add_attribute("dateAdded", formatTimestamp(tDateAdded));
         tag.add_tag(tagCronItem);
     }
@@ -614,6 +806,17 @@ auto OTCron::computeTimeout() -> std::chrono::milliseconds
                Clock::now() - last_executed_);
 }
 
+auto OTCron::NextDue() const -> std::optional<Time>
+{
+    if (due_.empty()) {
+
+        return std::nullopt;
+    } else {
+
+        return due_.begin()->first;
+    }
+}
+
 // Make sure to call this regularly so the CronItems get a chance to process and
 // expire.
 void OTCron::ProcessCronItems()
@@ -645,10 +848,27 @@ void OTCron::ProcessCronItems()
     }
     bool bNeedToSave = false;
 
-    // loop through the cron items and tell each one to ProcessCron().
+    // Only the items which are due get a chance to ProcessCron(). They are
+    // visited in the order they were added to cron, which is the order a pass
+    // over cron_items_multi_ would have visited them in.
+    const auto now = Clock::now();
+    auto due = UnallocatedVector<std::pair<Time, std::int64_t>>{};
+
+    for (const auto& [time, lTransactionNum] : due_) {
+        if (time > now) { break; }
+
+        const auto it = schedule_.find(lTransactionNum);
+
+        assert_true(schedule_.end() != it);
+
+        due.emplace_back(it->second.added_, lTransactionNum);
+    }
+
+    std::ranges::sort(due);
+
     // If the item returns true, that means leave it on the list. Otherwise,
     // if it returns false, that means "it's done: remove it."
-    for (auto it = cron_items_multi_.begin(); it != cron_items_multi_.end();) {
+    for (const auto& [tDateAdded, lTransactionNum] : due) {
         if (GetTransactionCount() <= nTwentyPercent) {
             LogError()()(
                 "WARNING: Cron has fewer than 20 percent of its normal "
@@ -665,27 +885,37 @@ void OTCron::ProcessCronItems()
                 .Flush();
             break;
         }
-        auto pItem = it->second;
+
+        auto it_map = FindItemOnMap(lTransactionNum);
+
+        // Processing an earlier item may have removed this one
+        if (cron_items_.end() == it_map) { continue; }
+
+        auto pItem = it_map->second;
         assert_true(false != bool(pItem));
         LogVerbose()()("Processing item number: ")(pItem->GetTransactionNum())
             .Flush();
 
         if (pItem->ProcessCron(reason)) {
-            it++;
+            reschedule(lTransactionNum, pItem->GetNextProcessDate());
+            store_item(*pItem);
+
             continue;
         }
         pItem->HookRemovalFromCron(
             api_.Wallet(), nullptr, GetNextTransactionNumber(), reason);
         LogConsole()()("Removing cron item: ")(pItem->GetTransactionNum())(".")
             .Flush();
-        it = cron_items_multi_.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        assert_true(cron_items_.end() != it_map);
+        auto it_multimap = FindItemOnMultimap(lTransactionNum);
+        assert_true(cron_items_multi_.end() != it_multimap);
+        cron_items_multi_.erase(it_multimap);
         cron_items_.erase(it_map);
+        erase_item(lTransactionNum);
+        unschedule(lTransactionNum);
 
         bNeedToSave = true;
     }
-    if (bNeedToSave) { SaveCron(); }
+    if (bNeedToSave || numbers_changed_) { SaveCron(); }
 }
 
 // OTCron IS responsible for cleaning up theItem, and takes ownership.
@@ -743,6 +973,13 @@ auto OTCron::AddCronItem(
             cron_items_multi_.upper_bound(tDateAdded),
             std::pair<Time, std::shared_ptr<OTCronItem>>(tDateAdded, theItem));
 
+        // Schedule it (an item which has never run is due immediately)
+        //
+        const auto due = theItem->GetNextProcessDate();
+        schedule_.try_emplace(
+            theItem->GetTransactionNum(), ScheduledItem{tDateAdded, due});
+        due_.emplace(due, theItem->GetTransactionNum());
+
         theItem->SetCronPointer(*this);
         theItem->setServerNym(server_nym_);
         theItem->setNotaryID(notary_id_);
@@ -794,6 +1031,9 @@ auto OTCron::AddCronItem(
             }
         }
 
+        // NOTE the new item may be due before the next scheduled cron pass
+        if (wake_) { wake_(); }
+
         return bSuccess;
     }
     // Otherwise, if it was already there, log an error.
@@ -839,6 +1079,8 @@ auto OTCron::RemoveCronItem(
 
         cron_items_.erase(it_map);             // Remove from MAP.
         cron_items_multi_.erase(it_multimap);  // Remove from MULTIMAP.
+        erase_item(lTransactionNum);
+        unschedule(lTransactionNum);
 
         // An item has been removed from Cron. SAVE.
         return SaveCron();
@@ -887,18 +1129,22 @@ auto OTCron::FindItemOnMap(std::int64_t lTransactionNum)
 auto OTCron::FindItemOnMultimap(std::int64_t lTransactionNum)
     -> multimapOfCronItems::iterator
 {
-    auto itt = cron_items_multi_.begin();
+    // Only the items which were added at the same time as this one need to be
+    // checked.
+    const auto scheduled = schedule_.find(lTransactionNum);
 
-    while (cron_items_multi_.end() != itt) {
+    if (schedule_.end() == scheduled) { return cron_items_multi_.end(); }
+
+    auto [itt, end] = cron_items_multi_.equal_range(scheduled->second.added_);
+
+    for (; end != itt; ++itt) {
         auto pItem = itt->second;
         assert_true(false != bool(pItem));
 
-        if (pItem->GetTransactionNum() == lTransactionNum) { break; }
-
-        ++itt;
+        if (pItem->GetTransactionNum() == lTransactionNum) { return itt; }
     }
 
-    return itt;
+    return cron_items_multi_.end();
 }
 
 // Look up a transaction by transaction number and see if it is in the map.
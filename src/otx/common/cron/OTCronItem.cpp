@@ -702,6 +702,15 @@ auto OTCronItem::CanRemoveItemFromCron(const otx::context::Client& context)
     // above. Only if that fails, do you need to dig deeper...
 }
 
+auto OTCronItem::GetNextProcessDate() const -> Time
+{
+    if (Time{} == last_process_date_) { return Time{}; }
+
+    // Subclasses which throttle themselves skip processing until strictly more
+    // than process_interval_ has elapsed since the last time they ran.
+    return last_process_date_ + process_interval_ + Time::duration{1};
+}
+
 // OTCron calls this regularly, which is my chance to expire, etc.
 // Child classes will override this, AND call it (to verify valid date
 // range.)
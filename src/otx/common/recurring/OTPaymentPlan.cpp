@@ -1294,7 +1294,7 @@ void OTPaymentPlan::ProcessInitialPayment(
     // if it is dirty, or instruct it to update itself if it is.  Anyway, let's
     // save Cron...
 
-    GetCron()->SaveCron();
+    GetCron()->SaveCronItem(*this);
 
     // Todo: put the actual Cron items in separate files, so I don't have to
     // update
@@ -1377,7 +1377,7 @@ void OTPaymentPlan::ProcessPaymentPlan(
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    GetCron()->SaveCron();
+    GetCron()->SaveCronItem(*this);
 }
 
 // OTCron calls this regularly, which is my chance to expire, etc.
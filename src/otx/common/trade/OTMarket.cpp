@@ -5,16 +5,20 @@
 
 #include "internal/otx/common/trade/OTMarket.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string_view>
 #include <utility>
 
 #include "internal/core/Armored.hpp"
+#include "internal/core/Factory.hpp"
 #include "internal/core/String.hpp"
 #include "internal/otx/common/Account.hpp"
 #include "internal/otx/common/Contract.hpp"
@@ -60,13 +64,23 @@ namespace opentxs
 {
 using namespace std::literals;
 
+// Changes to a market since its last snapshot are appended to a file of the
+// same name in this subfolder of the markets folder.
+static constexpr auto market_journal_folder_{"journal"};
+
 OTMarket::OTMarket(const api::Session& api, const char* szFilename)
     : Contract(api)
     , cron_(nullptr)
     , trade_list_(nullptr)
     , bids_()
     , asks_()
+    , bid_count_(0)
+    , ask_count_(0)
     , offers_()
+    , nym_offers_()
+    , journal_entries_(0)
+    , journal_sequence_(0)
+    , snapshot_required_(false)
     , notary_id_()
     , instrument_definition_id_()
     , currency_type_id_()
@@ -87,7 +101,13 @@ OTMarket::OTMarket(const api::Session& api)
     , trade_list_(nullptr)
     , bids_()
     , asks_()
+    , bid_count_(0)
+    , ask_count_(0)
     , offers_()
+    , nym_offers_()
+    , journal_entries_(0)
+    , journal_sequence_(0)
+    , snapshot_required_(false)
     , notary_id_()
     , instrument_definition_id_()
     , currency_type_id_()
@@ -109,7 +129,13 @@ OTMarket::OTMarket(
     , trade_list_(nullptr)
     , bids_()
     , asks_()
+    , bid_count_(0)
+    , ask_count_(0)
     , offers_()
+    , nym_offers_()
+    , journal_entries_(0)
+    , journal_sequence_(0)
+    , snapshot_required_(false)
     , notary_id_(NOTARY_ID)
     , instrument_definition_id_(INSTRUMENT_DEFINITION_ID)
     , currency_type_id_(CURRENCY_TYPE_ID)
@@ -142,6 +168,11 @@ auto OTMarket::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
         last_sale_price_ =
             String::StringToLong(xml->getAttributeValue("lastSalePrice"));
         last_sale_date_ = xml->getAttributeValue("lastSaleDate");
+        const auto strJournal =
+            String::Factory(xml->getAttributeValue("journalSequence"));
+        journal_sequence_ = strJournal->Exists()
+                                ? String::StringToUlong(strJournal->Get())
+                                : 0;
 
         const auto strNotaryID =
                        String::Factory(xml->getAttributeValue("notaryID")),
@@ -242,37 +273,30 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
         last_sale_price_.Serialize(writer(buf));
         return buf;
     }());
-
-    // Save the offers for sale.
-    for (auto& it : asks_) {
-        OTOffer* pOffer = it.second;
-        assert_false(nullptr == pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        auto ascOffer = Armored::Factory(
-            api_.Crypto(), strOffer);  // Base64-encode that for storage.
-
-        TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
-    }
-
-    // Save the bids.
-    for (auto& it : bids_) {
-        OTOffer* pOffer = it.second;
-        assert_false(nullptr == pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        auto ascOffer = Armored::Factory(
-            api_.Crypto(), strOffer);  // Base64-encode that for storage.
-
-        TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
+    tag.add_attribute("journalSequence", std::to_string(journal_sequence_));
+
+    // Save the offers for sale, and then the bids. Each price level is saved
+    // in the order its offers were added, which is the order they are added
+    // back in when the market is loaded.
+    for (const auto* side : {&asks_, &bids_}) {
+        for (const auto& [price, level] : *side) {
+            for (OTOffer* pOffer : level.offers_) {
+                assert_false(nullptr == pOffer);
+
+                auto strOffer = String::Factory(*pOffer);  // Extract the offer
+                                                           // contract into
+                                                           // string form.
+                auto ascOffer = Armored::Factory(
+                    api_.Crypto(), strOffer);  // Base64-encode that for
+                                               // storage.
+
+                TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
+                tagOffer->add_attribute(
+                    "dateAdded",
+                    formatTimestamp(pOffer->GetDateAddedToMarket()));
+                tag.add_tag(tagOffer);
+            }
+        }
     }
 
     UnallocatedCString str_result;
@@ -285,12 +309,7 @@ auto OTMarket::GetTotalAvailableAssets() -> Amount
 {
     Amount lTotal = 0;
 
-    for (auto& it : asks_) {
-        OTOffer* pOffer = it.second;
-        assert_false(nullptr == pOffer);
-
-        lTotal += pOffer->GetAmountAvailable();
-    }
+    for (const auto& [price, level] : asks_) { lTotal += level.depth_; }
 
     return lTotal;
 }
@@ -305,11 +324,15 @@ auto OTMarket::GetNym_OfferList(
     nNymOfferCount =
         0;  // Outputs the count of offers for NYM_ID (on this market.)
 
-    // Loop through the offers, up to some maximum depth, and then add each
+    const auto nym = nym_offers_.find(NYM_ID);
+
+    if (nym_offers_.end() == nym) { return true; }
+
+    // Loop through the offers belonging to this Nym, and then add each
     // as a data member to an offer list, then pack it into ascOutput.
     //
-    for (auto& it : offers_) {
-        OTOffer* pOffer = it.second;
+    for (const auto& lNymTransactionNum : nym->second) {
+        OTOffer* pOffer = GetOffer(lNymTransactionNum);
         assert_false(nullptr == pOffer);
 
         OTTrade* pTrade = pOffer->GetTrade();
@@ -517,25 +540,32 @@ auto OTMarket::GetOfferList(
         dynamic_cast<OTDB::OfferListMarket*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
 
-    //    mapOfOffers            bids_;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            asks_;        // The sellers, ordered by
-    // price limit
-
     std::int32_t nTempDepth = 0;
+    const auto bids = [&] {
+        auto out = UnallocatedVector<OTOffer*>{};
+
+        for (const auto& [price, level] : bids_) {
+            // Within each price level the most recent bid is listed first.
+            for (auto i = level.offers_.rbegin(); i != level.offers_.rend();
+                 ++i) {
+                if (nTempDepth++ > lDepth) { return out; }
 
-    for (auto& it : bids_) {
-        if (nTempDepth++ > lDepth) { break; }
+                if (0 == price) {  // Skipping any market orders.
+                    continue;
+                }
+
+                out.emplace_back(*i);
+            }
+        }
+
+        return out;
+    }();
 
-        OTOffer* pOffer = it.second;
+    for (OTOffer* pOffer : bids) {
         assert_false(nullptr == pOffer);
 
         const Amount& lPriceLimit = pOffer->GetPriceLimit();
 
-        if (0 == lPriceLimit) {  // Skipping any market orders.
-            continue;
-        }
-
         // OfferDataMarket
         std::unique_ptr<OTDB::BidData> pOfferData(dynamic_cast<OTDB::BidData*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
@@ -573,11 +603,21 @@ auto OTMarket::GetOfferList(
     }
 
     nTempDepth = 0;
+    const auto asks = [&] {
+        auto out = UnallocatedVector<OTOffer*>{};
+
+        for (const auto& [price, level] : asks_) {
+            for (OTOffer* pOffer : level.offers_) {
+                if (nTempDepth++ > lDepth) { return out; }
 
-    for (auto& it : asks_) {
-        if (nTempDepth++ > lDepth) { break; }
+                out.emplace_back(pOffer);
+            }
+        }
+
+        return out;
+    }();
 
-        OTOffer* pOffer = it.second;
+    for (OTOffer* pOffer : asks) {
         assert_false(nullptr == pOffer);
 
         // OfferDataMarket"
@@ -662,17 +702,11 @@ auto OTMarket::GetOfferList(
     return false;
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
-//
-// typedef UnallocatedMultimap<std::int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    bids_; // The buyers, ordered
-// mapOfOffers    asks_; // The sellers, ordered
+// Offers at each price limit are kept in the order they were received, so
+// reading a price level from the front always gets them in the order they
+// were received for that price. The price levels themselves are ordered by
+// price, so the best bid is the last bid level and the best ask is the first
+// ask level (after any market orders, which have a 0 price.)
 
 auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
 {
@@ -685,7 +719,7 @@ auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
     }
     // Found it!
     else {
-        OTOffer* pOffer = it->second;
+        OTOffer* pOffer = *(it->second.offer_);
 
         assert_true((nullptr != pOffer));
 
@@ -702,90 +736,130 @@ auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
     return nullptr;
 }
 
+auto OTMarket::GetBidDepth(const Amount& lPrice) const -> Amount
+{
+    const auto it = bids_.find(lPrice);
+
+    return (bids_.end() == it) ? Amount{0} : it->second.depth_;
+}
+
+auto OTMarket::GetAskDepth(const Amount& lPrice) const -> Amount
+{
+    const auto it = asks_.find(lPrice);
+
+    return (asks_.end() == it) ? Amount{0} : it->second.depth_;
+}
+
 // if false, offer wasn't found.
 auto OTMarket::RemoveOffer(
     const std::int64_t& lTransactionNum,
     const PasswordPrompt& reason) -> bool
 {
-    bool bReturnValue = false;
-
-    // See if there's something there with that transaction number.
-    auto it = offers_.find(lTransactionNum);
+    OTOffer* pOffer = remove_offer(lTransactionNum);
 
     // If it's not already on the list, then there's nothing to remove.
-    if (it == offers_.end()) {
+    if (nullptr == pOffer) {
         LogError()()("Attempt to remove non-existent Offer from Market. "
                      "Transaction #: ")(lTransactionNum)(".")
             .Flush();
         return false;
     }
-    // Otherwise, if it WAS already there, remove it properly.
-    else {
-        OTOffer* pOffer = it->second;
 
-        assert_false(nullptr == pOffer);
+    delete pOffer;
+    pOffer = nullptr;
 
-        // This removes it from one list (the one indexed by transaction
-        // number.)
-        // But it's still on one of the other lists...
-        offers_.erase(it);
+    // <====== SAVE since an offer was removed.
+    return append_journal(
+        "remove "s + std::to_string(lTransactionNum) + '\n', reason);
+}
 
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &bids_ : &asks_);
+// Takes an offer out of the book, and returns it. (The caller is responsible
+// to delete it.) Returns nullptr if no offer has that transaction number.
+auto OTMarket::remove_offer(const std::int64_t lTransactionNum) -> OTOffer*
+{
+    auto it = offers_.find(lTransactionNum);
 
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
+    if (it == offers_.end()) { return nullptr; }
 
-        for (auto iii = pMap->begin(); iii != pMap->end(); ++iii) {
-            pSameOffer = iii->second;
+    const auto& [level, offer, available, nym] = it->second;
+    OTOffer* pOffer = *offer;
 
-            assert_false(nullptr == pSameOffer, "nullptr offer pointer");
+    assert_false(nullptr == pOffer);
 
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
+    const bool bBid = pOffer->IsBid();
+    auto& side = bBid ? bids_ : asks_;
+    auto& count = bBid ? bid_count_ : ask_count_;
+    level->second.depth_ -= available;
+    level->second.offers_.erase(offer);
 
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
+    if (level->second.offers_.empty()) { side.erase(level); }
 
-        if (nullptr == pSameOffer) {
-            LogError()()(
-                "Removed offer from offers list, but not found on bid/ask list")
-                .Flush();
-        } else  // This means it was found and removed from the second list as
-                // well.
-        {
-            bReturnValue = true;  // Success.
-        }
+    --count;
 
-        // pOffer was found on the Offers list.
-        // pSameOffer was found on the Bid or Ask list, with the same
-        // transaction ID.
-        // They SHOULD be pointers to the SAME object.
-        // Therefore I CANNOT delete them both.
-        //
-        assert_true(pOffer == pSameOffer);
+    if (auto i = nym_offers_.find(nym); nym_offers_.end() != i) {
+        i->second.erase(lTransactionNum);
 
-        delete pOffer;
-        pOffer = nullptr;
-        pSameOffer = nullptr;
+        if (i->second.empty()) { nym_offers_.erase(i); }
     }
 
-    if (bReturnValue) {
-        return SaveMarket(reason);  // <====== SAVE since an offer was removed.
-    } else {
-        return false;
-    }
+    offers_.erase(it);
+
+    return pOffer;
+}
+
+// Puts an offer at the back of the line for its price level. Returns false if
+// an offer with the same transaction number is already on the market.
+auto OTMarket::insert_offer(OTOffer& theOffer) -> bool
+{
+    const std::int64_t lTransactionNum = theOffer.GetTransactionNum();
+
+    if (offers_.contains(lTransactionNum)) { return false; }
+
+    const bool bBid = theOffer.IsBid();
+    auto& side = bBid ? bids_ : asks_;
+    auto& count = bBid ? bid_count_ : ask_count_;
+    auto level = side.try_emplace(theOffer.GetPriceLimit()).first;
+    auto& [offers, depth] = level->second;
+    const Amount available = theOffer.GetAmountAvailable();
+    auto offer = offers.insert(offers.end(), &theOffer);
+    depth += available;
+    ++count;
+    offers_.try_emplace(lTransactionNum, Position{level, offer, available, {}});
+
+    return true;
+}
+
+void OTMarket::LinkTrade(OTOffer& theOffer, OTTrade& theTrade)
+{
+    theOffer.SetTrade(theTrade);
+    add_to_nym(theOffer.GetTransactionNum(), theTrade.GetSenderNymID());
+}
+
+void OTMarket::add_to_nym(
+    const std::int64_t lTransactionNum,
+    const identifier::Nym& nym)
+{
+    auto it = offers_.find(lTransactionNum);
+
+    if ((offers_.end() == it) || (it->second.nym_ == nym)) { return; }
+
+    it->second.nym_ = nym;
+    nym_offers_[nym].emplace(lTransactionNum);
+}
+
+// Trades change the amount an offer has available, so its price level needs
+// to be updated to match.
+void OTMarket::update_depth(OTOffer& theOffer)
+{
+    auto it = offers_.find(theOffer.GetTransactionNum());
+
+    if (offers_.end() == it) { return; }
+
+    auto& [level, offer, available, nym] = it->second;
+    const Amount current = theOffer.GetAmountAvailable();
+    level->second.depth_ += current;
+    level->second.depth_ -= available;
+    available = current;
 }
 
 // This method demands an Offer reference in order to verify that it really
@@ -803,7 +877,6 @@ auto OTMarket::AddOffer(
     const Time tDateAddedToMarket) -> bool
 {
     const std::int64_t lTransactionNum = theOffer.GetTransactionNum();
-    const Amount& lPriceLimit = theOffer.GetPriceLimit();
 
     // Make sure the offer is even appropriate for this market...
     if (!ValidateOfferForMarket(theOffer)) {
@@ -811,53 +884,23 @@ auto OTMarket::AddOffer(
 
         if (nullptr != pTrade) { pTrade->FlagForRemoval(); }
     } else {
-        // I store duplicate lists of offer pointers. Two multimaps ordered by
-        // price,
-        // (for buyers and sellers) and one map ordered by transaction number.
-
-        // See if there's something else already there with the same transaction
-        // number.
-        //
-        auto it = offers_.find(lTransactionNum);
-
-        // If it's not already on the list, then add it...
-        if (it == offers_.end()) {
-            offers_[lTransactionNum] = &theOffer;
-            LogTrace()()("Offer added as an offer to the market.").Flush();
-        }
-        // Otherwise, if it was already there, log an error.
-        else {
+        // The offer is indexed by transaction number, and placed at the back
+        // of the line for its price level on the bid or ask side of the book.
+        // If something else is already there with the same transaction
+        // number, log an error.
+        if (!insert_offer(theOffer)) {
             LogError()()("Attempt to add Offer to Market with pre-existing "
                          "transaction number: ")(lTransactionNum)(".")
                 .Flush();
             return false;
         }
 
-        // Okay so we successfully added it to one list (indexed by Transaction
-        // Num) and we
-        // know it validated as an offer, AND we know it wasn't already on the
-        // market.
-        //
-        // So next, let's add it to the lists that are indexed by price:
-
-        // Determine if it's a buy or sell, and add it to the right list.
-        if (theOffer.IsBid()) {
-            // No bother checking if the offer is already on this list,
-            // since the code above basically already verifies that for us.
-
-            bids_.insert(
-                bids_.lower_bound(lPriceLimit),  // highest bidders go
-                                                 // first, so I am last in
-                                                 // line at lower bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
-            LogTrace()()("Offer added as a bid to the market.").Flush();
-        } else {
-            asks_.insert(
-                asks_.upper_bound(lPriceLimit),  // lowest price sells
-                                                 // first, so I am last in
-                                                 // line at upper bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
-            LogTrace()()("Offer added as an ask to the market.").Flush();
+        LogTrace()()("Offer added as ")(theOffer.IsBid() ? "a bid" : "an ask")(
+            " to the market.")
+            .Flush();
+
+        if (nullptr != pTrade) {
+            add_to_nym(lTransactionNum, pTrade->GetSenderNymID());
         }
 
         if (bSaveFile) {
@@ -866,8 +909,11 @@ auto OTMarket::AddOffer(
             //
             theOffer.SetDateAddedToMarket(Clock::now());
 
-            return SaveMarket(reason);  // <====== SAVE since an offer
-                                        // was added to the Market.
+            // NOTE the offer still carries the user's signature. The caller
+            // signs it with the server nym and then records it with
+            // SaveOffer(), since only server signed offers are accepted from
+            // the journal.
+            return true;
         } else {
             // Set this to the date passed in, since this offer was
             // added to the market in the past, and we are preserving that date.
@@ -920,6 +966,10 @@ auto OTMarket::LoadMarket() -> bool
             ""));  // markets/recent/<market_ID>.bin
     }
 
+    // Apply everything which has happened on the market since the snapshot
+    // was saved.
+    if (bSuccess) { bSuccess = replay_journal(); }
+
     return bSuccess;
 }
 
@@ -941,15 +991,26 @@ auto OTMarket::SaveMarket(const PasswordPrompt& reason) -> bool
     // the old version of the market from before the most recent changes.
     ReleaseSignatures();
 
+    // Everything in the current journal is part of the snapshot, so later
+    // changes go to the next one.
+    const auto previous = journal_sequence_;
+    ++journal_sequence_;
+
     // Sign it, save it internally to string, and then save that out to the
     // file.
     if (!SignContract(*(GetCron()->GetServerNym()), reason) ||
         !SaveContract() || !SaveContract(szFoldername, szFilename)) {
         LogError()()("Error saving Market: ")(szFoldername)('/')(szFilename)
             .Flush();
+        journal_sequence_ = previous;
+        snapshot_required_ = true;
+
         return false;
     }
 
+    snapshot_required_ = false;
+    erase_journal(previous);
+
     // Save a copy of recent trades.
 
     if (nullptr != trade_list_) {
@@ -977,6 +1038,292 @@ auto OTMarket::SaveMarket(const PasswordPrompt& reason) -> bool
     return true;
 }
 
+auto OTMarket::SaveOffer(OTOffer& theOffer, const PasswordPrompt& reason)
+    -> bool
+{
+    if (false == offers_.contains(theOffer.GetTransactionNum())) {
+        LogError()()("Offer ")(theOffer.GetTransactionNum())(
+            " is not on this market.")
+            .Flush();
+        return false;
+    }
+
+    update_depth(theOffer);
+
+    return append_journal(offer_entry(theOffer), reason);
+}
+
+// Appends a change to the market journal, unless enough changes have been
+// appended since the last snapshot that it's time for a new one.
+auto OTMarket::append_journal(
+    const UnallocatedCString& entry,
+    const PasswordPrompt& reason) -> bool
+{
+    if ((false == snapshot_required_) &&
+        (journal_entries_ < snapshot_interval_) &&
+        OTDB::AppendPlainString(
+            api_,
+            entry,
+            api_.DataFolder().string(),
+            api_.Internal().Paths().Market(),  // markets
+            market_journal_folder_,            // markets/journal
+            journal_name(journal_sequence_),
+            "")) {  // markets/journal/<Market_ID>.<sequence>
+        journal_entries_ +=
+            static_cast<std::size_t>(std::ranges::count(entry, '\n'));
+
+        return true;
+    }
+
+    // If the journal couldn't be written then the snapshot has to be.
+    return SaveMarket(reason);
+}
+
+void OTMarket::erase_journal(const std::uint64_t sequence)
+{
+    const auto filename = journal_name(sequence);
+    const char* szFoldername = api_.Internal().Paths().Market();
+    journal_entries_ = 0;
+
+    if (!OTDB::Exists(
+            api_,
+            api_.DataFolder().string(),
+            szFoldername,
+            market_journal_folder_,
+            filename,
+            "")) {
+        return;
+    }
+
+    if (!OTDB::EraseValueByKey(
+            api_,
+            api_.DataFolder().string(),
+            szFoldername,
+            market_journal_folder_,
+            filename,
+            "")) {
+        LogError()()("Error erasing journal for Market: ")(szFoldername)('/')(
+            market_journal_folder_)('/')(filename)
+            .Flush();
+    }
+}
+
+auto OTMarket::journal_name(const std::uint64_t sequence) const
+    -> UnallocatedCString
+{
+    auto MARKET_ID = identifier::Generic{};
+    GetIdentifier(MARKET_ID);
+    auto out =
+        UnallocatedCString{String::Factory(MARKET_ID, api_.Crypto())->Get()};
+
+    // NOTE markets saved before journals were numbered use the bare market ID
+    if (0 < sequence) { out += '.' + std::to_string(sequence); }
+
+    return out;
+}
+
+// offer <date added to market> <armored offer>
+auto OTMarket::offer_entry(OTOffer& theOffer) const -> UnallocatedCString
+{
+    const auto strOffer = String::Factory(theOffer);
+    const auto ascOffer = Armored::Factory(api_.Crypto(), strOffer);
+
+    return "offer "s + formatTimestamp(theOffer.GetDateAddedToMarket()) + ' ' +
+           ascOffer->Get() + '\n';
+}
+
+// The journal holds one change per line:
+//
+// offer <date added to market> <armored offer>
+//     An offer was added to the market, or its state changed.
+// remove <transaction number>
+//     An offer was removed from the market.
+// sale <transaction number> <date> <price> <amount sold>
+//     A trade was processed.
+auto OTMarket::replay_journal() -> bool
+{
+    const auto filename = journal_name(journal_sequence_);
+    const char* szFoldername = api_.Internal().Paths().Market();
+    journal_entries_ = 0;
+
+    // A crash after the snapshot was saved may have left behind the journal it
+    // replaced.
+    if (0 < journal_sequence_) { erase_journal(journal_sequence_ - 1); }
+
+    if (!OTDB::Exists(
+            api_,
+            api_.DataFolder().string(),
+            szFoldername,
+            market_journal_folder_,
+            filename,
+            "")) {
+        return true;
+    }
+
+    auto journal = OTDB::QueryPlainString(
+        api_,
+        api_.DataFolder().string(),
+        szFoldername,
+        market_journal_folder_,
+        filename,
+        "");
+
+    // Every entry ends with a newline, so anything after the last one was
+    // left by a crash during an append. It is discarded, and the journal is
+    // truncated so that later entries are not appended to it.
+    if (const auto end = journal.rfind('\n') + 1; end < journal.size()) {
+        LogError()()("Discarding incomplete entry at the end of journal for "
+                     "Market: ")(filename)(".")
+            .Flush();
+        journal.resize(end);
+
+        if (!OTDB::StorePlainString(
+                api_,
+                journal,
+                api_.DataFolder().string(),
+                szFoldername,
+                market_journal_folder_,
+                filename,
+                "")) {
+            LogError()()("Error truncating journal for Market: ")(filename)(
+                ".")
+                .Flush();
+            return false;
+        }
+    }
+
+    auto stream = std::istringstream{journal};
+    auto line = UnallocatedCString{};
+
+    while (std::getline(stream, line)) {
+        auto fields = std::istringstream{line};
+        auto type = UnallocatedCString{};
+        fields >> type;
+
+        if ("offer"sv == type) {
+            auto date = UnallocatedCString{};
+            auto armored = UnallocatedCString{};
+            fields >> date >> armored;
+            const auto ascOffer =
+                Armored::Factory(api_.Crypto(), String::Factory(armored));
+            auto strOffer = String::Factory();
+
+            if (!ascOffer->GetString(strOffer) ||
+                !replay_offer(parseTimestamp(date), strOffer)) {
+                LogError()()("Invalid offer in journal for Market: ")(
+                    filename)(".")
+                    .Flush();
+                return false;
+            }
+        } else if ("remove"sv == type) {
+            auto lTransactionNum = std::int64_t{0};
+            fields >> lTransactionNum;
+            delete remove_offer(lTransactionNum);
+        } else if ("sale"sv == type) {
+            if (nullptr == trade_list_) {
+                trade_list_ = dynamic_cast<OTDB::TradeListMarket*>(
+                    OTDB::CreateObject(OTDB::STORED_OBJ_TRADE_LIST_MARKET));
+            }
+
+            std::unique_ptr<OTDB::TradeDataMarket> pTradeData(
+                dynamic_cast<OTDB::TradeDataMarket*>(OTDB::CreateObject(
+                    OTDB::STORED_OBJ_TRADE_DATA_MARKET)));
+            fields >> pTradeData->transaction_id_ >> pTradeData->date_ >>
+                pTradeData->price_ >> pTradeData->amount_sold_;
+
+            try {
+                last_sale_price_ = factory::Amount(pTradeData->price_);
+            } catch (...) {
+                LogError()()("Invalid sale in journal for Market: ")(
+                    filename)(".")
+                    .Flush();
+                return false;
+            }
+
+            last_sale_date_ = pTradeData->date_;
+            trade_list_->AddTradeDataMarket(*pTradeData);
+
+            while (trade_list_->GetTradeDataMarketCount() >
+                   MAX_MARKET_QUERY_DEPTH) {
+                trade_list_->RemoveTradeDataMarket(0);
+            }
+        } else if (!type.empty()) {
+            LogError()()("Unknown entry in journal for Market: ")(filename)(
+                ".")
+                .Flush();
+            return false;
+        }
+
+        ++journal_entries_;
+    }
+
+    LogDetail()()("Replayed ")(journal_entries_)(
+        " journal entries for Market: ")(filename)(".")
+        .Flush();
+
+    return true;
+}
+
+auto OTMarket::replay_offer(const Time tDateAdded, const String& strOffer)
+    -> bool
+{
+    auto pOffer{api_.Factory().Internal().Session().Offer(
+        notary_id_, instrument_definition_id_, currency_type_id_, scale_)};
+
+    assert_true(false != bool(pOffer));
+
+    if (!pOffer->LoadContractFromString(strOffer)) { return false; }
+
+    // The journal is not covered by the signature on the snapshot, so each
+    // offer in it must carry its own.
+    if (!pOffer->VerifySignature(*(GetCron()->GetServerNym()))) {
+        LogError()()("ERROR SECURITY: Server signature failed to verify on "
+                     "offer ")(pOffer->GetTransactionNum())(" in journal.")
+            .Flush();
+        return false;
+    }
+
+    OTOffer* pExisting = GetOffer(pOffer->GetTransactionNum());
+
+    if (nullptr == pExisting) {
+        OTOffer* offer = pOffer.release();
+        // TODO this isn't actually used, since the offer is not saved
+        auto reason = api_.Factory().PasswordPrompt(__func__);
+
+        if (!AddOffer(nullptr, *offer, reason, false, tDateAdded)) {
+            delete offer;
+            offer = nullptr;
+
+            return false;
+        }
+
+        return true;
+    }
+
+    // The offer keeps its place in line, so the existing instance is updated
+    // rather than replaced.
+    if ((pExisting->IsBid() != pOffer->IsBid()) ||
+        (pExisting->GetPriceLimit() != pOffer->GetPriceLimit())) {
+        LogError()()("Offer ")(pOffer->GetTransactionNum())(
+            " changed price or side.")
+            .Flush();
+        return false;
+    }
+
+    OTTrade* pTrade = pExisting->GetTrade();
+    const auto tExistingDateAdded = pExisting->GetDateAddedToMarket();
+
+    if (!pExisting->LoadContractFromString(strOffer)) { return false; }
+
+    pExisting->SetDateAddedToMarket(tExistingDateAdded);
+
+    if (nullptr != pTrade) { pExisting->SetTrade(*pTrade); }
+
+    update_depth(*pExisting);
+
+    return true;
+}
+
 // A Market's ID is based on the instrument definition, the currency type, and
 // the scale.
 //
@@ -1007,9 +1354,7 @@ auto OTMarket::GetHighestBidPrice() -> Amount
 {
     Amount lPrice = 0;
 
-    auto rr = bids_.rbegin();
-
-    if (rr != bids_.rend()) { lPrice = rr->first; }
+    if (auto rr = bids_.rbegin(); rr != bids_.rend()) { lPrice = rr->first; }
 
     return lPrice;
 }
@@ -1022,25 +1367,14 @@ auto OTMarket::GetLowestAskPrice() -> Amount
 
     auto it = asks_.begin();
 
-    if (it != asks_.end()) {
-        lPrice = it->first;
-
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
-
-            if (it == asks_.end()) { break; }
+    // Market orders have a 0 price, so we need to skip them if they are here.
+    //
+    // Note that we don't have to do this with the highest bid price (above
+    // function) but in the case of asks, a "0 price" will undercut the other
+    // actual prices, so we need to skip the price level that has a 0 price.
+    if ((it != asks_.end()) && (0 == it->first)) { ++it; }
 
-            lPrice = it->first;
-        }
-    }
+    if (it != asks_.end()) { lPrice = it->first; }
 
     return lPrice;
 }
@@ -1949,6 +2283,8 @@ void OTMarket::ProcessTrade(
                 last_sale_price_ =
                     theOtherOffer.GetPriceLimit();  // Priced per scale.
 
+                auto sale = UnallocatedCString{};
+
                 // Here we save this trade in a list of the most recent
                 // 50 trades.
                 {
@@ -1982,6 +2318,9 @@ void OTMarket::ProcessTrade(
                     }();
 
                     last_sale_date_ = pTradeData->date_;
+                    sale = "sale "s + pTradeData->transaction_id_ + ' ' +
+                           pTradeData->date_ + ' ' + pTradeData->price_ +
+                           ' ' + pTradeData->amount_sold_ + '\n';
 
                     // *pTradeData is CLONED at this time (I'm still
                     // responsible to delete.) That's also why I add it
@@ -2000,15 +2339,28 @@ void OTMarket::ProcessTrade(
                 }
 
                 // Account balances have changed based on these trades
-                // that we just processed. Make sure to save the Market
-                // since it contains those offers that have just
-                // updated.
-                SaveMarket(reason);
-
-                // The Trade has changed, and it is stored as a
-                // CronItem. So I save Cron as well, for the same reason
-                // I saved the Market.
-                pCron->SaveCron();
+                // that we just processed. Make sure to record the offers
+                // that have just updated, and the sale, in the Market
+                // journal.
+                update_depth(theOffer);
+                update_depth(theOtherOffer);
+                if (false == append_journal(
+                                 offer_entry(theOffer) +
+                                     offer_entry(theOtherOffer) + sale,
+                                 reason)) {
+                    // NOTE the next change to this market will retry the
+                    // snapshot, since the journal can't be trusted until then
+                    LogError()()("Failed to record trade ")(
+                        theTrade.GetTransactionNum())(" in Market ")(
+                        journal_name(journal_sequence_))(".")
+                        .Flush();
+                }
+
+                // Both Trades have changed, and they are stored as
+                // CronItems. So I save them as well, for the same reason
+                // I recorded the offers.
+                pCron->SaveCronItem(theTrade);
+                pCron->SaveCronItem(*pOtherTrade);
             }
 
             //
@@ -2486,104 +2838,108 @@ auto OTMarket::ProcessTrade(
         // other hand, is first in line.  So we start there, and loop
         // backwards until there are no other bids within my price
         // range.
+        // NOTE: Market orders have a 0 price, so they are all in the last
+        // price level visited here.
         // NOLINTBEGIN(modernize-loop-convert)
         for (auto rr = bids_.rbegin(); rr != bids_.rend(); ++rr) {
-            // then I want to start at the highest bidder and loop DOWN
-            // until hitting my price limit.
-            OTOffer* pBid = rr->second;
-            assert_false(nullptr == pBid);
+            for (OTOffer* pBid : rr->second.offers_) {
+                // then I want to start at the highest bidder and loop DOWN
+                // until hitting my price limit.
+                assert_false(nullptr == pBid);
 
-            // NOTE: Market orders only process once, and they are
-            // processed in the order they were added to the market.
-            //
-            // If BOTH offers are market orders, we just skip this bid.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pBid! Imagine if pBid is a market order
-            // and theOffer isn't -- that would mean pBid hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pBid->IsMarketOrder()) {
-                //          if (theOffer.IsMarketOrder() &&
-                // pBid->IsMarketOrder())
-                //              continue;
-                break;
-            }
-            // NOTE: Why break, instead of continue? Because since we
-            // are looping through the bids, from the HIGHEST down to
-            // the LOWEST, and since market orders have a ZERO price, we
-            // know for a fact that there are not any other non-zero
-            // bids. (So we might as well break.)
+                // NOTE: Market orders only process once, and they are
+                // processed in the order they were added to the market.
+                //
+                // If BOTH offers are market orders, we just skip this bid.
+                //
+                // But FURTHERMORE: We ONLY process a market order as
+                // theOffer, not as pBid! Imagine if pBid is a market order
+                // and theOffer isn't -- that would mean pBid hasn't been
+                // processed yet (since it will only process once.) So it
+                // needs to wait its turn! It will get its one shot WHEN ITS
+                // TURN comes.
+                //
+                if (pBid->IsMarketOrder()) {
+                    //          if (theOffer.IsMarketOrder() &&
+                    // pBid->IsMarketOrder())
+                    //              continue;
+                    break;
+                }
+                // NOTE: Why break, instead of continue? Because since we
+                // are looping through the bids, from the HIGHEST down to
+                // the LOWEST, and since market orders have a ZERO price, we
+                // know for a fact that there are not any other non-zero
+                // bids. (So we might as well break.)
 
-            // I'm selling.
-            //
-            // If the bid is larger than, or equal to, my
-            // low-side-limit, and the amount available is at least my
-            // minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pBid->GetPriceLimit() >=
-                 theOffer.GetPriceLimit()))  // Or if this bid is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.)
+                // I'm selling.
                 //
-                // ...So all the other "if"s have to go INSIDE the block
-                // here:
+                // If the bid is larger than, or equal to, my
+                // low-side-limit, and the amount available is at least my
+                // minimum increment, (and vice versa),
+                // ...then let's trade!
                 //
-                if ((pBid->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pBid->GetMinimumIncrement()) &&
-                    (nullptr != pBid->GetTrade()) &&
-                    !pBid->GetTrade()->IsFlaggedForRemoval()) {
-
-                    ProcessTrade(
-                        wallet,
-                        theTrade,
-                        theOffer,
-                        *pBid,
-                        reason);  // <========
+                if (theOffer.IsMarketOrder() ||  // If I don't care about
+                                                 // price...
+                    (pBid->GetPriceLimit() >=
+                     theOffer.GetPriceLimit()))  // Or if this bid is within
+                                                 // my price range...
+                {
+                    // Notice the above "if" is ONLY based on price...
+                    // because the "else" returns! (Once I am out of my
+                    // price range, no point to continue looping.)
+                    //
+                    // ...So all the other "if"s have to go INSIDE the block
+                    // here:
+                    //
+                    if ((pBid->GetAmountAvailable() >=
+                         theOffer.GetMinimumIncrement()) &&
+                        (theOffer.GetAmountAvailable() >=
+                         pBid->GetMinimumIncrement()) &&
+                        (nullptr != pBid->GetTrade()) &&
+                        !pBid->GetTrade()->IsFlaggedForRemoval()) {
+
+                        ProcessTrade(
+                            wallet,
+                            theTrade,
+                            theOffer,
+                            *pBid,
+                            reason);  // <========
+                    }
                 }
-            }
 
-            // Else, the bid is lower than I am willing to sell. (And
-            // all the remaining bids are even lower.)
-            //
-            else if (theOffer.IsLimitOrder()) {
-                pBid = nullptr;
-                return true;  // stay on cron for more processing (for
-                              // now.)
-            }
+                // Else, the bid is lower than I am willing to sell. (And
+                // all the remaining bids are even lower.)
+                //
+                else if (theOffer.IsLimitOrder()) {
+                    pBid = nullptr;
+                    return true;  // stay on cron for more processing (for
+                                  // now.)
+                }
 
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                const auto unittype =
-                    wallet.Internal().CurrencyTypeBasedOnUnitType(
-                        GetInstrumentDefinitionID());
-                LogVerbose()()("Removing market order: ")(
-                    theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
-                    theTrade.IsFlaggedForRemoval())(". Minimum increment: ")(
-                    theOffer.GetMinimumIncrement(),
-                    unittype)(" is larger than Amount available: ")(
-                    theOffer.GetAmountAvailable(), unittype)
-                    .Flush();
+                // The offer has no more trading to do--it's done.
+                if (theTrade.IsFlaggedForRemoval() ||  // during processing,
+                                                       // the trade may have
+                                                       // gotten flagged.
+                    (theOffer.GetMinimumIncrement() >
+                     theOffer.GetAmountAvailable())) {
+
+                    const auto unittype =
+                        wallet.Internal().CurrencyTypeBasedOnUnitType(
+                            GetInstrumentDefinitionID());
+                    LogVerbose()()("Removing market order: ")(
+                        theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
+                        theTrade.IsFlaggedForRemoval())(
+                        ". Minimum increment: ")(
+                        theOffer.GetMinimumIncrement(),
+                        unittype)(" is larger than Amount available: ")(
+                        theOffer.GetAmountAvailable(), unittype)
+                        .Flush();
 
-                return false;  // remove this trade from cron
-            }
+                    return false;  // remove this trade from cron
+                }
 
-            pBid = nullptr;
+                pBid = nullptr;
+            }
         }
         // NOLINTEND(modernize-loop-convert)
     }
@@ -2596,87 +2952,93 @@ auto OTMarket::ProcessTrade(
         // there, and loop forwards until there are no other asks within
         // my price range.
         //
-        for (auto& it : asks_) {
-            // then I want to start at the lowest seller and loop UP
-            // until hitting my price limit.
-            OTOffer* pAsk = it.second;
-            assert_false(nullptr == pAsk);
-
-            // NOTE: Market orders only process once, and they are
-            // processed in the order they were added to the market.
-            //
-            // If BOTH offers are market orders, we just skip this ask.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pAsk! Imagine if pAsk is a market order
-            // and theOffer isn't -- that would mean pAsk hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pAsk->IsMarketOrder()) {
-                //          if (theOffer.IsMarketOrder() &&
-                // pAsk->IsMarketOrder())
-                continue;
-            }
+        for (auto& [price, level] : asks_) {
+            for (OTOffer* pAsk : level.offers_) {
+                // then I want to start at the lowest seller and loop UP
+                // until hitting my price limit.
+                assert_false(nullptr == pAsk);
+
+                // NOTE: Market orders only process once, and they are
+                // processed in the order they were added to the market.
+                //
+                // If BOTH offers are market orders, we just skip this ask.
+                //
+                // But FURTHERMORE: We ONLY process a market order as
+                // theOffer, not as pAsk! Imagine if pAsk is a market order
+                // and theOffer isn't -- that would mean pAsk hasn't been
+                // processed yet (since it will only process once.) So it
+                // needs to wait its turn! It will get its one shot WHEN ITS
+                // TURN comes.
+                //
+                if (pAsk->IsMarketOrder()) {
+                    //          if (theOffer.IsMarketOrder() &&
+                    // pAsk->IsMarketOrder())
+                    continue;
+                }
 
-            // I'm buying.
-            // If the ask price is less than, or equal to, my price
-            // limit, and the amount available for purchase is at least
-            // my minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pAsk->GetPriceLimit() <=
-                 theOffer.GetPriceLimit()))  // Or if this ask is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.) So all
-                // the other "if"s have to go INSIDE the block here:
+                // I'm buying.
+                // If the ask price is less than, or equal to, my price
+                // limit, and the amount available for purchase is at least
+                // my minimum increment, (and vice versa),
+                // ...then let's trade!
                 //
-                if ((pAsk->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pAsk->GetMinimumIncrement()) &&
-                    (nullptr != pAsk->GetTrade()) &&
-                    !pAsk->GetTrade()->IsFlaggedForRemoval()) {
-
-                    ProcessTrade(
-                        wallet, theTrade, theOffer, *pAsk, reason);  // <======
+                if (theOffer.IsMarketOrder() ||  // If I don't care about
+                                                 // price...
+                    (pAsk->GetPriceLimit() <=
+                     theOffer.GetPriceLimit()))  // Or if this ask is within
+                                                 // my price range...
+                {
+                    // Notice the above "if" is ONLY based on price...
+                    // because the "else" returns! (Once I am out of my
+                    // price range, no point to continue looping.) So all
+                    // the other "if"s have to go INSIDE the block here:
+                    //
+                    if ((pAsk->GetAmountAvailable() >=
+                         theOffer.GetMinimumIncrement()) &&
+                        (theOffer.GetAmountAvailable() >=
+                         pAsk->GetMinimumIncrement()) &&
+                        (nullptr != pAsk->GetTrade()) &&
+                        !pAsk->GetTrade()->IsFlaggedForRemoval()) {
+
+                        ProcessTrade(
+                            wallet,
+                            theTrade,
+                            theOffer,
+                            *pAsk,
+                            reason);  // <======
+                    }
+                }
+                // Else, the ask price is higher than I am willing to pay.
+                // (And all the remaining sellers are even HIGHER.)
+                else if (theOffer.IsLimitOrder()) {
+                    pAsk = nullptr;
+                    return true;  // stay on the market for now.
                 }
-            }
-            // Else, the ask price is higher than I am willing to pay.
-            // (And all the remaining sellers are even HIGHER.)
-            else if (theOffer.IsLimitOrder()) {
-                pAsk = nullptr;
-                return true;  // stay on the market for now.
-            }
 
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                const auto unittype =
-                    wallet.Internal().CurrencyTypeBasedOnUnitType(
-                        GetInstrumentDefinitionID());
-                LogVerbose()()("Removing market order: ")(
-                    theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
-                    theTrade.IsFlaggedForRemoval())(". Minimum increment: ")(
-                    theOffer.GetMinimumIncrement(),
-                    unittype)(" is larger than Amount available: ")(
-                    theOffer.GetAmountAvailable(), unittype)
-                    .Flush();
+                // The offer has no more trading to do--it's done.
+                if (theTrade.IsFlaggedForRemoval() ||  // during processing,
+                                                       // the trade may have
+                                                       // gotten flagged.
+                    (theOffer.GetMinimumIncrement() >
+                     theOffer.GetAmountAvailable())) {
+
+                    const auto unittype =
+                        wallet.Internal().CurrencyTypeBasedOnUnitType(
+                            GetInstrumentDefinitionID());
+                    LogVerbose()()("Removing market order: ")(
+                        theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
+                        theTrade.IsFlaggedForRemoval())(
+                        ". Minimum increment: ")(
+                        theOffer.GetMinimumIncrement(),
+                        unittype)(" is larger than Amount available: ")(
+                        theOffer.GetAmountAvailable(), unittype)
+                        .Flush();
 
-                return false;  // remove this trade from the market.
-            }
+                    return false;  // remove this trade from the market.
+                }
 
-            pAsk = nullptr;
+                pAsk = nullptr;
+            }
         }
     }
 
@@ -2790,18 +3152,18 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
-    while (!bids_.empty()) {
-        OTOffer* pOffer = bids_.begin()->second;
-        bids_.erase(bids_.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
-    while (!asks_.empty()) {
-        OTOffer* pOffer = asks_.begin()->second;
-        asks_.erase(asks_.begin());
+    for (auto& [lTransactionNum, position] : offers_) {
+        OTOffer* pOffer = *(position.offer_);
         delete pOffer;
         pOffer = nullptr;
     }
+
+    offers_.clear();
+    bids_.clear();
+    asks_.clear();
+    bid_count_ = 0;
+    ask_count_ = 0;
+    nym_offers_.clear();
 }
 
 void OTMarket::Release()
@@ -527,7 +527,7 @@ auto OTTrade::GetOffer(
     if (marketOffer != nullptr) {
         offer_ = marketOffer;
 
-        offer_->SetTrade(*this);
+        pMarket->LinkTrade(*offer_, *this);
 
         return offer_;
     }
@@ -578,7 +578,7 @@ auto OTTrade::GetOffer(
             offer_->SignContract(*(GetCron()->GetServerNym()), reason);
             offer_->SaveContract();
 
-            pMarket->SaveMarket(reason);
+            pMarket->SaveOffer(*offer_, reason);
 
             // Now when the market loads next time, it can verify this offer
             // using the server's signature,
@@ -648,7 +648,7 @@ auto OTTrade::GetOffer(
                 offer_->SignContract(*(GetCron()->GetServerNym()), reason);
                 offer_->SaveContract();
 
-                pMarket->SaveMarket(reason);
+                pMarket->SaveOffer(*offer_, reason);
 
                 // Now when the market loads next time, it can verify this offer
                 // using the server's signature,
@@ -11,6 +11,7 @@
 #include "internal/core/Factory.hpp"
 #include "internal/core/String.hpp"
 #include "internal/otx/common/Ledger.hpp"
+#include "internal/otx/common/LedgerCache.hpp"
 #include "internal/otx/common/NumList.hpp"
 #include "internal/otx/common/OTTransaction.hpp"
 #include "internal/otx/common/OTTransactionType.hpp"
@@ -397,37 +398,51 @@ auto LoadBoxReceipt(
         return nullptr;  // This already logs -- no need to log twice, here.
     }
 
-    // See if the box receipt exists before trying to load it...
-    //
-    if (!OTDB::Exists(
+    auto& cache = api.Internal().Ledgers();
+    const auto cacheKey = LedgerCache::Key(
+        api.DataFolder().string(),
+        strFolder1name->Get(),
+        strFolder2name->Get(),
+        strFolder3name->Get(),
+        strFilename->Get());
+    auto strFileContents = cache.Load(cacheKey).value_or(UnallocatedCString{});
+
+    if (strFileContents.empty()) {
+        // See if the box receipt exists before trying to load it...
+        //
+        if (!OTDB::Exists(
+                api,
+                api.DataFolder().string(),
+                strFolder1name->Get(),
+                strFolder2name->Get(),
+                strFolder3name->Get(),
+                strFilename->Get())) {
+            LogDetail()()("Box receipt does not exist: ")(
+                strFolder1name.get())('/')(strFolder2name.get())('/')(
+                strFolder3name.get())('/')(strFilename.get())
+                .Flush();
+            return nullptr;
+        }
+
+        // Try to load the box receipt from local storage.
+        //
+        strFileContents = OTDB::QueryPlainString(
             api,
             api.DataFolder().string(),
-            strFolder1name->Get(),
+            strFolder1name->Get(),  // <=== LOADING FROM DATA STORE.
             strFolder2name->Get(),
             strFolder3name->Get(),
-            strFilename->Get())) {
-        LogDetail()()("Box receipt does not exist: ")(strFolder1name.get())(
-            '/')(strFolder2name.get())('/')(strFolder3name.get())('/')(
-            strFilename.get())
-            .Flush();
-        return nullptr;
-    }
+            strFilename->Get());
 
-    // Try to load the box receipt from local storage.
-    //
-    const UnallocatedCString strFileContents(OTDB::QueryPlainString(
-        api,
-        api.DataFolder().string(),
-        strFolder1name->Get(),  // <=== LOADING FROM DATA STORE.
-        strFolder2name->Get(),
-        strFolder3name->Get(),
-        strFilename->Get()));
-    if (strFileContents.length() < 2) {
-        LogError()()("Error reading file: ")(strFolder1name.get())('/')(
-            strFolder2name.get())('/')(strFolder3name.get())('/')(
-            strFilename.get())
-            .Flush();
-        return nullptr;
+        if (strFileContents.length() < 2) {
+            LogError()()("Error reading file: ")(strFolder1name.get())('/')(
+                strFolder2name.get())('/')(strFolder3name.get())('/')(
+                strFilename.get())
+                .Flush();
+            return nullptr;
+        }
+
+        cache.Store(cacheKey, strFileContents);
     }
 
     auto strRawFile = String::Factory(strFileContents.c_str());
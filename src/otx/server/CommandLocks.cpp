@@ -0,0 +1,59 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "otx/server/CommandLocks.hpp"  // IWYU pragma: associated
+
+#include <functional>
+#include <utility>
+
+namespace opentxs::server
+{
+CommandLocks::CommandLocks() noexcept
+    : gate_()
+    , map_lock_()
+    , resources_()
+{
+}
+
+auto CommandLocks::Exclusive() noexcept -> Guard
+{
+    auto out = Guard{};
+    out.exclusive_ = eLock{gate_};
+
+    return out;
+}
+
+auto CommandLocks::Shared(const Resources& resources) noexcept -> Guard
+{
+    auto out = Guard{};
+    out.shared_ = sLock{gate_};
+    // NOTE mutexes are never erased from the map so the references remain
+    // valid after map_lock_ is released
+    const auto mutexes = [&] {
+        using Mutex = std::reference_wrapper<std::shared_mutex>;
+        auto output = UnallocatedVector<std::pair<Mutex, bool>>{};
+        output.reserve(resources.size());
+        const auto lock = Lock{map_lock_};
+
+        for (const auto& [id, exclusive] : resources) {
+            output.emplace_back(resources_[id], exclusive);
+        }
+
+        return output;
+    }();
+
+    // NOTE resources is an ordered map so every caller acquires the mutexes in
+    // the same order
+    for (auto& [mutex, exclusive] : mutexes) {
+        if (exclusive) {
+            out.exclusive_resources_.emplace_back(mutex.get());
+        } else {
+            out.shared_resources_.emplace_back(mutex.get());
+        }
+    }
+
+    return out;
+}
+}  // namespace opentxs::server
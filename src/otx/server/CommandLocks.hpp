@@ -0,0 +1,68 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <mutex>
+#include <shared_mutex>
+
+#include "internal/util/Mutex.hpp"
+#include "opentxs/Export.hpp"
+#include "opentxs/identifier/Generic.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::server
+{
+/// Serializes user commands and cron which touch the same nyms, accounts or
+/// instrument definitions while allowing unrelated commands to run in parallel
+class OPENTXS_NO_EXPORT CommandLocks
+{
+public:
+    /// Maps each resource to whether the command needs it exclusively. Any
+    /// number of commands may hold a resource at the same time, unless one of
+    /// them needs it exclusively.
+    using Resources = UnallocatedMap<identifier::Generic, bool>;
+
+    class Guard
+    {
+    public:
+        Guard() noexcept = default;
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) noexcept = default;
+        auto operator=(const Guard&) -> Guard& = delete;
+        auto operator=(Guard&&) noexcept -> Guard& = default;
+
+        ~Guard() = default;
+
+    private:
+        friend CommandLocks;
+
+        // NOTE member order matters: resource locks must be released before
+        // the gate
+        eLock exclusive_;
+        sLock shared_;
+        UnallocatedVector<eLock> exclusive_resources_;
+        UnallocatedVector<sLock> shared_resources_;
+    };
+
+    /// Waits for every in-progress command to finish and blocks new ones
+    auto Exclusive() noexcept -> Guard;
+    /// Locks the specified resources in a globally consistent order
+    auto Shared(const Resources& resources) noexcept -> Guard;
+
+    CommandLocks() noexcept;
+    CommandLocks(const CommandLocks&) = delete;
+    CommandLocks(CommandLocks&&) = delete;
+    auto operator=(const CommandLocks&) -> CommandLocks& = delete;
+    auto operator=(CommandLocks&&) -> CommandLocks& = delete;
+
+    ~CommandLocks() = default;
+
+private:
+    std::shared_mutex gate_;
+    std::mutex map_lock_;
+    UnallocatedMap<identifier::Generic, std::shared_mutex> resources_;
+};
+}  // namespace opentxs::server
@@ -158,6 +158,23 @@ auto ConfigLoader::load(
             ServerSettings::SetHeartbeatMsBetweenBeats(
                 static_cast<std::int32_t>(lValue));
         }
+        {
+            const char* szComment =
+                "; concurrent_commands allows user commands which touch "
+                "unrelated nyms, accounts,\n; and instrument definitions to "
+                "execute in parallel.\n";
+
+            bool bIsNewKey = false;
+            bool bValue = false;
+            config.Internal().CheckSet_bool(
+                String::Factory("heartbeat"),
+                String::Factory("concurrent_commands"),
+                ServerSettings::GetConcurrentCommands(),
+                bValue,
+                bIsNewKey,
+                String::Factory(szComment));
+            ServerSettings::SetConcurrentCommands(bValue);
+        }
 
         // PERMISSIONS
         {
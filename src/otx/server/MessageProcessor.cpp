@@ -10,6 +10,7 @@
 #include <opentxs/protobuf/ServerRequest.pb.h>
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <span>
 #include <sstream>
 #include <stdexcept>
@@ -17,6 +18,7 @@
 #include <tuple>
 #include <utility>
 
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/core/Armored.hpp"
 #include "internal/core/String.hpp"
@@ -36,6 +38,7 @@
 #include "opentxs/api/Factory.internal.hpp"
 #include "opentxs/api/Network.hpp"
 #include "opentxs/api/Session.internal.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/ZeroMQ.hpp"
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
@@ -66,6 +69,7 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "otx/server/Server.hpp"
+#include "otx/server/ServerSettings.hpp"
 #include "otx/server/UserCommandProcessor.hpp"
 
 namespace opentxs::server
@@ -99,6 +103,7 @@ MessageProcessor::Imp::Imp(
     : api_(server.API())
     , server_(server)
     , reason_(reason)
+    , concurrent_(false)
     , running_(true)
     , zmq_handle_(api_.Network().ZeroMQ().Context().Internal().MakeBatch(
           {
@@ -124,6 +129,15 @@ MessageProcessor::Imp::Imp(
     , drop_outgoing_(0)
     , active_connections_()
     , connection_map_lock_()
+    , command_locks_()
+    , job_lock_()
+    , job_available_()
+    , jobs_()
+    , workers_()
+    , cron_timer_(api_.Network().Asio().Internal().GetTimer())
+    , cron_lock_()
+    , cron_wake_()
+    , cron_due_(true)
 {
     zmq_batch_.listen_callbacks_.emplace_back(zmq::ListenCallback::Factory(
         [this](auto&& m) { old_pipeline(std::move(m)); }));
@@ -199,7 +213,19 @@ auto MessageProcessor::Imp::associate_connection(
 
 auto MessageProcessor::Imp::cleanup() noexcept -> void
 {
-    running_ = false;
+    {
+        const auto lock = Lock{job_lock_};
+        running_ = false;
+    }
+
+    job_available_.notify_all();
+
+    {
+        const auto lock = Lock{cron_lock_};
+        cron_timer_.Cancel();
+    }
+
+    cron_wake_.notify_all();
     zmq_handle_.Release();
 }
 
@@ -228,6 +254,7 @@ auto MessageProcessor::Imp::init(
 {
     if (port == 0) { LogAbort()().Abort(); }
 
+    concurrent_ = ServerSettings::GetConcurrentCommands();
     api_.Network().ZeroMQ().Context().Internal().Modify(
         frontend_id_,
         [this, inproc, port, key = Secret{privkey}](auto& socket) {
@@ -281,32 +308,42 @@ auto MessageProcessor::Imp::old_pipeline(zmq::Message&& message) noexcept
 }
 
 auto MessageProcessor::Imp::process_backend(
-    const bool tagged,
+    const Format format,
     zmq::Message&& incoming) noexcept -> network::zeromq::Message
 {
     auto reply = UnallocatedCString{};
     const auto error = [&] {
-        // ProcessCron and process_backend must not run simultaneously
-        auto lock = Lock{lock_};
-        const auto request = [&] {
-            auto out = UnallocatedCString{};
-            const auto body = incoming.Payload();
+        const auto body = incoming.Payload();
+        // NOTE tagged requests carry the message type in the first frame
+        const auto index = (Format::untagged == format) ? 0u : 1u;
 
-            if (0u < body.size()) { out = body[0].Bytes(); }
+        if (index >= body.size()) { return true; }
 
-            return out;
-        }();
-
-        return process_message(request, reply);
+        return process_message(
+            body[index].Bytes(), (Format::raw == format), reply);
     }();
 
     if (error) { reply = ""; }
 
     auto output = network::zeromq::reply_to_message(std::move(incoming));
 
-    if (tagged) { output.AddFrame(WorkType::OTXLegacyXML); }
-
-    output.AddFrame(reply);
+    switch (format) {
+        case Format::armored: {
+            output.AddFrame(WorkType::OTXLegacyXML);
+            output.AddFrame(reply);
+            // NOTE advertise support for unarmored requests. Clients which do
+            // not understand this frame ignore it.
+            output.AddFrame(WorkType::OTXLegacyBinary);
+        } break;
+        case Format::raw: {
+            output.AddFrame(WorkType::OTXLegacyBinary);
+            output.AddFrame(reply);
+        } break;
+        case Format::untagged:
+        default: {
+            output.AddFrame(reply);
+        }
+    }
 
     return output;
 }
@@ -362,7 +399,7 @@ auto MessageProcessor::Imp::process_frontend(zmq::Message&& message) noexcept
     const auto body = message.Payload();
 
     if (2u > body.size()) {
-        process_legacy(id, false, std::move(message));
+        process_legacy(id, Format::untagged, std::move(message));
 
         return;
     }
@@ -389,7 +426,10 @@ auto MessageProcessor::Imp::process_frontend(zmq::Message&& message) noexcept
                 process_proto(id, oldProtoFormat, std::move(message));
             } break;
             case WorkType::OTXLegacyXML: {
-                process_legacy(id, true, std::move(message));
+                process_legacy(id, Format::armored, std::move(message));
+            } break;
+            case WorkType::OTXLegacyBinary: {
+                process_legacy(id, Format::raw, std::move(message));
             } break;
             default: {
                 throw std::runtime_error{"Unsupported message type"};
@@ -419,36 +459,57 @@ auto MessageProcessor::Imp::process_internal(zmq::Message&& message) noexcept
 
     if (drop) { return; }
 
-    const auto sent = frontend_.SendExternal(std::move(message));
-
-    if (sent) {
-        LogTrace()()("Reply message delivered.").Flush();
+    if (concurrent_) {
+        // NOTE frontend_ may only be used by the zmq thread which owns it
+        api_.Network().ZeroMQ().Context().Internal().Modify(
+            frontend_id_,
+            [this, reply = std::move(message)](auto&) mutable {
+                send_reply(std::move(reply));
+            });
     } else {
-        LogError()()("Failed to send reply message.").Flush();
+        send_reply(std::move(message));
     }
 }
 
 auto MessageProcessor::Imp::process_legacy(
     const network::zeromq::Envelope& id,
-    const bool tagged,
+    const Format format,
     network::zeromq::Message&& incoming) noexcept -> void
 {
     LogTrace()()("Processing request via ").asHex(id.get()[0].Bytes()).Flush();
-    process_internal(process_backend(tagged, std::move(incoming)));
+
+    if (concurrent_) {
+        queue_job(format, std::move(incoming));
+    } else {
+        process_internal(process_backend(format, std::move(incoming)));
+    }
 }
 
 auto MessageProcessor::Imp::process_message(
-    const UnallocatedCString& messageString,
+    const ReadView request,
+    const bool raw,
     UnallocatedCString& reply) noexcept -> bool
 {
-    if (messageString.size() < 1) { return true; }
+    if (request.size() < 1) { return true; }
 
     try {
-        auto armored = Armored::Factory(api_.Crypto());
-        armored->MemSet(messageString.data(), shorten(messageString.size()));
-        auto serialized = String::Factory();
-        armored->GetString(serialized);
-        auto request{api_.Factory().Internal().Session().Message()};
+        // NOTE raw requests are the signed message itself so the frame
+        // contents are parsed directly instead of being base64 decoded and
+        // decompressed first
+        const auto serialized = [&] {
+            if (raw) {
+
+                return String::Factory(request.data(), request.size());
+            } else {
+                auto armored = Armored::Factory(api_.Crypto());
+                armored->MemSet(request.data(), shorten(request.size()));
+                auto out = String::Factory();
+                armored->GetString(out);
+
+                return out;
+            }
+        }();
+        auto message{api_.Factory().Internal().Session().Message()};
 
         if (false == serialized->Exists()) {
             LogError()()("Empty serialized request.").Flush();
@@ -456,7 +517,7 @@ auto MessageProcessor::Imp::process_message(
             return true;
         }
 
-        if (false == request->LoadContractFromString(serialized)) {
+        if (false == message->LoadContractFromString(serialized)) {
             LogError()()("Failed to deserialized request.").Flush();
 
             return true;
@@ -466,17 +527,35 @@ auto MessageProcessor::Imp::process_message(
 
         assert_true(false != bool(replymsg));
 
-        const bool processed =
-            server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+        const bool processed = [&] {
+            auto& processor = server_.CommandProcessor();
+            auto parsed = UserCommandProcessor::Parsed{};
+            // NOTE ProcessCron and commands which may touch the same nyms,
+            // accounts, or instrument definitions must not run simultaneously
+            const auto guard = [&] {
+                if (concurrent_) {
+                    if (const auto resources =
+                            processor.Resources(*message, parsed);
+                        resources.has_value()) {
+
+                        return command_locks_.Shared(*resources);
+                    }
+                }
+
+                return command_locks_.Exclusive();
+            }();
+
+            return processor.ProcessUserCommand(*message, *replymsg, parsed);
+        }();
 
         if (false == processed) {
             LogDetail()()("Failed to process user command ")(
-                request->command_.get())
+                message->command_.get())
                 .Flush();
-            LogVerbose()()(String::Factory(*request).get()).Flush();
+            LogVerbose()()(String::Factory(*message).get()).Flush();
         } else {
             LogDetail()()("Successfully processed user command ")(
-                request->command_.get())
+                message->command_.get())
                 .Flush();
         }
 
@@ -488,6 +567,12 @@ auto MessageProcessor::Imp::process_message(
             return true;
         }
 
+        if (raw) {
+            reply.assign(serializedReply->Get(), serializedReply->GetLength());
+
+            return false;
+        }
+
         auto armoredReply = Armored::Factory(api_.Crypto(), serializedReply);
 
         if (false == armoredReply->Exists()) {
@@ -626,27 +711,121 @@ auto MessageProcessor::Imp::query_connection(const identifier::Nym& id) noexcept
     }
 }
 
+auto MessageProcessor::Imp::queue_job(
+    const Format format,
+    zmq::Message&& incoming) noexcept -> void
+{
+    {
+        const auto lock = Lock{job_lock_};
+        jobs_.emplace_back(format, std::move(incoming));
+    }
+
+    job_available_.notify_one();
+}
+
 auto MessageProcessor::Imp::run() noexcept -> void
 {
     SetThisThreadsName("MessageProcessor");
 
-    while (running_.load()) {
-        // timeout is the time left until the next cron should execute.
-        const auto timeout = server_.ComputeTimeout();
+    while (true) {
+        {
+            auto lock = Lock{cron_lock_};
+            cron_wake_.wait(
+                lock, [&] { return cron_due_ || (false == running_); });
+
+            if (false == running_) { break; }
 
-        if (timeout.count() <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            auto lock = Lock{lock_};
-            server_.ProcessCron();
+            cron_due_ = false;
         }
 
-        sleep(50ms);
+        // ProcessCron and process_backend must not run simultaneously
+        const auto guard = command_locks_.Exclusive();
+        server_.ProcessCron();
+        schedule_cron();
+    }
+}
+
+auto MessageProcessor::Imp::schedule_cron() noexcept -> void
+{
+    const auto timeout = server_.ComputeTimeout();
+    const auto lock = Lock{cron_lock_};
+    cron_timer_.Cancel();
+
+    if (false == timeout.has_value()) {
+        LogTrace()()("Cron is idle").Flush();
+
+        return;
+    }
+
+    cron_timer_.SetRelative(*timeout);
+    cron_timer_.Wait([this](const auto& ec) {
+        if (false == ec.operator bool()) { wake_cron(); }
+    });
+}
+
+auto MessageProcessor::Imp::send_reply(zmq::Message&& message) noexcept
+    -> void
+{
+    const auto sent = frontend_.SendExternal(std::move(message));
+
+    if (sent) {
+        LogTrace()()("Reply message delivered.").Flush();
+    } else {
+        LogError()()("Failed to send reply message.").Flush();
     }
 }
 
 auto MessageProcessor::Imp::Start() noexcept -> void
 {
+    server_.Cron().SetWakeCallback([this] { wake_cron(); });
     thread_ = std::thread(&Imp::run, this);
+
+    if (concurrent_) {
+        const auto count = MaxJobs();
+        workers_.reserve(count);
+
+        for (auto n = 0u; n < count; ++n) {
+            workers_.emplace_back(&Imp::work, this);
+        }
+
+        LogConsole()("Executing user commands on ")(count)(" threads").Flush();
+    }
+}
+
+auto MessageProcessor::Imp::wake_cron() noexcept -> void
+{
+    {
+        const auto lock = Lock{cron_lock_};
+        cron_due_ = true;
+    }
+
+    cron_wake_.notify_one();
+}
+
+auto MessageProcessor::Imp::work() noexcept -> void
+{
+    SetThisThreadsName("OTX worker");
+
+    while (true) {
+        auto job = [&]() -> std::optional<Job> {
+            auto lock = Lock{job_lock_};
+            job_available_.wait(lock, [&] {
+                return (false == jobs_.empty()) || (false == running_);
+            });
+
+            if (false == running_) { return std::nullopt; }
+
+            auto out = std::make_optional(std::move(jobs_.front()));
+            jobs_.pop_front();
+
+            return out;
+        }();
+
+        if (false == job.has_value()) { break; }
+
+        auto& [format, incoming] = *job;
+        process_internal(process_backend(format, std::move(incoming)));
+    }
 }
 
 MessageProcessor::Imp::~Imp()
@@ -654,6 +833,12 @@ MessageProcessor::Imp::~Imp()
     cleanup();
 
     if (thread_.joinable()) { thread_.join(); }
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+
+    server_.Cron().SetWakeCallback({});
 }
 }  // namespace opentxs::server
 
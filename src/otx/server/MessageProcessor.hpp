@@ -7,7 +7,9 @@
 
 #include <opentxs/protobuf/ServerRequest.pb.h>
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <shared_mutex>
 #include <thread>
@@ -15,12 +17,14 @@
 
 #include "internal/network/zeromq/Handle.hpp"
 #include "internal/otx/server/MessageProcessor.hpp"
-#include "internal/util/Lockable.hpp"
+#include "internal/util/Timer.hpp"
 #include "opentxs/Export.hpp"
+#include "opentxs/Types.hpp"
 #include "opentxs/identifier/Nym.hpp"
 #include "opentxs/network/zeromq/message/Envelope.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/util/Container.hpp"
+#include "otx/server/CommandLocks.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs
@@ -66,7 +70,7 @@ namespace zmq = opentxs::network::zeromq;
 
 namespace opentxs::server
 {
-class OPENTXS_NO_EXPORT MessageProcessor::Imp final : Lockable
+class OPENTXS_NO_EXPORT MessageProcessor::Imp final
 {
 public:
     auto DropIncoming(const int count) const noexcept -> void;
@@ -89,14 +93,24 @@ public:
     ~Imp() final;
 
 private:
+    // NOTE legacy requests either consist of a single untagged frame, or are
+    // tagged to indicate whether the signed message is armored
+    enum class Format : std::uint8_t {
+        untagged,
+        armored,
+        raw,
+    };
+
     // connection identifier, old format
     using ConnectionData = std::pair<network::zeromq::Envelope, bool>;
+    using Job = std::pair<Format, network::zeromq::Message>;
 
     static constexpr auto zap_domain_{"opentxs-otx"};
 
     const api::session::Notary& api_;
     Server& server_;
     const PasswordPrompt& reason_;
+    std::atomic<bool> concurrent_;
     std::atomic<bool> running_;
     zmq::internal::Handle zmq_handle_;
     zmq::internal::Batch& zmq_batch_;
@@ -110,6 +124,15 @@ private:
     mutable int drop_outgoing_;
     UnallocatedMap<identifier::Nym, ConnectionData> active_connections_;
     mutable std::shared_mutex connection_map_lock_;
+    CommandLocks command_locks_;
+    std::mutex job_lock_;
+    std::condition_variable job_available_;
+    UnallocatedDeque<Job> jobs_;
+    UnallocatedVector<std::thread> workers_;
+    Timer cron_timer_;
+    std::mutex cron_lock_;
+    std::condition_variable cron_wake_;
+    bool cron_due_;
 
     auto extract_proto(const network::zeromq::Frame& incoming) const noexcept
         -> protobuf::ServerRequest;
@@ -120,7 +143,7 @@ private:
         const network::zeromq::Envelope& connection) noexcept -> void;
     auto old_pipeline(zmq::Message&& message) noexcept -> void;
     auto process_backend(
-        const bool tagged,
+        const Format format,
         network::zeromq::Message&& incoming) noexcept
         -> network::zeromq::Message;
     auto process_command(
@@ -130,10 +153,11 @@ private:
     auto process_internal(network::zeromq::Message&& incoming) noexcept -> void;
     auto process_legacy(
         const network::zeromq::Envelope& id,
-        const bool tagged,
+        const Format format,
         network::zeromq::Message&& incoming) noexcept -> void;
     auto process_message(
-        const UnallocatedCString& messageString,
+        const ReadView request,
+        const bool raw,
         UnallocatedCString& reply) noexcept -> bool;
     auto process_notification(network::zeromq::Message&& incoming) noexcept
         -> void;
@@ -143,6 +167,13 @@ private:
         network::zeromq::Message&& incoming) noexcept -> void;
     auto query_connection(const identifier::Nym& nymID) noexcept
         -> const ConnectionData&;
+    auto queue_job(
+        const Format format,
+        network::zeromq::Message&& incoming) noexcept -> void;
     auto run() noexcept -> void;
+    auto schedule_cron() noexcept -> void;
+    auto send_reply(network::zeromq::Message&& message) noexcept -> void;
+    auto wake_cron() noexcept -> void;
+    auto work() noexcept -> void;
 };
 }  // namespace opentxs::server
@@ -2566,7 +2566,8 @@ void Notary::NotarizeDeposit(
     OTTransaction& output,
     Ledger& inbox,
     Ledger& outbox,
-    bool& success)
+    bool& success,
+    const std::shared_ptr<const Cheque>& cheque)
 {
     const auto& nymID = context.Signer()->ID();
     output.SetType(otx::transactionType::atDeposit);
@@ -2661,7 +2662,8 @@ void Notary::NotarizeDeposit(
                 outbox,
                 success,
                 *responseItem,
-                *responseBalanceItem);
+                *responseBalanceItem,
+                cheque);
         } break;
         case otx::itemType::atDeposit: {
             process_cash_deposit(
@@ -5858,7 +5860,8 @@ void Notary::NotarizeTransaction(
     otx::context::Client& context,
     OTTransaction& tranIn,
     OTTransaction& tranOut,
-    bool& bOutSuccess)
+    bool& bOutSuccess,
+    const std::shared_ptr<const Cheque>& cheque)
 {
     struct Cleanup {
         OTTransaction& transaction_;
@@ -6117,7 +6120,8 @@ void Notary::NotarizeTransaction(
                         tranOut,
                         inbox,
                         outbox,
-                        bOutSuccess);
+                        bOutSuccess,
+                        cheque);
                     theReplyItemType = otx::itemType::atDeposit;
                     break;
 
@@ -8682,7 +8686,8 @@ void Notary::process_cheque_deposit(
     Ledger& outbox,
     bool& success,
     Item& responseItem,
-    Item& responseBalanceItem)
+    Item& responseBalanceItem,
+    const std::shared_ptr<const Cheque>& parsed)
 {
     const auto& serverID = context.Notary();
     const auto accountID =
@@ -8703,7 +8708,11 @@ void Notary::process_cheque_deposit(
         return;
     }
 
-    const auto cheque = extract_cheque(serverID, unitID, depositItem);
+    const auto cheque = [&]() -> std::shared_ptr<const Cheque> {
+        if (parsed) { return parsed; }
+
+        return extract_cheque(serverID, unitID, depositItem);
+    }();
 
     if (false == bool(cheque)) { return; }
 
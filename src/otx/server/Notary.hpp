@@ -82,11 +82,14 @@ public:
         OTTransaction& tranIn,
         OTTransaction& tranOut,
         bool& outSuccess) -> bool;
+    /// cheque is the cheque deposited by tranIn, if the caller has already
+    /// parsed it
     void NotarizeTransaction(
         otx::context::Client& context,
         OTTransaction& tranIn,
         OTTransaction& tranOut,
-        bool& outSuccess);
+        bool& outSuccess,
+        const std::shared_ptr<const Cheque>& cheque);
 
     Notary() = delete;
     Notary(const Notary&) = delete;
@@ -198,7 +201,8 @@ private:
         OTTransaction& tranOut,
         Ledger& inbox,
         Ledger& outbox,
-        bool& outSuccess);
+        bool& outSuccess,
+        const std::shared_ptr<const Cheque>& cheque);
     void NotarizeExchangeBasket(
         otx::context::Client& context,
         ExclusiveAccount& sourceAccount,
@@ -284,7 +288,8 @@ private:
         Ledger& outbox,
         bool& success,
         Item& responseItem,
-        Item& responseBalanceItem);
+        Item& responseBalanceItem,
+        const std::shared_ptr<const Cheque>& parsed);
     auto process_token_deposit(
         ExclusiveAccount& reserveAccount,
         Account& depositAccount,
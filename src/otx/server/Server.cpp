@@ -9,8 +9,10 @@
 #include <opentxs/protobuf/OTXPush.pb.h>
 #include <opentxs/protobuf/ServerContract.pb.h>
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <regex>
 
 #include "internal/api/crypto/Encode.hpp"
@@ -161,6 +163,22 @@ void Server::ProcessCron()
     // Such as sweeping server accounts after expiration dates, etc.
 }
 
+auto Server::ComputeTimeout() -> std::optional<std::chrono::milliseconds>
+{
+    using namespace std::chrono;
+
+    if (false == cron_->IsActivated()) { return std::nullopt; }
+
+    const auto due = cron_->NextDue();
+
+    if (false == due.has_value()) { return std::nullopt; }
+
+    // NOTE round up so the timer never fires before the item is due
+    const auto untilDue = ceil<milliseconds>(*due - Clock::now());
+
+    return std::max({untilDue, cron_->computeTimeout(), milliseconds{0}});
+}
+
 auto Server::GetServerID() const noexcept -> const identifier::Notary&
 {
     return notary_id_.get();
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "internal/core/String.hpp"
@@ -77,10 +78,9 @@ public:
     {
         return user_command_processor_;
     }
-    auto ComputeTimeout() -> std::chrono::milliseconds
-    {
-        return cron_->computeTimeout();
-    }
+    /// Time remaining until ProcessCron has work to do, or nothing if only a
+    /// change to cron can create work
+    auto ComputeTimeout() -> std::optional<std::chrono::milliseconds>;
     auto Cron() -> OTCron& { return *cron_; }
     auto DropMessageToNymbox(
         const identifier::Notary& notaryID,
@@ -42,6 +42,16 @@ struct ServerSettings {
         _heartbeat_ms_between_beats = value;
     }
 
+    static auto GetConcurrentCommands() -> bool
+    {
+        return _concurrent_commands;
+    }
+
+    static void SetConcurrentCommands(bool value)
+    {
+        _concurrent_commands = value;
+    }
+
     static auto GetOverrideNymID() -> const UnallocatedCString&
     {
         return _override_nym_id;
@@ -57,6 +67,10 @@ struct ServerSettings {
     static std::int32_t _heartbeat_no_requests;
     static std::int32_t _heartbeat_ms_between_beats;
 
+    // Are user commands which touch unrelated nyms, accounts, and instrument
+    // definitions allowed to execute in parallel?
+    static bool _concurrent_commands;
+
     // The Nym who's allowed to do certain commands even if they are turned off.
     static UnallocatedCString _override_nym_id;
     // Are usage credits REQUIRED in order to use this server?
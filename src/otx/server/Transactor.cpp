@@ -11,6 +11,8 @@
 #include "internal/otx/AccountList.hpp"
 #include "internal/otx/common/Account.hpp"
 #include "internal/otx/consensus/Client.hpp"
+#include "internal/util/Lockable.hpp"
+#include "internal/util/Mutex.hpp"
 #include "internal/util/Pimpl.hpp"
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Factory.hpp"
@@ -29,6 +31,7 @@ namespace opentxs::server
 Transactor::Transactor(Server& server, const PasswordPrompt& reason)
     : server_(server)
     , reason_(reason)
+    , lock_()
     , transaction_number_(0)
     , id_to_basket_map_()
     , contract_id_to_basket_account_id_()
@@ -47,6 +50,17 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
 auto Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber) -> bool
 {
+    const auto lock = Lock{lock_};
+
+    return issue_next_transaction_number(lock, lTransactionNumber);
+}
+
+auto Transactor::issue_next_transaction_number(
+    const Lock& lock,
+    TransactionNumber& lTransactionNumber) -> bool
+{
+    assert_true(CheckLock(lock, lock_));
+
     // transaction_number_ stores the last VALID AND ISSUED transaction number.
     // So first, we increment that, since we don't want to issue the same number
     // twice.
@@ -70,7 +84,11 @@ auto Transactor::issueNextTransactionNumberToNym(
     otx::context::Client& context,
     TransactionNumber& lTransactionNumber) -> bool
 {
-    if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
+    const auto lock = Lock{lock_};
+
+    if (!issue_next_transaction_number(lock, lTransactionNumber)) {
+        return false;
+    }
 
     // Each Nym stores the transaction numbers that have been issued to it.
     // (On client AND server side.)
@@ -219,6 +237,7 @@ auto Transactor::getVoucherAccount(
     const auto& NOTARY_NYM_ID = server_.GetServerNym().ID();
     const auto& NOTARY_ID = server_.GetServerID();
     bool bWasAcctCreated = false;
+    const auto lock = Lock{lock_};
     auto pAccount = voucher_accounts_.GetOrRegisterAccount(
         server_.GetServerNym(),
         NOTARY_NYM_ID,
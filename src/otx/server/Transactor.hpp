@@ -5,7 +5,10 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "internal/otx/AccountList.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/api/session/Wallet.internal.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
@@ -97,6 +100,9 @@ private:
 
     Server& server_;
     const PasswordPrompt& reason_;
+    // Guards the transaction number and voucher accounts against concurrent
+    // user commands
+    mutable std::mutex lock_;
     // This stores the last VALID AND ISSUED transaction number.
     TransactionNumber transaction_number_;
     // maps basketId with basketAccountId
@@ -107,5 +113,9 @@ private:
     BasketsMap contract_id_to_basket_account_id_;
     // The list of voucher accounts (see GetVoucherAccount below for details)
     otx::internal::AccountList voucher_accounts_;
+
+    auto issue_next_transaction_number(
+        const Lock& lock,
+        TransactionNumber& txNumber) -> bool;
 };
 }  // namespace opentxs::server
@@ -16,6 +16,7 @@
 #include <opentxs/protobuf/UnitDefinition.pb.h>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <span>
 #include <stdexcept>
 #include <utility>
@@ -30,6 +31,7 @@
 #include "internal/identity/Nym.hpp"
 #include "internal/otx/blind/Mint.hpp"
 #include "internal/otx/common/Account.hpp"
+#include "internal/otx/common/Cheque.hpp"
 #include "internal/otx/common/Item.hpp"
 #include "internal/otx/common/Ledger.hpp"
 #include "internal/otx/common/Message.hpp"
@@ -1464,8 +1466,9 @@ auto UserCommandProcessor::cmd_issue_basket(ReplyMessage& reply) const -> bool
     }
 }
 
-auto UserCommandProcessor::cmd_notarize_transaction(ReplyMessage& reply) const
-    -> bool
+auto UserCommandProcessor::cmd_notarize_transaction(
+    ReplyMessage& reply,
+    Parsed& parsed) const -> bool
 {
     const auto& msgIn = reply.Original();
     reply.SetAccount(msgIn.acct_id_);
@@ -1480,8 +1483,10 @@ auto UserCommandProcessor::cmd_notarize_transaction(ReplyMessage& reply) const
     const auto accountID =
         server_.API().Factory().AccountIDFromBase58(msgIn.acct_id_->Bytes());
     auto nymboxHash = identifier::Generic{};
-    auto input{
-        api_.Factory().Internal().Session().Ledger(nymID, accountID, serverID)};
+    const auto loaded = (nullptr != parsed.ledger_);
+    auto input = loaded ? std::move(parsed.ledger_)
+                        : api_.Factory().Internal().Session().Ledger(
+                              nymID, accountID, serverID);
     auto responseLedger{api_.Factory().Internal().Session().Ledger(
         serverNymID, accountID, serverID, otx::ledgerType::message, false)};
 
@@ -1494,7 +1499,9 @@ auto UserCommandProcessor::cmd_notarize_transaction(ReplyMessage& reply) const
         return false;
     }
 
-    if (false == input->LoadLedgerFromString(String::Factory(msgIn.payload_))) {
+    if ((false == loaded) &&
+        (false ==
+         input->LoadLedgerFromString(String::Factory(msgIn.payload_)))) {
         LogError()()("Unable to load input ledger.").Flush();
 
         return false;
@@ -1530,8 +1537,15 @@ auto UserCommandProcessor::cmd_notarize_transaction(ReplyMessage& reply) const
                 .release()));
 
         bool success{false};
+        const auto cheque = [&]() -> std::shared_ptr<const Cheque> {
+            const auto i = parsed.cheques_.find(inputNumber);
+
+            if (parsed.cheques_.end() == i) { return nullptr; }
+
+            return i->second;
+        }();
         server_.GetNotary().NotarizeTransaction(
-            context, *transaction, *outTrans, success);
+            context, *transaction, *outTrans, success, cheque);
 
         if (outTrans->IsCancelled()) {
             LogError()()("Success canceling transaction ")(
@@ -2767,9 +2781,131 @@ auto UserCommandProcessor::load_outbox(
     return outbox;
 }
 
+auto UserCommandProcessor::notarize_resources(
+    const Message& msgIn,
+    CommandLocks::Resources& out,
+    Parsed& parsed) const -> bool
+{
+    const auto nymID = api_.Factory().NymIDFromBase58(msgIn.nym_id_->Bytes());
+    const auto accountID =
+        api_.Factory().AccountIDFromBase58(msgIn.acct_id_->Bytes());
+    auto input{api_.Factory().Internal().Session().Ledger(
+        nymID, accountID, server_.GetServerID())};
+
+    assert_false(nullptr == input);
+
+    if (false == input->LoadLedgerFromString(String::Factory(msgIn.payload_))) {
+
+        return false;
+    }
+
+    // NOTE the unit of the account named by the request is only locked
+    // exclusively when a transaction may touch an account which the request
+    // does not name
+    auto unit{false};
+    auto cheques = decltype(parsed.cheques_){};
+
+    for (const auto& [number, transaction] : input->GetTransactionMap()) {
+        if (nullptr == transaction) { return false; }
+
+        switch (transaction->GetType()) {
+            case otx::transactionType::processInbox:
+            case otx::transactionType::withdrawal: {
+                // NOTE receipts in the inbox name the accounts of other nyms,
+                // and withdrawals touch the voucher or reserve account for the
+                // unit
+                unit = true;
+            } break;
+            case otx::transactionType::transfer: {
+                const auto item =
+                    transaction->GetItem(otx::itemType::transfer);
+
+                if (false == bool(item)) { return false; }
+
+                if (false == resource_account(
+                                 item->GetDestinationAcctID(), false, out)) {
+
+                    return false;
+                }
+            } break;
+            case otx::transactionType::deposit: {
+                const auto item =
+                    transaction->GetItem(otx::itemType::depositCheque);
+
+                // NOTE cash deposits only touch the reserve account for the
+                // unit of the deposit account
+                if (false == bool(item)) {
+                    unit = true;
+
+                    break;
+                }
+
+                auto serialized = String::Factory();
+                item->GetAttachment(serialized);
+                auto cheque = api_.Factory().Internal().Session().Cheque();
+
+                assert_false(nullptr == cheque);
+
+                if (false == cheque->LoadContractFromString(serialized)) {
+
+                    return false;
+                }
+
+                // NOTE depositing a cheque modifies the account and client
+                // context of the drawer (or remitter, for vouchers)
+                out.insert_or_assign(cheque->GetSenderNymID(), true);
+
+                if (false == resource_account(
+                                 cheque->GetSenderAcctID(), false, out)) {
+
+                    return false;
+                }
+
+                if (cheque->HasRemitter()) {
+                    out.insert_or_assign(cheque->GetRemitterNymID(), true);
+
+                    if (false == resource_account(
+                                     cheque->GetRemitterAcctID(), false, out)) {
+
+                        return false;
+                    }
+                }
+
+                cheques.emplace(number, std::move(cheque));
+            } break;
+            default: {
+                // NOTE everything else either touches cron, more than one
+                // instrument definition, or an unbounded set of nymboxes
+
+                return false;
+            }
+        }
+    }
+
+    if (unit && (false == resource_account(accountID, true, out))) {
+
+        return false;
+    }
+
+    parsed.ledger_ = std::move(input);
+    parsed.cheques_ = std::move(cheques);
+
+    return true;
+}
+
 auto UserCommandProcessor::ProcessUserCommand(
     const Message& msgIn,
     Message& msgOut) -> bool
+{
+    auto parsed = Parsed{};
+
+    return ProcessUserCommand(msgIn, msgOut, parsed);
+}
+
+auto UserCommandProcessor::ProcessUserCommand(
+    const Message& msgIn,
+    Message& msgOut,
+    Parsed& parsed) -> bool
 {
     UnallocatedCString command(msgIn.command_->Get());
     const auto type = Message::Type(command);
@@ -2884,7 +3020,7 @@ auto UserCommandProcessor::ProcessUserCommand(
             return cmd_issue_basket(reply);
         }
         case otx::MessageType::notarizeTransaction: {
-            return cmd_notarize_transaction(reply);
+            return cmd_notarize_transaction(reply, parsed);
         }
         case otx::MessageType::getNymbox: {
             return cmd_get_nymbox(reply);
@@ -2988,6 +3124,100 @@ auto UserCommandProcessor::reregister_nym(ReplyMessage& reply) const -> bool
     return true;
 }
 
+auto UserCommandProcessor::resource_account(
+    const identifier::Account& accountID,
+    const bool exclusiveUnit,
+    CommandLocks::Resources& out) const -> bool
+{
+    const auto unit =
+        server_.API().Storage().Internal().AccountContract(accountID);
+
+    if (unit.empty()) { return false; }
+
+    out.insert_or_assign(accountID, true);
+    // NOTE transfers, cheques, and vouchers only move funds between accounts
+    // of the same instrument definition, so a command which may touch accounts
+    // it does not name locks the instrument definition exclusively. Every
+    // other command which touches an account of that instrument definition
+    // shares the lock, so such commands don't wait for each other.
+    auto& exclusive = out[unit];
+    exclusive = exclusive || exclusiveUnit;
+
+    return true;
+}
+
+auto UserCommandProcessor::Resources(const Message& msgIn, Parsed& parsed)
+    const -> std::optional<CommandLocks::Resources>
+{
+    auto out = CommandLocks::Resources{};
+    const auto nym = [&](const String& id) {
+        if (id.Exists()) {
+            out.insert_or_assign(
+                api_.Factory().NymIDFromBase58(id.Bytes()), true);
+        }
+    };
+    const auto account = [&](const String& id, const bool exclusiveUnit) {
+        return id.Exists() &&
+               resource_account(
+                   api_.Factory().AccountIDFromBase58(id.Bytes()),
+                   exclusiveUnit,
+                   out);
+    };
+    nym(msgIn.nym_id_);
+
+    switch (Message::Type(msgIn.command_->Get())) {
+        case otx::MessageType::pingNotary:
+        case otx::MessageType::getRequestNumber:
+        case otx::MessageType::getTransactionNumbers:
+        case otx::MessageType::getNymbox:
+        case otx::MessageType::processNymbox:
+        case otx::MessageType::checkNym:
+        case otx::MessageType::queryInstrumentDefinitions:
+        case otx::MessageType::getInstrumentDefinition:
+        case otx::MessageType::getMint:
+        case otx::MessageType::getMarketList:
+        case otx::MessageType::getMarketOffers:
+        case otx::MessageType::getMarketRecentTrades:
+        case otx::MessageType::getNymMarketOffers: {
+
+            return out;
+        }
+        case otx::MessageType::sendNymMessage: {
+            nym(msgIn.nym_id2_);
+
+            return out;
+        }
+        case otx::MessageType::getAccountData:
+        case otx::MessageType::getBoxReceipt: {
+            // NOTE box receipt requests for a nymbox do not name an account
+            account(msgIn.acct_id_, false);
+
+            return out;
+        }
+        case otx::MessageType::processInbox: {
+            if (account(msgIn.acct_id_, true)) { return out; }
+
+            return std::nullopt;
+        }
+        case otx::MessageType::notarizeTransaction: {
+            if (account(msgIn.acct_id_, false) &&
+                notarize_resources(msgIn, out, parsed)) {
+
+                return out;
+            }
+
+            return std::nullopt;
+        }
+        default: {
+            // NOTE registrations, cron items, baskets, and dividends touch
+            // state which is not covered by any resource lock so they run
+            // exclusively
+
+            return std::nullopt;
+        }
+    }
+}
+
 auto UserCommandProcessor::save_box(const identity::Nym& nym, Ledger& box) const
     -> bool
 {
@@ -7,11 +7,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 
+#include "internal/otx/common/Ledger.hpp"
 #include "internal/otx/common/Message.hpp"
 #include "opentxs/Export.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
+#include "otx/server/CommandLocks.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs
@@ -55,7 +58,7 @@ class ReplyMessage;
 class Server;
 }  // namespace server
 
-class Ledger;
+class Cheque;
 class NumList;
 class OTTransaction;
 class PasswordPrompt;
@@ -67,6 +70,15 @@ namespace opentxs::server
 class OPENTXS_NO_EXPORT UserCommandProcessor
 {
 public:
+    /// The input ledger of a notarizeTransaction request and the cheques it
+    /// deposits, as parsed by Resources(), so that ProcessUserCommand() does
+    /// not parse them again
+    struct Parsed {
+        std::unique_ptr<Ledger> ledger_{};
+        UnallocatedMap<TransactionNumber, std::shared_ptr<const Cheque>>
+            cheques_{};
+    };
+
     Server& server_;
 
     static auto check_client_isnt_server(
@@ -91,6 +103,14 @@ public:
         Server& server) const;
 
     auto ProcessUserCommand(const Message& msgIn, Message& msgOut) -> bool;
+    auto ProcessUserCommand(
+        const Message& msgIn,
+        Message& msgOut,
+        Parsed& parsed) -> bool;
+    /// Returns the nyms, accounts, and instrument definitions which the
+    /// command may modify, or nothing if the command must run exclusively
+    auto Resources(const Message& msgIn, Parsed& parsed) const
+        -> std::optional<CommandLocks::Resources>;
 
     UserCommandProcessor() = delete;
     UserCommandProcessor(const UserCommandProcessor&) = delete;
@@ -165,7 +185,8 @@ private:
     auto cmd_get_request_number(ReplyMessage& reply) const -> bool;
     auto cmd_get_transaction_numbers(ReplyMessage& reply) const -> bool;
     auto cmd_issue_basket(ReplyMessage& reply) const -> bool;
-    auto cmd_notarize_transaction(ReplyMessage& reply) const -> bool;
+    auto cmd_notarize_transaction(ReplyMessage& reply, Parsed& parsed) const
+        -> bool;
     auto cmd_ping_notary(ReplyMessage& reply) const -> bool;
     auto cmd_process_inbox(ReplyMessage& reply) const -> bool;
     auto cmd_process_nymbox(ReplyMessage& reply) const -> bool;
@@ -204,7 +225,15 @@ private:
         const identifier::Notary& serverID,
         const identity::Nym& serverNym,
         const bool verifyAccount) const -> std::unique_ptr<Ledger>;
+    auto notarize_resources(
+        const Message& msgIn,
+        CommandLocks::Resources& out,
+        Parsed& parsed) const -> bool;
     auto reregister_nym(ReplyMessage& reply) const -> bool;
+    auto resource_account(
+        const identifier::Account& accountID,
+        const bool exclusiveUnit,
+        CommandLocks::Resources& out) const -> bool;
     auto save_box(const identity::Nym& nym, Ledger& box) const -> bool;
     auto save_inbox(
         const identity::Nym& nym,
@@ -35,6 +35,8 @@ struct Options::Imp::Parser {
     static constexpr auto blockchain_reset_cfilter_{"reset_cfilter"};
     static constexpr auto blockchain_ipv4_bind_{"blockchain_bind_ipv4"};
     static constexpr auto blockchain_ipv6_bind_{"blockchain_bind_ipv6"};
+    static constexpr auto blockchain_block_cache_{
+        "blockchain_block_cache_bytes"};
     static constexpr auto blockchain_profile_{"blockchain_profile"};
     static constexpr auto blockchain_sync_provide_{"provide_sync_server"};
     static constexpr auto blockchain_sync_connect_{"blockchain_sync_server"};
@@ -88,6 +90,11 @@ struct Options::Imp::Parser {
                 po::value<Multistring>()->multitoken()->composing(),
                 "Local ipv6 addresses to bind for incoming blockchain "
                 "connections");
+            out.add_options()(
+                blockchain_block_cache_,
+                po::value<std::size_t>(),
+                "Maximum size in bytes of the in-memory block cache for each "
+                "blockchain. 0 selects the default of 64 MiB");
             out.add_options()(
                 blockchain_profile_,
                 po::value<int>(),
@@ -224,6 +231,7 @@ Options::Imp::Imp() noexcept
     , blockchain_reset_cfilter_()
     , blockchain_ipv4_bind_()
     , blockchain_ipv6_bind_()
+    , blockchain_block_cache_bytes_(std::nullopt)
     , blockchain_profile_(std::nullopt)
     , blockchain_sync_server_enabled_(std::nullopt)
     , blockchain_sync_servers_()
@@ -329,6 +337,8 @@ auto Options::Imp::import_value(
             blockchain_ipv4_bind_.emplace(value);
         } else if (0 == key.compare(Parser::blockchain_ipv6_bind_)) {
             blockchain_ipv6_bind_.emplace(value);
+        } else if (0 == key.compare(Parser::blockchain_block_cache_)) {
+            blockchain_block_cache_bytes_ = std::stoull(sValue);
         } else if (0 == key.compare(Parser::blockchain_profile_)) {
             using Type = opentxs::BlockchainProfile;
 
@@ -477,6 +487,11 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                 }
             } catch (...) {
             }
+        } else if (name == Parser::blockchain_block_cache_) {
+            try {
+                blockchain_block_cache_bytes_ = value.as<std::size_t>();
+            } catch (...) {
+            }
         } else if (name == Parser::blockchain_profile_) {
             try {
                 using Type = opentxs::BlockchainProfile;
@@ -698,6 +713,10 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
         r.blockchain_ipv6_bind_,
         std::inserter(l.blockchain_ipv6_bind_, l.blockchain_ipv6_bind_.end()));
 
+    if (const auto& v = r.blockchain_block_cache_bytes_; v.has_value()) {
+        l.blockchain_block_cache_bytes_ = v.value();
+    }
+
     if (const auto& v = r.blockchain_profile_; v.has_value()) {
         l.blockchain_profile_ = v.value();
     }
@@ -911,6 +930,11 @@ auto Options::BlockchainBindIpv6() const noexcept -> const Set<CString>&
     return imp_->blockchain_ipv6_bind_;
 }
 
+auto Options::BlockchainBlockCacheBytes() const noexcept -> std::size_t
+{
+    return Imp::get(imp_->blockchain_block_cache_bytes_);
+}
+
 auto Options::BlockchainProfile() const noexcept -> opentxs::BlockchainProfile
 {
     return Imp::get(
@@ -1090,6 +1114,14 @@ auto Options::ResetCfilter(blockchain::Type chain) const noexcept -> bool
     return imp_->blockchain_reset_cfilter_.contains(chain);
 }
 
+auto Options::SetBlockchainBlockCacheBytes(std::size_t bytes) noexcept
+    -> Options&
+{
+    imp_->blockchain_block_cache_bytes_ = bytes;
+
+    return *this;
+}
+
 auto Options::SetBlockchainProfile(opentxs::BlockchainProfile value) noexcept
     -> Options&
 {
@@ -28,6 +28,7 @@ struct Options::Imp final : public internal::Options {
     Set<blockchain::Type> blockchain_reset_cfilter_;
     Set<CString> blockchain_ipv4_bind_;
     Set<CString> blockchain_ipv6_bind_;
+    std::optional<std::size_t> blockchain_block_cache_bytes_;
     std::optional<opentxs::BlockchainProfile> blockchain_profile_;
     std::optional<bool> blockchain_sync_server_enabled_;
     Set<CString> blockchain_sync_servers_;
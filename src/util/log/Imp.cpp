@@ -8,17 +8,14 @@
 #include <boost/multiprecision/cpp_dec_float.hpp>  // IWYU pragma: keep
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/system/error_code.hpp>
+#include <atomic>
 #include <chrono>
 #include <compare>
-#include <cstddef>
 #include <cstdlib>
-#include <sstream>
 #include <utility>
 #include <variant>
 
 #include "internal/core/Amount.hpp"
-#include "internal/network/zeromq/socket/Raw.hpp"
-#include "internal/otx/common/util/Common.hpp"
 #include "internal/util/Log.hpp"
 #include "opentxs/Time.hpp"
 #include "opentxs/Types.hpp"
@@ -31,7 +28,6 @@
 #include "opentxs/display/Definition.hpp"
 #include "opentxs/display/Scale.hpp"
 #include "opentxs/identifier/Generic.hpp"
-#include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/storage/Types.internal.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
@@ -39,6 +35,8 @@
 #include "opentxs/util/Writer.hpp"
 #include "util/log/LogBuffer.hpp"
 #include "util/log/Logger.hpp"
+#include "util/log/Record.hpp"
+#include "util/log/Ring.hpp"
 
 namespace opentxs
 {
@@ -58,23 +56,29 @@ auto Log::Imp::Abort() const noexcept -> void
     wait_for_terminate();
 }
 
+auto Log::Imp::Active() const noexcept -> bool { return active(); }
+
 auto Log::Imp::active() const noexcept -> bool
 {
-    return logger_->verbosity_.load() >= level_;
+    // NOTE messages above the compiled maximum are rejected without reading
+    // the runtime verbosity
+    if (level_ > max_level_) { return false; }
+
+    return logger_->verbosity_.load(std::memory_order_relaxed) >= level_;
 }
 
 auto Log::Imp::asHex(const Data& in) const noexcept -> void
 {
-    if (false == active()) { return; }
-
-    buffer(in.asHex());
+    asHex(in.Bytes());
 }
 
 auto Log::Imp::asHex(std::string_view in) const noexcept -> void
 {
     if (false == active()) { return; }
 
-    buffer(to_hex(reinterpret_cast<const std::byte*>(in.data()), in.size()));
+    if (auto p = get_data(); p) {
+        internal::LogRecord::AddHex(in, p->record_);
+    }
 }
 
 auto Log::Imp::Assert(const std::source_location& loc, std::string_view message)
@@ -143,7 +147,9 @@ auto Log::Imp::Buffer(const Time in) const noexcept -> void
 {
     if (false == active()) { return; }
 
-    buffer(formatTimestamp(in));
+    if (auto p = get_data(); p) {
+        internal::LogRecord::AddTime(in, p->record_);
+    }
 }
 
 auto Log::Imp::Buffer(const storage::Hash& in) const noexcept -> void
@@ -190,33 +196,9 @@ auto Log::Imp::Buffer(const std::chrono::nanoseconds& in) const noexcept -> void
 {
     if (false == active()) { return; }
 
-    auto value = std::stringstream{};
-    static constexpr auto nanoThreshold = 2us;
-    static constexpr auto microThreshold = 2ms;
-    static constexpr auto milliThreshold = 2s;
-    static constexpr auto threshold = std::chrono::minutes{2};
-    static constexpr auto minThreshold = std::chrono::hours{2};
-    static constexpr auto usRatio = 1000ull;
-    static constexpr auto msRatio = 1000ull * usRatio;
-    static constexpr auto ratio = 1000ull * msRatio;
-    static constexpr auto minRatio = 60ull * ratio;
-    static constexpr auto hourRatio = 60ull * minRatio;
-
-    if (in < nanoThreshold) {
-        value << std::to_string(in.count()) << " nanoseconds";
-    } else if (in < microThreshold) {
-        value << std::to_string(in.count() / usRatio) << " microseconds";
-    } else if (in < milliThreshold) {
-        value << std::to_string(in.count() / msRatio) << " milliseconds";
-    } else if (in < threshold) {
-        value << std::to_string(in.count() / ratio) << " seconds";
-    } else if (in < minThreshold) {
-        value << std::to_string(in.count() / minRatio) << " minutes";
-    } else {
-        value << std::to_string(in.count() / hourRatio) << " hours";
+    if (auto p = get_data(); p) {
+        internal::LogRecord::AddDuration(in, p->record_);
     }
-
-    buffer(value.str());
 }
 
 auto Log::Imp::Buffer(const std::filesystem::path& in) const noexcept -> void
@@ -230,12 +212,9 @@ auto Log::Imp::Buffer(const std::source_location& loc) const noexcept -> void
 {
     if (false == active()) { return; }
 
-    buffer(loc.function_name());
-    buffer(" in ");
-    buffer(loc.file_name());
-    buffer(": ");
-    buffer(std::to_string(loc.line()));
-    buffer(":\n * ");
+    if (auto p = get_data(); p) {
+        internal::LogRecord::AddLocation(loc, p->record_);
+    }
 }
 
 auto Log::Imp::Buffer(const std::string_view in) const noexcept -> void
@@ -249,7 +228,9 @@ auto Log::Imp::buffer(std::string_view text) const noexcept -> void
 {
     if (false == valid(text)) { return; }
 
-    if (auto p = get_data(); p) { p->first.append(text); }
+    if (auto p = get_data(); p) {
+        internal::LogRecord::AddText(text, p->record_);
+    }
 }
 
 auto Log::Imp::Flush() const noexcept -> void
@@ -307,27 +288,42 @@ auto Log::Imp::get_data(internal::LogBuffer& buf) noexcept
 auto Log::Imp::send(const LogAction action, const Console console)
     const noexcept -> void
 {
-    auto& buf = get_buffer();
-    const auto id = buf.ThreadID();
+    using internal::LogRecord;
     const auto terminate = LogAction::terminate == action;
 
-    if (auto p = get_data(buf); p) {
-        auto& [buffer, socket] = *p;
-
-        if (active() || terminate) {
-            socket.SendDeferred([&]() {
-                auto message = network::zeromq::Message{};
-                message.StartBody();
-                message.AddFrame(level_);
-                message.AddFrame(buffer.data(), buffer.size());
-                message.AddFrame(id.data(), id.size());
-                message.AddFrame(action);
-                message.AddFrame(console);
-
-                return message;
-            }());
-            buf.Reset(buffer);
+    if ((false == terminate) && (false == active())) { return; }
+
+    if (auto p = get_data(); p) {
+        auto& record = p->record_;
+        auto& ring = p->ring_;
+
+        if (terminate) {
+            // NOTE a fatal message which could never fit in the ring is
+            // shortened rather than lost
+            LogRecord::Truncate(internal::LogRing::max_record_, record);
+            LogRecord::Finish({level_, action, console}, record);
+
+            // NOTE a fatal message waits for the log thread to make room
+            // instead of being discarded, but not forever since a log thread
+            // which has stopped draining the ring would otherwise prevent the
+            // process from terminating
+            const auto deadline = Clock::now() + terminate_timeout_;
+
+            while (false == ring.TryPush(record)) {
+                if (Clock::now() >= deadline) { std::abort(); }
+
+                logger_->Notify();
+                sleep(1ms);
+            }
+
+            logger_->Notify();
+        } else if (false == LogRecord::Empty(record)) {
+            LogRecord::Finish({level_, action, console}, record);
+            ring.Push(record);
+            logger_->Notify();
         }
+
+        LogRecord::Reset(record);
     }
 
     if (terminate) { wait_for_terminate(); }
@@ -351,7 +347,7 @@ auto Log::Imp::Trace(const std::source_location& loc, std::string_view message)
 
 auto Log::Imp::wait_for_terminate() const noexcept -> void
 {
-    sleep(10s);
+    sleep(terminate_timeout_);
     std::abort();
 }
 }  // namespace opentxs
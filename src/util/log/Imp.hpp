@@ -70,6 +70,7 @@ class Log::Imp final : public internal::Log
 {
 public:
     [[noreturn]] auto Abort() const noexcept -> void;
+    auto Active() const noexcept -> bool final;
     [[noreturn]] auto Assert(
         const std::source_location& loc,
         std::string_view message) const noexcept -> void;
@@ -107,6 +108,8 @@ public:
     ~Imp() final = default;
 
 private:
+    static constexpr auto terminate_timeout_ = std::chrono::seconds{10};
+
     const int level_;
     const std::shared_ptr<internal::Logger> logger_;
 
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <memory>
+#include <utility>
 
 #include "opentxs/network/zeromq/Types.hpp"
 #include "util/log/Logger.hpp"
@@ -35,10 +36,10 @@ auto Log::Shutdown() noexcept -> void
     if (logger) { logger->Stop(); }
 }
 
-auto Log::Start() noexcept -> void
+auto Log::Start(Print print, bool publish) noexcept -> void
 {
     static auto logger = GetLogger();
 
-    if (logger) { logger->Start(); }
+    if (logger) { logger->Start(std::move(print), publish); }
 }
 }  // namespace opentxs::internal
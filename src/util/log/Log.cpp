@@ -15,6 +15,7 @@
 #include "internal/core/Armored.hpp"
 #include "internal/core/String.hpp"
 #include "internal/otx/common/StringXML.hpp"
+#include "internal/util/Log.hpp"
 #include "opentxs/identifier/Account.hpp"
 #include "opentxs/identifier/Notary.hpp"
 #include "opentxs/identifier/Nym.hpp"
@@ -259,56 +260,64 @@ namespace opentxs
 {
 auto LogAbort() noexcept -> Log&
 {
-    static auto logger = Log{std::make_unique<Log::Imp>(-2).release()};
+    static auto logger = Log{
+        std::make_unique<Log::Imp>(internal::Log::abort_).release()};
 
     return logger;
 }
 
 auto LogConsole() noexcept -> Log&
 {
-    static auto logger = Log{std::make_unique<Log::Imp>(0).release()};
+    static auto logger = Log{
+        std::make_unique<Log::Imp>(internal::Log::console_).release()};
 
     return logger;
 }
 
 auto LogDebug() noexcept -> Log&
 {
-    static auto logger = Log{std::make_unique<Log::Imp>(3).release()};
+    static auto logger = Log{
+        std::make_unique<Log::Imp>(internal::Log::debug_).release()};
 
     return logger;
 }
 
 auto LogDetail() noexcept -> Log&
 {
-    static auto logger = Log{std::make_unique<Log::Imp>(1).release()};
+    static auto logger = Log{
+        std::make_unique<Log::Imp>(internal::Log::detail_).release()};
 
     return logger;
 }
 
 auto LogError() noexcept -> Log&
 {
-    static auto logger = Log{std::make_unique<Log::Imp>(-1).release()};
+    static auto logger = Log{
+        std::make_unique<Log::Imp>(internal::Log::error_).release()};
 
     return logger;
 }
 
 auto LogInsane() noexcept -> Log&
 {
-    static auto logger = Log{std::make_unique<Log::Imp>(5).release()};
+    static auto logger = Log{
+        std::make_unique<Log::Imp>(internal::Log::insane_).release()};
 
     return logger;
 }
 
 auto LogTrace() noexcept -> Log&
 {
-    static auto logger = Log{std::make_unique<Log::Imp>(4).release()};
+    static auto logger = Log{
+        std::make_unique<Log::Imp>(internal::Log::trace_).release()};
 
     return logger;
 }
 
 auto LogVerbose() noexcept -> Log&
 {
-    static auto logger = Log{std::make_unique<Log::Imp>(2).release()};
+    static auto logger = Log{
+        std::make_unique<Log::Imp>(internal::Log::verbose_).release()};
 
     return logger;
 }
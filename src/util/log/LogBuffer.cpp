@@ -6,7 +6,6 @@
 #include "util/log/LogBuffer.hpp"  // IWYU pragma: associated
 
 #include <memory>
-#include <sstream>  // IWYU pragma: keep
 #include <thread>
 #include <tuple>
 
@@ -16,12 +15,6 @@ LogBuffer::LogBuffer(
     std::thread::id id,
     std::pair<int, std::shared_ptr<Source>> data) noexcept
     : id_(id)
-    , hex_id_([&] {
-        auto buf = std::stringstream{};
-        buf << std::hex << id_;
-
-        return buf.str();
-    }())
     , logger_(GetLogger())
     , session_counter_(data.first)
     , data_(std::move(data.second))
@@ -54,21 +47,6 @@ auto LogBuffer::Refresh() noexcept -> std::shared_ptr<Source>
     return Get();
 }
 
-auto LogBuffer::Reset(std::string& buf) const noexcept -> void
-{
-    Reset(id_, buf);
-}
-
-auto LogBuffer::Reset(std::thread::id id, std::string& buf) noexcept -> void
-{
-    buf.clear();
-}
-
-auto LogBuffer::ThreadID() const noexcept -> std::string_view
-{
-    return hex_id_;
-}
-
 LogBuffer::~LogBuffer()
 {
     auto& logger = *logger_;
@@ -6,11 +6,9 @@
 #pragma once
 
 #include <memory>
-#include <string_view>
 #include <thread>
 #include <utility>
 
-#include "opentxs/util/Container.hpp"
 #include "util/log/Logger.hpp"
 
 namespace opentxs::internal
@@ -20,11 +18,6 @@ class LogBuffer
 public:
     using Source = Logger::Source;
 
-    static auto Reset(std::thread::id id, std::string& buf) noexcept -> void;
-
-    auto Reset(std::string& buf) const noexcept -> void;
-    auto ThreadID() const noexcept -> std::string_view;
-
     auto Get() noexcept -> std::shared_ptr<Source>;
     auto Refresh() noexcept -> std::shared_ptr<Source>;
 
@@ -38,7 +31,6 @@ public:
 
 private:
     const std::thread::id id_;
-    const CString hex_id_;
     const std::shared_ptr<internal::Logger> logger_;
     int session_counter_;
     std::weak_ptr<Source> data_;
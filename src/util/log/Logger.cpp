@@ -5,17 +5,27 @@
 
 #include "util/log/Logger.hpp"  // IWYU pragma: associated
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <iterator>
 #include <memory>
+#include <optional>
+#include <sstream>
 
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "internal/util/Log.hpp"
+#include "internal/util/Mutex.hpp"
+#include "internal/util/Thread.hpp"
+#include "opentxs/Time.hpp"
 #include "opentxs/api/Context.internal.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/network/zeromq/socket/SocketType.hpp"
 #include "opentxs/network/zeromq/socket/Types.hpp"
-#include "util/log/LogBuffer.hpp"
+#include "util/log/Record.hpp"
 
 namespace opentxs
 {
@@ -29,50 +39,161 @@ auto GetLogger() noexcept -> std::shared_ptr<internal::Logger>
 
 namespace opentxs::internal
 {
+using namespace std::literals;
+
+Logger::Source::Source(std::thread::id id) noexcept
+    : thread_([&] {
+        auto buf = std::stringstream{};
+        buf << std::hex << id;
+
+        return buf.str();
+    }())
+    , record_()
+    , ring_()
+{
+    LogRecord::Reset(record_);
+}
+
+auto Logger::drain(network::zeromq::socket::Raw* socket) noexcept -> void
+{
+    const auto sources = [this] {
+        auto out = Vector<std::shared_ptr<Source>>{};
+        auto handle = data_.lock();
+        auto& [disabled, session, map, retired] = *handle;
+        out.reserve(map.size() + retired.size());
+
+        for (const auto& [id, source] : map) { out.emplace_back(source); }
+
+        // NOTE the threads which owned retired sources have exited so they
+        // will be empty once this pass is complete
+        std::move(retired.begin(), retired.end(), std::back_inserter(out));
+        retired.clear();
+
+        return out;
+    }();
+    auto record = std::string{};
+    auto text = std::string{};
+
+    for (const auto& source : sources) {
+        auto& ring = source->ring_;
+
+        while (ring.Pop(record)) { send(socket, *source, record, text); }
+
+        if (const auto dropped = ring.Dropped(); 0u < dropped) {
+            LogRecord::Reset(record);
+            LogRecord::AddText(
+                "discarded " + std::to_string(dropped) +
+                    " log messages because the log thread fell behind",
+                record);
+            LogRecord::Finish({-1, LogAction::flush, Console::err}, record);
+            send(socket, *source, record, text);
+        }
+    }
+}
+
+auto Logger::Notify() noexcept -> void
+{
+    // NOTE pairs with the fence in run(). Either this thread observes that
+    // the log thread has cleared the flag, or the log thread observes the
+    // record which was just pushed, so a relaxed load is enough to skip the
+    // exchange and the wake up while the log thread is already pending.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (pending_.load(std::memory_order_relaxed)) { return; }
+
+    if (false == pending_.exchange(true)) { pending_.notify_one(); }
+}
+
 auto Logger::Register(const std::thread::id id) noexcept
     -> std::pair<int, std::shared_ptr<Source>>
 {
     auto handle = data_.lock();
-    auto& [disabled, session, map] = *handle;
+    auto& [disabled, session, map, retired] = *handle;
 
     if (disabled) {
 
         return std::make_pair(session, nullptr);
     } else if (auto i = map.find(id); map.end() == i) {
-        auto weak = get_zeromq();
+        auto [it, rc] = map.try_emplace(id, std::make_shared<Source>(id));
 
-        if (auto zmq = weak.lock(); zmq) {
-            using enum network::zeromq::socket::Type;
-            auto [it, rc] = map.try_emplace(
-                id,
-                std::make_shared<Source>(
-                    std::string{}, zmq->Internal().RawSocket(Push)));
+        assert(rc);
+        assert(it->second);
 
-            assert(rc);
+        return std::make_pair(session, it->second);
+    } else {
 
-            auto& source = it->second;
+        return std::make_pair(session, i->second);
+    }
+}
 
-            assert(source);
+auto Logger::run() noexcept -> void
+{
+    SetThisThreadsName("Logger");
+    // NOTE records are written by this thread and only forwarded over zeromq
+    // if they are published
+    auto zmq = publish_ ? get_zeromq().lock() : nullptr;
+    auto socket = std::optional<network::zeromq::socket::Raw>{};
 
-            auto& [buffer, socket] = *source;
+    if (zmq) {
+        using enum network::zeromq::socket::Type;
+        auto& push = socket.emplace(zmq->Internal().RawSocket(Push));
+        auto rc = push.SetOutgoingHWM(0);
 
-            LogBuffer::Reset(id, buffer);
-            rc = socket.SetOutgoingHWM(0);
+        assert(rc);
 
-            assert(rc);
+        rc = push.Connect(internal::Log::Endpoint());
 
-            rc = socket.Connect(internal::Log::Endpoint());
+        assert(rc);
+    }
 
-            assert(rc);
+    auto* const publish = socket.has_value() ? &(*socket) : nullptr;
 
-            return std::make_pair(session, source);
-        } else {
+    while (running_.load()) {
+        pending_.wait(false);
+        pending_.exchange(false);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        drain(publish);
+    }
 
-            return std::make_pair(session, nullptr);
+    drain(publish);
+}
+
+auto Logger::send(
+    network::zeromq::socket::Raw* socket,
+    const Source& source,
+    ReadView record,
+    std::string& text) noexcept -> void
+{
+    const auto header = LogRecord::Format(record, text);
+
+    if (false == header.has_value()) { return; }
+
+    const auto& [level, action, console] = *header;
+    const auto& thread = source.thread_;
+
+    if (false == text.empty()) {
+        print_(level, console, text, thread);
+
+        if (nullptr != socket) {
+            socket->SendDeferred([&]() {
+                auto message = network::zeromq::Message{};
+                message.StartBody();
+                message.AddFrame(level);
+                message.AddFrame(text.data(), text.size());
+                message.AddFrame(thread.data(), thread.size());
+                message.AddFrame(action);
+                message.AddFrame(console);
+
+                return message;
+            }());
         }
-    } else {
+    }
 
-        return std::make_pair(session, i->second);
+    if (LogAction::terminate == action) {
+        // NOTE give the subscribers a chance to receive the final message
+        if (nullptr != socket) { sleep(1s); }
+
+        std::abort();
     }
 }
 
@@ -81,26 +202,57 @@ auto Logger::Session() const noexcept -> int
     return data_.lock_shared()->session_counter_;
 }
 
-auto Logger::Start() noexcept -> void
+auto Logger::Start(Log::Print print, bool publish) noexcept -> void
 {
-    auto handle = data_.lock();
-    auto& [disabled, session, map] = *handle;
-    disabled = false;
-    ++session;
+    {
+        auto handle = data_.lock();
+        auto& [disabled, session, map, retired] = *handle;
+        disabled = false;
+        ++session;
+    }
+
+    const auto lock = Lock{thread_lock_};
+
+    if (thread_.joinable()) { return; }
+
+    print_ = std::move(print);
+    publish_ = publish;
+    running_.store(true);
+    thread_ = std::thread{&Logger::run, this};
 }
 
 auto Logger::Stop() noexcept -> void
 {
-    auto handle = data_.lock();
-    auto& [disabled, session, map] = *handle;
-    disabled = true;
-    map.clear();
+    {
+        auto handle = data_.lock();
+        auto& [disabled, session, map, retired] = *handle;
+        disabled = true;
+
+        for (auto& [id, source] : map) { retired.emplace_back(source); }
+
+        map.clear();
+    }
+
+    const auto lock = Lock{thread_lock_};
+
+    if (false == thread_.joinable()) { return; }
+
+    running_.store(false);
+    pending_.store(true);
+    pending_.notify_one();
+    thread_.join();
 }
 
 auto Logger::Unregister(const std::thread::id id) noexcept -> void
 {
     auto handle = data_.lock();
-    auto& [disabled, session, map] = *handle;
-    map.erase(id);
+    auto& [disabled, session, map, retired] = *handle;
+
+    if (auto i = map.find(id); map.end() != i) {
+        retired.emplace_back(std::move(i->second));
+        map.erase(i);
+    }
 }
+
+Logger::~Logger() { Stop(); }
 }  // namespace opentxs::internal
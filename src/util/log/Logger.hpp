@@ -8,12 +8,16 @@
 #include <cs_shared_guarded.h>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <string>
 #include <thread>
 #include <utility>
 
-#include "internal/network/zeromq/socket/Raw.hpp"
+#include "internal/util/Log.hpp"
+#include "opentxs/Types.hpp"
 #include "opentxs/util/Container.hpp"
+#include "util/log/Ring.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs
@@ -22,6 +26,17 @@ namespace internal
 {
 class Logger;
 }  // namespace internal
+
+namespace network
+{
+namespace zeromq
+{
+namespace socket
+{
+class Raw;
+}  // namespace socket
+}  // namespace zeromq
+}  // namespace network
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
@@ -36,25 +51,62 @@ namespace opentxs::internal
 class Logger
 {
 public:
-    using Source = std::pair<std::string, network::zeromq::socket::Raw>;
+    struct Source {
+        const CString thread_;
+        // NOTE the record under construction is only accessed by the thread
+        // which owns this source
+        std::string record_;
+        LogRing ring_;
+
+        Source(std::thread::id id) noexcept;
+    };
 
     std::atomic_int verbosity_{-1};
 
     auto Session() const noexcept -> int;
 
+    /// Wakes the log thread after a record has been pushed
+    auto Notify() noexcept -> void;
     auto Register(const std::thread::id id) noexcept
         -> std::pair<int, std::shared_ptr<Source>>;
-    auto Start() noexcept -> void;
+    auto Start(Log::Print print, bool publish) noexcept -> void;
     auto Stop() noexcept -> void;
     auto Unregister(const std::thread::id id) noexcept -> void;
 
+    Logger() = default;
+    Logger(const Logger&) = delete;
+    Logger(Logger&&) = delete;
+    auto operator=(const Logger&) -> Logger& = delete;
+    auto operator=(Logger&&) -> Logger& = delete;
+
+    ~Logger();
+
 private:
     struct Data {
         bool disabled_{true};
         int session_counter_{-1};
         Map<std::thread::id, std::shared_ptr<Source>> map_{};
+        // NOTE sources belonging to exited threads which may still contain
+        // records the log thread has not delivered
+        Vector<std::shared_ptr<Source>> retired_{};
     };
 
     libguarded::shared_guarded<Data, std::shared_mutex> data_{};
+    std::atomic_bool pending_{false};
+    std::atomic_bool running_{false};
+    std::mutex thread_lock_{};
+    // NOTE only modified by Start while the log thread is not running
+    Log::Print print_{};
+    bool publish_{false};
+    std::thread thread_{};
+
+    // NOTE socket is null unless records are published
+    auto drain(network::zeromq::socket::Raw* socket) noexcept -> void;
+    auto run() noexcept -> void;
+    auto send(
+        network::zeromq::socket::Raw* socket,
+        const Source& source,
+        ReadView record,
+        std::string& text) noexcept -> void;
 };
 }  // namespace opentxs::internal
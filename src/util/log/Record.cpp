@@ -0,0 +1,274 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "util/log/Record.hpp"  // IWYU pragma: associated
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "internal/otx/common/util/Common.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace opentxs::internal
+{
+using namespace std::literals;
+
+auto LogRecord::add_bytes(Field type, ReadView bytes, std::string& record)
+    -> void
+{
+    const auto size = static_cast<std::uint32_t>(bytes.size());
+    record.push_back(static_cast<char>(type));
+    record.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    record.append(bytes);
+}
+
+auto LogRecord::AddDuration(
+    std::chrono::nanoseconds value,
+    std::string& record) noexcept -> void
+{
+    const auto count = value.count();
+    record.push_back(static_cast<char>(Field::duration));
+    record.append(reinterpret_cast<const char*>(&count), sizeof(count));
+}
+
+auto LogRecord::AddHex(ReadView bytes, std::string& record) noexcept -> void
+{
+    add_bytes(Field::hex, bytes, record);
+}
+
+auto LogRecord::AddLocation(
+    const std::source_location& loc,
+    std::string& record) noexcept -> void
+{
+    // NOTE the strings returned by std::source_location have static storage
+    // duration so only the pointers need to be copied
+    const auto* function = loc.function_name();
+    const auto* file = loc.file_name();
+    const auto line = loc.line();
+    record.push_back(static_cast<char>(Field::location));
+    record.append(reinterpret_cast<const char*>(&function), sizeof(function));
+    record.append(reinterpret_cast<const char*>(&file), sizeof(file));
+    record.append(reinterpret_cast<const char*>(&line), sizeof(line));
+}
+
+auto LogRecord::AddText(ReadView text, std::string& record) noexcept -> void
+{
+    add_bytes(Field::text, text, record);
+}
+
+auto LogRecord::AddTime(Time value, std::string& record) noexcept -> void
+{
+    const auto count = value.time_since_epoch().count();
+    record.push_back(static_cast<char>(Field::time));
+    record.append(reinterpret_cast<const char*>(&count), sizeof(count));
+}
+
+auto LogRecord::Empty(const std::string& record) noexcept -> bool
+{
+    return record.size() <= sizeof(Header);
+}
+
+auto LogRecord::Finish(const Header& header, std::string& record) noexcept
+    -> void
+{
+    std::memcpy(record.data(), &header, sizeof(header));
+}
+
+auto LogRecord::Format(ReadView record, std::string& text) noexcept
+    -> std::optional<Header>
+{
+    text.clear();
+
+    try {
+        const auto header = take<Header>(record);
+
+        while (false == record.empty()) {
+            switch (take<Field>(record)) {
+                case Field::text: {
+                    text.append(take(record, take<std::uint32_t>(record)));
+                } break;
+                case Field::hex: {
+                    const auto bytes =
+                        take(record, take<std::uint32_t>(record));
+                    text.append(to_hex(
+                        reinterpret_cast<const std::byte*>(bytes.data()),
+                        bytes.size()));
+                } break;
+                case Field::location: {
+                    const auto* function = take<const char*>(record);
+                    const auto* file = take<const char*>(record);
+                    const auto line = take<std::uint_least32_t>(record);
+                    text.append(function);
+                    text.append(" in "sv);
+                    text.append(file);
+                    text.append(": "sv);
+                    text.append(std::to_string(line));
+                    text.append(":\n * "sv);
+                } break;
+                case Field::duration: {
+                    const auto count =
+                        take<std::chrono::nanoseconds::rep>(record);
+                    text.append(
+                        format_duration(std::chrono::nanoseconds{count}));
+                } break;
+                case Field::time: {
+                    const auto count = take<Time::rep>(record);
+                    text.append(formatTimestamp(Time{Time::duration{count}}));
+                } break;
+                default: {
+
+                    throw std::runtime_error{"unknown field type"};
+                }
+            }
+        }
+
+        return header;
+    } catch (...) {
+        text.clear();
+
+        return std::nullopt;
+    }
+}
+
+auto LogRecord::format_duration(std::chrono::nanoseconds in) -> std::string
+{
+    auto value = std::stringstream{};
+    static constexpr auto nanoThreshold = 2us;
+    static constexpr auto microThreshold = 2ms;
+    static constexpr auto milliThreshold = 2s;
+    static constexpr auto threshold = std::chrono::minutes{2};
+    static constexpr auto minThreshold = std::chrono::hours{2};
+    static constexpr auto usRatio = 1000ull;
+    static constexpr auto msRatio = 1000ull * usRatio;
+    static constexpr auto ratio = 1000ull * msRatio;
+    static constexpr auto minRatio = 60ull * ratio;
+    static constexpr auto hourRatio = 60ull * minRatio;
+
+    if (in < nanoThreshold) {
+        value << std::to_string(in.count()) << " nanoseconds";
+    } else if (in < microThreshold) {
+        value << std::to_string(in.count() / usRatio) << " microseconds";
+    } else if (in < milliThreshold) {
+        value << std::to_string(in.count() / msRatio) << " milliseconds";
+    } else if (in < threshold) {
+        value << std::to_string(in.count() / ratio) << " seconds";
+    } else if (in < minThreshold) {
+        value << std::to_string(in.count() / minRatio) << " minutes";
+    } else {
+        value << std::to_string(in.count() / hourRatio) << " hours";
+    }
+
+    return value.str();
+}
+
+auto LogRecord::Reset(std::string& record) noexcept -> void
+{
+    record.assign(sizeof(Header), '\0');
+}
+
+auto LogRecord::Truncate(std::size_t limit, std::string& record) noexcept
+    -> void
+{
+    static constexpr auto marker = " [truncated]"sv;
+    static constexpr auto prefix = sizeof(Field) + sizeof(std::uint32_t);
+
+    if (record.size() <= limit) { return; }
+
+    assert(limit >= sizeof(Header) + prefix + marker.size());
+
+    const auto target = limit - prefix - marker.size();
+    auto remaining = ReadView{record};
+    auto end = sizeof(Header);
+
+    try {
+        remaining.remove_prefix(sizeof(Header));
+
+        while (false == remaining.empty()) {
+            const auto start = record.size() - remaining.size();
+            const auto type = take<Field>(remaining);
+            const auto sized = (Field::text == type) || (Field::hex == type);
+
+            switch (type) {
+                case Field::text:
+                case Field::hex: {
+                    take(remaining, take<std::uint32_t>(remaining));
+                } break;
+                case Field::location: {
+                    take(
+                        remaining,
+                        2_uz * sizeof(const char*) +
+                            sizeof(std::uint_least32_t));
+                } break;
+                case Field::duration: {
+                    take(remaining, sizeof(std::chrono::nanoseconds::rep));
+                } break;
+                case Field::time: {
+                    take(remaining, sizeof(Time::rep));
+                } break;
+                default: {
+
+                    throw std::runtime_error{"unknown field type"};
+                }
+            }
+
+            if (const auto stop = record.size() - remaining.size();
+                stop <= target) {
+                end = stop;
+
+                continue;
+            }
+
+            // NOTE the field which crosses the limit is kept in part if it is
+            // text or hex, and dropped otherwise
+            if (const auto body = start + prefix; sized && (body < target)) {
+                const auto size = static_cast<std::uint32_t>(target - body);
+                std::memcpy(
+                    record.data() + start + sizeof(Field),
+                    &size,
+                    sizeof(size));
+                end = target;
+            }
+
+            break;
+        }
+    } catch (...) {
+        // NOTE a malformed field ends the part of the record which is kept
+    }
+
+    record.resize(end);
+    AddText(marker, record);
+}
+
+template <typename T>
+auto LogRecord::take(ReadView& record) noexcept(false) -> T
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    const auto bytes = take(record, sizeof(T));
+    auto out = T{};
+    std::memcpy(&out, bytes.data(), sizeof(out));
+
+    return out;
+}
+
+auto LogRecord::take(ReadView& record, std::size_t bytes) noexcept(false)
+    -> ReadView
+{
+    if (record.size() < bytes) {
+
+        throw std::out_of_range{"truncated log record"};
+    }
+
+    const auto out = record.substr(0, bytes);
+    record.remove_prefix(bytes);
+
+    return out;
+}
+}  // namespace opentxs::internal
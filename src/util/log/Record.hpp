@@ -0,0 +1,71 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <source_location>
+#include <string>
+
+#include "internal/util/Log.hpp"
+#include "opentxs/Time.hpp"
+#include "opentxs/Types.hpp"
+
+namespace opentxs::internal
+{
+/// Binary encoding of a single log message
+///
+/// The emitting thread appends typed fields and the log thread converts them
+/// to text, so values which are cheap to copy but expensive to print are
+/// formatted off the hot path.
+class LogRecord
+{
+public:
+    struct Header {
+        int level_{};
+        LogAction action_{};
+        Console console_{};
+    };
+
+    static auto AddDuration(
+        std::chrono::nanoseconds value,
+        std::string& record) noexcept -> void;
+    static auto AddHex(ReadView bytes, std::string& record) noexcept -> void;
+    static auto AddLocation(
+        const std::source_location& loc,
+        std::string& record) noexcept -> void;
+    static auto AddText(ReadView text, std::string& record) noexcept -> void;
+    static auto AddTime(Time value, std::string& record) noexcept -> void;
+    static auto Empty(const std::string& record) noexcept -> bool;
+    static auto Finish(const Header& header, std::string& record) noexcept
+        -> void;
+    /// Converts an encoded record to text
+    ///
+    /// Returns nullopt if the record is malformed
+    static auto Format(ReadView record, std::string& text) noexcept
+        -> std::optional<Header>;
+    static auto Reset(std::string& record) noexcept -> void;
+    /// Shortens an encoded record to at most limit bytes
+    ///
+    /// Fields which do not fit are cut off and replaced by a marker
+    static auto Truncate(std::size_t limit, std::string& record) noexcept
+        -> void;
+
+private:
+    enum class Field : std::uint8_t { text, hex, location, duration, time };
+
+    static auto add_bytes(Field type, ReadView bytes, std::string& record)
+        -> void;
+    static auto format_duration(std::chrono::nanoseconds value)
+        -> std::string;
+    template <typename T>
+    static auto take(ReadView& record) noexcept(false) -> T;
+    static auto take(ReadView& record, std::size_t bytes) noexcept(false)
+        -> ReadView;
+};
+}  // namespace opentxs::internal
@@ -0,0 +1,83 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "util/log/Ring.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cstring>
+
+namespace opentxs::internal
+{
+LogRing::LogRing() noexcept
+    : data_(capacity_)
+    , read_(0)
+    , write_(0)
+    , dropped_(0)
+{
+}
+
+auto LogRing::copy_in(std::size_t position, ReadView bytes) noexcept -> void
+{
+    const auto offset = position & (capacity_ - 1u);
+    const auto first = std::min(bytes.size(), capacity_ - offset);
+    std::memcpy(data_.data() + offset, bytes.data(), first);
+    std::memcpy(data_.data(), bytes.data() + first, bytes.size() - first);
+}
+
+auto LogRing::copy_out(std::size_t position, std::span<char> bytes)
+    const noexcept -> void
+{
+    const auto offset = position & (capacity_ - 1u);
+    const auto first = std::min(bytes.size(), capacity_ - offset);
+    std::memcpy(bytes.data(), data_.data() + offset, first);
+    std::memcpy(bytes.data() + first, data_.data(), bytes.size() - first);
+}
+
+auto LogRing::Dropped() noexcept -> std::size_t
+{
+    return dropped_.exchange(0, std::memory_order_relaxed);
+}
+
+auto LogRing::Pop(std::string& out) noexcept -> bool
+{
+    const auto read = read_.load(std::memory_order_relaxed);
+    const auto write = write_.load(std::memory_order_acquire);
+
+    if (read == write) { return false; }
+
+    auto size = Size{};
+    copy_out(read, {reinterpret_cast<char*>(&size), sizeof(size)});
+    out.resize(size);
+    copy_out(read + sizeof(size), out);
+    read_.store(read + sizeof(size) + size, std::memory_order_release);
+
+    return true;
+}
+
+auto LogRing::Push(ReadView record) noexcept -> bool
+{
+    if (TryPush(record)) { return true; }
+
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+
+    return false;
+}
+
+auto LogRing::TryPush(ReadView record) noexcept -> bool
+{
+    const auto required = sizeof(Size) + record.size();
+    const auto write = write_.load(std::memory_order_relaxed);
+    const auto read = read_.load(std::memory_order_acquire);
+
+    if ((capacity_ - (write - read)) < required) { return false; }
+
+    const auto size = static_cast<Size>(record.size());
+    copy_in(write, {reinterpret_cast<const char*>(&size), sizeof(size)});
+    copy_in(write + sizeof(size), record);
+    write_.store(write + required, std::memory_order_release);
+
+    return true;
+}
+}  // namespace opentxs::internal
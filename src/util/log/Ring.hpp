@@ -0,0 +1,65 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::internal
+{
+/// Fixed size queue of encoded log records owned by a single thread
+///
+/// Only the owning thread pushes records and only the log thread pops them so
+/// neither side takes a lock. A record which does not fit in the free space is
+/// discarded and counted rather than blocking the thread which emitted it.
+class LogRing
+{
+public:
+    using Size = std::uint32_t;
+
+    static constexpr auto capacity_ = std::size_t{256u * 1024u};
+    static constexpr auto max_record_ = capacity_ - sizeof(Size);
+
+    /// Returns the number of records discarded since the previous call
+    auto Dropped() noexcept -> std::size_t;
+    /// Moves the oldest record into out
+    auto Pop(std::string& out) noexcept -> bool;
+    /// Appends a record or counts it as dropped if there is not enough space
+    auto Push(ReadView record) noexcept -> bool;
+    /// Appends a record if there is enough space
+    auto TryPush(ReadView record) noexcept -> bool;
+
+    LogRing() noexcept;
+    LogRing(const LogRing&) = delete;
+    LogRing(LogRing&&) = delete;
+    auto operator=(const LogRing&) -> LogRing& = delete;
+    auto operator=(LogRing&&) -> LogRing& = delete;
+
+    ~LogRing() = default;
+
+private:
+    static constexpr auto cache_line_ = std::size_t{64u};
+
+    static_assert(0u == (capacity_ & (capacity_ - 1u)));
+
+    UnallocatedVector<char> data_;
+    // NOTE positions increase monotonically and are reduced modulo capacity_
+    // only when the buffer is accessed
+    alignas(cache_line_) std::atomic<std::size_t> read_;
+    alignas(cache_line_) std::atomic<std::size_t> write_;
+    alignas(cache_line_) std::atomic<std::size_t> dropped_;
+
+    auto copy_in(std::size_t position, ReadView bytes) noexcept -> void;
+    auto copy_out(std::size_t position, std::span<char> bytes) const noexcept
+        -> void;
+};
+}  // namespace opentxs::internal
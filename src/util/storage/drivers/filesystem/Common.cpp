@@ -91,6 +91,18 @@ auto Common::init(Data& data) noexcept(false) -> void
     }
 }
 
+auto Common::Exists(const Hash& key, Bucket bucket) const noexcept -> bool
+{
+    auto handle = data_.lock_shared();
+    const auto& data = *handle;
+    auto notUsed = fs::path{};
+    const auto file =
+        calculate_path(data, std::visit(EncodedView{}, key), bucket, notUsed);
+    auto ec = std::error_code{};
+
+    return fs::exists(file, ec);
+}
+
 auto Common::Load(
     const Log& logger,
     const Hash& key,
@@ -43,6 +43,7 @@ namespace opentxs::storage::driver::filesystem
 class Common : public storage::implementation::Driver
 {
 public:
+    auto Exists(const Hash& key, Bucket bucket) const noexcept -> bool final;
     auto Load(const Log& logger, const Hash& key, Search order, Writer& value)
         const noexcept -> bool final;
     auto LoadRoot() const noexcept -> Hash final;
@@ -129,6 +129,14 @@ auto LMDB::EmptyBucket(Bucket bucket) const noexcept -> bool
     return data.lmdb_.Delete(data.get_table(bucket));
 }
 
+auto LMDB::Exists(const Hash& key, Bucket bucket) const noexcept -> bool
+{
+    auto handle = data_.lock_shared();
+    const auto& data = *handle;
+
+    return data.lmdb_.Exists(data.get_table(bucket), unencoded_view(key));
+}
+
 auto LMDB::Load(const Log& logger, const Hash& key, Search order, Writer& out)
     const noexcept -> bool
 {
@@ -44,6 +44,7 @@ class LMDB final : public virtual storage::implementation::Driver
 {
 public:
     auto Description() const noexcept -> std::string_view final;
+    auto Exists(const Hash& key, Bucket bucket) const noexcept -> bool final;
     auto Load(const Log& logger, const Hash& key, Search order, Writer& value)
         const noexcept -> bool final;
     auto LoadRoot() const noexcept -> Hash final;
@@ -108,6 +108,11 @@ auto MemDB::EmptyBucket(Bucket bucket) const noexcept -> bool
     return true;
 }
 
+auto MemDB::Exists(const Hash& key, Bucket bucket) const noexcept -> bool
+{
+    return data_.lock_shared()->get_bucket(bucket).contains(key);
+}
+
 auto MemDB::Load(const Log&, const Hash& key, Search order, Writer& value)
     const noexcept -> bool
 {
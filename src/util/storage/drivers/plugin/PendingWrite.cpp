@@ -6,6 +6,7 @@
 #include "util/storage/drivers/plugin/PendingWrite.hpp"  // IWYU pragma: associated
 
 #include <string_view>
+#include <utility>
 
 #include "internal/util/P0330.hpp"
 #include "opentxs/core/FixedByteArray.hpp"
@@ -15,7 +16,8 @@
 namespace opentxs::storage::driver
 {
 PendingWrite::PendingWrite() noexcept
-    : key_()
+    : index_()
+    , key_()
     , data_()
     , view_()
 {
@@ -23,6 +25,12 @@ PendingWrite::PendingWrite() noexcept
 
 auto PendingWrite::Add(const Hash& key, ReadView data) noexcept -> void
 {
+    // NOTE keys are content hashes so an object which is already queued does
+    // not need to be copied again
+    const auto [_, added] = index_.try_emplace(key, key_.size());
+
+    if (false == added) { return; }
+
     key_.emplace_back(key);
     const auto& value = data_.emplace_back(data);
     view_.emplace_back(value);
@@ -30,6 +38,7 @@ auto PendingWrite::Add(const Hash& key, ReadView data) noexcept -> void
 
 auto PendingWrite::Add(const Hash& key) noexcept -> Writer
 {
+    index_.insert_or_assign(key, key_.size());
     key_.emplace_back(key);
     auto& value = data_.emplace_back();
     view_.emplace_back(value);
@@ -42,6 +51,18 @@ auto PendingWrite::Data() const noexcept -> std::span<const ReadView>
     return view_;
 }
 
+auto PendingWrite::Find(const Hash& key) const noexcept
+    -> std::optional<ReadView>
+{
+    if (const auto i = index_.find(key); index_.end() != i) {
+
+        return data_[i->second];
+    } else {
+
+        return std::nullopt;
+    }
+}
+
 auto PendingWrite::Keys() const noexcept -> std::span<const Hash>
 {
     return key_;
@@ -54,6 +75,7 @@ auto PendingWrite::RecalculateViews() noexcept -> void
 
 auto PendingWrite::Reset() noexcept -> void
 {
+    index_.clear();
     key_.clear();
     data_.clear();
     view_.clear();
@@ -62,6 +84,7 @@ auto PendingWrite::Reset() noexcept -> void
 auto PendingWrite::swap(PendingWrite& rhs) noexcept -> void
 {
     using std::swap;
+    swap(index_, rhs.index_);
     swap(key_, rhs.key_);
     swap(data_, rhs.data_);
     swap(view_, rhs.view_);
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <span>
 
 #include "opentxs/Types.hpp"
@@ -26,6 +27,7 @@ class PendingWrite
 {
 public:
     auto Data() const noexcept -> std::span<const ReadView>;
+    auto Find(const Hash& key) const noexcept -> std::optional<ReadView>;
     auto Keys() const noexcept -> std::span<const Hash>;
     auto size() const noexcept -> std::size_t;
 
@@ -42,6 +44,7 @@ public:
     auto operator=(PendingWrite&&) -> PendingWrite& = delete;
 
 private:
+    Map<Hash, std::size_t> index_;
     Vector<Hash> key_;
     Vector<CString> data_;
     Vector<ReadView> view_;
@@ -6,11 +6,13 @@
 #include "util/storage/drivers/plugin/Plugin.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 #include <variant>
@@ -25,6 +27,7 @@
 #include "opentxs/crypto/HashType.hpp"  // IWYU pragma: keep
 #include "opentxs/crypto/Types.hpp"
 #include "opentxs/storage/Types.internal.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Writer.hpp"  // IWYU pragma: keep
@@ -41,10 +44,22 @@ auto StoragePlugin(
     const std::atomic<storage::Bucket>& primaryBucket,
     const storage::Config& config) noexcept
     -> std::shared_ptr<storage::driver::Plugin>
+{
+    return StoragePlugin(crypto, factory, primaryBucket, config, nullptr);
+}
+
+auto StoragePlugin(
+    const api::Crypto& crypto,
+    const api::session::Factory& factory,
+    const std::atomic<storage::Bucket>& primaryBucket,
+    const storage::Config& config,
+    std::unique_ptr<storage::Driver> primary) noexcept
+    -> std::shared_ptr<storage::driver::Plugin>
 {
     using ReturnType = opentxs::storage::driver::implementation::Plugin;
 
-    return std::make_shared<ReturnType>(crypto, factory, primaryBucket, config);
+    return std::make_shared<ReturnType>(
+        crypto, factory, primaryBucket, config, std::move(primary));
 }
 }  // namespace opentxs::factory
 
@@ -56,17 +71,19 @@ Plugin::Plugin(
     const api::Crypto& crypto,
     const api::session::Factory& factory,
     const std::atomic<Bucket>& primaryBucket,
-    const storage::Config& config)
+    const storage::Config& config,
+    std::unique_ptr<storage::Driver> primary)
     : crypto_(crypto)
     , factory_(factory)
     , primary_bucket_(primaryBucket)
     , config_(config)
-    , primary_driver_()
+    , primary_driver_(std::move(primary))
     , backup_drivers_()
     , drivers_()
     , null_()
     , root_(NullHash{})
     , write_()
+    , gc_()
     , init_promise_()
     , init_(init_promise_.get_future())
 {
@@ -112,19 +129,82 @@ auto Plugin::Cleanup() -> void { Cleanup_Plugin(); }
 
 auto Plugin::Cleanup_Plugin() -> void {}
 
-auto Plugin::DoGC(const tree::GCParams& params) noexcept -> bool
+auto Plugin::DoGC(tree::GCParams& params, std::size_t limit) noexcept -> bool
 {
-    const auto& log = LogTrace();
-    const auto from = params.from_;
-    const auto to = next(from);
-    log()("migrating all active objects from ")(print(from))(" to ")(print(to))
-        .Flush();
+    try {
+        const auto& log = LogTrace();
+        const auto from = params.from_;
+        const auto to = next(from);
 
-    if (migrate(params.root_, from, to, nullptr, false)) {
+        // NOTE objects reachable from the root being collected must be present
+        // in the drivers before they can be migrated
+        if (false == Flush()) {
+            throw std::runtime_error{"failed to commit pending writes"};
+        }
+
+        auto handle = gc_.lock();
+        auto& state = *handle;
+        auto& objects = state.objects_;
+
+        // NOTE the object list for a given root is always produced in the same
+        // order so a persisted position remains valid after a restart
+        if (state.root_ != params.root_) {
+            log()("enumerating objects reachable from ")(params.root_).Flush();
+            objects = list_objects(params.root_);
+            state.root_ = params.root_;
+        }
+
+        const auto total = objects.size();
+        const auto start =
+            std::min(static_cast<std::size_t>(params.position_), total);
+        const auto stop = start + std::min(limit, total - start);
+        params.total_ = total;
+
+        if (Time{} == params.started_) { params.started_ = Clock::now(); }
+
+        auto pending = Vector<Hash>{};
+        pending.reserve(stop - start);
+        pending.clear();
+
+        for (auto n = start; n < stop; ++n) {
+            const auto& hash = objects[n];
+            const auto present =
+                std::ranges::all_of(drivers_, [&](const auto* driver) {
+                    return driver->Exists(hash, to);
+                });
+
+            if (present) {
+                ++params.skipped_;
+            } else {
+                pending.emplace_back(hash);
+            }
+        }
+
+        log()("copying ")(pending.size())(" of ")(stop - start)(
+            " objects from ")(print(from))(" to ")(print(to))
+            .Flush();
+
+        if (false == pending.empty()) {
+            const auto copied = migrate(
+                pending, to, get_search_order(from), nullptr, std::nullopt);
+
+            if (false == copied) {
+                throw std::runtime_error{"failed to copy objects"};
+            }
+        }
+
+        params.copied_ += pending.size();
+        params.position_ = stop;
+
+        if (stop < total) { return true; }
+
+        state.root_.reset();
+        objects = Vector<Hash>{};
         log()("purging stale bucket ")(print(from)).Flush();
 
         return EmptyBucket(from);
-    } else {
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
 
         return false;
     }
@@ -153,6 +233,38 @@ auto Plugin::find_best(Results& lhs, Results::iterator rhs) noexcept
     return static_cast<std::size_t>(std::distance(lhs.begin(), rhs));
 }
 
+auto Plugin::Flush() const noexcept -> bool { return flush(*write_.lock()); }
+
+auto Plugin::flush(Batch& batch) const noexcept -> bool
+{
+    if (false == batch.root_.has_value()) { return true; }
+
+    const auto& root = *batch.root_;
+    auto& data = batch.data_;
+    LogTrace()()("committing ")(data.size())(" objects from ")(batch.roots_)(
+        " updates and updating root hash to ")(root)
+        .Flush();
+    data.RecalculateViews();
+    const auto tx = Transaction{data.Keys(), data.Data()};
+    const auto bucket = primary_bucket_.load();
+
+    if (false == evaluate(evaluate(commit(root, tx, bucket)))) {
+        // NOTE the batch is kept so the next commit attempt retries it. The
+        // objects are content addressed so rewriting them is harmless.
+        LogError()()("failed to commit ")(data.size())(
+            " objects, keeping them queued for retry")
+            .Flush();
+
+        return false;
+    }
+
+    data.Reset();
+    batch.root_.reset();
+    batch.roots_ = 0_uz;
+
+    return true;
+}
+
 auto Plugin::FindBestRoot() noexcept -> Hash
 {
     const auto post = ScopeGuard{[this] { init_promise_.set_value(); }};
@@ -226,7 +338,9 @@ auto Plugin::init_memdb(std::unique_ptr<storage::Driver>& plugin) -> void
 
 auto Plugin::Init_Plugin() -> void
 {
-    if (config_.migrate_plugin_) {
+    if (primary_driver_) {
+        LogVerbose()()("using the supplied primary driver").Flush();
+    } else if (config_.migrate_plugin_) {
         migrate_primary(
             config_.previous_primary_plugin_, config_.primary_plugin_);
     } else {
@@ -269,6 +383,15 @@ auto Plugin::Load(
     Writer&& value,
     const Driver* specifiedDriver) const noexcept -> bool
 {
+    if (nullptr == specifiedDriver) {
+        const auto handle = write_.lock();
+
+        if (const auto data = handle->data_.Find(key); data.has_value()) {
+
+            return copy(*data, std::move(value));
+        }
+    }
+
     return load(
         key,
         checking,
@@ -321,6 +444,21 @@ auto Plugin::LoadRoot() const noexcept -> Hash
     return *root_.lock();
 }
 
+auto Plugin::list_objects(const Hash& root) const noexcept(false)
+    -> Vector<Hash>
+{
+    auto bucket = std::atomic<Bucket>{};
+    const auto tree = tree::Root{crypto_, factory_, *this, root, bucket};
+    auto out = Vector<Hash>{};
+
+    if (false == tree.Dump(out)) {
+
+        throw std::runtime_error{"failed to query hash list"};
+    }
+
+    return out;
+}
+
 auto Plugin::make_results() const noexcept -> Results
 {
     auto out = Results{};
@@ -341,19 +479,7 @@ auto Plugin::migrate(
 {
     try {
         const auto& log = LogTrace();
-        const auto hashes = [&] {
-            auto bucket = std::atomic<Bucket>{};
-            const auto root =
-                tree::Root{crypto_, factory_, *this, rootHash, bucket};
-            auto out = Vector<Hash>{};
-
-            if (false == root.Dump(out)) {
-
-                throw std::runtime_error{"failed to query hash list"};
-            }
-
-            return out;
-        }();
+        const auto hashes = list_objects(rootHash);
         log()("copying ")(hashes.size())(" objects").Flush();
 
         return migrate(
@@ -487,30 +613,54 @@ auto Plugin::Store(ReadView value, Hash& key) const noexcept -> bool
         return false;
     }
 
-    write_.lock()->Add(key, value);
+    write_.lock()->data_.Add(key, value);
 
     return true;
 }
 
+auto Plugin::SetPendingCallback(SimpleCallback cb) noexcept -> void
+{
+    *pending_callback_.lock() = std::move(cb);
+}
+
 auto Plugin::StoreRoot(const Hash& hash) const noexcept -> bool
 {
-    LogTrace()()("committing queue and updating root hash to ")(hash).Flush();
-    auto handle = write_.lock();
-    auto& data = *handle;
-    const auto write = [&] {
-        auto out = PendingWrite{};
-        out.Reset();
-        data.swap(out);
-        out.RecalculateViews();
+    auto output{true};
+    auto notify{false};
 
-        return out;
-    }();
-    const auto tx = Transaction{write.Keys(), write.Data()};
-    const auto bucket = primary_bucket_.load();
-    const auto result = evaluate(evaluate(commit(hash, tx, bucket)));
-    *root_.lock() = hash;
+    {
+        auto handle = write_.lock();
+        auto& batch = *handle;
+        const auto now = Clock::now();
+        const auto start = (false == batch.root_.has_value());
+
+        if (start) { batch.start_ = now; }
+
+        batch.root_ = hash;
+        ++batch.roots_;
+        *root_.lock() = hash;
+        const auto due = (batch.roots_ >= commit_threshold_) ||
+                         ((now - batch.start_) >= commit_interval_);
 
-    return result;
+        if (due) {
+            output = flush(batch);
+        } else {
+            LogTrace()()("deferring root hash ")(hash)(" until next commit")
+                .Flush();
+        }
+
+        // NOTE only a batch which was just started or which failed to commit
+        // needs a deferred flush scheduled. Otherwise one is already pending.
+        notify = batch.root_.has_value() && (start || due);
+    }
+
+    if (notify) {
+        const auto handle = pending_callback_.lock();
+
+        if (*handle) { std::invoke(*handle); }
+    }
+
+    return output;
 }
 
 auto Plugin::synchronize(
@@ -538,5 +688,9 @@ auto Plugin::synchronize(
     }
 }
 
-Plugin::~Plugin() { Cleanup_Plugin(); }
+Plugin::~Plugin()
+{
+    Flush();
+    Cleanup_Plugin();
+}
 }  // namespace opentxs::storage::driver::implementation
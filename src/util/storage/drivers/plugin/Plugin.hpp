@@ -17,6 +17,7 @@
 #include <utility>
 
 #include "internal/util/storage/drivers/Plugin.hpp"
+#include "opentxs/Time.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/core/FixedByteArray.hpp"
 #include "opentxs/crypto/symmetric/Key.hpp"
@@ -60,6 +61,7 @@ class Plugin final : virtual public driver::Plugin
 {
 public:
     auto EmptyBucket(Bucket bucket) const noexcept -> bool final;
+    auto Flush() const noexcept -> bool final;
     auto Load(
         const Hash& key,
         ErrorReporting checking,
@@ -70,17 +72,20 @@ public:
     auto Store(ReadView value, Hash& key) const noexcept -> bool final;
     auto StoreRoot(const Hash& hash) const noexcept -> bool final;
 
-    auto DoGC(const tree::GCParams& params) noexcept -> bool final;
+    auto DoGC(tree::GCParams& params, std::size_t limit) noexcept
+        -> bool final;
     auto FindBestRoot() noexcept -> Hash final;
     auto InitBackup() -> void final;
     auto InitEncryptedBackup(crypto::symmetric::Key& key) -> void final;
     auto Primary() noexcept -> storage::Driver& final;
+    auto SetPendingCallback(SimpleCallback cb) noexcept -> void final;
 
     Plugin(
         const api::Crypto& crypto,
         const api::session::Factory& factory,
         const std::atomic<Bucket>& primaryBucket,
-        const storage::Config& config);
+        const storage::Config& config,
+        std::unique_ptr<storage::Driver> primary);
     Plugin() = delete;
     Plugin(const Plugin&) = delete;
     Plugin(Plugin&&) = delete;
@@ -92,6 +97,18 @@ public:
 private:
     using Results = Vector<std::pair<storage::Driver*, std::uint64_t>>;
 
+    struct Batch {
+        PendingWrite data_{};
+        std::optional<Hash> root_{};
+        std::size_t roots_{};
+        Time start_{};
+    };
+
+    struct GCState {
+        std::optional<Hash> root_{};
+        Vector<Hash> objects_{};
+    };
+
     const api::Crypto& crypto_;
     const api::session::Factory& factory_;
     const std::atomic<Bucket>& primary_bucket_;
@@ -101,7 +118,9 @@ private:
     Vector<storage::Driver*> drivers_;
     crypto::symmetric::Key null_;
     mutable libguarded::plain_guarded<Hash> root_;
-    mutable libguarded::plain_guarded<PendingWrite> write_;
+    mutable libguarded::plain_guarded<Batch> write_;
+    mutable libguarded::plain_guarded<SimpleCallback> pending_callback_;
+    libguarded::plain_guarded<GCState> gc_;
     std::promise<void> init_promise_;
     std::shared_future<void> init_;
 
@@ -120,6 +139,8 @@ private:
     auto commit(const Hash& root, Transaction data, Bucket bucket)
         const noexcept -> Results;
     auto empty_bucket(Bucket bucket) const noexcept -> Results;
+    auto flush(Batch& batch) const noexcept -> bool;
+    auto list_objects(const Hash& root) const noexcept(false) -> Vector<Hash>;
     auto make_results() const noexcept -> Results;
     auto scan(const Log& log) const noexcept -> Results;
 
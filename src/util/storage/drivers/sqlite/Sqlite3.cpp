@@ -339,6 +339,16 @@ auto Sqlite3::Data::insert(
     return out;
 }
 
+auto Sqlite3::Data::Exists(const Hash& key, Bucket bucket) const noexcept
+    -> bool
+{
+    auto value = ByteArray{};
+    auto writer = value.WriteInto();
+
+    return select(
+        std::visit(EncodedView{}, key), get_table_name(bucket), writer);
+}
+
 auto Sqlite3::Data::Load(
     const Log& logger,
     const Hash& key,
@@ -565,6 +575,11 @@ auto Sqlite3::EmptyBucket(Bucket bucket) const noexcept -> bool
     return data_.lock()->EmptyBucket(bucket);
 }
 
+auto Sqlite3::Exists(const Hash& key, Bucket bucket) const noexcept -> bool
+{
+    return data_.lock_shared()->Exists(key, bucket);
+}
+
 auto Sqlite3::Load(
     const Log& logger,
     const Hash& key,
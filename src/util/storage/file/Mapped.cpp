@@ -28,6 +28,7 @@ Mapped::Mapped(
     lmdb::Database& lmdb,
     int positionTable,
     std::size_t positionKey,
+    Layout layout,
     allocator_type alloc) noexcept(false)
     : lmdb_(lmdb)
     , mapped_private_(pmr::construct<MappedPrivate>(
@@ -36,16 +37,29 @@ Mapped::Mapped(
           filenamePrefix,
           lmdb_,
           positionTable,
-          positionKey))
+          positionKey,
+          layout))
 {
     assert_true(mapped_private_);
 }
 
+auto Mapped::Compact(std::size_t batch, allocator_type monotonic) noexcept
+    -> bool
+{
+    return mapped_private_->Compact(batch, monotonic).second;
+}
+
 auto Mapped::Erase(const Index& index, lmdb::Transaction& tx) noexcept -> bool
 {
     return mapped_private_->Erase(index, tx);
 }
 
+auto Mapped::Forget(int table, ReadView key, lmdb::Transaction& tx) noexcept
+    -> bool
+{
+    return mapped_private_->Forget(table, key, tx);
+}
+
 auto Mapped::get_allocator() const noexcept -> allocator_type
 {
     return mapped_private_->get_allocator();
@@ -62,6 +76,23 @@ auto Mapped::Read(const std::span<const Index> indices, allocator_type alloc)
     return mapped_private_->Read(indices, alloc);
 }
 
+auto Mapped::Reclaim(
+    std::span<const int> tables,
+    int freeTable,
+    allocator_type monotonic) noexcept -> bool
+{
+    return mapped_private_->Reclaim(tables, freeTable, monotonic);
+}
+
+auto Mapped::Store(
+    int table,
+    ReadView key,
+    const Index& index,
+    lmdb::Transaction& tx) noexcept -> bool
+{
+    return mapped_private_->Store(table, key, index, tx);
+}
+
 auto Mapped::Write(
     const ReadView& data,
     const Location& file,
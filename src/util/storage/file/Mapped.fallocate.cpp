@@ -0,0 +1,48 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "internal/util/storage/file/Mapped.hpp"  // IWYU pragma: associated
+
+extern "C" {
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/falloc.h>
+#include <unistd.h>
+}
+
+#include "opentxs/strerror_r.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::storage::file
+{
+auto Mapped::release_platform(
+    const std::filesystem::path& file,
+    std::size_t offset,
+    std::size_t bytes) noexcept -> void
+{
+    const auto fd = ::open(file.c_str(), O_RDWR);
+
+    if (0 > fd) {
+        LogError()()("error opening ")(file)(": ")(error_code_to_string(errno))
+            .Flush();
+
+        return;
+    }
+
+    const auto rc = ::fallocate(
+        fd,
+        FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+        static_cast<off_t>(offset),
+        static_cast<off_t>(bytes));
+
+    if (0 != rc) {
+        LogError()()("error calling fallocate (FALLOC_FL_PUNCH_HOLE) for ")(
+            file)(", ")(offset)(", ")(bytes)(": ")(error_code_to_string(errno))
+            .Flush();
+    }
+
+    ::close(fd);
+}
+}  // namespace opentxs::storage::file
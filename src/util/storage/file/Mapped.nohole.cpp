@@ -0,0 +1,18 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "internal/util/storage/file/Mapped.hpp"  // IWYU pragma: associated
+
+namespace opentxs::storage::file
+{
+auto Mapped::release_platform(
+    const std::filesystem::path&,
+    std::size_t,
+    std::size_t) noexcept -> void
+{
+    // NOTE there is no portable way to deallocate part of a file on other
+    // POSIX systems so only trailing files which become empty are removed
+}
+}  // namespace opentxs::storage::file
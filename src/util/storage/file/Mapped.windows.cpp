@@ -12,4 +12,13 @@ auto Mapped::preload_platform(std::span<ReadView>) noexcept -> void
     // TODO use PrefetchVirtualMemory
     // https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-prefetchvirtualmemory?redirectedfrom=MSDN
 }
+
+auto Mapped::release_platform(
+    const std::filesystem::path&,
+    std::size_t,
+    std::size_t) noexcept -> void
+{
+    // NOTE FSCTL_SET_ZERO_DATA can not deallocate a range which is mapped by
+    // a view so on Windows only trailing files which become empty are removed
+}
 }  // namespace opentxs::storage::file
@@ -6,11 +6,14 @@
 #include "util/storage/file/MappedPrivate.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <span>
 #include <stdexcept>
 #include <utility>
@@ -22,9 +25,14 @@
 #include "internal/util/storage/file/Index.hpp"
 #include "internal/util/storage/file/Mapped.hpp"
 #include "internal/util/storage/lmdb/Database.hpp"
+#include "internal/util/storage/lmdb/Transaction.hpp"
+#include "internal/util/storage/lmdb/Types.hpp"
 #include "opentxs/Types.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Writer.hpp"
+#include "util/ByteLiterals.hpp"
 #include "util/FileSize.hpp"
 #include "util/ScopeGuard.hpp"
 
@@ -50,6 +58,40 @@ constexpr auto get_start_position(const std::size_t file) noexcept
 {
     return file * mapped_file_size();
 }
+
+// NOTE upper limit on the amount of data relocated by a single compaction step
+constexpr auto compaction_bytes_ = 64_mib;
+
+// NOTE granularity of records stored in a packed layout
+constexpr auto packed_alignment_ = 16_uz;
+
+constexpr auto packed_align(const std::size_t in) noexcept -> std::size_t
+{
+    return (in + (packed_alignment_ - 1_uz)) & ~(packed_alignment_ - 1_uz);
+}
+
+// NOTE free extents are keyed by their first byte. The value holds the end of
+// the extent and whether its pages have been returned to the filesystem.
+using FreeValue = std::array<std::size_t, 2>;
+
+// NOTE key which indicates the free extent table describes every free extent
+constexpr auto free_list_marker_ = std::numeric_limits<std::size_t>::max();
+
+auto deserialize_free(const ReadView key, const ReadView value) noexcept(false)
+    -> std::pair<std::size_t, FreeValue>
+{
+    auto out = std::pair<std::size_t, FreeValue>{};
+    auto& [begin, data] = out;
+
+    if ((sizeof(begin) != key.size()) || (sizeof(data) != value.size())) {
+        throw std::runtime_error{"invalid free extent"};
+    }
+
+    std::memcpy(&begin, key.data(), key.size());
+    std::memcpy(data.data(), value.data(), value.size());
+
+    return out;
+}
 }  // namespace opentxs::storage::file
 
 namespace opentxs::storage::file
@@ -60,14 +102,22 @@ MappedPrivate::Data::Data(
     lmdb::Database& lmdb,
     int positionTable,
     std::size_t positionKey,
+    Layout layout,
     allocator_type alloc) noexcept(false)
     : path_prefix_(basePath)
     , filename_prefix_(filenamePrefix)
     , position_table_(positionTable)
     , position_key_(positionKey)
+    , layout_(layout)
+    , packed_limit_(PageSize())
     , db_(lmdb)
     , next_position_(0_uz)
     , files_(alloc)
+    , free_table_()
+    , free_(alloc)
+    , free_by_size_(alloc)
+    , candidates_loaded_(false)
+    , candidates_(alloc)
 {
     init_position();
     init_files();
@@ -85,6 +135,34 @@ MappedPrivate::Data::Data(
     static_assert(Offset{1_uz, 1_uz} == get_offset(mapped_file_size() + 1_uz));
     static_assert(0_uz == get_start_position(0_uz));
     static_assert(mapped_file_size() == get_start_position(1_uz));
+    static_assert(0_uz == packed_align(0_uz));
+    static_assert(packed_alignment_ == packed_align(1_uz));
+    static_assert(packed_alignment_ == packed_align(packed_alignment_));
+    static_assert(
+        2_uz * packed_alignment_ == packed_align(packed_alignment_ + 1_uz));
+}
+
+auto MappedPrivate::Data::add_free(const Extent& extent) noexcept -> void
+{
+    const auto& [begin, end] = extent;
+    free_.emplace(begin, end);
+    free_by_size_.emplace(end - begin, begin);
+}
+
+auto MappedPrivate::Data::align(std::size_t position) const noexcept
+    -> std::size_t
+{
+    switch (layout_) {
+        case Layout::Packed: {
+
+            return packed_align(position);
+        }
+        case Layout::PageAligned:
+        default: {
+
+            return AdvanceToNextPageBoundry(position);
+        }
+    }
 }
 
 auto MappedPrivate::Data::calculate_file_name(
@@ -123,12 +201,269 @@ auto MappedPrivate::Data::can_read(const Index& index) const noexcept -> bool
     }
 }
 
+auto MappedPrivate::Data::CandidateThreshold() const noexcept
+    -> std::optional<std::size_t>
+{
+    if (candidates_loaded_ || free_.empty()) { return std::nullopt; }
+
+    // NOTE only records which begin within the final n bytes of the live
+    // region, where n is the total size of the free extents, can be moved
+    // somewhere that reduces the size of the files
+    auto bytes = 0_uz;
+
+    for (const auto& [begin, end] : free_) { bytes += end - begin; }
+
+    return next_position_ - std::min(next_position_, bytes);
+}
+
+auto MappedPrivate::Data::find_free(
+    std::size_t source,
+    std::size_t bytes,
+    Index& out) const noexcept -> std::optional<Extent>
+{
+    // NOTE the smallest extent below the record which can hold it is chosen
+    // so that larger extents remain available for larger records
+    for (auto i = free_by_size_.lower_bound(std::make_pair(bytes, 0_uz));
+         i != free_by_size_.end();
+         ++i) {
+        const auto& [size, begin] = *i;
+
+        if (begin >= source) { continue; }
+
+        const auto end = begin + size;
+        update_index(begin, bytes, out);
+
+        if (out.MemoryPosition() + bytes <= end) { return Extent{begin, end}; }
+    }
+
+    return std::nullopt;
+}
+
+auto MappedPrivate::Data::FindFree(
+    const Extents& live,
+    allocator_type monotonic) const noexcept(false) -> Holes
+{
+    auto out = Holes{monotonic};
+    auto liveEnd = 0_uz;
+
+    for (const auto& [start, end] : live) {
+        if (start > liveEnd) {
+            out.emplace_back(Hole{{liveEnd, start}, false});
+        }
+
+        // NOTE the padding which follows a record belongs to it so that the
+        // space freed when the record is deleted coalesces with its neighbours
+        liveEnd = std::max(liveEnd, align(end));
+    }
+
+    if (liveEnd > next_position_) {
+        throw std::runtime_error{"index references unallocated space"};
+    }
+
+    if (liveEnd < next_position_) {
+        out.emplace_back(Hole{{liveEnd, next_position_}, false});
+    }
+
+    return out;
+}
+
+auto MappedPrivate::Data::HaveFreeList(int freeTable, lmdb::Transaction& tx)
+    const noexcept -> bool
+{
+    return db_.Exists(freeTable, tsv(free_list_marker_), tx);
+}
+
+auto MappedPrivate::Data::is_aligned(std::size_t position) const noexcept
+    -> bool
+{
+    return align(position) == position;
+}
+
+auto MappedPrivate::Data::is_packed(std::size_t bytes) const noexcept -> bool
+{
+    return (Layout::Packed == layout_) && (bytes < packed_limit_);
+}
+
 auto MappedPrivate::Data::check_file(const FileCounter position) noexcept
     -> void
 {
     while (files_.size() < (position + 1_uz)) { create_or_load(files_.size()); }
 }
 
+auto MappedPrivate::Data::clip_free(lmdb::Transaction& tx) noexcept(false)
+    -> void
+{
+    while (false == free_.empty()) {
+        const auto last = *free_.rbegin();
+        const auto& [begin, end] = last;
+
+        if (end <= next_position_) { break; }
+
+        remove_free(last);
+
+        if ((begin < next_position_) &&
+            ((next_position_ - begin) >= min_extent())) {
+            add_free({begin, next_position_});
+        }
+    }
+
+    if (false == free_table_.has_value()) { return; }
+
+    auto clipped = Vector<std::pair<std::size_t, FreeValue>>{
+        free_.get_allocator()};
+    auto cb = [&](const auto key, const auto value) {
+        if (tsv(free_list_marker_) == key) { return true; }
+
+        auto extent = deserialize_free(key, value);
+
+        if (extent.second[0] > next_position_) {
+            clipped.emplace_back(std::move(extent));
+        }
+
+        return true;
+    };
+
+    if (false == db_.Read(*free_table_, cb, lmdb::Dir::Forward, tx)) {
+        throw std::runtime_error{"failed to read free extent table"};
+    }
+
+    for (const auto& [begin, data] : clipped) {
+        if (false == db_.Delete(*free_table_, begin, tx)) {
+            throw std::runtime_error{"failed to update free extent table"};
+        }
+
+        if (begin < next_position_) {
+            store_free(
+                *free_table_, {begin, next_position_}, 0_uz != data[1], tx);
+        }
+    }
+}
+
+auto MappedPrivate::Data::close_trailing_files() noexcept -> void
+{
+    const auto target = get_file_count(next_position_);
+
+    while (files_.size() > target) {
+        const auto file = files_.size() - 1_uz;
+        files_.pop_back();
+
+        try {
+            const auto path = calculate_file_name(file);
+            LogTrace()()("removing empty file ")(path).Flush();
+            std::filesystem::remove(path);
+        } catch (const std::exception& e) {
+            LogError()()(e.what()).Flush();
+        }
+    }
+}
+
+auto MappedPrivate::Data::Apply(Step&& step) noexcept -> void
+{
+    const auto& [changes, consumed, done] = step;
+
+    if (done) {
+        free_.clear();
+        free_by_size_.clear();
+        candidates_.clear();
+    } else {
+        candidates_.resize(candidates_.size() - consumed);
+    }
+}
+
+auto MappedPrivate::Data::Compact(
+    std::size_t batch,
+    lmdb::Transaction& tx,
+    allocator_type monotonic) noexcept(false) -> Step
+{
+    auto out = Step{Changes{monotonic}, 0_uz, false};
+    auto& [changes, consumed, done] = out;
+
+    try {
+        // NOTE records are moved from the end of the file into the smallest
+        // free extent below them that can hold them. Relocation stops at the
+        // first record which does not fit anywhere since nothing below that
+        // record can reduce the size of the file.
+        auto in = Vector<SourceData>{monotonic};
+        auto locations = Vector<Location>{monotonic};
+        auto moved = 0_uz;
+        auto bytes = 0_uz;
+
+        for (auto i = candidates_.rbegin(); i != candidates_.rend();
+             ++i, ++consumed) {
+            if ((moved >= batch) || (bytes >= compaction_bytes_)) { break; }
+
+            const auto& [table, key, index] = *i;
+            const auto source = index.MemoryPosition();
+            const auto size = index.ItemSize();
+            const auto current = [&] {
+                auto value = Index{};
+                db_.Load(
+                    table,
+                    key,
+                    [&](const auto in) { value.Deserialize(in); },
+                    tx);
+
+                return value;
+            }();
+
+            // NOTE records which were deleted or rewritten since the
+            // candidates were found are left where they are
+            if ((current.MemoryPosition() != source) ||
+                (current.ItemSize() != size)) {
+                continue;
+            }
+
+            auto relocated = Index{};
+            const auto destination = find_free(source, size, relocated);
+
+            if (false == destination.has_value()) {
+                done = true;
+
+                break;
+            }
+
+            const auto position = relocated.MemoryPosition();
+            const auto [sFile, sOffset] = get_offset(source);
+            const auto [dFile, dOffset] = get_offset(position);
+            check_file(dFile);
+            const auto view =
+                ReadView{std::next(files_.at(sFile).data(), sOffset), size};
+            in.emplace_back(
+                [view](auto&& writer) { return copy(view, std::move(writer)); },
+                size);
+            locations.emplace_back(
+                FileOffset{calculate_file_name(dFile), dOffset},
+                WriteRange{std::next(files_.at(dFile).data(), dOffset), size});
+            const auto sIndex = relocated.Serialize();
+
+            if (false == db_.Store(table, key, sIndex.Bytes(), tx).first) {
+                throw std::runtime_error{"failed to update index"};
+            }
+
+            take_free(*destination, relocated, changes, tx);
+            Free(index, tx);
+            ++moved;
+            bytes += size;
+        }
+
+        if (consumed == candidates_.size()) { done = true; }
+
+        if (false == Mapped::Write(in, locations, monotonic)) {
+            throw std::runtime_error{"failed to relocate records"};
+        }
+
+        LogTrace()()("relocated ")(moved)(" records totalling ")(bytes)(
+            " bytes")
+            .Flush();
+    } catch (...) {
+        Revert(std::move(out));
+
+        throw;
+    }
+
+    return out;
+}
+
 auto MappedPrivate::Data::create_or_load(FileCounter file) noexcept -> void
 {
     try {
@@ -164,8 +499,17 @@ auto MappedPrivate::Data::Erase(
     lmdb::Transaction& tx) noexcept -> bool
 {
     if (const auto pos = index.MemoryPosition(); pos < next_position_) {
+        if (false == update_next_position(pos, tx)) { return false; }
+
+        try {
+            clip_free(tx);
 
-        return update_next_position(pos, tx);
+            return true;
+        } catch (const std::exception& e) {
+            LogError()()(e.what()).Flush();
+
+            return false;
+        }
     } else {
         LogError()()("position ")(pos)(" is already deleted").Flush();
 
@@ -173,6 +517,18 @@ auto MappedPrivate::Data::Erase(
     }
 }
 
+auto MappedPrivate::Data::Free(
+    const Index& index,
+    lmdb::Transaction& tx) noexcept(false) -> void
+{
+    // NOTE space is only tracked for files whose free extents were reclaimed
+    if (false == free_table_.has_value()) { return; }
+
+    const auto begin = index.MemoryPosition();
+    store_free(
+        *free_table_, {begin, align(begin + index.ItemSize())}, false, tx);
+}
+
 auto MappedPrivate::Data::init_files() noexcept -> void
 {
     const auto target = get_file_count(next_position_);
@@ -189,14 +545,45 @@ auto MappedPrivate::Data::init_position() noexcept -> void
             if (sizeof(next_position_) != in.size()) { return; }
 
             std::memcpy(&next_position_, in.data(), in.size());
-            next_position_ = AdvanceToNextPageBoundry(next_position_);
+            // NOTE positions written by a page aligned layout are also valid
+            // for a packed layout so existing indices require no migration
+            next_position_ = align(next_position_);
         };
         db_.Load(position_table_, tsv(position_key_), cb);
     } else {
         db_.Store(position_table_, tsv(position_key_), tsv(next_position_));
     }
 
-    assert_true(IsPageAligned(next_position_));
+    assert_true(is_aligned(next_position_));
+}
+
+auto MappedPrivate::Data::LoadFreeList(
+    int freeTable,
+    lmdb::Transaction& tx,
+    allocator_type monotonic) const noexcept(false) -> Holes
+{
+    auto out = Holes{monotonic};
+    auto cb = [&](const auto key, const auto value) {
+        if (tsv(free_list_marker_) == key) { return true; }
+
+        const auto [begin, data] = deserialize_free(key, value);
+        const auto& [end, released] = data;
+        out.emplace_back(Hole{{begin, end}, 0_uz != released});
+
+        return true;
+    };
+
+    if (false == db_.Read(freeTable, cb, lmdb::Dir::Forward, tx)) {
+        throw std::runtime_error{"failed to read free extent table"};
+    }
+
+    return out;
+}
+
+auto MappedPrivate::Data::min_extent() const noexcept -> std::size_t
+{
+    // NOTE no record occupies less space than this
+    return align(1_uz);
 }
 
 auto MappedPrivate::Data::Read(
@@ -225,21 +612,216 @@ auto MappedPrivate::Data::Read(
     return out;
 }
 
+auto MappedPrivate::Data::Reclaim(
+    int freeTable,
+    Holes&& holes,
+    lmdb::Transaction& tx,
+    allocator_type monotonic) const noexcept(false) -> Reclaimed
+{
+    auto out = Reclaimed{next_position_, Holes{monotonic}};
+    auto& [position, merged] = out;
+    std::ranges::sort(
+        holes, {}, [](const auto& hole) { return hole.extent_.first; });
+
+    for (const auto& [extent, released] : holes) {
+        const auto begin = extent.first;
+        const auto end = std::min(extent.second, next_position_);
+
+        if (begin >= end) { continue; }
+
+        if (merged.empty() || (merged.back().extent_.second < begin)) {
+            merged.emplace_back(Hole{{begin, end}, released});
+        } else {
+            auto& last = merged.back();
+            last.extent_.second = std::max(last.extent_.second, end);
+            last.released_ = last.released_ && released;
+        }
+    }
+
+    // NOTE a free extent at the end of the live region is returned by
+    // truncating the files instead
+    if ((false == merged.empty()) &&
+        (merged.back().extent_.second >= position)) {
+        position = align(merged.back().extent_.first);
+        merged.pop_back();
+    }
+
+    // NOTE extents too small to hold any record are dropped
+    std::erase_if(merged, [this](const auto& hole) {
+        const auto& [begin, end] = hole.extent_;
+
+        return (end - begin) < min_extent();
+    });
+
+    if ((position < next_position_) &&
+        (false == store_next_position(position, tx))) {
+        throw std::runtime_error{"failed to update next write position"};
+    }
+
+    if (false == db_.Delete(freeTable, tx)) {
+        throw std::runtime_error{"failed to clear free extent table"};
+    }
+
+    for (const auto& hole : merged) {
+        store_free(freeTable, hole.extent_, true, tx);
+    }
+
+    const auto marker =
+        db_.Store(freeTable, free_list_marker_, tsv(free_list_marker_), tx);
+
+    if (false == marker.first) {
+        throw std::runtime_error{"failed to update free extent table"};
+    }
+
+    return out;
+}
+
+auto MappedPrivate::Data::release(Extent extent) noexcept -> void
+{
+    // NOTE only whole pages are returned to the filesystem
+    const auto page = PageSize();
+    auto begin = AdvanceToNextPageBoundry(extent.first);
+    const auto end = extent.second - (extent.second % page);
+
+    while (begin < end) {
+        const auto [file, offset] = get_offset(begin);
+        const auto limit = std::min(end, get_start_position(file + 1_uz));
+
+        if (file < files_.size()) {
+            Mapped::release_platform(
+                calculate_file_name(file), offset, limit - begin);
+        }
+
+        begin = limit;
+    }
+}
+
+auto MappedPrivate::Data::Release(
+    int freeTable,
+    Reclaimed&& reclaimed) noexcept -> void
+{
+    // NOTE this is only called before the first read so no views exist which
+    // could refer to the space being released
+    const auto& [position, holes] = reclaimed;
+    next_position_ = std::min(next_position_, position);
+
+    assert_true(is_aligned(next_position_));
+
+    for (const auto& [extent, released] : holes) {
+        if (false == released) { release(extent); }
+    }
+
+    release({next_position_, files_.size() * mapped_file_size()});
+    close_trailing_files();
+    free_table_ = freeTable;
+    free_.clear();
+    free_by_size_.clear();
+
+    for (const auto& hole : holes) { add_free(hole.extent_); }
+
+    candidates_loaded_ = false;
+    candidates_.clear();
+}
+
+auto MappedPrivate::Data::remove_free(const Extent& extent) noexcept -> void
+{
+    const auto& [begin, end] = extent;
+    free_.erase(begin);
+    free_by_size_.erase(std::make_pair(end - begin, begin));
+}
+
+auto MappedPrivate::Data::Revert(Step&& step) noexcept -> void
+{
+    const auto& changes = step.changes_;
+
+    for (auto i = changes.rbegin(); i != changes.rend(); ++i) {
+        const auto& [inserted, extent] = *i;
+
+        if (inserted) {
+            remove_free(extent);
+        } else {
+            add_free(extent);
+        }
+    }
+}
+
+auto MappedPrivate::Data::SetCandidates(Records&& candidates) noexcept -> void
+{
+    candidates_ = std::move(candidates);
+    candidates_loaded_ = true;
+}
+
+auto MappedPrivate::Data::start_position(
+    std::size_t next,
+    std::size_t bytes) const noexcept -> std::size_t
+{
+    if (false == is_packed(bytes)) { return AdvanceToNextPageBoundry(next); }
+
+    const auto start = packed_align(next);
+    const auto end = start + (bytes - 1_uz);
+
+    // NOTE small records never span a page boundary so that reading one
+    // touches exactly one page
+    if (const auto page = PageSize(); (start / page) == (end / page)) {
+
+        return start;
+    } else {
+
+        return AdvanceToNextPageBoundry(start);
+    }
+}
+
+auto MappedPrivate::Data::take_free(
+    const Extent& extent,
+    const Index& relocated,
+    Changes& changes,
+    lmdb::Transaction& tx) noexcept(false) -> void
+{
+    const auto table = free_table_.value();
+    const auto& [begin, end] = extent;
+    const auto position = relocated.MemoryPosition();
+    remove_free(extent);
+    changes.emplace_back(false, extent);
+
+    if (false == db_.Delete(table, begin, tx)) {
+        throw std::runtime_error{"failed to update free extent table"};
+    }
+
+    // NOTE any space before the relocated record remains free
+    const auto pieces = std::array<Extent, 2>{
+        Extent{begin, position},
+        Extent{align(position + relocated.ItemSize()), end}};
+
+    for (const auto& piece : pieces) {
+        const auto& [first, last] = piece;
+
+        if (first >= last) { continue; }
+
+        store_free(table, piece, true, tx);
+
+        if ((last - first) >= min_extent()) {
+            add_free(piece);
+            changes.emplace_back(true, piece);
+        }
+    }
+}
+
 auto MappedPrivate::Data::update_index(
     const std::size_t& next,
     std::size_t bytes,
-    Index& out) noexcept -> void
+    Index& out) const noexcept -> std::size_t
 {
     assert_true(0_uz < bytes);
 
     const auto position = [&] {
-        const auto start = get_offset(next).first;
-        const auto end = get_offset(next + (bytes - 1_uz)).first;
+        const auto first = start_position(next, bytes);
+        const auto start = get_offset(first).first;
+        const auto end = get_offset(first + (bytes - 1_uz)).first;
 
         // NOTE This check prevents writing past end of file
         if (end == start) {
 
-            return next;
+            return first;
         } else {
             assert_true(end > start);
 
@@ -249,15 +831,30 @@ auto MappedPrivate::Data::update_index(
 
     out.SetMemoryPosition(position);
     out.SetItemSize(bytes);
+
+    return align(position + bytes);
 }
 
-auto MappedPrivate::Data::update_next_position(
+auto MappedPrivate::Data::store_free(
+    int table,
+    const Extent& extent,
+    bool released,
+    lmdb::Transaction& tx) const noexcept(false) -> void
+{
+    const auto& [begin, end] = extent;
+    const auto value = FreeValue{end, released ? 1_uz : 0_uz};
+
+    if (false == db_.Store(table, begin, tsv(value), tx).first) {
+        throw std::runtime_error{"failed to update free extent table"};
+    }
+}
+
+auto MappedPrivate::Data::store_next_position(
     std::size_t position,
-    lmdb::Transaction& tx) noexcept -> bool
+    lmdb::Transaction& tx) const noexcept -> bool
 {
-    const auto effective = AdvanceToNextPageBoundry(position);
     auto result =
-        db_.Store(position_table_, tsv(position_key_), tsv(effective), tx);
+        db_.Store(position_table_, tsv(position_key_), tsv(position), tx);
 
     if (false == result.first) {
         LogError()()("Failed to next write position").Flush();
@@ -265,9 +862,20 @@ auto MappedPrivate::Data::update_next_position(
         return false;
     }
 
+    return true;
+}
+
+auto MappedPrivate::Data::update_next_position(
+    std::size_t position,
+    lmdb::Transaction& tx) noexcept -> bool
+{
+    const auto effective = align(position);
+
+    if (false == store_next_position(effective, tx)) { return false; }
+
     next_position_ = effective;
 
-    assert_true(IsPageAligned(next_position_));
+    assert_true(is_aligned(next_position_));
 
     return true;
 }
@@ -293,13 +901,13 @@ auto MappedPrivate::Data::Write(
 
         if (0_uz == size) { continue; }
 
-        update_index(next, size, index);
+        const auto end = update_index(next, size, index);
         const auto [file, offset] = get_offset(index.MemoryPosition());
         check_file(file);
         path = calculate_file_name(file);
         fileOffset = offset;
         view = {std::next(files_.at(file).data(), offset), size};
-        next = AdvanceToNextPageBoundry(next + size);
+        next = end;
     }
 
     if (false == update_next_position(next, tx)) {
@@ -320,10 +928,60 @@ MappedPrivate::MappedPrivate(
     lmdb::Database& lmdb,
     int positionTable,
     std::size_t positionKey,
+    Layout layout,
     allocator_type alloc) noexcept(false)
     : Allocated(alloc)
-    , data_(basePath, filenamePrefix, lmdb, positionTable, positionKey, alloc)
+    , lmdb_(lmdb)
+    , tables_(alloc)
+    , data_(
+          basePath,
+          filenamePrefix,
+          lmdb,
+          positionTable,
+          positionKey,
+          layout,
+          alloc)
+{
+}
+
+auto MappedPrivate::Compact(
+    std::size_t batch,
+    allocator_type monotonic) noexcept -> CompactResult
 {
+    try {
+        if (const auto threshold = data_.lock()->CandidateThreshold();
+            threshold.has_value()) {
+            // NOTE the index tables are scanned without holding the mutex so
+            // that writers are not blocked. Candidates which change before
+            // they are relocated are skipped by Data::Compact.
+            auto tx = lmdb_.TransactionRO();
+            auto records =
+                load_records(tables_, *threshold, tx, get_allocator());
+            data_.lock()->SetCandidates(std::move(records));
+        }
+
+        // NOTE the write transaction must be acquired before the mutex which
+        // protects Data to match the lock order used by writers
+        auto tx = lmdb_.TransactionRW();
+        auto handle = data_.lock();
+        auto& data = *handle;
+        auto step = data.Compact(batch, tx, monotonic);
+
+        if (false == tx.Finalize(true)) {
+            data.Revert(std::move(step));
+
+            throw std::runtime_error{"failed to commit compaction"};
+        }
+
+        const auto more = (false == step.done_);
+        data.Apply(std::move(step));
+
+        return std::make_pair(true, more);
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return std::make_pair(false, false);
+    }
 }
 
 auto MappedPrivate::Erase(const Index& index, lmdb::Transaction& tx) noexcept
@@ -332,6 +990,100 @@ auto MappedPrivate::Erase(const Index& index, lmdb::Transaction& tx) noexcept
     return data_.lock()->Erase(index, tx);
 }
 
+auto MappedPrivate::Forget(
+    int table,
+    ReadView key,
+    lmdb::Transaction& tx) noexcept -> bool
+{
+    try {
+        const auto previous = load_index(table, key, tx);
+
+        if (false == lmdb_.Delete(table, key, tx)) { return false; }
+
+        if (false == previous.empty()) { data_.lock()->Free(previous, tx); }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto MappedPrivate::load_extents(
+    std::span<const int> tables,
+    lmdb::Transaction& tx,
+    allocator_type monotonic) const noexcept(false) -> Extents
+{
+    auto out = Extents{monotonic};
+
+    for (const auto table : tables) {
+        auto cb = [&](const auto, const auto value) {
+            auto index = Index{};
+            index.Deserialize(value);
+
+            if (false == index.empty()) {
+                const auto start = index.MemoryPosition();
+                out.emplace_back(start, start + index.ItemSize());
+            }
+
+            return true;
+        };
+
+        if (false == lmdb_.Read(table, cb, lmdb::Dir::Forward, tx)) {
+            throw std::runtime_error{"failed to read index table"};
+        }
+    }
+
+    std::ranges::sort(out);
+
+    return out;
+}
+
+auto MappedPrivate::load_index(
+    int table,
+    ReadView key,
+    lmdb::Transaction& tx) const noexcept(false) -> Index
+{
+    auto out = Index{};
+    lmdb_.Load(table, key, [&](const auto in) { out.Deserialize(in); }, tx);
+
+    return out;
+}
+
+auto MappedPrivate::load_records(
+    std::span<const int> tables,
+    std::size_t threshold,
+    lmdb::Transaction& tx,
+    allocator_type alloc) const noexcept(false) -> Records
+{
+    auto out = Records{alloc};
+
+    for (const auto table : tables) {
+        auto cb = [&](const auto key, const auto value) {
+            auto index = Index{};
+            index.Deserialize(value);
+
+            if ((false == index.empty()) &&
+                (index.MemoryPosition() >= threshold)) {
+                out.emplace_back(Record{table, CString{key, alloc}, index});
+            }
+
+            return true;
+        };
+
+        if (false == lmdb_.Read(table, cb, lmdb::Dir::Forward, tx)) {
+            throw std::runtime_error{"failed to read index table"};
+        }
+    }
+
+    std::ranges::sort(out, [](const auto& lhs, const auto& rhs) {
+        return lhs.index_.MemoryPosition() < rhs.index_.MemoryPosition();
+    });
+
+    return out;
+}
+
 auto MappedPrivate::Read(
     const std::span<const Index> indices,
     allocator_type alloc) const noexcept -> Vector<ReadView>
@@ -339,6 +1091,74 @@ auto MappedPrivate::Read(
     return data_.lock()->Read(indices, alloc);
 }
 
+auto MappedPrivate::Reclaim(
+    std::span<const int> tables,
+    int freeTable,
+    allocator_type monotonic) noexcept -> bool
+{
+    try {
+        tables_.assign(tables.begin(), tables.end());
+        auto tx = lmdb_.TransactionRW();
+        auto handle = data_.lock();
+        auto& data = *handle;
+        auto holes = [&] {
+            if (data.HaveFreeList(freeTable, tx)) {
+
+                return data.LoadFreeList(freeTable, tx, monotonic);
+            }
+
+            // NOTE the index tables are only scanned if the free extent
+            // table has never been populated
+            LogVerbose()()("building free extent table").Flush();
+
+            return data.FindFree(
+                load_extents(tables, tx, monotonic), monotonic);
+        }();
+        auto reclaimed =
+            data.Reclaim(freeTable, std::move(holes), tx, monotonic);
+
+        if (false == tx.Finalize(true)) {
+            throw std::runtime_error{"failed to commit reclaimed space"};
+        }
+
+        data.Release(freeTable, std::move(reclaimed));
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto MappedPrivate::Store(
+    int table,
+    ReadView key,
+    const Index& index,
+    lmdb::Transaction& tx) noexcept -> bool
+{
+    try {
+        const auto previous = load_index(table, key, tx);
+        const auto bytes = index.Serialize();
+
+        if (false == lmdb_.Store(table, key, bytes.Bytes(), tx).first) {
+            return false;
+        }
+
+        const auto replaced =
+            (false == previous.empty()) &&
+            (previous.MemoryPosition() != index.MemoryPosition());
+
+        if (replaced) { data_.lock()->Free(previous, tx); }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
+}
+
 auto MappedPrivate::Write(
     lmdb::Transaction& tx,
     const Vector<std::size_t>& items) noexcept -> WriteParam
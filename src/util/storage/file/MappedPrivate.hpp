@@ -8,12 +8,15 @@
 #include <cs_plain_guarded.h>
 #include <cstddef>
 #include <filesystem>
+#include <optional>
 #include <span>
 #include <string_view>
+#include <utility>
 
 #include "BoostIostreams.hpp"
 #include "internal/util/PMR.hpp"
 #include "internal/util/alloc/Allocated.hpp"
+#include "internal/util/storage/file/Index.hpp"
 #include "internal/util/storage/file/Types.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/util/Container.hpp"
@@ -23,11 +26,6 @@ namespace opentxs
 {
 namespace storage
 {
-namespace file
-{
-class Index;
-}  // namespace file
-
 namespace lmdb
 {
 class Database;
@@ -42,14 +40,29 @@ namespace opentxs::storage::file
 class MappedPrivate final : public opentxs::pmr::Allocated
 {
 public:
+    using CompactResult = std::pair<bool, bool>;
+
     auto Read(const std::span<const Index> indices, allocator_type alloc)
         const noexcept -> Vector<ReadView>;
 
+    auto Compact(std::size_t batch, allocator_type monotonic) noexcept
+        -> CompactResult;
     auto Erase(const Index& index, lmdb::Transaction& tx) noexcept -> bool;
+    auto Forget(int table, ReadView key, lmdb::Transaction& tx) noexcept
+        -> bool;
     auto get_deleter() noexcept -> delete_function final
     {
         return pmr::make_deleter(this);
     }
+    auto Reclaim(
+        std::span<const int> tables,
+        int freeTable,
+        allocator_type monotonic) noexcept -> bool;
+    auto Store(
+        int table,
+        ReadView key,
+        const Index& index,
+        lmdb::Transaction& tx) noexcept -> bool;
     auto Write(lmdb::Transaction& tx, const Vector<std::size_t>& items) noexcept
         -> WriteParam;
 
@@ -59,6 +72,7 @@ public:
         lmdb::Database& lmdb,
         int positionTable,
         std::size_t positionKey,
+        Layout layout,
         allocator_type alloc) noexcept(false);
     MappedPrivate(const MappedPrivate&) = delete;
     MappedPrivate(MappedPrivate&&) = delete;
@@ -68,13 +82,71 @@ public:
     ~MappedPrivate() final;
 
 private:
+    struct Record {
+        int table_;
+        CString key_;
+        Index index_;
+    };
+
+    using Records = Vector<Record>;
+    using Extent = std::pair<std::size_t, std::size_t>;
+    using Extents = Vector<Extent>;
+
+    struct Hole {
+        Extent extent_;
+        bool released_;
+    };
+
+    using Holes = Vector<Hole>;
+
     class Data
     {
     public:
+        /// Changes to the free extents made while building a compaction step,
+        /// in order, with true for an insertion and false for a removal
+        using Changes = Vector<std::pair<bool, Extent>>;
+
+        /// Changes which take effect after the transaction which produced them
+        /// is committed
+        struct Step {
+            Changes changes_;
+            std::size_t consumed_;
+            bool done_;
+        };
+        struct Reclaimed {
+            std::size_t position_;
+            Holes free_;
+        };
+
+        auto CandidateThreshold() const noexcept -> std::optional<std::size_t>;
+        auto FindFree(const Extents& live, allocator_type monotonic) const
+            noexcept(false) -> Holes;
+        auto HaveFreeList(int freeTable, lmdb::Transaction& tx) const noexcept
+            -> bool;
+        auto LoadFreeList(
+            int freeTable,
+            lmdb::Transaction& tx,
+            allocator_type monotonic) const noexcept(false) -> Holes;
+        auto Reclaim(
+            int freeTable,
+            Holes&& holes,
+            lmdb::Transaction& tx,
+            allocator_type monotonic) const noexcept(false) -> Reclaimed;
+
+        auto Apply(Step&& step) noexcept -> void;
+        auto Compact(
+            std::size_t batch,
+            lmdb::Transaction& tx,
+            allocator_type monotonic) noexcept(false) -> Step;
         auto Erase(const Index& index, lmdb::Transaction& tx) noexcept -> bool;
+        auto Free(const Index& index, lmdb::Transaction& tx) noexcept(false)
+            -> void;
         auto Read(
             const std::span<const Index> indices,
             allocator_type alloc) noexcept -> Vector<ReadView>;
+        auto Release(int freeTable, Reclaimed&& reclaimed) noexcept -> void;
+        auto Revert(Step&& step) noexcept -> void;
+        auto SetCandidates(Records&& candidates) noexcept -> void;
         auto Write(
             lmdb::Transaction& tx,
             const Vector<std::size_t>& items) noexcept -> WriteParam;
@@ -85,6 +157,7 @@ private:
             lmdb::Database& lmdb,
             int positionTable,
             std::size_t positionKey,
+            Layout layout,
             allocator_type alloc) noexcept(false);
         Data(const Data&) = delete;
         Data(Data&&) = delete;
@@ -93,33 +166,87 @@ private:
 
     private:
         using FileCounter = std::size_t;
+        using FreeByPosition = Map<std::size_t, std::size_t>;
+        using FreeBySize = Set<std::pair<std::size_t, std::size_t>>;
 
         const std::filesystem::path path_prefix_;
         const std::filesystem::path filename_prefix_;
         const int position_table_;
         const std::size_t position_key_;
+        const Layout layout_;
+        const std::size_t packed_limit_;
         lmdb::Database& db_;
         FileCounter next_position_;
         Vector<MappedFileType> files_;
-
-        static auto update_index(
-            const std::size_t& next,
-            std::size_t bytes,
-            Index& out) noexcept -> void;
-
+        std::optional<int> free_table_;
+        // NOTE extents which were unreferenced when the files were opened,
+        // keyed by position and mapped to the end of the extent. Space
+        // vacated during a session may still be visible to readers holding
+        // views from an earlier index so it is recorded in the free table
+        // but not reused until the next session.
+        FreeByPosition free_;
+        // NOTE the same extents as free_ ordered by size then position
+        FreeBySize free_by_size_;
+        bool candidates_loaded_;
+        // NOTE records which might be relocated into free_, sorted by position
+        Records candidates_;
+
+        auto align(std::size_t position) const noexcept -> std::size_t;
         auto calculate_file_name(const FileCounter index) const noexcept
             -> std::filesystem::path;
         auto can_read(const Index& index) const noexcept -> bool;
-
+        auto find_free(std::size_t source, std::size_t bytes, Index& out)
+            const noexcept -> std::optional<Extent>;
+        auto is_aligned(std::size_t position) const noexcept -> bool;
+        auto is_packed(std::size_t bytes) const noexcept -> bool;
+        auto min_extent() const noexcept -> std::size_t;
+        auto start_position(std::size_t next, std::size_t bytes) const noexcept
+            -> std::size_t;
+        auto update_index(const std::size_t& next, std::size_t bytes, Index& out)
+            const noexcept -> std::size_t;
+
+        auto add_free(const Extent& extent) noexcept -> void;
         auto check_file(FileCounter position) noexcept -> void;
+        auto clip_free(lmdb::Transaction& tx) noexcept(false) -> void;
+        auto close_trailing_files() noexcept -> void;
         auto create_or_load(FileCounter file) noexcept -> void;
         auto init_files() noexcept -> void;
         auto init_position() noexcept -> void;
+        auto release(Extent extent) noexcept -> void;
+        auto remove_free(const Extent& extent) noexcept -> void;
+        auto store_free(
+            int table,
+            const Extent& extent,
+            bool released,
+            lmdb::Transaction& tx) const noexcept(false) -> void;
+        auto take_free(
+            const Extent& extent,
+            const Index& relocated,
+            Changes& changes,
+            lmdb::Transaction& tx) noexcept(false) -> void;
+        auto store_next_position(
+            std::size_t position,
+            lmdb::Transaction& tx) const noexcept -> bool;
         auto update_next_position(
             std::size_t position,
             lmdb::Transaction& tx) noexcept -> bool;
     };
 
+    lmdb::Database& lmdb_;
+    // NOTE set by Reclaim before compaction begins
+    Vector<int> tables_;
     mutable libguarded::plain_guarded<Data> data_;
+
+    auto load_extents(
+        std::span<const int> tables,
+        lmdb::Transaction& tx,
+        allocator_type monotonic) const noexcept(false) -> Extents;
+    auto load_index(int table, ReadView key, lmdb::Transaction& tx) const
+        noexcept(false) -> Index;
+    auto load_records(
+        std::span<const int> tables,
+        std::size_t threshold,
+        lmdb::Transaction& tx,
+        allocator_type alloc) const noexcept(false) -> Records;
 };
 }  // namespace opentxs::storage::file
@@ -11,6 +11,7 @@
 #include <chrono>
 #include <compare>
 #include <cstdlib>
+#include <memory>
 #include <optional>
 #include <ratio>
 #include <string_view>
@@ -20,6 +21,7 @@
 #include "api/session/Storage.hpp"
 #include "internal/api/network/Asio.hpp"
 #include "internal/network/zeromq/Context.hpp"
+#include "internal/util/storage/drivers/Plugin.hpp"
 #include "opentxs/Context.hpp"
 #include "opentxs/Time.hpp"
 #include "opentxs/Types.hpp"
@@ -49,6 +51,8 @@ auto print(Job state) noexcept -> std::string_view
         frozen::make_unordered_map<Job, std::string_view>({
             {shutdown, "shutdown"sv},
             {finished, "finished"sv},
+            {flush, "flush"sv},
+            {pending, "pending"sv},
             {init, "init"sv},
             {statemachine, "statemachine"sv},
         });
@@ -104,12 +108,29 @@ Actor::Actor(
         return out;
     }())
     , timer_(api_.Network().Asio().Internal().GetTimer())
+    , flush_timer_(api_.Network().Asio().Internal().GetTimer())
+    , gc_active_(false)
+    , flush_scheduled_(false)
 {
 }
 
+auto Actor::continue_gc(GCParams params) noexcept -> void
+{
+    gc_active_ = true;
+    RunJob([api = api_p_,
+            parent = parent_p_,
+            self = self_,
+            params = std::move(params)]() mutable {
+        run_gc(api, parent, self, params);
+    });
+}
+
 auto Actor::do_shutdown() noexcept -> void
 {
     timer_.Cancel();
+    flush_timer_.Cancel();
+    parent_.SetPendingCallback({});
+    parent_.Flush();
     api_p_.reset();
     parent_p_.reset();
     self_.reset();
@@ -119,11 +140,31 @@ auto Actor::do_startup(allocator_type monotonic) noexcept -> bool
 {
     if (api_.Internal().ShuttingDown()) { return true; }
 
+    parent_.SetPendingCallback([me = std::weak_ptr<Actor>{self_}] {
+        if (auto self = me.lock(); self) {
+            self->push_.lock()->Send(MakeWork(Job::pending));
+        }
+    });
     reset_gc_timer(0s);
+    // NOTE a batch may have been started before the callback was registered
+    reset_flush_timer();
 
     return false;
 }
 
+auto Actor::flush_storage() noexcept -> void
+{
+    // NOTE publish root updates which were deferred by the group commit even
+    // if no further writes arrive to trigger it
+    flush_scheduled_ = false;
+
+    if (false == parent_.Flush()) {
+        LogError()()(name_)(": failed to commit pending storage writes")
+            .Flush();
+        reset_flush_timer();
+    }
+}
+
 auto Actor::need_gc(std::chrono::microseconds elapsed) const noexcept -> bool
 {
     return elapsed >= interval_;
@@ -132,13 +173,22 @@ auto Actor::need_gc(std::chrono::microseconds elapsed) const noexcept -> bool
 auto Actor::pipeline(
     const Work work,
     Message&& msg,
-    allocator_type monotonic) noexcept -> void
+    allocator_type) noexcept -> void
 {
     using enum Job;
 
     switch (work) {
         case finished: {
-            do_work(monotonic);
+            // NOTE pause between steps so collection does not monopolize the
+            // storage drivers
+            gc_active_ = false;
+            reset_gc_timer(gc_pause_);
+        } break;
+        case flush: {
+            flush_storage();
+        } break;
+        case pending: {
+            schedule_flush();
         } break;
         case shutdown:
         case init:
@@ -154,6 +204,12 @@ auto Actor::pipeline(
     }
 }
 
+auto Actor::reset_flush_timer() noexcept -> void
+{
+    flush_scheduled_ = true;
+    reset_timer(driver::Plugin::commit_interval_, flush_timer_, Work::flush);
+}
+
 auto Actor::reset_gc_timer(std::chrono::microseconds wait) noexcept -> void
 {
     reset_timer(wait, timer_, Work::statemachine);
@@ -163,7 +219,7 @@ auto Actor::run_gc(
     std::shared_ptr<const api::internal::Session> api,
     std::shared_ptr<api::session::imp::Storage> parent,
     std::shared_ptr<Actor> self,
-    const GCParams& params) noexcept -> void
+    GCParams& params) noexcept -> void
 {
     assert_false(nullptr == api);
     assert_false(nullptr == parent);
@@ -171,22 +227,43 @@ auto Actor::run_gc(
 
     using enum Job;
     auto success{false};
-    const auto post = ScopeGuard{[parent, self, &success] {
-        parent->FinishGC(success);
+    auto done{false};
+    const auto post = ScopeGuard{[&] {
+        if (done || (false == success)) {
+            parent->FinishGC(success);
+        } else {
+            parent->UpdateGC(params);
+        }
+
         self->push_.lock()->Send(MakeWork(finished));
     }};
     const auto& me = *self;
     const auto& log = me.log_;
-    log()(me.name_)(": garbage collection running").Flush();
-    success = parent->DoGC(params);
+    log()(me.name_)(": garbage collection step running").Flush();
+    success = parent->DoGC(params, gc_step_);
+    done = success && (params.position_ >= params.total_);
 
-    if (success) {
-        log()(me.name_)(": garbage collection finished").Flush();
-    } else {
+    if (false == success) {
         LogError()()(me.name_)(": garbage collection failed").Flush();
+    } else {
+        log()(me.name_)(": processed ")(params.position_)(" of ")(
+            params.total_)(" objects (")(params.copied_)(" copied, ")(
+            params.skipped_)(" skipped, ")(params.Throughput())(
+            " objects per second)")
+            .Flush();
+
+        if (done) {
+            log()(me.name_)(": garbage collection finished").Flush();
+        }
     }
 }
 
+auto Actor::schedule_flush() noexcept -> void
+{
+    // NOTE a flush which is already scheduled will commit the new batch too
+    if (false == flush_scheduled_) { reset_flush_timer(); }
+}
+
 auto Actor::schedule_gc(std::chrono::microseconds elapsed) noexcept -> void
 {
     using namespace std::chrono;
@@ -202,12 +279,7 @@ auto Actor::start_gc() noexcept -> void
     log_()(name_)(": beginning garbage collection").Flush();
 
     if (auto gc = parent_.StartGC(); gc) {
-        RunJob([api = api_p_,
-                parent = parent_p_,
-                self = self_,
-                params = std::move(gc.value())] {
-            run_gc(api, parent, self, params);
-        });
+        continue_gc(std::move(gc.value()));
     } else {
         log_()(name_)(": failed to start garbage collection").Flush();
         reset_gc_timer(10s);
@@ -219,8 +291,15 @@ auto Actor::work(allocator_type) noexcept -> bool
     const auto& log = log_;
     const auto status = parent_.GCStatus();
 
-    if (status.running_) {
+    if (gc_active_) {
         log()(name_)(": garbage collection already running").Flush();
+    } else if (status.running_) {
+        // NOTE either the previous step finished or the run was interrupted by
+        // a restart, in which case it resumes from the persisted position
+        log()(name_)(": continuing garbage collection at object ")(
+            status.position_)
+            .Flush();
+        continue_gc(status);
     } else {
         using namespace std::chrono;
         const auto elapsed =
@@ -10,6 +10,7 @@
 #include <memory>
 
 #include "internal/network/zeromq/socket/Raw.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/PMR.hpp"
 #include "internal/util/Timer.hpp"
 #include "internal/util/storage/tree/Types.hpp"
@@ -77,6 +78,9 @@ private:
     using GuardedSocket =
         libguarded::plain_guarded<network::zeromq::socket::Raw>;
 
+    static constexpr auto gc_step_ = 1000_uz;
+    static constexpr auto gc_pause_ = std::chrono::milliseconds{100};
+
     std::shared_ptr<const api::internal::Session> api_p_;
     std::shared_ptr<api::session::imp::Storage> parent_p_;
     std::shared_ptr<Actor> self_;
@@ -85,20 +89,27 @@ private:
     const std::chrono::seconds interval_;
     GuardedSocket push_;
     Timer timer_;
+    Timer flush_timer_;
+    bool gc_active_;
+    bool flush_scheduled_;
 
     static auto run_gc(
         std::shared_ptr<const api::internal::Session> api,
         std::shared_ptr<api::session::imp::Storage> parent,
         std::shared_ptr<Actor> self,
-        const GCParams& params) noexcept -> void;
+        GCParams& params) noexcept -> void;
 
     auto need_gc(std::chrono::microseconds elapsed) const noexcept -> bool;
 
+    auto continue_gc(GCParams params) noexcept -> void;
     auto do_shutdown() noexcept -> void;
     auto do_startup(allocator_type monotonic) noexcept -> bool;
+    auto flush_storage() noexcept -> void;
     auto pipeline(const Work work, Message&& msg, allocator_type) noexcept
         -> void;
+    auto reset_flush_timer() noexcept -> void;
     auto reset_gc_timer(std::chrono::microseconds wait) noexcept -> void;
+    auto schedule_flush() noexcept -> void;
     auto schedule_gc(std::chrono::microseconds elapsed) noexcept -> void;
     auto start_gc() noexcept -> void;
     auto work(allocator_type monotonic) noexcept -> bool;
@@ -113,6 +113,7 @@ auto Root::FinishGC(bool success) noexcept -> void
 {
     auto lock = Lock{write_lock_};
     gc_params_.running_ = false;
+    gc_params_.position_ = 0u;
 
     if (success) { gc_params_.last_ = Clock::now(); }
 
@@ -146,6 +147,7 @@ auto Root::init(const Hash& hash) noexcept(false) -> void
                     seconds_since_epoch_unsigned(proto.lastgc()).value();
                 gc_params_.root_ = read(proto.gcroot());
                 gc_params_.from_ = next(current_bucket_.load());
+                gc_params_.position_ = proto.gcposition();
             }
         }
     } else {
@@ -203,6 +205,8 @@ auto Root::serialize(const Lock&) const -> protobuf::StorageRoot
     output.set_gc(gc_params_.running_);
     write(gc_params_.root_, *output.mutable_gcroot());
 
+    if (gc_params_.running_) { output.set_gcposition(gc_params_.position_); }
+
     return output;
 }
 
@@ -218,6 +222,11 @@ auto Root::StartGC() noexcept -> std::optional<GCParams>
 
     gc_params_.root_ = plugin_.LoadRoot();
     gc_params_.from_ = current_bucket_.load();
+    gc_params_.position_ = 0u;
+    gc_params_.total_ = 0u;
+    gc_params_.copied_ = 0u;
+    gc_params_.skipped_ = 0u;
+    gc_params_.started_ = Clock::now();
     current_bucket_.store(next(gc_params_.from_));
 
     if (save(lock)) {
@@ -247,6 +256,26 @@ auto Root::trunk() const -> tree::Trunk*
 
 auto Root::Trunk() const -> const tree::Trunk& { return *trunk(); }
 
+auto Root::UpdateGC(const GCParams& progress) noexcept -> bool
+{
+    auto lock = Lock{write_lock_};
+
+    if ((false == gc_params_.running_) || (progress.root_ != gc_params_.root_)) {
+        LogError()()("progress does not belong to the active collection")
+            .Flush();
+
+        return false;
+    }
+
+    gc_params_.position_ = progress.position_;
+    gc_params_.total_ = progress.total_;
+    gc_params_.copied_ = progress.copied_;
+    gc_params_.skipped_ = progress.skipped_;
+    gc_params_.started_ = progress.started_;
+
+    return save(lock);
+}
+
 auto Root::upgrade(const Lock& lock) noexcept -> bool
 {
     auto changed = Node::upgrade(lock);
@@ -80,6 +80,7 @@ public:
     auto FinishGC(bool success) noexcept -> void;
     auto Sequence() const -> std::uint64_t;
     auto StartGC() noexcept -> std::optional<GCParams>;
+    auto UpdateGC(const GCParams& progress) noexcept -> bool;
 
     Root(
         const api::Crypto& crypto,
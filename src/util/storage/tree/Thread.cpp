@@ -6,8 +6,15 @@
 #include "util/storage/tree/Thread.hpp"  // IWYU pragma: associated
 
 #include <opentxs/protobuf/StorageThread.pb.h>
+#include <opentxs/protobuf/StorageThreadChunk.pb.h>
 #include <opentxs/protobuf/StorageThreadItem.pb.h>
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <source_location>
@@ -22,6 +29,7 @@
 #include "opentxs/otx/client/Types.hpp"
 #include "opentxs/protobuf/Types.internal.hpp"
 #include "opentxs/protobuf/syntax/StorageThread.hpp"
+#include "opentxs/protobuf/syntax/StorageThreadChunk.hpp"
 #include "opentxs/protobuf/syntax/StorageThreadItem.hpp"
 #include "opentxs/protobuf/syntax/Types.internal.tpp"
 #include "opentxs/storage/Types.internal.hpp"
@@ -48,13 +56,14 @@ Thread::Thread(
           storage,
           hash,
           std::source_location::current().function_name(),
-          1)
+          current_version_)
     , id_(id)
     , alias_(alias)
     , index_(0)
+    , unread_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
-    , items_()
+    , chunks_()
     , participants_()
 {
     if (is_valid(hash)) {
@@ -78,13 +87,14 @@ Thread::Thread(
           storage,
           NullHash{},
           std::source_location::current().function_name(),
-          1)
+          current_version_)
     , id_(id)
     , alias_()
     , index_(0)
+    , unread_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
-    , items_()
+    , chunks_()
     , participants_(participants)
 {
     blank();
@@ -133,14 +143,15 @@ auto Thread::Add(
         return false;
     }
 
-    auto& item = items_[id];
-    item.set_version(version_);
+    auto item = protobuf::StorageThreadItem{};
+    item.set_version(item_version_);
     item.set_id(id.asBase58(crypto_));
 
     if (0 == index) {
         item.set_index(index_++);
     } else {
         item.set_index(index);
+        index_ = std::max(index_, convert_to_size(index) + 1);
     }
 
     item.set_time(seconds_since_epoch_unsigned(time).value());
@@ -155,8 +166,13 @@ auto Thread::Add(
 
     const auto valid = protobuf::syntax::check(LogError(), item);
 
-    if (false == valid) {
-        items_.erase(id);
+    if (false == valid) { return false; }
+
+    try {
+        erase_item(lock, id);
+        insert_item(lock, id, std::move(item));
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
 
         return false;
     }
@@ -164,6 +180,14 @@ auto Thread::Add(
     return save(lock);
 }
 
+auto Thread::add_to_filter(const identifier::Generic& id, Filter& filter)
+    -> void
+{
+    for (const auto bit : filter_bits(id)) {
+        filter[bit / 8_uz] |= static_cast<std::uint8_t>(1u << (bit % 8_uz));
+    }
+}
+
 auto Thread::Alias() const -> UnallocatedCString
 {
     const auto lock = Lock{write_lock_};
@@ -178,20 +202,72 @@ auto Thread::init(const Hash& hash) noexcept(false) -> void
     if (LoadProto(hash, p, verbose) && p) {
         const auto& proto = *p;
 
+        for (const auto& participant : proto.participant()) {
+            participants_.emplace(factory_.IdentifierFromBase58(participant));
+        }
+
         switch (set_original_version(proto.version())) {
-            case 1u:
-            default: {
-                for (const auto& participant : proto.participant()) {
-                    participants_.emplace(
-                        factory_.IdentifierFromBase58(participant));
-                }
+            case 1u: {
+                // NOTE version 1 threads store every item inline. They are
+                // split into chunks here and written in the new format the
+                // next time the thread is saved, even if that happens before
+                // the thread is upgraded.
+                version_.store(current_version_);
+                auto items = ChunkItems{};
 
                 for (const auto& it : proto.item()) {
+                    const auto key = sort_key(it);
+
+                    if (std::get<2>(key).empty()) { continue; }
+
                     const auto index = convert_to_size(it.index());
-                    items_.emplace(factory_.IdentifierFromBase58(it.id()), it);
+                    items.insert_or_assign(key, it);
 
                     if (index >= index_) { index_ = index + 1; }
                 }
+
+                for (auto& [key, item] : items) {
+                    if (chunks_.empty() ||
+                        (chunks_.back().count_ >= chunk_size_)) {
+                        auto& chunk = chunks_.emplace_back();
+                        chunk.items_.emplace();
+                        chunk.dirty_ = true;
+                    }
+
+                    auto& chunk = chunks_.back();
+                    const auto unread = item.unread();
+                    chunk.items_->emplace(key, std::move(item));
+                    ++chunk.count_;
+
+                    if (unread) {
+                        ++chunk.unread_;
+                        ++unread_;
+                    }
+                }
+
+                for (auto& chunk : chunks_) {
+                    chunk.filter_.emplace(build_filter(*chunk.items_));
+                }
+            } break;
+            case 2u:
+            default: {
+                index_ = convert_to_size(proto.nextindex());
+                unread_ = convert_to_size(proto.unread());
+
+                for (const auto& it : proto.chunk()) {
+                    auto& chunk = chunks_.emplace_back();
+                    chunk.hash_ = read(it.hash());
+                    chunk.count_ = convert_to_size(it.count());
+                    chunk.unread_ = convert_to_size(it.unread());
+                    const auto& filter = it.filter();
+
+                    // NOTE chunks written without a filter are loaded the
+                    // first time any item is looked up
+                    if (sizeof(Filter) == filter.size()) {
+                        std::ranges::copy(
+                            filter, chunk.filter_.emplace().begin());
+                    }
+                }
             }
         }
     } else {
@@ -200,37 +276,305 @@ auto Thread::init(const Hash& hash) noexcept(false) -> void
     }
 }
 
+auto Thread::build_filter(const ChunkItems& items) -> Filter
+{
+    auto out = Filter{};
+
+    for (const auto& [key, item] : items) {
+        add_to_filter(std::get<2>(key), out);
+    }
+
+    return out;
+}
+
 auto Thread::Check(const identifier::Generic& id) const -> bool
 {
     const auto lock = Lock{write_lock_};
 
-    return items_.end() != items_.find(id);
+    try {
+        return find_item(lock, id).has_value();
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto Thread::dump(const Lock& lock, const Log& log, Vector<Hash>& out)
+    const noexcept -> bool
+{
+    if (false == Node::dump(lock, log, out)) { return false; }
+
+    if (false == is_valid(root_)) { return true; }
+
+    for (const auto& chunk : chunks_) {
+        if (is_valid(chunk.hash_)) {
+            log(name_)("copying chunk hash ")(chunk.hash_).Flush();
+            out.emplace_back(chunk.hash_);
+        }
+    }
+
+    return true;
+}
+
+auto Thread::erase_item(
+    const Lock& lock,
+    const identifier::Generic& id) noexcept(false)
+    -> std::optional<protobuf::StorageThreadItem>
+{
+    const auto location = find_item(lock, id);
+
+    if (false == location.has_value()) { return std::nullopt; }
+
+    const auto& [position, key] = *location;
+    auto& chunk = chunks_[position];
+    auto& items = *chunk.items_;
+    const auto i = items.find(key);
+
+    assert_false(items.end() == i);
+
+    auto out = std::make_optional(std::move(i->second));
+    items.erase(i);
+    --chunk.count_;
+
+    if (out->unread()) {
+        --chunk.unread_;
+        --unread_;
+    }
+
+    // NOTE the filter of the chunk still matches the removed id until the
+    // chunk is saved
+    if (items.empty()) {
+        chunks_.erase(std::next(
+            chunks_.begin(), static_cast<std::ptrdiff_t>(position)));
+    } else {
+        chunk.dirty_ = true;
+    }
+
+    return out;
+}
+
+auto Thread::filter_bits(const identifier::Generic& id)
+    -> std::array<std::size_t, filter_hashes_>
+{
+    // NOTE the filter is persisted so it must not depend on std::hash. The
+    // bits are derived from a single FNV-1a hash by double hashing.
+    auto hash = std::uint64_t{14695981039346656037u};
+
+    for (const auto c : id.Bytes()) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= std::uint64_t{1099511628211u};
+    }
+
+    constexpr auto bits = sizeof(Filter) * 8_uz;
+    const auto h1 = static_cast<std::size_t>(hash & 0xffffffffu);
+    const auto h2 = static_cast<std::size_t>(hash >> 32u) | 1_uz;
+    auto out = std::array<std::size_t, filter_hashes_>{};
+
+    for (auto i = 0_uz; i < out.size(); ++i) { out[i] = (h1 + i * h2) % bits; }
+
+    return out;
+}
+
+auto Thread::find_chunk(const SortKey& key) const noexcept -> std::size_t
+{
+    // NOTE every chunk is loaded and non-empty whenever this function is called
+    assert_false(chunks_.empty());
+
+    const auto i = std::ranges::partition_point(chunks_, [&](const auto& c) {
+        return c.items_->crbegin()->first < key;
+    });
+
+    if (chunks_.end() == i) { return chunks_.size() - 1_uz; }
+
+    return static_cast<std::size_t>(std::distance(chunks_.begin(), i));
+}
+
+auto Thread::find_item(const Lock& lock, const identifier::Generic& id) const
+    noexcept(false) -> std::optional<Location>
+{
+    assert_true(verify_write_lock(lock));
+
+    for (auto position = 0_uz; position < chunks_.size(); ++position) {
+        auto& chunk = chunks_[position];
+
+        if (false == may_contain(chunk, id)) { continue; }
+
+        for (const auto& [key, item] : load_chunk(chunk)) {
+            if (std::get<2>(key) == id) {
+                return std::make_optional<Location>(position, key);
+            }
+        }
+    }
+
+    return std::nullopt;
 }
 
 auto Thread::ID() const -> identifier::Generic { return id_; }
 
+auto Thread::insert_item(
+    const Lock& lock,
+    const identifier::Generic& id,
+    protobuf::StorageThreadItem&& item) noexcept(false) -> void
+{
+    assert_true(verify_write_lock(lock));
+
+    const auto key = sort_key(item);
+    const auto unread = item.unread();
+    // NOTE items which sort after every existing item only need the tail
+    // chunk. Anything else needs every chunk to find its position.
+    const auto after = chunks_.empty() ||
+                       (load_chunk(chunks_.back()).crbegin()->first < key);
+    const auto append = after && (chunks_.empty() ||
+                                  (chunks_.back().count_ >= chunk_size_));
+
+    if (append) {
+        auto& chunk = chunks_.emplace_back();
+        chunk.filter_.emplace();
+        chunk.items_.emplace();
+    } else if (false == after) {
+        for (auto& chunk : chunks_) { load_chunk(chunk); }
+    }
+
+    const auto position = after ? chunks_.size() - 1_uz : find_chunk(key);
+    auto& chunk = chunks_[position];
+    chunk.items_->insert_or_assign(key, std::move(item));
+    add_to_filter(id, *chunk.filter_);
+    chunk.dirty_ = true;
+    ++chunk.count_;
+
+    if (unread) {
+        ++chunk.unread_;
+        ++unread_;
+    }
+
+    if (chunk.count_ > chunk_size_) { split_chunk(position); }
+}
+
+auto Thread::ItemCount() const -> std::size_t
+{
+    const auto lock = Lock{write_lock_};
+    auto output = 0_uz;
+
+    for (const auto& chunk : chunks_) { output += chunk.count_; }
+
+    return output;
+}
+
 auto Thread::Items() const -> protobuf::StorageThread
+{
+    return Items(0_uz, std::numeric_limits<std::size_t>::max());
+}
+
+auto Thread::Items(std::size_t start, std::size_t count) const
+    -> protobuf::StorageThread
 {
     const auto lock = Lock{write_lock_};
+    auto serialized = protobuf::StorageThread{};
+    serialized.set_version(version_);
+    serialized.set_id(id_.asBase58(crypto_));
+
+    for (const auto& nym : participants_) {
+        if (!nym.empty()) {
+            *serialized.add_participant() = nym.asBase58(crypto_);
+        }
+    }
+
+    try {
+        auto position = 0_uz;
+
+        for (auto& chunk : chunks_) {
+            if (0_uz == count) { break; }
+
+            if ((position + chunk.count_) <= start) {
+                position += chunk.count_;
 
-    return serialize(lock);
+                continue;
+            }
+
+            for (const auto& [key, item] : load_chunk(chunk)) {
+                if (0_uz == count) { break; }
+
+                if (position++ < start) { continue; }
+
+                *serialized.add_item() = item;
+                --count;
+            }
+        }
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+    }
+
+    return serialized;
+}
+
+auto Thread::load_chunk(Chunk& chunk) const noexcept(false) -> ChunkItems&
+{
+    if (chunk.items_.has_value()) { return *chunk.items_; }
+
+    auto p = std::shared_ptr<protobuf::StorageThreadChunk>{};
+
+    if ((false == LoadProto(chunk.hash_, p, verbose)) || (false == bool(p))) {
+        throw std::runtime_error{"failed to load thread chunk"};
+    }
+
+    auto& items = chunk.items_.emplace();
+
+    for (const auto& it : p->item()) { items.emplace(sort_key(it), it); }
+
+    if (false == chunk.filter_.has_value()) {
+        chunk.filter_.emplace(build_filter(items));
+    }
+
+    return items;
+}
+
+auto Thread::may_contain(const Chunk& chunk, const identifier::Generic& id)
+    -> bool
+{
+    if (false == chunk.filter_.has_value()) { return true; }
+
+    const auto& filter = *chunk.filter_;
+
+    return std::ranges::all_of(filter_bits(id), [&](const auto bit) {
+        return 0u != (filter[bit / 8_uz] & (1u << (bit % 8_uz)));
+    });
 }
 
 auto Thread::Read(const identifier::Generic& id, const bool unread) -> bool
 {
     const auto lock = Lock{write_lock_};
 
-    auto it = items_.find(id);
+    try {
+        const auto location = find_item(lock, id);
 
-    if (items_.end() == it) {
-        LogError()()("Item does not exist.").Flush();
+        if (false == location.has_value()) {
+            LogError()()("Item does not exist.").Flush();
 
-        return false;
-    }
+            return false;
+        }
 
-    auto& item = it->second;
+        const auto& [position, key] = *location;
+        auto& chunk = chunks_[position];
+        auto& item = chunk.items_->at(key);
+
+        if (item.unread() != unread) {
+            if (unread) {
+                ++chunk.unread_;
+                ++unread_;
+            } else {
+                --chunk.unread_;
+                --unread_;
+            }
+        }
 
-    item.set_unread(unread);
+        item.set_unread(unread);
+        chunk.dirty_ = true;
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
+
+        return false;
+    }
 
     return save(lock);
 }
@@ -238,14 +582,19 @@ auto Thread::Read(const identifier::Generic& id, const bool unread) -> bool
 auto Thread::Remove(const identifier::Generic& id) -> bool
 {
     const auto lock = Lock{write_lock_};
+    auto removed = std::optional<protobuf::StorageThreadItem>{};
+
+    try {
+        removed = erase_item(lock, id);
+    } catch (const std::exception& e) {
+        LogError()()(e.what()).Flush();
 
-    auto it = items_.find(id);
+        return false;
+    }
 
-    if (items_.end() == it) { return false; }
+    if (false == removed.has_value()) { return false; }
 
-    auto& item = it->second;
-    auto box = static_cast<otx::client::StorageBox>(item.box());
-    items_.erase(it);
+    auto box = static_cast<otx::client::StorageBox>(removed->box());
 
     switch (box) {
         case otx::client::StorageBox::MAILINBOX: {
@@ -282,6 +631,20 @@ auto Thread::save(const Lock& lock) const -> bool
 {
     assert_true(verify_write_lock(lock));
 
+    for (auto& chunk : chunks_) {
+        if (false == chunk.dirty_) { continue; }
+
+        const auto serialized = serialize(chunk);
+
+        if (!protobuf::syntax::check(LogError(), serialized)) { return false; }
+
+        if (false == StoreProto(serialized, chunk.hash_)) { return false; }
+
+        // NOTE drops the ids of items which were removed from the chunk
+        chunk.filter_.emplace(build_filter(*chunk.items_));
+        chunk.dirty_ = false;
+    }
+
     auto serialized = serialize(lock);
 
     if (!protobuf::syntax::check(LogError(), serialized)) { return false; }
@@ -303,12 +666,34 @@ auto Thread::serialize(const Lock& lock) const -> protobuf::StorageThread
         }
     }
 
-    auto sorted = sort(lock);
+    serialized.set_unread(unread_);
+    serialized.set_nextindex(index_);
 
-    for (const auto& it : sorted) {
-        assert_false(nullptr == it.second);
+    for (const auto& chunk : chunks_) {
+        auto& descriptor = *serialized.add_chunk();
+        descriptor.set_version(chunk_version_);
+        write(chunk.hash_, *descriptor.mutable_hash());
+        descriptor.set_count(chunk.count_);
+        descriptor.set_unread(chunk.unread_);
 
-        const auto& item = *it.second;
+        if (chunk.filter_.has_value()) {
+            const auto& filter = *chunk.filter_;
+            descriptor.set_filter(UnallocatedCString{
+                reinterpret_cast<const char*>(filter.data()), filter.size()});
+        }
+    }
+
+    return serialized;
+}
+
+auto Thread::serialize(const Chunk& chunk) const -> protobuf::StorageThreadChunk
+{
+    assert_true(chunk.items_.has_value());
+
+    auto serialized = protobuf::StorageThreadChunk{};
+    serialized.set_version(chunk_version_);
+
+    for (const auto& [key, item] : *chunk.items_) {
         *serialized.add_item() = item;
     }
 
@@ -324,37 +709,46 @@ auto Thread::SetAlias(std::string_view alias) -> bool
     return true;
 }
 
-auto Thread::sort(const Lock& lock) const -> Thread::SortedItems
+auto Thread::sort_key(const protobuf::StorageThreadItem& item) const -> SortKey
 {
-    assert_true(verify_write_lock(lock));
-
-    SortedItems output;
-
-    for (const auto& it : items_) {
-        const auto& id = it.first;
-        const auto& item = it.second;
+    return {
+        convert_to_size(item.index()),
+        static_cast<std::int64_t>(item.time()),
+        factory_.IdentifierFromBase58(item.id())};
+}
 
-        if (!id.empty()) {
-            SortKey key{item.index(), item.time(), id};
-            output.emplace(key, &item);
+auto Thread::split_chunk(std::size_t position) noexcept -> void
+{
+    auto& chunk = chunks_[position];
+    auto& items = *chunk.items_;
+    auto upper = Chunk{};
+    upper.items_.emplace();
+    upper.dirty_ = true;
+    const auto half = static_cast<std::ptrdiff_t>(items.size() / 2_uz);
+    auto i = std::next(items.begin(), half);
+
+    while (items.end() != i) {
+        const auto unread = i->second.unread();
+        upper.items_->insert(items.extract(i++));
+        ++upper.count_;
+        --chunk.count_;
+
+        if (unread) {
+            ++upper.unread_;
+            --chunk.unread_;
         }
     }
 
-    return output;
+    upper.filter_.emplace(build_filter(*upper.items_));
+    const auto next = static_cast<std::ptrdiff_t>(position + 1_uz);
+    chunks_.insert(std::next(chunks_.begin(), next), std::move(upper));
 }
 
 auto Thread::UnreadCount() const -> std::size_t
 {
     const auto lock = Lock{write_lock_};
-    std::size_t output{0};
-
-    for (const auto& it : items_) {
-        const auto& item = it.second;
-
-        if (item.unread()) { ++output; }
-    }
 
-    return output;
+    return unread_;
 }
 
 auto Thread::upgrade(const Lock& lock) noexcept -> bool
@@ -362,24 +756,29 @@ auto Thread::upgrade(const Lock& lock) noexcept -> bool
     auto changed = Node::upgrade(lock);
 
     switch (original_version_.get()) {
-        case 1u:
-        default: {
-            for (auto& it : items_) {
-                auto& item = it.second;
-                const auto box =
-                    static_cast<otx::client::StorageBox>(item.box());
-
-                switch (box) {
-                    case otx::client::StorageBox::MAILOUTBOX: {
-                        if (item.unread()) {
-                            item.set_unread(false);
-                            changed = true;
+        case 1u: {
+            for (auto& chunk : chunks_) {
+                for (auto& [key, item] : *chunk.items_) {
+                    const auto box =
+                        static_cast<otx::client::StorageBox>(item.box());
+
+                    switch (box) {
+                        case otx::client::StorageBox::MAILOUTBOX: {
+                            if (item.unread()) {
+                                item.set_unread(false);
+                                --chunk.unread_;
+                                --unread_;
+                                changed = true;
+                            }
+                        } break;
+                        default: {
                         }
-                    } break;
-                    default: {
                     }
                 }
             }
+        } break;
+        case 2u:
+        default: {
         }
     }
 
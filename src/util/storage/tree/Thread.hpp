@@ -6,13 +6,18 @@
 #pragma once
 
 #include <opentxs/protobuf/StorageThread.pb.h>
+#include <opentxs/protobuf/StorageThreadChunk.pb.h>
 #include <opentxs/protobuf/StorageThreadItem.pb.h>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string_view>
 #include <tuple>
+#include <utility>
 
 #include "internal/util/Mutex.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/Time.hpp"
 #include "opentxs/identifier/Generic.hpp"
 #include "opentxs/otx/client/Types.hpp"
@@ -57,7 +62,14 @@ public:
     auto Alias() const -> UnallocatedCString;
     auto Check(const identifier::Generic& id) const -> bool;
     auto ID() const -> identifier::Generic;
+    auto ItemCount() const -> std::size_t;
     auto Items() const -> protobuf::StorageThread;
+    /// Return up to count items beginning at position start
+    ///
+    /// Positions are counted from the oldest item. Only the chunks which
+    /// contain the requested items are loaded.
+    auto Items(std::size_t start, std::size_t count) const
+        -> protobuf::StorageThread;
     auto UnreadCount() const -> std::size_t;
 
     auto Add(
@@ -84,24 +96,71 @@ public:
 
 private:
     friend Threads;
+
     using SortKey = std::tuple<std::size_t, std::int64_t, identifier::Generic>;
-    using SortedItems =
-        UnallocatedMap<SortKey, const protobuf::StorageThreadItem*>;
+    using ChunkItems = UnallocatedMap<SortKey, protobuf::StorageThreadItem>;
+    // NOTE a bloom filter over the ids of the items in a chunk
+    using Filter = std::array<std::uint8_t, 256>;
+    using Location = std::pair<std::size_t, SortKey>;
+
+    // NOTE items are kept in sort order across a sequence of chunks which are
+    // stored as separate objects. Chunk contents are loaded on demand and only
+    // modified chunks are written when the thread is saved. The reference to
+    // each chunk holds a filter of the item ids it contains, so finding an
+    // item only loads the chunks which might contain it.
+    struct Chunk {
+        Hash hash_{};
+        std::size_t count_{};
+        std::size_t unread_{};
+        std::optional<Filter> filter_{};
+        std::optional<ChunkItems> items_{};
+        bool dirty_{};
+    };
+
+    static constexpr auto current_version_ = VersionNumber{2};
+    static constexpr auto chunk_version_ = VersionNumber{1};
+    static constexpr auto item_version_ = VersionNumber{1};
+    static constexpr auto chunk_size_ = 128_uz;
+    static constexpr auto filter_hashes_ = 4_uz;
+
+    static auto add_to_filter(const identifier::Generic& id, Filter& filter)
+        -> void;
+    static auto build_filter(const ChunkItems& items) -> Filter;
+    static auto filter_bits(const identifier::Generic& id)
+        -> std::array<std::size_t, filter_hashes_>;
+    static auto may_contain(const Chunk& chunk, const identifier::Generic& id)
+        -> bool;
 
     identifier::Generic id_;
     UnallocatedCString alias_;
     std::size_t index_;
+    std::size_t unread_;
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
-    UnallocatedMap<identifier::Generic, protobuf::StorageThreadItem> items_;
+    mutable UnallocatedVector<Chunk> chunks_;
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
     UnallocatedSet<identifier::Generic> participants_;
 
-    auto init(const Hash& hash) noexcept(false) -> void final;
+    auto dump(const Lock&, const Log&, Vector<Hash>& out) const noexcept
+        -> bool final;
+    auto find_chunk(const SortKey& key) const noexcept -> std::size_t;
+    auto find_item(const Lock& lock, const identifier::Generic& id) const
+        noexcept(false) -> std::optional<Location>;
+    auto load_chunk(Chunk& chunk) const noexcept(false) -> ChunkItems&;
     auto save(const Lock& lock) const -> bool final;
     auto serialize(const Lock& lock) const -> protobuf::StorageThread;
-    auto sort(const Lock& lock) const -> SortedItems;
+    auto serialize(const Chunk& chunk) const -> protobuf::StorageThreadChunk;
+    auto sort_key(const protobuf::StorageThreadItem& item) const -> SortKey;
+
+    auto erase_item(const Lock& lock, const identifier::Generic& id) noexcept(
+        false) -> std::optional<protobuf::StorageThreadItem>;
+    auto init(const Hash& hash) noexcept(false) -> void final;
+    auto insert_item(
+        const Lock& lock,
+        const identifier::Generic& id,
+        protobuf::StorageThreadItem&& item) noexcept(false) -> void;
+    auto split_chunk(std::size_t position) noexcept -> void;
     auto upgrade(const Lock& lock) noexcept -> bool final;
 
     Thread(
@@ -7,11 +7,17 @@
 
 #include <opentxs/opentxs.hpp>
 
+#include "internal/core/String.hpp"
 #include "internal/otx/common/Ledger.hpp"  // IWYU pragma: keep
+#include "internal/otx/common/LedgerCache.hpp"
+#include "internal/otx/common/transaction/Helpers.hpp"
 #include "opentxs/api/Factory.internal.hpp"
+#include "opentxs/api/Paths.internal.hpp"
+#include "opentxs/api/Session.internal.hpp"
 #include "opentxs/api/session/Factory.internal.hpp"
 #include "opentxs/otx/Types.internal.hpp"
 #include "ottest/env/OTTestEnvironment.hpp"
+#include "otx/common/OTStorage.hpp"
 
 namespace ot = opentxs;
 
@@ -25,6 +31,20 @@ Ledger::Ledger()
 {
 }
 
+auto Ledger::cache() const noexcept -> ot::LedgerCache&
+{
+    return client_.Internal().Ledgers();
+}
+
+auto Ledger::cached(const Location& location) const noexcept
+    -> std::optional<ot::UnallocatedCString>
+{
+    const auto& [one, two, three, four] = location;
+
+    return cache().Load(ot::LedgerCache::Key(
+        client_.DataFolder().string(), one, two, three, four));
+}
+
 auto Ledger::get_nymbox(
     const ot::identifier::Nym& nym,
     const ot::identifier::Notary& server,
@@ -33,4 +53,52 @@ auto Ledger::get_nymbox(
     return client_.Factory().Internal().Session().Ledger(
         nym, nym, server, ot::otx::ledgerType::nymbox, create);
 }
+
+auto Ledger::nymbox(
+    const ot::identifier::Nym& nym,
+    const ot::identifier::Notary& server) const noexcept -> Location
+{
+    const auto& crypto = client_.Crypto();
+
+    return {
+        client_.Internal().Paths().Nymbox(),
+        server.asBase58(crypto),
+        nym.asBase58(crypto),
+        ""};
+}
+
+auto Ledger::path(const Location& location) const noexcept
+    -> std::filesystem::path
+{
+    const auto& [one, two, three, four] = location;
+    auto out = ot::UnallocatedCString{};
+    ot::OTDB::FormPathString(
+        client_, out, client_.DataFolder().string(), one, two, three, four);
+
+    return out;
+}
+
+auto Ledger::read(const Location& location) const noexcept
+    -> ot::UnallocatedCString
+{
+    const auto& [one, two, three, four] = location;
+
+    return ot::OTDB::QueryPlainString(
+        client_, client_.DataFolder().string(), one, two, three, four);
+}
+
+auto Ledger::receipt(opentxs::Ledger& box, ot::OTTransaction& transaction)
+    const noexcept -> Location
+{
+    auto one = ot::String::Factory();
+    auto two = ot::String::Factory();
+    auto three = ot::String::Factory();
+    auto four = ot::String::Factory();
+    const auto rc = ot::SetupBoxReceiptFilename(
+        client_, box, transaction, __func__, one, two, three, four);
+
+    if (false == rc) { return {}; }
+
+    return {one->Get(), two->Get(), three->Get(), four->Get()};
+}
 }  // namespace ottest
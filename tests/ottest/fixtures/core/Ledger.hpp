@@ -7,7 +7,10 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <array>
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 namespace ot = opentxs;
 
@@ -15,21 +18,39 @@ namespace ot = opentxs;
 namespace opentxs
 {
 class Ledger;
+class LedgerCache;
+class OTTransaction;
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
 namespace ottest
 {
 struct OPENTXS_EXPORT Ledger : public ::testing::Test {
+    /// Location of a box or box receipt relative to the data folder
+    using Location = std::array<ot::UnallocatedCString, 4>;
+
     const ot::api::session::Client& client_;
     const ot::api::session::Notary& server_;
     ot::PasswordPrompt reason_c_;
     ot::PasswordPrompt reason_s_;
 
+    auto cache() const noexcept -> ot::LedgerCache&;
+    auto cached(const Location& location) const noexcept
+        -> std::optional<ot::UnallocatedCString>;
     auto get_nymbox(
         const ot::identifier::Nym& nym,
         const ot::identifier::Notary& server,
         bool create) const noexcept -> std::unique_ptr<opentxs::Ledger>;
+    auto nymbox(
+        const ot::identifier::Nym& nym,
+        const ot::identifier::Notary& server) const noexcept -> Location;
+    auto path(const Location& location) const noexcept
+        -> std::filesystem::path;
+    /// Reads from the data store without consulting the cache
+    auto read(const Location& location) const noexcept
+        -> ot::UnallocatedCString;
+    auto receipt(opentxs::Ledger& box, ot::OTTransaction& transaction)
+        const noexcept -> Location;
 
     Ledger();
 };
@@ -0,0 +1,51 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ottest/fixtures/core/Storage.hpp"  // IWYU pragma: associated
+
+#include <opentxs/opentxs.hpp>
+
+#include "api/session/Storage.hpp"
+#include "internal/util/storage/drivers/Factory.hpp"
+#include "internal/util/storage/drivers/Plugin.hpp"
+#include "opentxs/api/Session.internal.hpp"
+#include "opentxs/api/session/internal.factory.hpp"
+#include "ottest/env/OTTestEnvironment.hpp"
+
+namespace ottest
+{
+Storage::Storage()
+    : api_(OTTestEnvironment::GetOT().StartClientSession(0))
+    , config_(
+          api_.Internal().Paths(),
+          api_.Config(),
+          api_.GetOptions(),
+          api_.DataFolder())
+    , bucket_()
+{
+    config_.primary_plugin_ = ot::OT_STORAGE_PRIMARY_PLUGIN_LMDB;
+    config_.migrate_plugin_ = false;
+}
+
+auto Storage::open() const -> std::shared_ptr<Imp>
+{
+    auto out = std::dynamic_pointer_cast<Imp>(
+        ot::factory::StorageAPI(api_.Crypto(), api_.Factory(), config_));
+
+    if (out) { out->Internal().start(); }
+
+    return out;
+}
+
+auto Storage::plugin() -> std::shared_ptr<Plugin>
+{
+    auto out = ot::factory::StoragePlugin(
+        api_.Crypto(), api_.Factory(), bucket_, config_);
+
+    if (out) { out->FindBestRoot(); }
+
+    return out;
+}
+}  // namespace ottest
@@ -0,0 +1,66 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <atomic>
+#include <memory>
+
+#include "util/storage/Config.hpp"
+
+namespace ot = opentxs;
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs
+{
+namespace api
+{
+namespace session
+{
+namespace imp
+{
+class Storage;
+}  // namespace imp
+}  // namespace session
+}  // namespace api
+
+namespace storage
+{
+namespace driver
+{
+class Plugin;
+}  // namespace driver
+}  // namespace storage
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace ottest
+{
+/// Opens storage instances backed by an LMDB database in the data folder of
+/// client session 0
+///
+/// Each instance opens the same database, so destroying one and opening
+/// another is equivalent to restarting the process. Only one instance may be
+/// open at a time.
+class OPENTXS_EXPORT Storage : public ::testing::Test
+{
+protected:
+    using Imp = ot::api::session::imp::Storage;
+    using Plugin = ot::storage::driver::Plugin;
+
+    const ot::api::Session& api_;
+    ot::storage::Config config_;
+    std::atomic<ot::storage::Bucket> bucket_;
+
+    auto open() const -> std::shared_ptr<Imp>;
+    /// Opens the database without the storage api so tests can read tree
+    /// nodes and drivers directly
+    auto plugin() -> std::shared_ptr<Plugin>;
+
+    Storage();
+};
+}  // namespace ottest
@@ -881,4 +881,43 @@ TEST_F(ApiCryptoBlockchain, batch)
         }
     }
 }
+
+TEST_F(ApiCryptoBlockchain, batch_derivation)
+{
+    const auto& nym = alex_;
+    const auto chain = bch_chain_;
+    const auto& accountID = account_9_id_.get();
+    const auto& account = api_.Crypto()
+                              .Blockchain()
+                              .Account(nym, chain)
+                              .Subaccount(accountID)
+                              .asDeterministic()
+                              .asHD();
+    const auto& root = account.RootNode(reason_);
+
+    ASSERT_TRUE(root.IsValid());
+
+    // NOTE keys generated in batches by the parallel backend must be the same
+    // keys which are obtained by deriving each index individually
+    for (const auto& [subchain, change] :
+         {std::make_pair(Subchain::External, 0u),
+          std::make_pair(Subchain::Internal, 1u)}) {
+        const auto gen = account.LastGenerated(subchain);
+
+        ASSERT_TRUE(gen.has_value());
+
+        const auto parent = root.ChildKey(change, reason_);
+
+        ASSERT_TRUE(parent.IsValid());
+
+        for (auto index{0u}; index <= gen.value(); ++index) {
+            const auto expected = parent.ChildKey(index, reason_);
+            const auto& element = account.BalanceElement(subchain, index);
+
+            ASSERT_TRUE(expected.IsValid());
+            EXPECT_EQ(element.Index(), index);
+            EXPECT_EQ(element.Key().PublicKey(), expected.PublicKey());
+        }
+    }
+}
 }  // namespace ottest
@@ -3,16 +3,20 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <boost/endian/conversion.hpp>
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
+#include <span>
 #include <string_view>
 #include <utility>
 
+#include "blockchain/cfilter/SipHash.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/bloom/Filter.hpp"
 #include "internal/blockchain/bloom/UpdateFlag.hpp"
@@ -158,6 +162,154 @@ TEST_F(Filters, golomb_coding)
     }
 }
 
+TEST_F(Filters, golomb_decode_matches_bitreader)
+{
+    const auto P = std::uint8_t{19};
+    const auto elements = [] {
+        auto out = ot::Vector<std::uint64_t>{};
+        auto value = std::uint64_t{0};
+
+        for (auto i = 0_uz; i < 5000_uz; ++i) {
+            // NOLINTNEXTLINE(cert-msc30-c,cert-msc50-cpp)
+            value += 1u + static_cast<std::uint64_t>(rand());
+
+            // include quotients longer than a 64 bit word
+            if (0_uz == (i % 997_uz)) { value += std::uint64_t{1} << 27u; }
+
+            out.emplace_back(value);
+        }
+
+        return out;
+    }();
+    const auto encoded = ot::gcs::GolombEncode(P, elements, {});
+    // NOTE request a few more elements than were encoded to verify that
+    // reading past the end behaves the same in both decoders
+    const auto N = static_cast<std::uint32_t>(elements.size() + 3_uz);
+    const auto expected = [&] {
+        auto out = ot::Vector<std::uint64_t>{};
+        auto stream = ot::blockchain::internal::BitReader{encoded};
+        auto last = std::uint64_t{0};
+
+        for (auto i = 0_uz; i < N; ++i) {
+            auto quotient = std::uint64_t{0};
+
+            while (1 == stream.read(1)) { ++quotient; }
+
+            last += (quotient << P) + stream.read(P);
+            out.emplace_back(last);
+        }
+
+        return out;
+    }();
+    const auto decoded = ot::gcs::GolombDecode(N, P, encoded, {});
+
+    ASSERT_EQ(expected.size(), decoded.size());
+
+    for (auto i = 0_uz; i < decoded.size(); ++i) {
+        EXPECT_EQ(expected.at(i), decoded.at(i));
+    }
+}
+
+TEST_F(Filters, siphash_kernels)
+{
+    namespace sh = ot::gcs::siphash;
+
+    const auto random = [&](std::size_t size) {
+        auto out = ot::Space(size);
+
+        EXPECT_TRUE(api_.Crypto().Util().RandomizeMemory(out.data(), size));
+
+        return out;
+    };
+    // NOTE libsodium provides the reference implementation
+    const auto reference = [&](ot::ReadView key, ot::ReadView item) {
+        auto out = ot::gcs::Hash{};
+
+        EXPECT_TRUE(api_.Crypto().Hash().HMAC(
+            ot::crypto::HashType::SipHash24,
+            key,
+            item,
+            ot::preallocated(sizeof(out), &out)));
+
+        return boost::endian::little_to_native(out);
+    };
+    // NOTE covers every tail length of the final block several times over
+    constexpr auto max_size = 67_uz;
+    constexpr auto count = 1000_uz;
+
+    for (auto round = 0_uz; round < 16_uz; ++round) {
+        const auto key = random(16_uz);
+        const auto k0 = [&] {
+            auto out = std::uint64_t{};
+            std::memcpy(&out, key.data(), sizeof(out));
+
+            return boost::endian::little_to_native(out);
+        }();
+        const auto k1 = [&] {
+            auto out = std::uint64_t{};
+            std::memcpy(&out, std::next(key.data(), 8), sizeof(out));
+
+            return boost::endian::little_to_native(out);
+        }();
+        // NOTE random lengths leave a number of items of each length which
+        // is usually not a multiple of the lane count, so the batch visits
+        // both the vector kernel and the scalar remainder
+        const auto sizes = random(count);
+        auto items = ot::Vector<ot::Space>{};
+        auto views = ot::Vector<ot::ReadView>{};
+        items.reserve(count);
+        views.reserve(count);
+
+        for (const auto size : sizes) {
+            const auto& item = items.emplace_back(
+                random(std::to_integer<std::size_t>(size) % (max_size + 1_uz)));
+            views.emplace_back(ot::reader(item));
+        }
+
+        auto hashes = ot::Vector<ot::gcs::Hash>(count);
+        ot::gcs::Siphash(ot::reader(key), views, hashes);
+
+        for (auto n = 0_uz; n < count; ++n) {
+            const auto& item = views[n];
+            const auto expected = reference(ot::reader(key), item);
+
+            EXPECT_EQ(sh::scalar(k0, k1, item.data(), item.size()), expected);
+            EXPECT_EQ(hashes[n], expected);
+        }
+
+        // NOTE batches smaller than the lane count
+        for (auto n = 1_uz; n < sh::lanes_; ++n) {
+            const auto batch = std::span{views}.first(n);
+            auto out = ot::Vector<ot::gcs::Hash>(n);
+            ot::gcs::Siphash(ot::reader(key), batch, out);
+
+            for (auto i = 0_uz; i < n; ++i) {
+                EXPECT_EQ(out[i], hashes[i]);
+            }
+        }
+
+        if (false == sh::avx2_available()) { continue; }
+
+        for (auto size = 0_uz; size <= max_size; ++size) {
+            auto lanes = ot::Vector<ot::Space>{};
+            auto data = sh::Messages{};
+            auto out = sh::Lanes{};
+            lanes.reserve(sh::lanes_);
+
+            for (auto l = 0_uz; l < sh::lanes_; ++l) {
+                data[l] = reinterpret_cast<const char*>(
+                    lanes.emplace_back(random(size)).data());
+            }
+
+            sh::avx2(k0, k1, data, size, out);
+
+            for (auto l = 0_uz; l < sh::lanes_; ++l) {
+                EXPECT_EQ(out[l], sh::scalar(k0, k1, data[l], size));
+            }
+        }
+    }
+}
+
 TEST_F(Filters, gcs)
 {
     const auto s1 = ot::UnallocatedCString{"blah"};
@@ -204,6 +356,50 @@ TEST_F(Filters, gcs)
     }
 }
 
+TEST_F(Filters, flat_serialization)
+{
+    const auto included = ot::Vector<ot::ByteArray>{
+        ot::ByteArray{"blah"sv.data(), 4_uz},
+        ot::ByteArray{"foo"sv.data(), 3_uz},
+        ot::ByteArray{"justus"sv.data(), 6_uz}};
+    const auto excluded = ot::Vector<ot::ByteArray>{
+        ot::ByteArray{"fellowtraveler"sv.data(), 14_uz}};
+    auto key = ot::UnallocatedCString{"0123456789abcdef"};
+    const auto gcs = ot::factory::GCS(
+        api_, params_.first, params_.second, key, included, {});
+
+    ASSERT_TRUE(gcs.IsValid());
+
+    auto flat = ot::Space{};
+
+    ASSERT_TRUE(gcs.Internal().SerializeFlat(ot::writer(flat)));
+    EXPECT_EQ(flat.size(), gcs.Internal().SerializedFlatSize());
+    EXPECT_TRUE(ot::gcs::IsFlat(ot::reader(flat)));
+
+    auto proto = ot::Space{};
+
+    ASSERT_TRUE(gcs.Serialize(ot::writer(proto)));
+    EXPECT_FALSE(ot::gcs::IsFlat(ot::reader(proto)));
+
+    const auto view = ot::factory::GCSView(api_, ot::reader(flat), {});
+
+    ASSERT_TRUE(view.IsValid());
+    EXPECT_EQ(gcs.ElementCount(), view.ElementCount());
+    EXPECT_EQ(gcs.Hash(), view.Hash());
+    EXPECT_TRUE(view.Test(included, {}));
+    EXPECT_FALSE(view.Test(excluded, {}));
+
+    const auto copy = ot::blockchain::cfilter::GCS{view};
+    // NOTE copies own their data so the record may be released
+    std::fill(flat.begin(), flat.end(), std::byte{0});
+    flat.clear();
+
+    ASSERT_TRUE(copy.IsValid());
+    EXPECT_EQ(gcs.Hash(), copy.Hash());
+    EXPECT_TRUE(copy.Test(included, {}));
+    EXPECT_FALSE(copy.Test(excluded, {}));
+}
+
 TEST_F(Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
 
 TEST_F(Filters, bip158_case_49291) { EXPECT_TRUE(TestGCSBlock(49291)); }
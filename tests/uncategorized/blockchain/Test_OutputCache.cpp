@@ -0,0 +1,439 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "blockchain/database/wallet/OutputCache.hpp"
+#include "internal/blockchain/database/Types.hpp"
+#include "internal/blockchain/node/SpendPolicy.hpp"
+#include "internal/blockchain/protocol/bitcoin/base/block/Factory.hpp"
+#include "internal/util/P0330.hpp"
+#include "internal/util/storage/lmdb/Database.hpp"
+#include "internal/util/storage/lmdb/Transaction.hpp"
+#include "internal/util/storage/lmdb/Types.hpp"
+#include "ottest/Basic.hpp"
+#include "ottest/env/OTTestEnvironment.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using namespace std::literals;
+
+class OutputCache : public ::testing::Test
+{
+protected:
+    using Balance = ot::blockchain::Balance;
+    using Cache = ot::blockchain::database::wallet::OutputCache;
+    using Filter = std::function<bool(const ot::blockchain::block::Outpoint&)>;
+    using Key = ot::blockchain::crypto::Key;
+    using Outpoint = ot::blockchain::block::Outpoint;
+    using Policy = ot::blockchain::node::internal::SpendPolicy;
+    using Selection = ot::blockchain::node::CoinSelection;
+    using State = ot::blockchain::node::TxoState;
+
+    struct Selected {
+        ot::UnallocatedVector<ot::Amount> values_{};
+        bool change_{};
+    };
+
+    static constexpr auto chain_ = ot::blockchain::Type::UnitTest;
+    static constexpr auto count_ = 36_uz;
+    static constexpr auto input_cost_ = 10u;
+    static constexpr auto change_cost_ = 100u;
+    static constexpr auto states_ = std::array{
+        State::ConfirmedNew,
+        State::UnconfirmedNew,
+        State::UnconfirmedSpend,
+        State::ConfirmedSpend,
+        State::OrphanedNew,
+        State::Immature,
+    };
+
+    const ot::api::session::Client& api_;
+    const ot::blockchain::block::Position blank_;
+    const std::array<ot::identifier::Nym, 2> nyms_;
+    const std::array<ot::identifier::Account, 3> accounts_;
+    const std::array<ot::identifier::Account, 3> subchains_;
+    ot::storage::lmdb::Database lmdb_;
+    Cache cache_;
+    ot::UnallocatedVector<Outpoint> outputs_;
+    ot::UnallocatedMap<Outpoint, State> state_;
+
+    // NOTE the calculation Output::get_balance performed with match() before
+    // balances were maintained incrementally
+    auto expected(const Filter& filter) const -> Balance
+    {
+        const auto sum = [&](State state) {
+            auto out = ot::Amount{0};
+
+            for (const auto& id : cache_.GetState(state)) {
+                if (filter(id)) { out += cache_.GetOutput(id).Value(); }
+            }
+
+            return out;
+        };
+        const auto spend = sum(State::UnconfirmedSpend);
+        const auto confirmed = spend + sum(State::ConfirmedNew);
+        const auto unconfirmed =
+            confirmed + sum(State::UnconfirmedNew) - spend;
+
+        return {confirmed, unconfirmed};
+    }
+    auto key(std::size_t account, std::size_t index) const -> Key
+    {
+        return {
+            accounts_.at(account),
+            ot::blockchain::crypto::Subchain::External,
+            static_cast<ot::crypto::Bip32Index>(index)};
+    }
+    auto owner(std::size_t account) const -> const ot::identifier::Nym&
+    {
+        // NOTE the first nym owns two accounts
+        return nyms_.at(account / 2_uz);
+    }
+
+    auto add() -> void
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        for (auto n = 0_uz; n < count_; ++n) {
+            const auto account = n % accounts_.size();
+            const auto state = states_.at(n % states_.size());
+            const auto id = [&] {
+                auto txid = ot::blockchain::block::TransactionHash{};
+
+                EXPECT_TRUE(txid.Randomize(32_uz));
+
+                return Outpoint{txid, static_cast<std::uint32_t>(n)};
+            }();
+            auto output = ot::factory::BitcoinTransactionOutput(
+                chain_,
+                static_cast<std::uint32_t>(n),
+                ot::Amount{1000u * (n + 1u)},
+                ot::factory::BitcoinScriptNullData(chain_, {}, {}),
+                std::nullopt,
+                {key(account, n % 2_uz)},
+                {});
+
+            ASSERT_TRUE(cache_.AddOutput(
+                id,
+                state,
+                ot::blockchain::block::Position{
+                    static_cast<ot::blockchain::block::Height>(n),
+                    ot::blockchain::block::Hash{}},
+                accounts_.at(account),
+                subchains_.at(account),
+                tx,
+                std::move(output)));
+
+            // NOTE some outputs belong to both nyms, for example if one sent
+            // to the other, and the owners are added after the state so the
+            // balance of an existing output is added to the new owner
+            cache_.AddToNym(owner(account), id, tx);
+
+            if (0_uz == (n % 5_uz)) { cache_.AddToNym(nyms_.at(1), id, tx); }
+
+            outputs_.emplace_back(id);
+            state_.emplace(id, state);
+        }
+
+        ASSERT_TRUE(tx.Finalize(true));
+    }
+    // NOTE adds confirmed outputs owned only by the specified nym, oldest
+    // first
+    auto add_spendable(
+        const ot::identifier::Nym& nym,
+        const ot::UnallocatedVector<unsigned>& values) -> void
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        for (auto n = 0_uz; n < values.size(); ++n) {
+            const auto id = [&] {
+                auto txid = ot::blockchain::block::TransactionHash{};
+
+                EXPECT_TRUE(txid.Randomize(32_uz));
+
+                return Outpoint{txid, 0u};
+            }();
+            auto output = ot::factory::BitcoinTransactionOutput(
+                chain_,
+                0u,
+                ot::Amount{values.at(n)},
+                ot::factory::BitcoinScriptNullData(chain_, {}, {}),
+                std::nullopt,
+                {key(0_uz, 0_uz)},
+                {});
+
+            ASSERT_TRUE(cache_.AddOutput(
+                id,
+                State::ConfirmedNew,
+                ot::blockchain::block::Position{
+                    static_cast<ot::blockchain::block::Height>(n + 1_uz),
+                    ot::blockchain::block::Hash{}},
+                accounts_.at(0),
+                subchains_.at(0),
+                tx,
+                std::move(output)));
+            cache_.AddToNym(nym, id, tx);
+        }
+
+        ASSERT_TRUE(tx.Finalize(true));
+    }
+    // NOTE reserves outputs the same way the transaction builder does until
+    // the target is funded
+    auto select(
+        const ot::identifier::Nym& nym,
+        Selection strategy,
+        const ot::Amount& target) -> Selected
+    {
+        const auto proposal = api_.Factory().IdentifierFromRandom();
+        auto out = Selected{};
+        auto policy = Policy{};
+        policy.selection_ = strategy;
+        policy.input_cost_ = input_cost_;
+        policy.change_cost_ = change_cost_;
+        policy.target_ = target;
+        auto tx = lmdb_.TransactionRW();
+
+        while (policy.target_ > 0) {
+            const auto [id, missing] =
+                cache_.Select(nym, State::ConfirmedNew, policy, std::nullopt);
+
+            EXPECT_FALSE(missing);
+
+            if (false == id.has_value()) { break; }
+
+            const auto value = cache_.GetOutput(*id).Value();
+            cache_.ConsumeOutput(ot::LogTrace(), proposal, *id, tx);
+            out.values_.emplace_back(value);
+            policy.target_ -= (value - input_cost_);
+        }
+
+        EXPECT_TRUE(tx.Finalize(true));
+        EXPECT_LE(policy.target_, 0);
+        out.change_ = ((ot::Amount{0} - policy.target_) >= change_cost_);
+
+        return out;
+    }
+    auto change() -> void
+    {
+        const auto next = [](State state) {
+            switch (state) {
+                case State::UnconfirmedNew:
+                case State::OrphanedNew:
+                case State::Immature: {
+
+                    return State::ConfirmedNew;
+                }
+                case State::ConfirmedNew: {
+
+                    return State::UnconfirmedSpend;
+                }
+                case State::UnconfirmedSpend: {
+
+                    return State::ConfirmedSpend;
+                }
+                default: {
+
+                    return State::OrphanedSpend;
+                }
+            }
+        };
+        auto tx = lmdb_.TransactionRW();
+
+        for (auto n = 0_uz; n < outputs_.size(); n += 2_uz) {
+            const auto& id = outputs_.at(n);
+            auto& state = state_.at(id);
+            const auto to = next(state);
+
+            ASSERT_TRUE(cache_.ChangeState(state, to, id, tx));
+
+            state = to;
+        }
+
+        ASSERT_TRUE(tx.Finalize(true));
+    }
+    auto check() const -> void
+    {
+        EXPECT_EQ(cache_.GetBalance(), expected([](const auto&) {
+                      return true;
+                  }));
+        EXPECT_EQ(cache_.GetBalances().size(), nyms_.size());
+
+        for (const auto& nym : nyms_) {
+            const auto balance = expected([&](const auto& id) {
+                return cache_.GetNym(nym).contains(id);
+            });
+
+            EXPECT_EQ(cache_.GetBalance(nym), balance);
+            EXPECT_EQ(cache_.GetBalances().at(nym), balance);
+        }
+
+        for (const auto& account : accounts_) {
+            EXPECT_EQ(cache_.GetBalance(account), expected([&](const auto& id) {
+                          return cache_.GetAccount(account).contains(id);
+                      }));
+        }
+
+        for (auto account = 0_uz; account < accounts_.size(); ++account) {
+            for (auto index = 0_uz; index < 2_uz; ++index) {
+                const auto id = key(account, index);
+
+                EXPECT_EQ(cache_.GetBalance(id), expected([&](const auto& o) {
+                              return cache_.GetKey(id).contains(o);
+                          }));
+            }
+        }
+    }
+
+    OutputCache()
+        : api_(OTTestEnvironment::GetOT().StartClientSession(0))
+        , blank_()
+        , nyms_{
+              api_.Factory().NymIDFromRandom(),
+              api_.Factory().NymIDFromRandom()}
+        , accounts_([&] {
+            using enum ot::identifier::AccountSubtype;
+            const auto& factory = api_.Factory();
+
+            return std::array{
+                factory.AccountIDFromRandom(blockchain_subaccount),
+                factory.AccountIDFromRandom(blockchain_subaccount),
+                factory.AccountIDFromRandom(blockchain_subaccount)};
+        }())
+        , subchains_([&] {
+            using enum ot::identifier::AccountSubtype;
+            const auto& factory = api_.Factory();
+
+            return std::array{
+                factory.AccountIDFromRandom(blockchain_subchain),
+                factory.AccountIDFromRandom(blockchain_subchain),
+                factory.AccountIDFromRandom(blockchain_subchain)};
+        }())
+        , lmdb_([&] {
+            namespace db = ot::blockchain::database;
+            // NOTE every test uses its own database
+            const auto folder =
+                Home() / "output-cache" /
+                ::testing::UnitTest::GetInstance()->current_test_info()->name();
+            std::filesystem::create_directories(folder);
+
+            return ot::storage::lmdb::Database{
+                {
+                    {db::Config, "config"},
+                    {db::WalletOutputs, "wallet_outputs"},
+                    {db::AccountOutputs, "account_outputs"},
+                    {db::NymOutputs, "nym_outputs"},
+                    {db::PositionOutputs, "position_outputs"},
+                    {db::ProposalCreatedOutputs, "proposal_created_outputs"},
+                    {db::ProposalSpentOutputs, "proposal_spent_outputs"},
+                    {db::OutputProposals, "output_proposals"},
+                    {db::StateOutputs, "state_outputs"},
+                    {db::SubchainOutputs, "subchain_outputs"},
+                    {db::KeyOutputs, "key_outputs"},
+                    {db::GenerationOutputs, "generation_outputs"},
+                },
+                folder,
+                {
+                    {db::Config, MDB_INTEGERKEY},
+                    {db::WalletOutputs, 0},
+                    {db::AccountOutputs, MDB_DUPSORT},
+                    {db::NymOutputs, MDB_DUPSORT},
+                    {db::PositionOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                    {db::ProposalCreatedOutputs, MDB_DUPSORT},
+                    {db::ProposalSpentOutputs, MDB_DUPSORT},
+                    {db::OutputProposals, 0},
+                    {db::StateOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                    {db::SubchainOutputs, MDB_DUPSORT},
+                    {db::KeyOutputs, MDB_DUPSORT},
+                    {db::GenerationOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                },
+                0};
+        }())
+        , cache_(api_, lmdb_, chain_, blank_)
+        , outputs_()
+        , state_()
+    {
+        cache_.Populate();
+    }
+};
+
+TEST_F(OutputCache, balances_match_outputs)
+{
+    add();
+    check();
+    change();
+    check();
+
+    // NOTE reloading from the database recalculates every aggregate
+    cache_.Clear();
+    cache_.Populate();
+    check();
+}
+
+TEST_F(OutputCache, coin_selection_oldest)
+{
+    const auto nym = api_.Factory().NymIDFromRandom();
+    add_spendable(nym, {1000u, 2000u, 4000u, 8000u});
+    const auto selected = select(nym, Selection::Oldest, 2500);
+    const auto expected =
+        ot::UnallocatedVector<ot::Amount>{ot::Amount{1000}, ot::Amount{2000}};
+
+    EXPECT_EQ(selected.values_, expected);
+    EXPECT_TRUE(selected.change_);
+}
+
+TEST_F(OutputCache, coin_selection_largest)
+{
+    const auto nym = api_.Factory().NymIDFromRandom();
+    add_spendable(nym, {1000u, 2000u, 4000u, 8000u});
+    const auto selected = select(nym, Selection::Largest, 2950);
+    const auto expected = ot::UnallocatedVector<ot::Amount>{ot::Amount{8000}};
+
+    EXPECT_EQ(selected.values_, expected);
+    EXPECT_TRUE(selected.change_);
+}
+
+TEST_F(OutputCache, coin_selection_branch_and_bound)
+{
+    const auto nym = api_.Factory().NymIDFromRandom();
+    add_spendable(nym, {4000u, 8000u, 2000u, 1000u});
+    // NOTE the smallest single output which covers the target would leave
+    // change but two smaller outputs fund it exactly
+    const auto selected = select(nym, Selection::BranchAndBound, 2950);
+    const auto expected =
+        ot::UnallocatedVector<ot::Amount>{ot::Amount{2000}, ot::Amount{1000}};
+
+    EXPECT_EQ(selected.values_, expected);
+    EXPECT_FALSE(selected.change_);
+}
+
+TEST_F(OutputCache, coin_selection_branch_and_bound_fallback)
+{
+    const auto nym = api_.Factory().NymIDFromRandom();
+    add_spendable(nym, {1000u, 2000u, 4000u, 8000u});
+    // NOTE no combination lands in the changeless window so the smallest
+    // output which covers the target is used
+    const auto selected = select(nym, Selection::BranchAndBound, 5000);
+    const auto expected = ot::UnallocatedVector<ot::Amount>{ot::Amount{8000}};
+
+    EXPECT_EQ(selected.values_, expected);
+    EXPECT_TRUE(selected.change_);
+}
+}  // namespace ottest
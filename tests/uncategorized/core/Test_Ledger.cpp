@@ -5,11 +5,16 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <cstdint>
+#include <filesystem>
 #include <memory>
 
 #include "internal/core/contract/ServerContract.hpp"
 #include "internal/otx/common/Ledger.hpp"
+#include "internal/otx/common/OTTransaction.hpp"
+#include "opentxs/api/session/Factory.internal.hpp"
 #include "opentxs/api/session/Wallet.internal.hpp"
+#include "opentxs/otx/Types.internal.hpp"
 #include "ottest/fixtures/common/Base.hpp"
 #include "ottest/fixtures/core/Ledger.hpp"
 
@@ -19,6 +24,7 @@ namespace ottest
 {
 ot::identifier::Nym nym_id_{};
 ot::identifier::Notary server_id_{};
+constexpr auto number_ = std::int64_t{7};
 
 TEST_F(Ledger, init)
 {
@@ -60,4 +66,137 @@ TEST_F(Ledger, load_nymbox)
     ASSERT_TRUE(nymbox);
     EXPECT_TRUE(nymbox->LoadNymbox());
 }
+
+TEST_F(Ledger, save_updates_cache)
+{
+    const auto location = nymbox(nym_id_, server_id_);
+    const auto before = cached(location);
+
+    ASSERT_TRUE(before.has_value());
+    EXPECT_EQ(*before, read(location));
+
+    const auto nym = client_.Wallet().Nym(nym_id_);
+    auto nymbox = get_nymbox(nym_id_, server_id_, false);
+
+    ASSERT_TRUE(nym);
+    ASSERT_TRUE(nymbox);
+    ASSERT_TRUE(nymbox->LoadNymbox());
+
+    auto transaction = std::shared_ptr<ot::OTTransaction>{
+        client_.Factory().Internal().Session().Transaction(
+            *nymbox,
+            ot::otx::transactionType::message,
+            ot::otx::originType::not_applicable,
+            number_)};
+
+    ASSERT_TRUE(transaction);
+    ASSERT_TRUE(transaction->SignContract(*nym, reason_c_));
+    ASSERT_TRUE(transaction->SaveContract());
+    ASSERT_TRUE(nymbox->AddTransaction(transaction));
+    ASSERT_TRUE(nymbox->SaveBoxReceipt(number_));
+
+    const auto receiptLocation = receipt(*nymbox, *transaction);
+    const auto saved = cached(receiptLocation);
+
+    ASSERT_TRUE(saved.has_value());
+    EXPECT_EQ(*saved, read(receiptLocation));
+
+    nymbox->ReleaseSignatures();
+
+    ASSERT_TRUE(nymbox->SignContract(*nym, reason_c_));
+    ASSERT_TRUE(nymbox->SaveContract());
+    ASSERT_TRUE(nymbox->SaveNymbox());
+
+    const auto after = cached(location);
+
+    ASSERT_TRUE(after.has_value());
+    EXPECT_NE(*after, *before);
+    EXPECT_EQ(*after, read(location));
+
+    auto loaded = get_nymbox(nym_id_, server_id_, false);
+
+    ASSERT_TRUE(loaded);
+    ASSERT_TRUE(loaded->LoadNymbox());
+    EXPECT_TRUE(loaded->GetTransaction(number_));
+}
+
+TEST_F(Ledger, delete_evicts_box_receipt)
+{
+    auto nymbox = get_nymbox(nym_id_, server_id_, false);
+
+    ASSERT_TRUE(nymbox);
+    ASSERT_TRUE(nymbox->LoadNymbox());
+
+    const auto transaction = nymbox->GetTransaction(number_);
+
+    ASSERT_TRUE(transaction);
+
+    const auto location = receipt(*nymbox, *transaction);
+    const auto saved = cached(location);
+
+    ASSERT_TRUE(saved.has_value());
+    ASSERT_TRUE(nymbox->DeleteBoxReceipt(number_));
+    EXPECT_FALSE(cached(location).has_value());
+    EXPECT_NE(read(location), *saved);
+}
+
+TEST_F(Ledger, failed_save_evicts_box)
+{
+    const auto location = nymbox(nym_id_, server_id_);
+    const auto file = path(location);
+    const auto nym = client_.Wallet().Nym(nym_id_);
+    auto nymbox = get_nymbox(nym_id_, server_id_, false);
+
+    ASSERT_TRUE(nym);
+    ASSERT_TRUE(nymbox);
+    ASSERT_TRUE(nymbox->LoadNymbox());
+    ASSERT_TRUE(cached(location).has_value());
+
+    // NOTE a directory in place of the file makes the next write fail
+    ASSERT_TRUE(std::filesystem::remove(file));
+    ASSERT_TRUE(std::filesystem::create_directory(file));
+    ASSERT_TRUE(nymbox->RemoveTransaction(number_));
+
+    nymbox->ReleaseSignatures();
+
+    ASSERT_TRUE(nymbox->SignContract(*nym, reason_c_));
+    ASSERT_TRUE(nymbox->SaveContract());
+    EXPECT_FALSE(nymbox->SaveNymbox());
+    EXPECT_FALSE(cached(location).has_value());
+
+    // NOTE neither the contents which were previously cached nor the contents
+    // which failed to save may be loaded
+    auto failed = get_nymbox(nym_id_, server_id_, false);
+
+    ASSERT_TRUE(failed);
+    EXPECT_FALSE(failed->LoadNymbox());
+    ASSERT_TRUE(std::filesystem::remove(file));
+    ASSERT_TRUE(nymbox->SaveNymbox());
+
+    const auto saved = cached(location);
+
+    ASSERT_TRUE(saved.has_value());
+    EXPECT_EQ(*saved, read(location));
+
+    auto loaded = get_nymbox(nym_id_, server_id_, false);
+
+    ASSERT_TRUE(loaded);
+    ASSERT_TRUE(loaded->LoadNymbox());
+    EXPECT_FALSE(loaded->GetTransaction(number_));
+}
+
+TEST_F(Ledger, verified_signatures_depend_on_keys)
+{
+    const auto alice = client_.Wallet().Nym(nym_id_);
+    const auto bob = client_.Wallet().Nym(reason_c_, "Bob");
+    auto nymbox = get_nymbox(nym_id_, server_id_, false);
+
+    ASSERT_TRUE(alice);
+    ASSERT_TRUE(bob);
+    ASSERT_TRUE(nymbox);
+    ASSERT_TRUE(nymbox->LoadNymbox());
+    EXPECT_TRUE(nymbox->VerifyAccount(*alice));
+    EXPECT_TRUE(nymbox->VerifyAccount(*alice));
+    EXPECT_FALSE(nymbox->VerifyAccount(*bob));
+}
 }  // namespace ottest
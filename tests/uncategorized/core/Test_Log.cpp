@@ -0,0 +1,141 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstddef>
+#include <source_location>
+#include <string>
+
+#include "internal/util/Log.hpp"
+#include "util/log/Record.hpp"
+#include "util/log/Ring.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace std::literals;
+
+TEST(LogRing, wraps_around)
+{
+    auto ring = ot::internal::LogRing{};
+    const auto record = std::string(1000u, 'x');
+    auto out = std::string{};
+
+    // NOTE pushing and popping more than the capacity forces every position
+    // in the buffer to be reused
+    for (auto i = std::size_t{0}; i < 1000u; ++i) {
+        const auto value = record + std::to_string(i);
+
+        EXPECT_TRUE(ring.Push(value));
+        EXPECT_TRUE(ring.Pop(out));
+        EXPECT_EQ(out, value);
+    }
+
+    EXPECT_FALSE(ring.Pop(out));
+    EXPECT_EQ(ring.Dropped(), 0u);
+}
+
+TEST(LogRing, counts_dropped_records)
+{
+    auto ring = ot::internal::LogRing{};
+    const auto record = std::string(1000u, 'x');
+    auto pushed = std::size_t{0};
+
+    while (ring.Push(record)) { ++pushed; }
+
+    EXPECT_FALSE(ring.Push(record));
+    EXPECT_FALSE(ring.TryPush(record));
+    EXPECT_EQ(ring.Dropped(), 2u);
+    EXPECT_EQ(ring.Dropped(), 0u);
+
+    auto out = std::string{};
+    auto popped = std::size_t{0};
+
+    while (ring.Pop(out)) { ++popped; }
+
+    EXPECT_EQ(popped, pushed);
+}
+
+TEST(LogRecord, formats_on_consumer)
+{
+    using ot::internal::LogRecord;
+    const auto loc = std::source_location::current();
+    const auto bytes = "\x01\xab"s;
+    auto record = std::string{};
+    LogRecord::Reset(record);
+
+    EXPECT_TRUE(LogRecord::Empty(record));
+
+    LogRecord::AddLocation(loc, record);
+    LogRecord::AddText("value: ", record);
+    LogRecord::AddHex(bytes, record);
+    LogRecord::AddText(" after ", record);
+    LogRecord::AddDuration(5ms, record);
+    LogRecord::Finish({3, ot::LogAction::flush, ot::Console::out}, record);
+
+    EXPECT_FALSE(LogRecord::Empty(record));
+
+    const auto expected = std::string{loc.function_name()} + " in " +
+                          loc.file_name() + ": " + std::to_string(loc.line()) +
+                          ":\n * value: 01ab after 5 milliseconds";
+    auto text = std::string{};
+    const auto header = LogRecord::Format(record, text);
+
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header->level_, 3);
+    EXPECT_EQ(header->action_, ot::LogAction::flush);
+    EXPECT_EQ(header->console_, ot::Console::out);
+    EXPECT_EQ(text, expected);
+    EXPECT_FALSE(LogRecord::Format(record.substr(0, record.size() - 1u), text)
+                     .has_value());
+}
+
+TEST(LogRecord, truncates_oversized_records)
+{
+    using ot::internal::LogRecord;
+    const auto header =
+        LogRecord::Header{-2, ot::LogAction::terminate, ot::Console::err};
+    const auto text = std::string(1000u, 'x');
+    auto record = std::string{};
+    LogRecord::Reset(record);
+    LogRecord::AddText("fatal: ", record);
+    LogRecord::AddText(text, record);
+    LogRecord::AddDuration(5ms, record);
+    auto small = record;
+    LogRecord::Finish(header, record);
+    LogRecord::Truncate(record.size(), record);
+    auto out = std::string{};
+
+    ASSERT_TRUE(LogRecord::Format(record, out).has_value());
+    EXPECT_EQ(out, "fatal: " + text + "5 milliseconds");
+
+    // NOTE the text field which crosses the limit is shortened and the
+    // duration after it is dropped
+    const auto limit = small.size() - 500u;
+    LogRecord::Truncate(limit, small);
+    LogRecord::Finish(header, small);
+
+    EXPECT_LE(small.size(), limit);
+
+    const auto formatted = LogRecord::Format(small, out);
+
+    ASSERT_TRUE(formatted.has_value());
+    EXPECT_EQ(formatted->action_, ot::LogAction::terminate);
+    EXPECT_EQ(out.substr(0u, 7u), "fatal: ");
+    EXPECT_EQ(out.substr(out.size() - 12u), " [truncated]");
+    EXPECT_GT(out.size(), 400u);
+    EXPECT_EQ(out.find("milliseconds"), std::string::npos);
+}
+
+TEST(Log, compiled_levels)
+{
+    using ot::internal::Log;
+
+    EXPECT_FALSE(Log::Active<Log::max_level_ + 1>(ot::LogInsane()));
+}
+}  // namespace ottest
@@ -0,0 +1,189 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "api/session/Storage.hpp"
+#include "internal/util/P0330.hpp"
+#include "internal/util/storage/tree/Types.hpp"
+#include "opentxs/util/storage/Driver.hpp"
+#include "ottest/fixtures/core/Storage.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using namespace std::literals;
+
+// NOTE implements only the members which existed before Exists was added
+class LegacyDriver final : public ot::storage::Driver
+{
+public:
+    auto Description() const noexcept -> std::string_view final
+    {
+        return "legacy"sv;
+    }
+    auto Load(
+        const ot::Log&,
+        const ot::storage::Hash&,
+        ot::storage::Search,
+        ot::Writer&) const noexcept -> bool final
+    {
+        return false;
+    }
+    auto LoadRoot() const noexcept -> ot::storage::Hash final { return {}; }
+
+    auto Commit(
+        const ot::storage::Hash&,
+        ot::storage::Transaction,
+        ot::storage::Bucket) const noexcept -> bool final
+    {
+        return false;
+    }
+    auto EmptyBucket(ot::storage::Bucket) const noexcept -> bool final
+    {
+        return false;
+    }
+    auto Store(ot::storage::Transaction, ot::storage::Bucket) const noexcept
+        -> bool final
+    {
+        return false;
+    }
+
+    LegacyDriver() = default;
+};
+
+#if OT_STORAGE_LMDB
+class StorageGC : public Storage
+{
+protected:
+    static constexpr auto accounts_ = 20_uz;
+
+    auto populate(const Imp& storage) const -> bool
+    {
+        const auto& factory = api_.Factory();
+
+        for (auto n = 0_uz; n < accounts_; ++n) {
+            using enum ot::identifier::AccountSubtype;
+            const auto nym = factory.NymIDFromRandom();
+            const auto stored = storage.Store(
+                factory.AccountIDFromRandom(custodial_account),
+                std::to_string(n),
+                {},
+                nym,
+                nym,
+                nym,
+                factory.NotaryIDFromRandom(),
+                factory.UnitIDFromRandom(),
+                ot::UnitType::Btc);
+
+            if (false == stored) { return false; }
+        }
+
+        return storage.Flush();
+    }
+};
+#endif  // OT_STORAGE_LMDB
+
+TEST(StorageDriver, exists_defaults_to_missing)
+{
+    const auto driver = LegacyDriver{};
+    const auto& base = static_cast<const ot::storage::Driver&>(driver);
+
+    EXPECT_FALSE(base.Exists({}, ot::storage::Bucket::left));
+    EXPECT_FALSE(base.Exists({}, ot::storage::Bucket::right));
+}
+
+#if OT_STORAGE_LMDB
+TEST_F(StorageGC, resumes_after_restart)
+{
+    auto first = ot::storage::tree::GCParams{};
+
+    {
+        const auto storage = open();
+
+        ASSERT_TRUE(storage);
+        ASSERT_TRUE(populate(*storage));
+
+        const auto params = storage->StartGC();
+
+        ASSERT_TRUE(params.has_value());
+
+        first = *params;
+
+        ASSERT_TRUE(storage->DoGC(first, 1_uz));
+        EXPECT_EQ(first.position_, 1u);
+        EXPECT_GT(first.total_, accounts_);
+        EXPECT_EQ(first.copied_ + first.skipped_, 1u);
+        EXPECT_TRUE(storage->UpdateGC(first));
+        EXPECT_TRUE(storage->Flush());
+    }
+
+    const auto storage = open();
+
+    ASSERT_TRUE(storage);
+
+    // NOTE the counters describe a single process so only the position and
+    // the root being collected survive a restart
+    auto resumed = storage->GCStatus();
+
+    EXPECT_TRUE(resumed.running_);
+    EXPECT_EQ(resumed.position_, first.position_);
+    EXPECT_EQ(resumed.root_, first.root_);
+    EXPECT_EQ(resumed.from_, first.from_);
+    EXPECT_EQ(resumed.copied_ + resumed.skipped_, 0u);
+    EXPECT_FALSE(storage->StartGC().has_value());
+    ASSERT_TRUE(storage->DoGC(resumed, first.total_));
+    EXPECT_EQ(resumed.total_, first.total_);
+    EXPECT_EQ(resumed.position_, resumed.total_);
+    EXPECT_EQ(resumed.copied_ + resumed.skipped_, first.total_ - 1u);
+
+    storage->FinishGC(true);
+    const auto status = storage->GCStatus();
+
+    EXPECT_FALSE(status.running_);
+    EXPECT_EQ(status.position_, 0u);
+}
+
+TEST_F(StorageGC, skips_objects_already_copied)
+{
+    const auto storage = open();
+
+    ASSERT_TRUE(storage);
+    ASSERT_TRUE(populate(*storage));
+
+    auto params = storage->StartGC();
+
+    ASSERT_TRUE(params.has_value());
+
+    const auto step = accounts_ / 2_uz;
+
+    ASSERT_TRUE(storage->DoGC(*params, step));
+
+    const auto copied = params->copied_;
+
+    EXPECT_EQ(params->position_, step);
+    EXPECT_GT(copied, 0u);
+
+    // NOTE an interruption before the position was persisted restarts the run
+    // from the beginning, but the objects copied so far are not copied again
+    params->position_ = 0u;
+    params->copied_ = 0u;
+    params->skipped_ = 0u;
+
+    ASSERT_TRUE(storage->DoGC(*params, params->total_));
+    EXPECT_EQ(params->position_, params->total_);
+    EXPECT_GE(params->skipped_, copied);
+    EXPECT_EQ(params->copied_ + params->skipped_, params->total_);
+
+    storage->FinishGC(true);
+}
+#endif  // OT_STORAGE_LMDB
+}  // namespace ottest
@@ -0,0 +1,237 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "internal/util/P0330.hpp"
+#include "internal/util/storage/drivers/Factory.hpp"
+#include "internal/util/storage/drivers/Plugin.hpp"
+#include "opentxs/storage/Types.internal.hpp"
+#include "opentxs/util/storage/Driver.hpp"
+#include "ottest/fixtures/core/Storage.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using namespace std::literals;
+
+// NOTE keeps objects in memory and fails every commit while fail_ is set
+class FlakyDriver final : public ot::storage::Driver
+{
+public:
+    std::atomic_bool fail_;
+    std::atomic<std::size_t> commits_;
+
+    auto Description() const noexcept -> std::string_view final
+    {
+        return "flaky"sv;
+    }
+    auto Load(
+        const ot::Log& logger,
+        const ot::storage::Hash& key,
+        ot::storage::Search order,
+        ot::Writer& value) const noexcept -> bool final
+    {
+        return memdb_->Load(logger, key, order, value);
+    }
+    auto LoadRoot() const noexcept -> ot::storage::Hash final
+    {
+        return memdb_->LoadRoot();
+    }
+
+    auto Commit(
+        const ot::storage::Hash& root,
+        ot::storage::Transaction data,
+        ot::storage::Bucket bucket) const noexcept -> bool final
+    {
+        if (fail_) { return false; }
+
+        ++commits_;
+
+        return memdb_->Commit(root, data, bucket);
+    }
+    auto EmptyBucket(ot::storage::Bucket bucket) const noexcept -> bool final
+    {
+        return memdb_->EmptyBucket(bucket);
+    }
+    auto Store(ot::storage::Transaction data, ot::storage::Bucket bucket)
+        const noexcept -> bool final
+    {
+        if (fail_) { return false; }
+
+        return memdb_->Store(data, bucket);
+    }
+
+    FlakyDriver(std::unique_ptr<ot::storage::Driver> memdb) noexcept
+        : fail_(false)
+        , commits_(0_uz)
+        , memdb_(std::move(memdb))
+    {
+    }
+
+private:
+    std::unique_ptr<ot::storage::Driver> memdb_;
+};
+
+class StoragePlugin : public Storage
+{
+protected:
+    using Hash = ot::storage::Hash;
+
+    FlakyDriver* driver_;
+    std::shared_ptr<Plugin> plugin_;
+    std::atomic<std::size_t> pending_;
+
+    // NOTE true if the object has been written to the driver
+    auto committed(const Hash& key) const -> bool
+    {
+        auto out = ot::UnallocatedCString{};
+        auto writer = ot::writer(out);
+
+        return driver_->Load(
+            ot::LogTrace(), key, ot::storage::Search::ltr, writer);
+    }
+    auto load(const Hash& key) const -> ot::UnallocatedCString
+    {
+        auto out = ot::UnallocatedCString{};
+        plugin_->Load(
+            key, ot::storage::ErrorReporting::silent, ot::writer(out), nullptr);
+
+        return out;
+    }
+    auto store(std::string_view value) const -> Hash
+    {
+        auto out = Hash{};
+
+        EXPECT_TRUE(plugin_->Store(value, out));
+
+        return out;
+    }
+
+    StoragePlugin()
+        : driver_(nullptr)
+        , plugin_()
+        , pending_(0_uz)
+    {
+        auto driver = std::make_unique<FlakyDriver>(
+            ot::factory::StorageMemDB(api_.Crypto(), config_));
+        driver_ = driver.get();
+        plugin_ = ot::factory::StoragePlugin(
+            api_.Crypto(), api_.Factory(), bucket_, config_, std::move(driver));
+        plugin_->FindBestRoot();
+        plugin_->SetPendingCallback([this] { ++pending_; });
+    }
+};
+
+TEST_F(StoragePlugin, pending_state_is_readable)
+{
+    const auto object = store("object");
+
+    ASSERT_TRUE(plugin_->StoreRoot(object));
+    EXPECT_EQ(driver_->commits_.load(), 0_uz);
+    EXPECT_EQ(pending_.load(), 1_uz);
+
+    // NOTE until the batch is committed only the plugin knows about it
+    EXPECT_EQ(plugin_->LoadRoot(), object);
+    EXPECT_EQ(load(object), "object");
+    EXPECT_NE(driver_->LoadRoot(), object);
+    EXPECT_FALSE(committed(object));
+
+    ASSERT_TRUE(plugin_->Flush());
+    EXPECT_EQ(driver_->commits_.load(), 1_uz);
+    EXPECT_EQ(driver_->LoadRoot(), object);
+    EXPECT_TRUE(committed(object));
+    EXPECT_EQ(load(object), "object");
+
+    // NOTE a flush without pending updates does not touch the driver
+    ASSERT_TRUE(plugin_->Flush());
+    EXPECT_EQ(driver_->commits_.load(), 1_uz);
+}
+
+TEST_F(StoragePlugin, failed_commit_is_retried)
+{
+    const auto first = store("first");
+
+    ASSERT_TRUE(plugin_->StoreRoot(first));
+    EXPECT_EQ(pending_.load(), 1_uz);
+
+    driver_->fail_ = true;
+
+    EXPECT_FALSE(plugin_->Flush());
+    EXPECT_EQ(plugin_->LoadRoot(), first);
+    EXPECT_EQ(load(first), "first");
+    EXPECT_FALSE(committed(first));
+
+    // NOTE an update which is due for commit reports the failure and asks
+    // for another flush
+    ot::sleep(Plugin::commit_interval_);
+    const auto second = store("second");
+
+    EXPECT_FALSE(plugin_->StoreRoot(second));
+    EXPECT_EQ(pending_.load(), 2_uz);
+    EXPECT_EQ(plugin_->LoadRoot(), second);
+    EXPECT_EQ(load(first), "first");
+    EXPECT_EQ(load(second), "second");
+
+    driver_->fail_ = false;
+
+    ASSERT_TRUE(plugin_->Flush());
+    EXPECT_EQ(driver_->commits_.load(), 1_uz);
+    EXPECT_EQ(driver_->LoadRoot(), second);
+    EXPECT_TRUE(committed(first));
+    EXPECT_TRUE(committed(second));
+}
+
+TEST_F(StoragePlugin, commit_after_threshold)
+{
+    const auto first = store("0");
+    auto last = first;
+
+    ASSERT_TRUE(plugin_->StoreRoot(first));
+
+    for (auto n = 2_uz; n < Plugin::commit_threshold_; ++n) {
+        last = store(std::to_string(n));
+
+        ASSERT_TRUE(plugin_->StoreRoot(last));
+    }
+
+    EXPECT_EQ(driver_->commits_.load(), 0_uz);
+    EXPECT_NE(driver_->LoadRoot(), last);
+
+    last = store(std::to_string(Plugin::commit_threshold_));
+
+    ASSERT_TRUE(plugin_->StoreRoot(last));
+    EXPECT_EQ(driver_->commits_.load(), 1_uz);
+    EXPECT_EQ(driver_->LoadRoot(), last);
+    EXPECT_TRUE(committed(first));
+    EXPECT_EQ(pending_.load(), 1_uz);
+}
+
+TEST_F(StoragePlugin, commit_after_interval)
+{
+    const auto first = store("first");
+
+    ASSERT_TRUE(plugin_->StoreRoot(first));
+    EXPECT_EQ(driver_->commits_.load(), 0_uz);
+
+    ot::sleep(Plugin::commit_interval_);
+    const auto second = store("second");
+
+    ASSERT_TRUE(plugin_->StoreRoot(second));
+    EXPECT_EQ(driver_->commits_.load(), 1_uz);
+    EXPECT_EQ(driver_->LoadRoot(), second);
+    EXPECT_TRUE(committed(first));
+    EXPECT_EQ(pending_.load(), 1_uz);
+}
+}  // namespace ottest
@@ -0,0 +1,352 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <opentxs/protobuf/StorageThread.pb.h>
+#include <opentxs/protobuf/StorageThreadChunk.pb.h>
+#include <opentxs/protobuf/StorageThreadItem.pb.h>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+
+#include "api/session/Storage.hpp"
+#include "internal/util/P0330.hpp"
+#include "internal/util/storage/drivers/Plugin.hpp"
+#include "opentxs/storage/Types.internal.hpp"
+#include "opentxs/util/storage/Driver.hpp"
+#include "ottest/fixtures/core/Storage.hpp"
+#include "util/storage/tree/Nym.hpp"
+#include "util/storage/tree/Nyms.hpp"
+#include "util/storage/tree/Root.hpp"
+#include "util/storage/tree/Thread.hpp"
+#include "util/storage/tree/Threads.hpp"
+#include "util/storage/tree/Trunk.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using namespace std::literals;
+
+#if OT_STORAGE_LMDB
+class StorageThread : public Storage
+{
+protected:
+    using Items = ot::UnallocatedVector<ot::UnallocatedCString>;
+    using Thread = ot::storage::tree::Thread;
+
+    // NOTE enough items to fill several chunks
+    static constexpr auto count_ = 300_uz;
+
+    const ot::identifier::Nym nym_;
+    const ot::identifier::Generic thread_;
+    const ot::identifier::Generic contact_;
+    Items items_;
+
+    static auto ids(const ot::protobuf::StorageThread& thread) -> Items
+    {
+        auto out = Items{};
+
+        for (const auto& item : thread.item()) { out.emplace_back(item.id()); }
+
+        return out;
+    }
+
+    auto add(const Imp& storage, std::size_t count) -> bool
+    {
+        const auto start = ot::Clock::now();
+
+        for (auto n = 0_uz; n < count; ++n) {
+            const auto id = api_.Factory().IdentifierFromRandom();
+            const auto stored = storage.Store(
+                nym_,
+                thread_,
+                id,
+                start + std::chrono::seconds(n),
+                {},
+                std::to_string(n),
+                ot::otx::client::StorageBox::MAILINBOX,
+                {});
+
+            if (false == stored) { return false; }
+
+            items_.emplace_back(id.asBase58(api_.Crypto()));
+        }
+
+        return true;
+    }
+    auto create() -> std::shared_ptr<Imp>
+    {
+        auto out = open();
+
+        if (false == out->CreateThread(nym_, thread_, {contact_})) {
+            return {};
+        }
+
+        if (false == add(*out, count_)) { return {}; }
+
+        return out;
+    }
+    auto load(const Imp& storage) const -> ot::protobuf::StorageThread
+    {
+        auto out = ot::protobuf::StorageThread{};
+        storage.Load(nym_, thread_, out);
+
+        return out;
+    }
+    auto read(const Imp& storage, std::size_t position) const -> bool
+    {
+        return storage.SetReadState(
+            nym_,
+            thread_,
+            api_.Factory().IdentifierFromBase58(items_.at(position)),
+            false);
+    }
+    // NOTE reads the thread node directly from the database so the version
+    // which was loaded and the partial item queries can be inspected
+    auto visit(const std::function<void(const Thread&)>& cb) -> void
+    {
+        const auto plugin = this->plugin();
+
+        ASSERT_TRUE(plugin);
+
+        visit(*plugin, cb);
+    }
+    auto visit(
+        const Plugin& plugin,
+        const std::function<void(const Thread&)>& cb) -> void
+    {
+        const auto root = ot::storage::tree::Root{
+            api_.Crypto(), api_.Factory(), plugin, plugin.LoadRoot(), bucket_};
+        cb(root.Trunk().Nyms().Nym(nym_).Threads().Thread(thread_));
+    }
+
+    StorageThread()
+        : nym_(api_.Factory().NymIDFromRandom())
+        , thread_(api_.Factory().IdentifierFromRandom())
+        , contact_(api_.Factory().IdentifierFromRandom())
+        , items_()
+    {
+    }
+};
+
+TEST_F(StorageThread, round_trip)
+{
+    auto unread = count_;
+    auto removed = ot::UnallocatedCString{};
+
+    {
+        const auto storage = create();
+
+        ASSERT_TRUE(storage);
+
+        for (auto n = 0_uz; n < count_; n += 3_uz) {
+            ASSERT_TRUE(read(*storage, n));
+
+            --unread;
+        }
+
+        // NOTE the removed item is unread so the counter must follow it
+        const auto position = 1_uz + (count_ / 2_uz);
+        removed = items_.at(position);
+        items_.erase(std::next(items_.begin(), position));
+        --unread;
+
+        ASSERT_TRUE(storage->RemoveThreadItem(
+            nym_, thread_, api_.Factory().IdentifierFromBase58(removed)));
+        EXPECT_EQ(ids(load(*storage)), items_);
+        EXPECT_EQ(storage->UnreadCount(nym_, thread_), unread);
+        ASSERT_TRUE(storage->Flush());
+    }
+
+    {
+        const auto storage = open();
+
+        ASSERT_TRUE(storage);
+
+        const auto thread = load(*storage);
+
+        EXPECT_EQ(ids(thread), items_);
+        EXPECT_EQ(storage->UnreadCount(nym_, thread_), unread);
+
+        auto flagged = 0_uz;
+
+        for (const auto& item : thread.item()) {
+            if (item.unread()) { ++flagged; }
+        }
+
+        EXPECT_EQ(flagged, unread);
+    }
+
+    visit([&](const Thread& thread) {
+        const auto& crypto = api_.Crypto();
+        const auto& factory = api_.Factory();
+        const auto start = 100_uz;
+        const auto window = 150_uz;
+
+        EXPECT_EQ(thread.UpgradeLevel(), 2u);
+        EXPECT_EQ(thread.ItemCount(), items_.size());
+        EXPECT_EQ(thread.UnreadCount(), unread);
+        EXPECT_TRUE(thread.Check(factory.IdentifierFromBase58(items_.back())));
+        EXPECT_FALSE(thread.Check(factory.IdentifierFromBase58(removed)));
+        EXPECT_EQ(
+            ids(thread.Items(start, window)),
+            Items(
+                std::next(items_.begin(), start),
+                std::next(items_.begin(), start + window)));
+        EXPECT_EQ(
+            ids(thread.Items(items_.size() - 10_uz, window)),
+            Items(std::prev(items_.end(), 10), items_.end()));
+        EXPECT_EQ(thread.Items(items_.size(), window).item_size(), 0);
+        EXPECT_EQ(thread.ID(), thread_);
+        EXPECT_EQ(thread.Items().id(), thread_.asBase58(crypto));
+    });
+}
+
+TEST_F(StorageThread, chunk_filters)
+{
+    auto removed = ot::UnallocatedCString{};
+
+    {
+        const auto storage = create();
+
+        ASSERT_TRUE(storage);
+
+        removed = items_.front();
+        items_.erase(items_.begin());
+
+        ASSERT_TRUE(storage->RemoveThreadItem(
+            nym_, thread_, api_.Factory().IdentifierFromBase58(removed)));
+        ASSERT_TRUE(storage->Flush());
+    }
+
+    {
+        const auto plugin = this->plugin();
+
+        ASSERT_TRUE(plugin);
+
+        auto hash = ot::storage::Hash{};
+        visit(*plugin, [&](const Thread& thread) { hash = thread.Root(); });
+        auto bytes = ot::UnallocatedCString{};
+
+        ASSERT_TRUE(plugin->Load(
+            hash, ot::storage::ErrorReporting::verbose, ot::writer(bytes)));
+
+        auto serialized = ot::protobuf::StorageThread{};
+
+        ASSERT_TRUE(serialized.ParseFromString(bytes));
+        ASSERT_GT(serialized.chunk_size(), 1);
+
+        // NOTE every chunk reference carries the filter of its items so a
+        // lookup does not need to load every chunk
+        for (const auto& chunk : serialized.chunk()) {
+            EXPECT_EQ(chunk.filter().size(), 256_uz);
+        }
+    }
+
+    visit([&](const Thread& thread) {
+        const auto& factory = api_.Factory();
+
+        for (const auto& id : items_) {
+            EXPECT_TRUE(thread.Check(factory.IdentifierFromBase58(id)));
+        }
+
+        // NOTE a filter may match an id which is not present, which must
+        // still be rejected after the chunk is scanned
+        EXPECT_FALSE(thread.Check(factory.IdentifierFromBase58(removed)));
+
+        for (auto n = 0_uz; n < count_; ++n) {
+            EXPECT_FALSE(thread.Check(factory.IdentifierFromRandom()));
+        }
+    });
+}
+
+TEST_F(StorageThread, migrates_version_1)
+{
+    auto unread = count_;
+    auto legacy = ot::protobuf::StorageThread{};
+
+    {
+        const auto storage = create();
+
+        ASSERT_TRUE(storage);
+
+        for (auto n = 0_uz; n < count_; n += 2_uz) {
+            ASSERT_TRUE(read(*storage, n));
+
+            --unread;
+        }
+
+        legacy = load(*storage);
+
+        ASSERT_TRUE(storage->Flush());
+    }
+
+    // NOTE a version 1 thread holds every item inline, so replacing the
+    // stored thread object with one makes the tree load it as a legacy thread
+    legacy.set_version(1u);
+    legacy.clear_unread();
+    legacy.clear_chunk();
+    legacy.clear_nextindex();
+
+    {
+        const auto plugin = this->plugin();
+
+        ASSERT_TRUE(plugin);
+
+        auto hash = ot::storage::Hash{};
+        visit(*plugin, [&](const Thread& thread) { hash = thread.Root(); });
+        const auto bytes = legacy.SerializeAsString();
+        const auto keys = std::array{hash};
+        const auto values = std::array{ot::ReadView{bytes}};
+        auto& driver = plugin->Primary();
+
+        for (const auto bucket :
+             {ot::storage::Bucket::left, ot::storage::Bucket::right}) {
+            ASSERT_TRUE(driver.Store({keys, values}, bucket));
+        }
+    }
+
+    visit([&](const Thread& thread) {
+        EXPECT_EQ(thread.UpgradeLevel(), 1u);
+        EXPECT_EQ(thread.ItemCount(), count_);
+        EXPECT_EQ(thread.UnreadCount(), unread);
+        EXPECT_EQ(ids(thread.Items()), items_);
+    });
+
+    {
+        // NOTE the thread is modified before the storage is upgraded, which
+        // must still write it in the current format
+        const auto storage = open();
+
+        ASSERT_TRUE(storage);
+        EXPECT_EQ(ids(load(*storage)), items_);
+        ASSERT_TRUE(add(*storage, 1_uz));
+
+        ++unread;
+
+        ASSERT_TRUE(storage->Flush());
+    }
+
+    visit([&](const Thread& thread) {
+        EXPECT_EQ(thread.UpgradeLevel(), 2u);
+        EXPECT_EQ(thread.ItemCount(), count_ + 1_uz);
+        EXPECT_EQ(thread.UnreadCount(), unread);
+
+        const auto items = thread.Items();
+
+        EXPECT_EQ(ids(items), items_);
+        ASSERT_EQ(items.item_size(), static_cast<int>(count_ + 1_uz));
+        // NOTE the next index is recovered from the legacy items
+        EXPECT_EQ(items.item(static_cast<int>(count_)).index(), count_);
+    });
+}
+#endif  // OT_STORAGE_LMDB
+}  // namespace ottest
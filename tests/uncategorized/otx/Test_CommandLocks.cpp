@@ -0,0 +1,204 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <optional>
+
+#include "internal/core/String.hpp"
+#include "internal/otx/common/Message.hpp"
+#include "opentxs/api/session/Factory.internal.hpp"
+#include "opentxs/otx/Types.internal.hpp"
+#include "otx/server/CommandLocks.hpp"
+#include "otx/server/Server.hpp"
+#include "otx/server/UserCommandProcessor.hpp"
+#include "ottest/fixtures/otx/Messages.hpp"
+
+namespace ottest
+{
+using namespace std::literals;
+
+class CommandLocks : public Messages
+{
+protected:
+    using Resources = ot::server::CommandLocks::Resources;
+
+    static constexpr auto blocked_ = 100ms;
+    static constexpr auto timeout_ = 10s;
+
+    ot::server::CommandLocks locks_{};
+
+    auto account() const -> ot::identifier::Account
+    {
+        using enum ot::identifier::AccountSubtype;
+
+        return server_.Factory().AccountIDFromRandom(custodial_account);
+    }
+
+    // NOTE the nym, account, and instrument definition which a notarization
+    // of a transfer within one account locks
+    auto notarization(
+        const ot::identifier::Account& account,
+        const ot::identifier::UnitDefinition& unit,
+        bool exclusiveUnit = false) const -> Resources
+    {
+        return {
+            {account, true},
+            {server_.Factory().NymIDFromRandom(), true},
+            {unit, exclusiveUnit}};
+    }
+
+    auto notarization(const ot::identifier::Account& account) const
+        -> Resources
+    {
+        return notarization(account, server_.Factory().UnitIDFromRandom());
+    }
+
+    auto message(ot::otx::MessageType type) const
+        -> std::unique_ptr<ot::Message>
+    {
+        auto out = client_.Factory().Internal().Session().Message();
+        out->command_->Set(ot::Message::Command(type).c_str());
+        out->nym_id_ = ot::String::Factory(alice_nym_id_, client_.Crypto());
+        out->notary_id_ = ot::String::Factory(server_id_, client_.Crypto());
+        out->request_num_ = ot::String::Factory("1");
+
+        return out;
+    }
+
+    auto resources(const ot::Message& msg) const
+        -> std::optional<Resources>
+    {
+        auto parsed = ot::server::UserCommandProcessor::Parsed{};
+
+        return server_.Server().CommandProcessor().Resources(msg, parsed);
+    }
+
+    // NOTE acquires the resources on another thread while the caller holds
+    // its own guard and keeps them until release is signalled
+    auto start(
+        const Resources& resources,
+        std::promise<void>& acquired,
+        std::shared_future<void> release) -> std::future<void>
+    {
+        return std::async(std::launch::async, [&, resources, release] {
+            const auto guard = locks_.Shared(resources);
+            acquired.set_value();
+            release.wait();
+        });
+    }
+};
+
+TEST_F(CommandLocks, unrelated_notarizations_run_concurrently)
+{
+    const auto first = notarization(account());
+    const auto second = notarization(account());
+    auto acquired = std::promise<void>{};
+    auto release = std::promise<void>{};
+    const auto guard = locks_.Shared(first);
+    auto worker = start(second, acquired, release.get_future().share());
+
+    EXPECT_EQ(
+        acquired.get_future().wait_for(timeout_), std::future_status::ready);
+
+    release.set_value();
+    worker.get();
+}
+
+TEST_F(CommandLocks, conflicting_notarizations_are_serialized)
+{
+    const auto shared = account();
+    const auto first = notarization(shared);
+    const auto second = notarization(shared);
+    auto acquired = std::promise<void>{};
+    auto release = std::promise<void>{};
+    auto guard = std::make_optional(locks_.Shared(first));
+    auto worker = start(second, acquired, release.get_future().share());
+    auto future = acquired.get_future();
+
+    EXPECT_EQ(future.wait_for(blocked_), std::future_status::timeout);
+
+    guard.reset();
+
+    EXPECT_EQ(future.wait_for(timeout_), std::future_status::ready);
+
+    release.set_value();
+    worker.get();
+}
+
+TEST_F(CommandLocks, unit_shared_by_named_accounts)
+{
+    const auto unit = server_.Factory().UnitIDFromRandom();
+    auto acquired = std::promise<void>{};
+    auto release = std::promise<void>{};
+    auto guard =
+        std::make_optional(locks_.Shared(notarization(account(), unit)));
+    auto worker = start(
+        notarization(account(), unit), acquired, release.get_future().share());
+
+    EXPECT_EQ(
+        acquired.get_future().wait_for(timeout_), std::future_status::ready);
+
+    release.set_value();
+    worker.get();
+
+    // NOTE a command which may touch accounts that it does not name waits for
+    // every command which touches an account of the same unit
+    auto blocked = std::promise<void>{};
+    auto unblock = std::promise<void>{};
+    auto exclusive = start(
+        notarization(account(), unit, true),
+        blocked,
+        unblock.get_future().share());
+    auto future = blocked.get_future();
+
+    EXPECT_EQ(future.wait_for(blocked_), std::future_status::timeout);
+
+    guard.reset();
+
+    EXPECT_EQ(future.wait_for(timeout_), std::future_status::ready);
+
+    unblock.set_value();
+    exclusive.get();
+}
+
+TEST_F(CommandLocks, exclusive_waits_for_shared)
+{
+    auto guard = std::make_optional(locks_.Shared(notarization(account())));
+    auto exclusive = std::async(std::launch::async, [this] {
+        [[maybe_unused]] const auto lock = locks_.Exclusive();
+    });
+
+    EXPECT_EQ(exclusive.wait_for(blocked_), std::future_status::timeout);
+
+    guard.reset();
+
+    EXPECT_EQ(exclusive.wait_for(timeout_), std::future_status::ready);
+}
+
+TEST_F(CommandLocks, command_resources)
+{
+    const auto ping = resources(*message(ot::otx::MessageType::pingNotary));
+
+    ASSERT_TRUE(ping.has_value());
+    EXPECT_EQ(ping->size(), 1u);
+    EXPECT_EQ(ping->count(alice_nym_id_), 1u);
+
+    EXPECT_FALSE(
+        resources(*message(ot::otx::MessageType::registerNym)).has_value());
+    EXPECT_FALSE(resources(*message(ot::otx::MessageType::registerAccount))
+                     .has_value());
+
+    auto notarize = message(ot::otx::MessageType::notarizeTransaction);
+    notarize->acct_id_ = ot::String::Factory(account(), server_.Crypto());
+
+    // NOTE an account which the notary does not know about can not be mapped
+    // to an instrument definition so the command runs exclusively
+    EXPECT_FALSE(resources(*notarize).has_value());
+}
+}  // namespace ottest
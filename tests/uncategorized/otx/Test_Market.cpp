@@ -0,0 +1,299 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstdint>
+#include <memory>
+
+#include "internal/core/Armored.hpp"
+#include "internal/core/String.hpp"
+#include "internal/otx/common/cron/OTCron.hpp"
+#include "internal/otx/common/trade/OTMarket.hpp"
+#include "internal/otx/common/trade/OTOffer.hpp"
+#include "opentxs/api/Paths.internal.hpp"
+#include "opentxs/api/Session.internal.hpp"
+#include "opentxs/api/session/Factory.internal.hpp"
+#include "otx/common/OTStorage.hpp"
+#include "ottest/fixtures/otx/Messages.hpp"
+
+namespace ottest
+{
+class Market : public Messages
+{
+protected:
+    static constexpr auto journal_folder_{"journal"};
+
+    const ot::identifier::UnitDefinition instrument_;
+    const ot::identifier::UnitDefinition currency_;
+    const ot::Nym_p server_nym_;
+    std::unique_ptr<ot::OTCron> cron_;
+    std::unique_ptr<ot::OTMarket> market_;
+
+    // NOTE the offer belongs to the market once it has been added
+    auto add(
+        bool selling,
+        std::int64_t price,
+        std::int64_t amount,
+        std::int64_t number,
+        const ot::Nym_p& signer = {}) -> ot::OTOffer&
+    {
+        auto* offer = make(selling, price, amount, number).release();
+        sign(*offer, signer ? signer : server_nym_);
+
+        EXPECT_TRUE(market_->AddOffer(
+            nullptr, *offer, reason_s_, false, ot::Clock::now()));
+
+        return *offer;
+    }
+
+    // NOTE the path of the journal with the given sequence number, relative
+    // to the markets folder
+    auto journal(std::uint64_t sequence) const -> ot::UnallocatedCString
+    {
+        auto id = ot::identifier::Generic{};
+        market_->GetIdentifier(id);
+        auto out = ot::UnallocatedCString{
+            ot::String::Factory(id, server_.Crypto())->Get()};
+
+        if (0 < sequence) { out += '.' + std::to_string(sequence); }
+
+        return out;
+    }
+
+    auto journal_exists(std::uint64_t sequence) const -> bool
+    {
+        return ot::OTDB::Exists(
+            server_,
+            server_.DataFolder().string(),
+            server_.Internal().Paths().Market(),
+            journal_folder_,
+            journal(sequence),
+            "");
+    }
+
+    auto make(
+        bool selling,
+        std::int64_t price,
+        std::int64_t amount,
+        std::int64_t number) const -> std::unique_ptr<ot::OTOffer>
+    {
+        auto out = server_.Factory().Internal().Session().Offer(
+            server_id_, instrument_, currency_, 1);
+
+        EXPECT_TRUE(out->MakeOffer(selling, price, amount, 1, number));
+
+        return out;
+    }
+
+    auto read_journal(std::uint64_t sequence) const -> ot::UnallocatedCString
+    {
+        return ot::OTDB::QueryPlainString(
+            server_,
+            server_.DataFolder().string(),
+            server_.Internal().Paths().Market(),
+            journal_folder_,
+            journal(sequence),
+            "");
+    }
+
+    // NOTE replaces the market with a new instance loaded from storage
+    auto reload() -> bool
+    {
+        market_ = server_.Factory().Internal().Session().Market(
+            server_id_, instrument_, currency_, 1);
+        market_->SetCronPointer(*cron_);
+
+        return market_->LoadMarket();
+    }
+
+    auto sign(ot::OTOffer& offer, const ot::Nym_p& signer) const -> void
+    {
+        offer.ReleaseSignatures();
+
+        EXPECT_TRUE(offer.SignContract(*signer, reason_s_));
+        EXPECT_TRUE(offer.SaveContract());
+    }
+
+    auto write_journal(
+        std::uint64_t sequence,
+        const ot::UnallocatedCString& contents) const -> bool
+    {
+        return ot::OTDB::AppendPlainString(
+            server_,
+            contents,
+            server_.DataFolder().string(),
+            server_.Internal().Paths().Market(),
+            journal_folder_,
+            journal(sequence),
+            "");
+    }
+
+    Market()
+        : Messages()
+        , instrument_(server_.Factory().UnitIDFromRandom())
+        , currency_(server_.Factory().UnitIDFromRandom())
+        , server_nym_(server_.Wallet().Nym(server_.NymID()))
+        , cron_(server_.Factory().Internal().Session().Cron())
+        , market_(server_.Factory().Internal().Session().Market(
+              server_id_,
+              instrument_,
+              currency_,
+              1))
+    {
+        cron_->SetServerNym(server_nym_);
+        market_->SetCronPointer(*cron_);
+    }
+};
+
+TEST_F(Market, price_levels)
+{
+    add(false, 100, 50, 1);
+    add(false, 100, 30, 2);
+    add(false, 110, 20, 3);
+    add(true, 130, 40, 4);
+    add(true, 120, 10, 5);
+    add(true, 120, 15, 6);
+
+    EXPECT_EQ(market_->GetBidCount(), 3u);
+    EXPECT_EQ(market_->GetAskCount(), 3u);
+    EXPECT_EQ(market_->GetBidDepth(100), 80);
+    EXPECT_EQ(market_->GetBidDepth(110), 20);
+    EXPECT_EQ(market_->GetAskDepth(120), 25);
+    EXPECT_EQ(market_->GetAskDepth(130), 40);
+    EXPECT_EQ(market_->GetHighestBidPrice(), 110);
+    EXPECT_EQ(market_->GetLowestAskPrice(), 120);
+
+    auto armored = ot::Armored::Factory(server_.Crypto());
+    auto count = std::int32_t{0};
+
+    ASSERT_TRUE(market_->GetOfferList(armored.get(), 0, count));
+    EXPECT_EQ(count, 6);
+
+    const std::unique_ptr<ot::OTDB::Storable> storable(ot::OTDB::DecodeObject(
+        server_.Crypto(),
+        ot::OTDB::STORED_OBJ_OFFER_LIST_MARKET,
+        armored->Get()));
+    auto* list = dynamic_cast<ot::OTDB::OfferListMarket*>(storable.get());
+
+    ASSERT_NE(list, nullptr);
+    ASSERT_EQ(list->GetBidDataCount(), 3u);
+    ASSERT_EQ(list->GetAskDataCount(), 3u);
+
+    // NOTE bids are listed by price level with the most recent first within
+    // a level, and asks in the order they were received within a level
+    EXPECT_EQ(list->GetBidData(0)->transaction_id_, "2");
+    EXPECT_EQ(list->GetBidData(1)->transaction_id_, "1");
+    EXPECT_EQ(list->GetBidData(2)->transaction_id_, "3");
+    EXPECT_EQ(list->GetAskData(0)->transaction_id_, "5");
+    EXPECT_EQ(list->GetAskData(1)->transaction_id_, "6");
+    EXPECT_EQ(list->GetAskData(2)->transaction_id_, "4");
+}
+
+TEST_F(Market, depth_updates_and_removal)
+{
+    auto& first = add(false, 100, 50, 1);
+    add(false, 100, 30, 2);
+    add(false, 110, 20, 3);
+
+    first.IncrementFinishedSoFar(20);
+    sign(first, server_nym_);
+
+    ASSERT_TRUE(market_->SaveOffer(first, reason_s_));
+    EXPECT_EQ(market_->GetBidDepth(100), 60);
+
+    ASSERT_TRUE(market_->RemoveOffer(1, reason_s_));
+    EXPECT_EQ(market_->GetBidDepth(100), 30);
+    EXPECT_EQ(market_->GetBidCount(), 2u);
+    EXPECT_EQ(market_->GetOffer(1), nullptr);
+
+    ASSERT_TRUE(market_->RemoveOffer(3, reason_s_));
+    EXPECT_EQ(market_->GetBidDepth(110), 0);
+    EXPECT_EQ(market_->GetHighestBidPrice(), 100);
+
+    EXPECT_FALSE(market_->RemoveOffer(3, reason_s_));
+
+    ASSERT_TRUE(market_->RemoveOffer(2, reason_s_));
+    EXPECT_EQ(market_->GetBidCount(), 0u);
+    EXPECT_EQ(market_->GetHighestBidPrice(), 0);
+}
+
+TEST_F(Market, journal_replay)
+{
+    ASSERT_TRUE(market_->SaveMarket(reason_s_));
+
+    auto& first = add(false, 100, 50, 1);
+    add(true, 120, 10, 2);
+
+    ASSERT_TRUE(market_->SaveOffer(first, reason_s_));
+    ASSERT_TRUE(market_->SaveOffer(*market_->GetOffer(2), reason_s_));
+
+    first.IncrementFinishedSoFar(20);
+    sign(first, server_nym_);
+
+    ASSERT_TRUE(market_->SaveOffer(first, reason_s_));
+    ASSERT_TRUE(market_->RemoveOffer(2, reason_s_));
+    ASSERT_TRUE(reload());
+
+    EXPECT_EQ(market_->GetBidCount(), 1u);
+    EXPECT_EQ(market_->GetAskCount(), 0u);
+    EXPECT_EQ(market_->GetBidDepth(100), 30);
+}
+
+TEST_F(Market, journal_torn_tail)
+{
+    ASSERT_TRUE(market_->SaveMarket(reason_s_));
+    ASSERT_TRUE(market_->SaveOffer(add(false, 100, 50, 1), reason_s_));
+
+    const auto complete = read_journal(1);
+
+    ASSERT_FALSE(complete.empty());
+    ASSERT_TRUE(write_journal(1, "offer 0 incomplete"));
+    ASSERT_TRUE(reload());
+
+    EXPECT_EQ(market_->GetBidDepth(100), 50);
+    EXPECT_EQ(read_journal(1), complete);
+}
+
+TEST_F(Market, journal_rejects_unsigned_offer)
+{
+    ASSERT_TRUE(market_->SaveMarket(reason_s_));
+
+    const auto alice = client_.Wallet().Nym(alice_nym_id_);
+
+    ASSERT_TRUE(alice);
+    ASSERT_TRUE(market_->SaveOffer(add(false, 100, 50, 1, alice), reason_s_));
+
+    EXPECT_FALSE(reload());
+}
+
+TEST_F(Market, journal_sequence_after_snapshot)
+{
+    ASSERT_TRUE(market_->SaveMarket(reason_s_));
+    ASSERT_TRUE(market_->SaveOffer(add(false, 100, 50, 1), reason_s_));
+    ASSERT_TRUE(journal_exists(1));
+    ASSERT_TRUE(market_->SaveMarket(reason_s_));
+
+    EXPECT_FALSE(journal_exists(1));
+
+    // NOTE a crash between writing a snapshot and erasing the journal it
+    // replaced leaves that journal behind, and it must not be replayed
+    ASSERT_TRUE(write_journal(1, "remove 1\n"));
+    ASSERT_TRUE(market_->SaveOffer(add(true, 120, 10, 2), reason_s_));
+    ASSERT_TRUE(reload());
+
+    EXPECT_FALSE(journal_exists(1));
+    EXPECT_TRUE(journal_exists(2));
+    EXPECT_EQ(market_->GetBidDepth(100), 50);
+    EXPECT_EQ(market_->GetAskDepth(120), 10);
+
+    // NOTE changes made after the reload go to the same journal
+    ASSERT_TRUE(market_->RemoveOffer(1, reason_s_));
+    ASSERT_TRUE(reload());
+
+    EXPECT_EQ(market_->GetBidCount(), 0u);
+    EXPECT_EQ(market_->GetAskCount(), 1u);
+}
+}  // namespace ottest
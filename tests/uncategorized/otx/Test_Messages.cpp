@@ -5,12 +5,27 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
 
+#include "internal/core/Armored.hpp"
+#include "internal/core/String.hpp"
+#include "internal/core/contract/ServerContract.hpp"
+#include "internal/network/zeromq/Context.hpp"
+#include "internal/network/zeromq/socket/Request.hpp"
+#include "internal/otx/common/Message.hpp"
+#include "network/ServerConnection.hpp"
+#include "opentxs/api/session/Factory.internal.hpp"
+#include "opentxs/otx/Types.internal.hpp"
 #include "ottest/fixtures/otx/Messages.hpp"
 
 namespace ottest
 {
+using namespace std::literals;
 
 TEST_F(Messages, activateRequest)
 {
@@ -58,6 +73,186 @@ TEST_F(Messages, activateRequest)
     EXPECT_TRUE(serverCopy.Validate());
 }
 
+TEST_F(Messages, legacyNegotiation)
+{
+    using Format = ot::network::LegacyEncoding::Format;
+    const auto alice = client_.Wallet().Nym(alice_nym_id_);
+
+    ASSERT_TRUE(alice);
+
+    auto message = client_.Factory().Internal().Session().Message();
+
+    ASSERT_TRUE(message);
+
+    message->command_->Set(
+        ot::Message::Command(ot::otx::MessageType::getRequestNumber).c_str());
+    message->nym_id_ = ot::String::Factory(alice_nym_id_, client_.Crypto());
+    message->notary_id_ = ot::String::Factory(server_id_, client_.Crypto());
+    message->request_num_ = ot::String::Factory("1");
+
+    ASSERT_TRUE(message->SignContract(*alice, reason_c_));
+    ASSERT_TRUE(message->SaveContract());
+
+    auto raw = ot::String::Factory();
+
+    ASSERT_TRUE(message->SaveContractRaw(raw));
+
+    const auto armored = ot::Armored::Factory(client_.Crypto(), raw);
+    const auto endpoint = [&] {
+        auto host = ot::UnallocatedCString{};
+        auto port = std::uint32_t{};
+        auto type = ot::AddressType{};
+        const auto have = server_contract_->ConnectInfo(
+            host, port, type, ot::AddressType::Inproc);
+
+        EXPECT_TRUE(have);
+
+        if (ot::AddressType::Inproc == type) {
+
+            return host + ':' + std::to_string(port);
+        } else {
+
+            return "tcp://" + host + ':' + std::to_string(port);
+        }
+    }();
+    auto socket =
+        client_.Network().ZeroMQ().Context().Internal().RequestSocket();
+
+    ASSERT_TRUE(socket->SetTimeouts(0ms, 30000ms, 30000ms));
+    ASSERT_TRUE(socket->SetServerPubkey(server_contract_));
+    ASSERT_TRUE(socket->Start(endpoint));
+
+    const auto load = [&](ot::ReadView bytes, bool isArmored) {
+        auto serialized = ot::String::Factory();
+
+        if (isArmored) {
+            auto envelope = ot::Armored::Factory(client_.Crypto());
+            envelope->MemSet(
+                bytes.data(), static_cast<std::uint32_t>(bytes.size()));
+            envelope->GetString(serialized);
+        } else {
+            serialized = ot::String::Factory(bytes.data(), bytes.size());
+        }
+
+        auto out = client_.Factory().Internal().Session().Message();
+
+        return out->LoadContractFromString(serialized) &&
+               (out->request_num_->Get() == std::string{"1"});
+    };
+    auto encoding = ot::network::LegacyEncoding{};
+
+    EXPECT_EQ(encoding.Get(), Format::unknown);
+
+    // NOTE the first request on a connection is tagged and armored
+    auto [status, reply] = socket->Send(
+        ot::network::LegacyEncoding::Request(encoding.Get(), raw, armored));
+
+    ASSERT_EQ(status, ot::otx::client::SendResult::VALID_REPLY);
+
+    {
+        const auto body = reply.Payload();
+
+        ASSERT_EQ(body.size(), 3u);
+        EXPECT_EQ(body[0].as<ot::WorkType>(), ot::WorkType::OTXLegacyXML);
+        EXPECT_TRUE(load(body[1].Bytes(), true));
+        // NOTE the notary advertises support for unarmored requests
+        EXPECT_EQ(body[2].as<ot::WorkType>(), ot::WorkType::OTXLegacyBinary);
+    }
+
+    EXPECT_FALSE(encoding.Reply(Format::unknown, reply));
+    EXPECT_EQ(encoding.Get(), Format::binary);
+
+    std::tie(status, reply) = socket->Send(
+        ot::network::LegacyEncoding::Request(encoding.Get(), raw, armored));
+
+    ASSERT_EQ(status, ot::otx::client::SendResult::VALID_REPLY);
+
+    {
+        const auto body = reply.Payload();
+
+        ASSERT_EQ(body.size(), 2u);
+        EXPECT_EQ(body[0].as<ot::WorkType>(), ot::WorkType::OTXLegacyBinary);
+        EXPECT_TRUE(load(body[1].Bytes(), false));
+    }
+
+    EXPECT_FALSE(encoding.Reply(Format::binary, reply));
+    EXPECT_EQ(encoding.Get(), Format::binary);
+
+    encoding.Reset();
+
+    EXPECT_EQ(encoding.Get(), Format::unknown);
+
+    // NOTE untagged requests are still answered in the original format
+    std::tie(status, reply) = socket->Send(
+        ot::network::LegacyEncoding::Request(Format::untagged, raw, armored));
+
+    ASSERT_EQ(status, ot::otx::client::SendResult::VALID_REPLY);
+
+    {
+        const auto body = reply.Payload();
+
+        ASSERT_EQ(body.size(), 1u);
+        EXPECT_TRUE(load(body[0].Bytes(), true));
+    }
+}
+
+TEST_F(Messages, legacyNegotiationFallback)
+{
+    using Format = ot::network::LegacyEncoding::Format;
+    const auto raw = ot::String::Factory("signed message");
+    const auto armored = ot::Armored::Factory(client_.Crypto(), raw);
+    auto encoding = ot::network::LegacyEncoding{};
+    const auto reply = [](bool empty) {
+        auto out = ot::network::zeromq::Message{};
+        out.AddFrame(ot::WorkType::OTXLegacyXML);
+
+        if (empty) {
+            out.AddFrame();
+        } else {
+            out.AddFrame("reply"sv);
+        }
+
+        return out;
+    };
+
+    {
+        const auto request = ot::network::LegacyEncoding::Request(
+            encoding.Get(), raw, armored);
+        const auto body = request.Payload();
+
+        ASSERT_EQ(body.size(), 2u);
+        EXPECT_EQ(body[0].as<ot::WorkType>(), ot::WorkType::OTXLegacyXML);
+        EXPECT_EQ(body[1].Bytes(), ot::UnallocatedCString{armored->Get()});
+    }
+
+    // NOTE a tagged reply which does not advertise unarmored requests leaves
+    // the format undecided
+    EXPECT_FALSE(encoding.Reply(Format::unknown, reply(false)));
+    EXPECT_EQ(encoding.Get(), Format::unknown);
+
+    // NOTE older notaries answer tagged requests with an empty reply without
+    // processing them, so the request must be sent again untagged
+    EXPECT_TRUE(encoding.Reply(Format::unknown, reply(true)));
+    EXPECT_EQ(encoding.Get(), Format::untagged);
+
+    {
+        const auto request = ot::network::LegacyEncoding::Request(
+            encoding.Get(), raw, armored);
+        const auto body = request.Payload();
+
+        ASSERT_EQ(body.size(), 1u);
+        EXPECT_EQ(body[0].Bytes(), ot::UnallocatedCString{armored->Get()});
+    }
+
+    // NOTE replies to untagged requests do not change the format
+    EXPECT_FALSE(encoding.Reply(Format::untagged, reply(true)));
+    EXPECT_EQ(encoding.Get(), Format::untagged);
+
+    encoding.Reset();
+
+    EXPECT_EQ(encoding.Get(), Format::unknown);
+}
+
 TEST_F(Messages, pushReply)
 {
     const ot::UnallocatedCString payload{"TEST PAYLOAD"};
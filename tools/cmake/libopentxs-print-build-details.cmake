@@ -72,6 +72,7 @@ macro(libopentxs_print_build_details)
   message(STATUS "Developer -----------------------------------")
   message(STATUS "addr2line:                ${OT_BOOST_STACKTRACE_ADDR2LINE}")
   message(STATUS "Valgrind support:         ${OT_VALGRIND}")
+  message(STATUS "Maximum log level:        ${OT_LOG_MAX_LEVEL}")
   message(STATUS "precompiled headers:      ${OT_PCH}")
   message(STATUS "iwyu:                     ${CMAKE_CXX_INCLUDE_WHAT_YOU_USE}")
   message(